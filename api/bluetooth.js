@@ -52,6 +52,32 @@ export class Bluetooth extends EventEmitter {
 
       if (err) return this.emit('error', err)
 
+      // batched delivery: one event per peripheral per flush interval,
+      // entries carry extents into the shared binary body
+      if (Array.isArray(data?.batch)) {
+        for (const entry of data.batch) {
+          if (entry.serviceId !== this.serviceId) continue
+
+          const bytes = e.detail.data?.slice(entry.offset, entry.offset + entry.length)
+          const detail = {
+            ...data,
+            batch: undefined,
+            serviceId: entry.serviceId,
+            characteristicId: entry.characteristicId
+          }
+
+          this.emit(entry.characteristicId, detail, bytes)
+          dc.channel('data').publish({
+            bluetooth: this,
+            serviceId,
+            characteristicId: entry.characteristicId,
+            data: bytes
+          })
+        }
+
+        return
+      }
+
       if (data?.serviceId === this.serviceId) {
         this.emit(data.characteristicId, data, e.detail.data)
         dc.channel('data').publish({
@@ -1126,13 +1126,6 @@ export class Socket extends EventEmitter {
     return this.state.sendBufferSize
   }
 
-  //
-  // For now we aren't going to implement any of the multicast options,
-  // mainly because 1. we don't need it in hyper and 2. if a user wants
-  // to deploy their app to the app store, they will need to request the
-  // multicast entitlement from apple. If someone really wants this they
-  // can implement it.
-  //
   setBroadcast () {
     throw new Error('not implemented')
   }
@@ -1141,36 +1134,137 @@ export class Socket extends EventEmitter {
     throw new Error('not implemented')
   }
 
-  setMulticastTTL () {
-    throw new Error('not implemented')
+  //
+  // Multicast maps onto the `udp.joinGroup`/`udp.leaveGroup`/
+  // `udp.setMulticastInterface` routes. Note that deploying a multicast
+  // app to the Apple app store still requires requesting the multicast
+  // entitlement from Apple.
+  //
+
+  /**
+   * Sets the multicast time-to-live for packets sent by this socket.
+   * @param {number} ttl - The time-to-live, between 0 and 255
+   * @see {@link https://nodejs.org/api/dgram.html#socketsetmulticastttlttl}
+   */
+  async setMulticastTTL (ttl) {
+    const result = await ipc.request('udp.setMulticastInterface', { id: this.id, ttl })
+    if (result.err) {
+      throw result.err
+    }
   }
 
-  setMulticastLoopback () {
-    throw new Error('not implemented')
+  /**
+   * Sets whether multicast packets sent by this socket loop back locally.
+   * @param {boolean} flag
+   * @see {@link https://nodejs.org/api/dgram.html#socketsetmulticastloopbackflag}
+   */
+  async setMulticastLoopback (flag) {
+    const result = await ipc.request('udp.setMulticastInterface', {
+      id: this.id,
+      loopback: Boolean(flag)
+    })
+
+    if (result.err) {
+      throw result.err
+    }
   }
 
   setMulticastMembership () {
     throw new Error('not implemented')
   }
 
-  setMulticastInterface () {
-    throw new Error('not implemented')
+  /**
+   * Sets the local interface multicast packets are sent on.
+   * @param {string} multicastInterface - The local interface address
+   * @see {@link https://nodejs.org/api/dgram.html#socketsetmulticastinterfacemulticastinterface}
+   */
+  async setMulticastInterface (multicastInterface) {
+    const result = await ipc.request('udp.setMulticastInterface', {
+      id: this.id,
+      iface: multicastInterface
+    })
+
+    if (result.err) {
+      throw result.err
+    }
   }
 
-  addMembership () {
-    throw new Error('not implemented')
+  /**
+   * Joins the given multicast group so this socket receives its traffic.
+   * @param {string} multicastAddress - The multicast group address to join
+   * @param {string=} [multicastInterface] - The local interface address the membership applies to
+   * @see {@link https://nodejs.org/api/dgram.html#socketaddmembershipmulticastaddress-multicastinterface}
+   */
+  async addMembership (multicastAddress, multicastInterface) {
+    const result = await ipc.request('udp.joinGroup', {
+      id: this.id,
+      group: multicastAddress,
+      iface: multicastInterface ?? ''
+    })
+
+    if (result.err) {
+      throw result.err
+    }
   }
 
-  dropMembership () {
-    throw new Error('not implemented')
+  /**
+   * Leaves a multicast group previously joined with `addMembership`.
+   * @param {string} multicastAddress - The multicast group address to leave
+   * @param {string=} [multicastInterface] - The local interface address the membership applies to
+   * @see {@link https://nodejs.org/api/dgram.html#socketdropmembershipmulticastaddress-multicastinterface}
+   */
+  async dropMembership (multicastAddress, multicastInterface) {
+    const result = await ipc.request('udp.leaveGroup', {
+      id: this.id,
+      group: multicastAddress,
+      iface: multicastInterface ?? ''
+    })
+
+    if (result.err) {
+      throw result.err
+    }
   }
 
-  addSourceSpecificMembership () {
-    throw new Error('not implemented')
+  /**
+   * Joins a source-specific multicast group, receiving only traffic the
+   * given source sends to it.
+   * @param {string} sourceAddress - The source address to filter on
+   * @param {string} groupAddress - The multicast group address to join
+   * @param {string=} [multicastInterface] - The local interface address the membership applies to
+   * @see {@link https://nodejs.org/api/dgram.html#socketaddsourcespecificmembershipsourceaddress-groupaddress-multicastinterface}
+   */
+  async addSourceSpecificMembership (sourceAddress, groupAddress, multicastInterface) {
+    const result = await ipc.request('udp.joinGroup', {
+      id: this.id,
+      group: groupAddress,
+      source: sourceAddress,
+      iface: multicastInterface ?? ''
+    })
+
+    if (result.err) {
+      throw result.err
+    }
   }
 
-  dropSourceSpecificMembership () {
-    throw new Error('not implemented')
+  /**
+   * Leaves a source-specific multicast group previously joined with
+   * `addSourceSpecificMembership`.
+   * @param {string} sourceAddress - The source address the membership filters on
+   * @param {string} groupAddress - The multicast group address to leave
+   * @param {string=} [multicastInterface] - The local interface address the membership applies to
+   * @see {@link https://nodejs.org/api/dgram.html#socketdropsourcespecificmembershipsourceaddress-groupaddress-multicastinterface}
+   */
+  async dropSourceSpecificMembership (sourceAddress, groupAddress, multicastInterface) {
+    const result = await ipc.request('udp.leaveGroup', {
+      id: this.id,
+      group: groupAddress,
+      source: sourceAddress,
+      iface: multicastInterface ?? ''
+    })
+
+    if (result.err) {
+      throw result.err
+    }
   }
 
   ref () {
@@ -4952,6 +4952,106 @@ function createWebAssemblyExtensionImports (env) {
   return imports
 }
 
+/**
+ * In-memory cache of compiled WebAssembly modules so every load of the
+ * same extension in this context shares one compilation (and the
+ * engine-shared machine code behind it).
+ * @ignore
+ */
+const webAssemblyModuleCache = new Map()
+
+/**
+ * Opens the persistent compiled module cache.
+ * @ignore
+ * @return {Promise<IDBDatabase|null>}
+ */
+async function openWebAssemblyModuleCacheStorage () {
+  if (!globalThis.indexedDB) {
+    return null
+  }
+
+  return await new Promise((resolve) => {
+    const request = globalThis.indexedDB.open('socket.extension.wasm.modules', 1)
+    request.onupgradeneeded = () => {
+      request.result.createObjectStore('modules')
+    }
+    request.onsuccess = () => resolve(request.result)
+    request.onerror = () => resolve(null)
+  })
+}
+
+/**
+ * Compiles (or recalls) the WebAssembly module for an extension.
+ * Compiled modules are cached in memory keyed by path + version and,
+ * where the engine supports structured-cloning `WebAssembly.Module`
+ * values, persisted to IndexedDB keyed by path so a later launch reuses
+ * the engine's compiled code instead of recompiling the binary. A stale
+ * `version` (the extension was rebuilt) overwrites the entry. Engines
+ * without module serialization reject the write and the cache degrades
+ * to compile-per-launch transparently.
+ * @ignore
+ * @param {string} path
+ * @param {string|null} version
+ * @param {function(): Promise<Response>} getResponse
+ * @return {Promise<WebAssembly.Module>}
+ */
+async function compileCachedWebAssemblyModule (path, version, getResponse) {
+  const key = `${path}:${version ?? ''}`
+
+  if (webAssemblyModuleCache.has(key)) {
+    return await webAssemblyModuleCache.get(key)
+  }
+
+  const promise = (async () => {
+    const storage = version !== null
+      ? await openWebAssemblyModuleCacheStorage()
+      : null
+
+    if (storage) {
+      const cached = await new Promise((resolve) => {
+        try {
+          const request = storage
+            .transaction('modules', 'readonly')
+            .objectStore('modules')
+            .get(path)
+          request.onsuccess = () => resolve(request.result ?? null)
+          request.onerror = () => resolve(null)
+        } catch (err) {
+          resolve(null)
+        }
+      })
+
+      if (cached?.version === version && cached.module instanceof WebAssembly.Module) {
+        return cached.module
+      }
+    }
+
+    const module = await WebAssembly.compileStreaming(await getResponse())
+
+    if (storage) {
+      // best effort - engines that cannot serialize compiled modules
+      // throw here and the entry is simply not persisted
+      try {
+        storage
+          .transaction('modules', 'readwrite')
+          .objectStore('modules')
+          .put({ version, module }, path)
+      } catch (err) {}
+    }
+
+    return module
+  })()
+
+  webAssemblyModuleCache.set(key, promise)
+
+  try {
+    return await promise
+  } catch (err) {
+    webAssemblyModuleCache.delete(key)
+    throw err
+  }
+}
+
 /**
  * @typedef {{
  *   allow: string[] | string,
@@ -5003,20 +5103,34 @@ export class Extension extends EventTarget {
       )
 
       let adapter = null
-      let stream = null
+      let version = null
       let path = null
 
       path = options.path ?? stats.path
-      if (path.startsWith('http')) {
-        const response = await fetch(path)
-        stream = response.stream()
-      } else {
+      if (!path.startsWith('http')) {
         path = path.startsWith('/') ? path.slice(1) : path
-        const fd = await fs.open(path)
-        const file = await createFile(path, { fd })
-        stream = file.stream()
-      }
-      const response = new WebAssemblyResponse(stream)
+        try {
+          // size + mtime versions the persistent module cache so a
+          // rebuilt extension recompiles and everything else recalls
+          // the previously compiled module
+          const fileStats = await fs.stat(path)
+          version = `${fileStats.size}:${Number(fileStats.mtimeMs)}`
+        } catch (err) {}
+      }
+
+      const module = await compileCachedWebAssemblyModule(path, version, async () => {
+        let stream = null
+        if (path.startsWith('http')) {
+          const response = await fetch(path)
+          stream = response.stream()
+        } else {
+          const fd = await fs.open(path)
+          const file = await createFile(path, { fd })
+          stream = file.stream()
+        }
+        return new WebAssemblyResponse(stream)
+      })
+
       const table = new WebAssembly.Table({
         initial: 0,
         element: 'anyfunc'
@@ -5042,10 +5156,7 @@ export class Extension extends EventTarget {
         ...options.imports
       }
 
-      const {
-        instance,
-        module
-      } = await WebAssembly.instantiateStreaming(response, imports)
+      const instance = await WebAssembly.instantiate(module, imports)
 
       adapter = new WebAssemblyExtensionAdapter({
         policies: options.allowed || [],
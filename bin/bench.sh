@@ -0,0 +1,89 @@
+#!/usr/bin/env bash
+#
+# Builds and runs the runtime microbenchmark suite (src/bench/bench.cc)
+# against the static runtime library. An optional argument filters
+# benchmarks by substring and is forwarded to the binary:
+#
+#   bin/bench.sh            # run everything
+#   bin/bench.sh message    # only the `ipc message ...` benchmarks
+#
+# Pass --no-run to only build the benchmark binary.
+#
+
+declare root="$(cd "$(dirname "$(dirname "${BASH_SOURCE[0]}")")" && pwd)"
+
+source "$root/bin/functions.sh"
+
+declare args=()
+declare no_run=0
+
+declare arch="$(host_arch)"
+declare host=$(host_os)
+declare platform="desktop"
+
+declare d=""
+if [[ "$host" == "Win32" ]] && [[ -n "$DEBUG" ]]; then
+  # We have to differentiate release and debug for Win32
+  d="d"
+fi
+
+if [[ -z "$CXX" ]]; then
+  if command -v clang++ >/dev/null 2>&1; then
+    CXX="$(command -v clang++)"
+  elif command -v g++ >/dev/null 2>&1; then
+    CXX="$(command -v g++)"
+  fi
+fi
+
+if [[ -z "$CXX" ]]; then
+  echo "not ok - could not determine \$CXX environment variable"
+  exit 1
+fi
+
+while (( $# > 0 )); do
+  declare arg="$1"; shift
+  if [[ "$arg" == "--no-run" ]]; then
+    no_run=1
+    continue
+  fi
+  args+=("$arg")
+done
+
+"$root/bin/build-runtime-library.sh"
+die $? "not ok - unable to build the runtime library"
+
+declare cflags=($("$root/bin/cflags.sh"))
+declare ldflags=($("$root/bin/ldflags.sh" --arch "$arch" --platform "$platform"))
+
+declare exe=""
+declare static_libs=()
+
+if [[ "$host" == "Win32" ]]; then
+  exe=".exe"
+  static_libs+=("$root/build/$arch-$platform/lib$d/libsocket-runtime$d.a")
+else
+  static_libs+=("$root/build/$arch-$platform/lib/libsocket-runtime.a")
+  if [[ "$host" == "Linux" ]]; then
+    static_libs+=("$root/build/$arch-$platform/lib/libuv.a")
+  fi
+fi
+
+declare output="$root/build/$arch-$platform/bin/bench$exe"
+
+mkdir -p "$root/build/$arch-$platform/bin"
+
+quiet "$CXX"                  \
+  "$root/src/bench/bench.cc"  \
+  "${static_libs[@]}"         \
+  "${cflags[@]}"              \
+  "${ldflags[@]}"             \
+  -o "$output"
+
+die $? "not ok - unable to build the benchmark suite:\n$CXX $root/src/bench/bench.cc ${cflags[@]} ${ldflags[@]} -o \"$output\""
+
+echo "ok - built the benchmark suite ($output)"
+
+if (( !no_run )); then
+  "$output" "${args[@]}"
+  die $? "not ok - benchmark suite exited with an error"
+fi
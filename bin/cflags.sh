@@ -59,6 +59,16 @@ cflags+=(
   -DSSC_VERSION=$(cat "$root/VERSION.txt")
 )
 
+if [[ -n "$SSC_ENABLE_TRACING" ]]; then
+  # compile-time opt-in trace-event instrumentation (src/core/trace.hh)
+  cflags+=("-DSSC_ENABLE_TRACING")
+fi
+
+if [[ -n "$SSC_ENABLE_HEAP_PROFILING" ]]; then
+  # compile-time opt-in tagged allocation accounting (src/core/heap.hh)
+  cflags+=("-DSSC_ENABLE_HEAP_PROFILING")
+fi
+
 if (( TARGET_OS_IPHONE )) || (( TARGET_IPHONE_SIMULATOR )); then
   if (( TARGET_OS_IPHONE )); then
     ios_sdk_path="$(xcrun -sdk iphoneos -show-sdk-path)"
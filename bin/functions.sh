@@ -365,25 +365,78 @@ function abs_path() {
   echo "$p"
 }
 
+# verify_sha256 <file> <expected> - succeeds when no hash tool exists so
+# platforms without one degrade to unvalidated downloads, as before
+verify_sha256() {
+  local file=$1
+  local expected=$2
+  local actual
+
+  if command -v sha256sum >/dev/null 2>&1; then
+    actual=$(sha256sum "$file" | awk '{print $1}')
+  elif command -v shasum >/dev/null 2>&1; then
+    actual=$(shasum -a 256 "$file" | awk '{print $1}')
+  else
+    return 0
+  fi
+
+  [ "$actual" = "$expected" ]
+}
+
+# download_to_tmp <uri> [sha256] [version]
+# Downloads into the shared cache when SSC_FETCH_CACHE is set (resuming
+# partial transfers and reusing files whose sha256 matches), otherwise
+# into a throwaway temp directory like before.
 download_to_tmp() {
   local uri=$1
-  local tmp="$(mktemp -d)"
-  local output=$tmp/"$(basename "$uri")"
-  local http_code
+  local sha256=$2
+  local version=${3:-default}
+  local output
+  local partial
 
   if [ -n "$SSC_ANDROID_REPO" ]; then
+    local tmp="$(mktemp -d)"
+    output=$tmp/"$(basename "$uri")"
     echo >&2 cp "$SSC_ANDROID_REPO/$(basename "$uri")" "$output"
     cp "$SSC_ANDROID_REPO/$(basename "$uri")" "$output" || return $?
+    echo "$output"
+    return 0
+  fi
+
+  if [ -n "$SSC_FETCH_CACHE" ]; then
+    mkdir -p "$SSC_FETCH_CACHE/$version" || return $?
+    output="$SSC_FETCH_CACHE/$version/$(basename "$uri")"
+
+    if [ -f "$output" ]; then
+      if [ -z "$sha256" ] || verify_sha256 "$output" "$sha256"; then
+        echo "$output"
+        return 0
+      fi
+      rm -f "$output"
+    fi
   else
-    http_code=$(curl -L --write-out '%{http_code}' "$uri" --output "$output")
-    # DONT COMMIT
-    cp "$output" ..
-    if  [ "$http_code" != "200" ] ; then
-      echo "$http_code"
-      rm -rf "$tmp"
+    output="$(mktemp -d)/$(basename "$uri")"
+  fi
+
+  partial="$output.part"
+
+  # -C - resumes a partial download left by an interrupted setup
+  if ! curl -L --fail --retry 3 -C - "$uri" --output "$partial"; then
+    # a stale partial can make the server refuse the range - retry clean
+    rm -f "$partial"
+    if ! curl -L --fail --retry 3 "$uri" --output "$partial"; then
+      rm -f "$partial"
       return 1
     fi
   fi
+
+  if [ -n "$sha256" ] && ! verify_sha256 "$partial" "$sha256"; then
+    echo >&2 "not ok - sha256 mismatch for $uri"
+    rm -f "$partial"
+    return 1
+  fi
+
+  mv "$partial" "$output" || return $?
   echo "$output"
 }
 
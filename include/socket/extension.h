@@ -114,6 +114,50 @@
     }                                                                          \
   SOCKET_RUNTIME_EXTENSION_EXTERN_END                                          \
 
+#if defined(_MSC_VER) && !defined(__clang__)
+#define SOCKET_RUNTIME_EXTENSION_CONSTRUCTOR(function)                         \
+  static void function (void);                                                 \
+  __pragma(section(".CRT$XCU", read))                                          \
+  __declspec(allocate(".CRT$XCU"))                                             \
+  static void (*function##_entry) (void) = function;                           \
+  static void function (void)
+#else
+#define SOCKET_RUNTIME_EXTENSION_CONSTRUCTOR(function)                         \
+  __attribute__((constructor)) static void function (void)
+#endif
+
+/**
+ * Like `SOCKET_RUNTIME_REGISTER_EXTENSION`, but for an extension
+ * compiled directly into the application binary instead of a
+ * `libextension-*` shared object. A constructor function records the
+ * registration as the image loads, so the runtime resolves the name
+ * from the in-binary registry with no `dlopen`/`LoadLibrary` - enabling
+ * whole-program optimization across the extension boundary and
+ * extensions on platforms without runtime loading (iOS). Initialization
+ * still happens later, exactly like a dynamically loaded extension.
+ * @param name          - *required* The name of the extension to register
+ * @param initializer   - *required* A function that is called to initialize
+ *                        the extension in the runtime
+ * @param deinitializer - (optional) A function that is called to deinitialize
+ *                        the extension in the runtime.
+ * @param description   - (optional) A human readable description of the
+ *                        registered extension
+ * @param version       - (optional) A human readable version of the
+ *                        registered extension
+ * @see SOCKET_RUNTIME_REGISTER_EXTENSION
+ */
+#define SOCKET_RUNTIME_REGISTER_STATIC_EXTENSION(_name, _initializer, ...)     \
+  SOCKET_RUNTIME_EXTENSION_EXTERN_BEGIN                                        \
+    static sapi_extension_registration_t __sapi_extension__ = {                \
+      SOCKET_RUNTIME_EXTENSION_ABI_VERSION,                                    \
+      _name, _initializer, ##__VA_ARGS__                                       \
+    };                                                                         \
+                                                                               \
+    SOCKET_RUNTIME_EXTENSION_CONSTRUCTOR(__sapi_extension_static_register) {   \
+      sapi_extension_register_static(&__sapi_extension__);                     \
+    }                                                                          \
+  SOCKET_RUNTIME_EXTENSION_EXTERN_END                                          \
+
 SOCKET_RUNTIME_EXTENSION_EXTERN_BEGIN
   typedef struct sapi_extension_registration sapi_extension_registration_t;
 
@@ -223,6 +267,88 @@ SOCKET_RUNTIME_EXTENSION_EXTERN_BEGIN
     sapi_context_dispatch_callback callback
   );
 
+  /**
+   * Queues `callback` on a worker pool reserved for long-running and
+   * CPU-bound work, so a heavy extension computation never stalls FS or
+   * UDP completion processing on the core event loop. The pool is sized
+   * independently of the libuv threadpool through the
+   * `[runtime] long_running_worker_pool_size` configuration. When
+   * `completion` is given it is dispatched back like
+   * `sapi_context_dispatch()` after `callback` returns, making it the
+   * right place to call APIs that must run on the main thread.
+   * @param context    - An extension context
+   * @param data       - User data given to both callbacks when called
+   * @param callback   - The callback to run on a background thread
+   * @param completion - Optional callback marshalled back afterwards
+   */
+  SOCKET_RUNTIME_EXTENSION_EXPORT
+  bool sapi_context_dispatch_background (
+    sapi_context_t* context,
+    const void* data,
+    sapi_context_dispatch_callback callback,
+    sapi_context_dispatch_callback completion
+  );
+
+  /**
+   * A callback fired when a timer scheduled with
+   * `sapi_context_set_timeout()` or `sapi_context_set_interval()` expires.
+   * @param context
+   * @param data
+   */
+  typedef void (*sapi_context_timer_callback)(
+    sapi_context_t* context,
+    const void* data
+  );
+
+  /**
+   * Schedules `callback` to fire once after at least `timeout`
+   * milliseconds. Timers share one timing wheel on the core event loop,
+   * so scheduling and cancelling are O(1) and fire at a coarse (16ms)
+   * resolution.
+   * @param context  - An extension context
+   * @param data     - User data to be given to `callback` when called
+   * @param timeout  - Milliseconds until `callback` fires
+   * @param callback - The callback to fire
+   * @return An id for `sapi_context_clear_timer()`, `0` on failure
+   */
+  SOCKET_RUNTIME_EXTENSION_EXPORT
+  uint64_t sapi_context_set_timeout (
+    sapi_context_t* context,
+    const void* data,
+    uint64_t timeout,
+    sapi_context_timer_callback callback
+  );
+
+  /**
+   * Schedules `callback` to fire every `interval` milliseconds until
+   * cancelled with `sapi_context_clear_timer()`.
+   * @param context  - An extension context
+   * @param data     - User data to be given to `callback` when called
+   * @param interval - Milliseconds between fires
+   * @param callback - The callback to fire
+   * @return An id for `sapi_context_clear_timer()`, `0` on failure
+   */
+  SOCKET_RUNTIME_EXTENSION_EXPORT
+  uint64_t sapi_context_set_interval (
+    sapi_context_t* context,
+    const void* data,
+    uint64_t interval,
+    sapi_context_timer_callback callback
+  );
+
+  /**
+   * Cancels a timer scheduled with `sapi_context_set_timeout()` or
+   * `sapi_context_set_interval()`.
+   * @param context - An extension context
+   * @param id      - The timer id
+   * @return `true` if a pending timer was cancelled, otherwise `false`
+   */
+  SOCKET_RUNTIME_EXTENSION_EXPORT
+  bool sapi_context_clear_timer (
+    sapi_context_t* context,
+    uint64_t id
+  );
+
   /**
    * Retain a context preventing any allocated memory from being deallocated
    * when the context is considered no longer valid. This function SHOULD NOT
@@ -785,6 +911,20 @@ SOCKET_RUNTIME_EXTENSION_EXTERN_BEGIN
     const sapi_extension_registration_t* registration
   );
 
+  /**
+   * Records a statically linked extension registration so the runtime
+   * can resolve its name without loading a shared object. Called from
+   * image constructors (see `SOCKET_RUNTIME_REGISTER_STATIC_EXTENSION`)
+   * before any runtime state exists, so it only links the registration -
+   * the extension initializes later like any other.
+   * @param registration - The registration info for an extension
+   * @return `true` if successful, otherwise `false`
+   */
+  SOCKET_RUNTIME_EXTENSION_EXPORT
+  bool sapi_extension_register_static (
+    const sapi_extension_registration_t* registration
+  );
+
   /**
    * Predicate to determine if a policy is allowed in an extension context.
    * Multiple policy names can be given as a list seperated by `,`.
@@ -874,6 +1014,22 @@ SOCKET_RUNTIME_EXTENSION_EXTERN_BEGIN
     const sapi_ipc_router_t* router
   );
 
+  /**
+   * A callback called when a batched IPC route receives requests. All
+   * messages in the batch share `context` - reply to each of them with a
+   * result created from `context` and the message.
+   * @param context  - The extension context shared by every message in the batch
+   * @param messages - The IPC messages accumulated for this batch
+   * @param count    - The number of messages in the batch
+   * @param router   - The IPC router associated with the extension context
+   */
+  typedef void (*sapi_ipc_router_batch_message_callback_t)(
+    sapi_context_t* context,
+    sapi_ipc_message_t** messages,
+    unsigned int count,
+    const sapi_ipc_router_t* router
+  );
+
   /**
    * A callback for `sapi_ipc_invoke()` called when an IPC has been invoked.
    * @param result - The result of the invocation
@@ -884,6 +1040,17 @@ SOCKET_RUNTIME_EXTENSION_EXTERN_BEGIN
     const sapi_ipc_router_t* router
   );
 
+  /**
+   * A callback called when the runtime is done with a buffer published
+   * through `sapi_ipc_result_set_bytes_with_release()`.
+   * @param bytes - The bytes given to `sapi_ipc_result_set_bytes_with_release()`
+   * @param data  - Optional user data given to `sapi_ipc_result_set_bytes_with_release()`
+   */
+  typedef void (*sapi_ipc_result_bytes_release_t)(
+    unsigned char* bytes,
+    void* data
+  );
+
   /**
    * Get the window index the IPC message is associated with.
    * @param message The IPC message
@@ -1105,6 +1272,28 @@ SOCKET_RUNTIME_EXTENSION_EXTERN_BEGIN
     unsigned char* bytes
   );
 
+  /**
+   * Set the IPC result bytes to a caller-owned buffer without copying it.
+   * The buffer must stay valid until `release` is called with `bytes` and
+   * `data` - this happens once the webview has consumed the response, so
+   * extension -> webview transfers are zero-copy. A `NULL` release
+   * callback marks the buffer as borrowed for the lifetime of the
+   * program (eg. static data).
+   * @param result  - An IPC request result
+   * @param size    - The size of the bytes
+   * @param bytes   - The bytes, owned by the caller
+   * @param release - Called when the runtime is done with `bytes` (optional)
+   * @param data    - Optional user data forwarded to `release`
+   */
+  SOCKET_RUNTIME_EXTENSION_EXPORT
+  void sapi_ipc_result_set_bytes_with_release (
+    sapi_ipc_result_t* result,
+    unsigned int size,
+    unsigned char* bytes,
+    sapi_ipc_result_bytes_release_t release,
+    void* data
+  );
+
   /**
    * Get the IPC result bytes.
    * @param result - An IPC request result
@@ -1359,6 +1548,26 @@ SOCKET_RUNTIME_EXTENSION_EXTERN_BEGIN
     const void* data
   );
 
+  /**
+   * Map a named route to a batch callback with optional user data for a
+   * given extension context. Messages arriving for the route within one
+   * event loop turn are accumulated and delivered together in a single
+   * invocation of `callback`, sharing one extension context, which
+   * amortizes dispatch and context setup for high-rate routes. Routes
+   * must "reply" once per message in the batch.
+   * @param context  - An extension context
+   * @param route    - The route name to map
+   * @param callback - The callback called with the accumulated IPC messages
+   * @param data     - User data propagated to `callback`
+   */
+  SOCKET_RUNTIME_EXTENSION_EXPORT
+  bool sapi_ipc_router_map_batch (
+    sapi_context_t* context,
+    const char* route,
+    sapi_ipc_router_batch_message_callback_t callback,
+    const void* data
+  );
+
   /**
    * Unmap a named route for a given extension context.
    * incoming request.
@@ -11,6 +11,14 @@ namespace SSC::android {
   {
     this->env = env;
     this->self = env->NewGlobalRef(self);
+    this->selfClass = reinterpret_cast<jclass>(
+      env->NewGlobalRef(env->GetObjectClass(self))
+    );
+    this->onInternalRouteResponseMethod = env->GetMethodID(
+      this->selfClass,
+      "onInternalRouteResponse",
+      onInternalRouteResponseSignature
+    );
     this->pointer = reinterpret_cast<jlong>(this);
     this->runtime = runtime;
     this->router.dispatchFunction = [this](auto callback) {
@@ -25,6 +33,7 @@ namespace SSC::android {
   }
 
   Bridge::~Bridge () {
+    this->env->DeleteGlobalRef(this->selfClass);
     this->env->DeleteGlobalRef(this->self);
     IPC::Bridge::~Bridge();
   }
@@ -93,11 +102,12 @@ extern "C" {
 
     auto uri = StringWrap(env, uriString);
     auto size = byteArray != nullptr ? env->GetArrayLength(byteArray) : 0;
-    auto input = size > 0 ? new char[size]{0} : nullptr;
-
-    if (size > 0 && input != nullptr) {
-      env->GetByteArrayRegion(byteArray, 0, size, (jbyte*) input);
-    }
+    // the router copies `input` into the message before `route()` returns,
+    // so borrow the array elements (a pin on most runtimes) instead of
+    // copying them into a scratch buffer first
+    auto input = size > 0
+      ? (char*) env->GetByteArrayElements(byteArray, nullptr)
+      : nullptr;
 
     auto routed = bridge->route(uri.str(), input, size, [=](auto result) mutable {
       if (result.seq == "-1") {
@@ -111,7 +121,7 @@ extern "C" {
 
       if (!attachment.hasException()) {
         auto size = result.post.length;
-        auto body = result.post.body;
+        auto body = result.post.body.get();
         auto bytes = body ? env->NewByteArray(size) : nullptr;
 
         if (bytes != nullptr) {
@@ -121,13 +131,11 @@ extern "C" {
         auto seq = env->NewStringUTF(result.seq.c_str());
         auto source = env->NewStringUTF(result.source.c_str());
         auto value = env->NewStringUTF(result.str().c_str());
-        auto headers = env->NewStringUTF(result.post.headers.c_str());
+        auto headers = env->NewStringUTF(result.post.headers.str().c_str());
 
-        CallVoidClassMethodFromEnvironment(
-          env,
+        env->CallVoidMethod(
           self,
-          "onInternalRouteResponse",
-          onInternalRouteResponseSignature,
+          bridge->onInternalRouteResponseMethod,
           requestId,
           seq,
           source,
@@ -147,7 +155,9 @@ extern "C" {
       }
     });
 
-    delete [] input;
+    if (input != nullptr) {
+      env->ReleaseByteArrayElements(byteArray, (jbyte*) input, JNI_ABORT);
+    }
 
     if (!routed) {
       auto attachment = JNIEnvironmentAttachment { jvm, jniVersion };
@@ -169,11 +179,9 @@ extern "C" {
         auto value = env->NewStringUTF(SSC::JSON::Object(err).str().c_str());
         auto headers = env->NewStringUTF("");
 
-        CallVoidClassMethodFromEnvironment(
-          env,
+        env->CallVoidMethod(
           self,
-          "onInternalRouteResponse",
-          onInternalRouteResponseSignature,
+          bridge->onInternalRouteResponseMethod,
           requestId,
           seq,
           source,
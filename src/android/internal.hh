@@ -235,6 +235,12 @@ namespace SSC::android {
 
       JNIEnv *env = nullptr;
       jobject self = nullptr;
+      // resolved once in the constructor - the result path crosses JNI for
+      // every routed message and should not pay for a `GetObjectClass` +
+      // `GetMethodID` lookup each time. The global class ref keeps the
+      // method id valid for the lifetime of the bridge
+      jclass selfClass = nullptr;
+      jmethodID onInternalRouteResponseMethod = nullptr;
       jlong pointer = 0;
       Runtime* runtime = nullptr;
 
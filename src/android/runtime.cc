@@ -1,5 +1,7 @@
 #include "internal.hh"
 
+#include <android/asset_manager_jni.h>
+
 using namespace SSC::android;
 
 namespace SSC::android {
@@ -67,6 +69,30 @@ extern "C" {
     return SSC::isDebugEnabled();
   }
 
+  jboolean external(Runtime, setAssetManager)(
+    JNIEnv *env,
+    jobject self,
+    jobject assetManager
+  ) {
+    auto runtime = Runtime::from(env, self);
+
+    if (runtime == nullptr) {
+      Throw(env, RuntimeNotInitializedException);
+      return false;
+    }
+
+    if (assetManager == nullptr) {
+      Throw(env, AssetManagerIsNotReachableException);
+      return false;
+    }
+
+    // lets `fs.open` fall back to app bundle assets for paths that do
+    // not exist on the real filesystem, serving reads zero-copy from
+    // the asset's mapped buffer
+    runtime->fs.setAssetManager(AAssetManager_fromJava(env, assetManager));
+    return true;
+  }
+
   jboolean external(Runtime, startEventLoop)(
     JNIEnv *env,
     jobject self
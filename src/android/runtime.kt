@@ -25,6 +25,12 @@ open class Runtime (
   val configuration = configuration;
   var isRunning = false
 
+  init {
+    // installs the bundle's native asset manager so `fs.open` can fall
+    // back to bundled assets and serve reads zero-copy
+    this.setAssetManager(configuration.assetManager)
+  }
+
   fun finalize () {
     if (this.pointer > 0) {
       this.dealloc()
@@ -68,6 +74,9 @@ open class Runtime (
 
   external fun isDebugEnabled (): Boolean;
 
+  @Throws(java.lang.Exception::class)
+  external fun setAssetManager (assetManager: android.content.res.AssetManager): Boolean;
+
   @Throws(java.lang.Exception::class)
   external fun pause (): Boolean;
 
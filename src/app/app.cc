@@ -37,9 +37,7 @@ static dispatch_queue_t queue = dispatch_queue_create(
   [NSApp activateIgnoringOtherApps:YES];
 
   if (app != nullptr && app->windowManager != nullptr) {
-    for (auto window : self.app->windowManager->windows) {
-      if (window != nullptr) window->bridge->router.emit("tray", "true");
-    }
+    self.app->windowManager->broadcast("tray", "true");
   }
 }
 
@@ -51,11 +49,7 @@ static dispatch_queue_t queue = dispatch_queue_create(
         "url", [url.absoluteString UTF8String]
       }};
 
-      for (auto window : self.app->windowManager->windows) {
-        if (window != nullptr) {
-          window->bridge->router.emit("applicationurl", json.str());
-        }
-      }
+      self.app->windowManager->broadcast("applicationurl", json.str());
     }
   }
 }
@@ -123,8 +117,8 @@ continueUserActivity: (NSUserActivity*) userActivity
 
   for (auto window : self.app->windowManager->windows) {
     if (window != nullptr) {
-      window->bridge->router.emit("applicationurl", json.str());
       emitted = true;
+      break;
     }
   }
 
@@ -132,6 +126,8 @@ continueUserActivity: (NSUserActivity*) userActivity
     return NO;
   }
 
+  self.app->windowManager->broadcast("applicationurl", json.str());
+
   return YES;
 }
 
@@ -155,6 +151,8 @@ namespace SSC {
   }
 
   App::App () {
+    SSC_TRACE_SPAN("launch", "App::App");
+
     if (applicationInstance == nullptr) {
       SSC::applicationInstance = this;
     }
@@ -248,6 +246,46 @@ namespace SSC {
   #endif
   }
 
+  //
+  // Warm restart: recycles webview navigation and resets JS state while
+  // the `Core` event loop, worker pools, DNS cache, buffer pools and
+  // loaded extensions stay alive - a kiosk style refresh measured in
+  // milliseconds instead of the full process relaunch `restart()`
+  // performs. The invalidation list is explicit: posts held for the
+  // page, per-router mapped buffers and queued scripts, and the router
+  // readiness handshake. Everything else survives.
+  //
+  void App::warmRestart () {
+    if (this->windowManager == nullptr) {
+      // nothing page-scoped to recycle - fall back to the cold path
+      return this->restart();
+    }
+
+    this->dispatch([this]() {
+      if (this->core != nullptr) {
+        // posts reference response bodies the old page never collected
+        this->core->removeAllPosts();
+      }
+
+      for (const auto window : this->windowManager->windows) {
+        if (
+          window == nullptr ||
+          window->status >= WindowManager::WindowStatus::WINDOW_CLOSING
+        ) {
+          continue;
+        }
+
+        if (window->bridge != nullptr) {
+          window->bridge->router.invalidate();
+        }
+
+        if (window->opts.url.size() > 0) {
+          window->navigate("", window->opts.url);
+        }
+      }
+    });
+  }
+
   void App::dispatch (std::function<void()> callback) {
   #if defined(__linux__) && !defined(__ANDROID__)
     auto threadCallback = new std::function<void()>(callback);
@@ -264,13 +302,37 @@ namespace SSC {
       }
     );
   #elif defined(__APPLE__)
-    auto priority = DISPATCH_QUEUE_PRIORITY_DEFAULT;
-    auto queue = dispatch_get_global_queue(priority, 0);
+    // callbacks land on the main queue directly - the old global-queue
+    // hop blocked a GCD worker in `dispatch_sync` per dispatch - and a
+    // burst coalesces into a single main-queue block per turn: only the
+    // push that finds the queue empty schedules a drain
+    static Mutex mutex;
+    static Vector<std::function<void()>> queue;
+
+    bool shouldSchedule = false;
+
+    do {
+      Lock lock(mutex);
+      shouldSchedule = queue.empty();
+      queue.push_back(callback);
+    } while (0);
+
+    if (!shouldSchedule) {
+      return;
+    }
 
-    dispatch_async(queue, ^{
-      dispatch_sync(dispatch_get_main_queue(), ^{
-        callback();
-      });
+    dispatch_async(dispatch_get_main_queue(), ^{
+      Vector<std::function<void()>> pending;
+
+      do {
+        Lock lock(mutex);
+        pending = std::move(queue);
+        queue.clear();
+      } while (0);
+
+      for (const auto& dispatched : pending) {
+        dispatched();
+      }
     });
   #elif defined(_WIN32)
     static auto mainThread = GetCurrentThreadId();
@@ -69,6 +69,7 @@ namespace SSC {
       void kill ();
       void exit (int code);
       void restart ();
+      void warmRestart ();
       void dispatch (std::function<void()>);
       String getcwd ();
       void setWindowManager (WindowManager*);
@@ -0,0 +1,276 @@
+/**
+ * Microbenchmarks for the core primitives the runtime leans on in hot
+ * paths. Each benchmark reports ns/op and allocations/op so releases can
+ * be gated on regressions in these numbers. Built and run with
+ * `bin/bench.sh` — an optional argument filters benchmarks by substring:
+ *
+ *   bin/bench.sh            # run everything
+ *   bin/bench.sh message    # only the `ipc message ...` benchmarks
+ *
+ * Numbers are only comparable on the same machine and build flags, so
+ * compare runs against a baseline recorded on the same host.
+ */
+#include "../ipc/ipc.hh"
+#include "../core/codec.hh"
+#include "../core/ini.hh"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+// global allocation counter - every `operator new` in the process bumps
+// it, so per-benchmark deltas include allocations made inside the
+// runtime primitives under test
+static std::atomic<uint64_t> allocationCount = 0;
+
+void* operator new (std::size_t size) {
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+  if (auto pointer = std::malloc(size)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[] (std::size_t size) {
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+  if (auto pointer = std::malloc(size)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete (void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[] (void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete (void* pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[] (void* pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+namespace SSC {
+  // keeps `value` observable so the optimizer cannot elide the work
+  // that produced it
+  template <typename T> static inline void keep (const T& value) {
+  #if defined(_MSC_VER) && !defined(__clang__)
+    volatile const T* sink = &value;
+    (void) sink;
+  #else
+    asm volatile("" : : "g"(&value) : "memory");
+  #endif
+  }
+
+  struct Benchmark {
+    // target wall time for the measured run - long enough to average
+    // out scheduler noise, short enough to keep the suite quick
+    static constexpr auto TARGET_RUN_TIME = std::chrono::milliseconds(200);
+    static constexpr uint64_t WARMUP_ITERATIONS = 256;
+    static constexpr uint64_t MAX_ITERATIONS = 1 << 24;
+
+    using Operation = std::function<void()>;
+
+    static uint64_t elapsed (
+      const std::chrono::steady_clock::time_point& since
+    ) {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - since
+      ).count();
+    }
+
+    static void run (
+      const String& filter,
+      const String& name,
+      const Operation& operation
+    ) {
+      if (filter.size() > 0 && name.find(filter) == String::npos) {
+        return;
+      }
+
+      for (uint64_t i = 0; i < WARMUP_ITERATIONS; ++i) {
+        operation();
+      }
+
+      // scale the iteration count until a run is long enough to measure
+      uint64_t iterations = WARMUP_ITERATIONS;
+      uint64_t nanoseconds = 0;
+
+      while (true) {
+        const auto started = std::chrono::steady_clock::now();
+
+        for (uint64_t i = 0; i < iterations; ++i) {
+          operation();
+        }
+
+        nanoseconds = elapsed(started);
+
+        if (
+          nanoseconds >= (uint64_t) std::chrono::nanoseconds(TARGET_RUN_TIME).count() ||
+          iterations >= MAX_ITERATIONS
+        ) {
+          break;
+        }
+
+        iterations *= 2;
+      }
+
+      // a separate pass for the allocation delta so timing is not
+      // perturbed by the counter reads
+      const auto allocationsBefore = allocationCount.load(std::memory_order_relaxed);
+
+      for (uint64_t i = 0; i < WARMUP_ITERATIONS; ++i) {
+        operation();
+      }
+
+      const auto allocations = (
+        allocationCount.load(std::memory_order_relaxed) - allocationsBefore
+      );
+
+      printf(
+        "ok - %-36s %10.1f ns/op %8.1f allocs/op (%llu ops)\n",
+        name.c_str(),
+        (double) nanoseconds / (double) iterations,
+        (double) allocations / (double) WARMUP_ITERATIONS,
+        (unsigned long long) iterations
+      );
+    }
+  };
+}
+
+int main (int argc, char** argv) {
+  using namespace SSC;
+  using namespace SSC::IPC;
+
+  const auto filter = argc > 1 ? String(argv[1]) : String("");
+
+  printf("# socket runtime microbenchmarks\n");
+
+  // a representative route uri: a name, a seq, and a handful of
+  // percent-encoded arguments
+  static const auto uri = String(
+    "ipc://fs.read?seq=R1024&id=18446744073709551615"
+    "&size=65536&offset=0&timeout=32000&resolve=true"
+    "&path=a%2Fdeeply%2Fnested%2Fproject%2Fpath%2Ffile.txt"
+  );
+
+  Benchmark::run(filter, "ipc message parse (eager)", []() {
+    auto message = Message(uri, true);
+    keep(message.name);
+  });
+
+  Benchmark::run(filter, "ipc message parse (lazy)", []() {
+    auto message = Message(uri, true, true);
+    keep(message.seq);
+  });
+
+  Benchmark::run(filter, "ipc message parse (lazy) + one arg", []() {
+    auto message = Message(uri, true, true);
+    const auto size = message.get("size");
+    keep(size);
+  });
+
+  // a live router with one synchronous route - measures the uri parse,
+  // table lookup, dispatch, and reply path end to end
+  Router router;
+  router.map("bench.echo", false, [](auto message, auto router, auto reply) {
+    reply(IPC::Result { message.seq, message });
+  });
+
+  Benchmark::run(filter, "router invoke dispatch", [&router]() {
+    router.invoke(
+      "ipc://bench.echo?seq=1&value=hello%20world",
+      [](auto result) {
+        keep(result.seq);
+      }
+    );
+  });
+
+  static const auto json = JSON::Object(JSON::Object::Entries {
+    {"source", "fs.stat"},
+    {"data", JSON::Object::Entries {
+      {"st_mode", 33188},
+      {"st_size", 1048576},
+      {"st_mtim", 1693526400.5},
+      {"isFile", true},
+      {"path", "a/deeply/nested/project/path/file.txt"},
+      {"blocks", JSON::Array::Entries {8, 16, 32, 64}}
+    }}
+  });
+
+  Benchmark::run(filter, "json any str", []() {
+    const auto value = json.str();
+    keep(value);
+  });
+
+  static const auto component = String(
+    "a value with spaces, unicode (\xc3\xa9\xc3\xa0\xc3\xbc), "
+    "reserved characters ?&=#/ and some plain ascii padding text"
+  );
+  static const auto encodedComponent = encodeURIComponent(component);
+
+  Benchmark::run(filter, "encodeURIComponent", []() {
+    const auto value = encodeURIComponent(component);
+    keep(value);
+  });
+
+  Benchmark::run(filter, "decodeURIComponent", []() {
+    const auto value = decodeURIComponent(encodedComponent);
+    keep(value);
+  });
+
+  static const auto headers = Headers(Headers::Entries {
+    {"content-type", "application/octet-stream"},
+    {"content-length", 65536},
+    {"cache-control", "no-store"},
+    {"access-control-allow-origin", "*"},
+    {"access-control-allow-headers", "*"},
+    {"connection", "keep-alive"}
+  });
+
+  Benchmark::run(filter, "headers str", []() {
+    const auto value = headers.str();
+    keep(value);
+  });
+
+  static const auto ini = String(
+    "; a representative socket.ini slice                \n"
+    "[build]                                            \n"
+    "name = \"benchmark-app\"                           \n"
+    "copy = \"src\"                                     \n"
+    "output = \"build\"                                 \n"
+    "headless = true                                    \n"
+    "                                                   \n"
+    "[build.script]                                     \n"
+    "forward_arguments = false                          \n"
+    "                                                   \n"
+    "[webview]                                          \n"
+    "root = \"/\"                                       \n"
+    "watch = true                                       \n"
+    "                                                   \n"
+    "[window]                                           \n"
+    "height = 50%                                       \n"
+    "width = 50%                                        \n"
+    "titlebar_style = \"hiddenInset\"                   \n"
+    "                                                   \n"
+    "[permissions]                                      \n"
+    "allow_fullscreen = true                            \n"
+    "allow_microphone = false                           \n"
+    "allow_geolocation = false                          \n"
+    "allow_notifications = true                         \n"
+  );
+
+  Benchmark::run(filter, "ini parse", []() {
+    const auto map = INI::parse(ini);
+    keep(map);
+  });
+
+  return 0;
+}
@@ -1,5 +1,10 @@
 #if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <unistd.h>
+#if defined(__APPLE__)
+#include <sys/clonefile.h>
+#endif
 #else
 #include <array>
 #include <AppxPackaging.h>
@@ -34,6 +39,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <filesystem>
 #include <iostream>
 #include <fstream>
@@ -44,6 +50,7 @@
 #include "../core/core.hh"
 #include "../extension/extension.hh"
 #include "../process/process.hh"
+#include "../process/pool.hh"
 
 #include "templates.hh"
 #include "cli.hh"
@@ -78,6 +85,10 @@ auto start = system_clock::now();
 bool flagDebugMode = true;
 bool flagVerboseMode = true;
 bool flagQuietMode = false;
+size_t flagBuildJobs = 0; // 0 - one job per hardware thread
+bool flagDevMode = false;
+bool flagProfileMode = false;
+bool flagRefreshDevices = false;
 Map defaultTemplateAttrs;
 
 #if defined(__APPLE__)
@@ -92,6 +103,14 @@ static dispatch_queue_t queue = dispatch_queue_create(
 );
 #endif
 
+// explicit flush point for the buffered log stream - registered with
+// `atexit()` in `main()` (so every `exit()` path flushes) and called
+// periodically from `log()` so output never lags far behind
+void flushLog () {
+  std::cerr.flush();
+  fflush(stderr);
+}
+
 void log (const String s) {
   if (flagQuietMode) return;
   if (s.size() == 0) return;
@@ -104,11 +123,19 @@ void log (const String s) {
   auto now = system_clock::now();
   auto delta = duration_cast<milliseconds>(now - start).count();
   #ifdef _WIN32
-  std::cerr << "• " << s << " " << delta << "ms" << std::endl;
+  std::cerr << "• " << s << " " << delta << "ms" << "\n";
   #else
-  std::cerr << "• " << s << " \033[0;32m+" << delta << "ms\033[0m" << std::endl;
+  std::cerr << "• " << s << " \033[0;32m+" << delta << "ms\033[0m" << "\n";
   #endif
   start = std::chrono::system_clock::now();
+
+  // bursts of log lines stay buffered, but output is never more than
+  // ~250ms behind a flush point
+  static auto lastFlush = now;
+  if (duration_cast<milliseconds>(now - lastFlush).count() >= 250) {
+    lastFlush = now;
+    flushLog();
+  }
 }
 
 inline Map& extendMap (Map& dst, const Map& src) {
@@ -124,6 +151,34 @@ inline String readFile (fs::path path) {
     return "";
   }
 
+#if !defined(_WIN32)
+  // map the file read-only and copy it out in one shot instead of
+  // pulling it through an ifstream character by character
+  const auto fd = ::open(path.c_str(), O_RDONLY);
+
+  if (fd >= 0) {
+    struct stat stats;
+
+    if (fstat(fd, &stats) == 0) {
+      if (stats.st_size == 0) {
+        ::close(fd);
+        return "";
+      }
+
+      const auto data = mmap(nullptr, stats.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+      if (data != MAP_FAILED) {
+        auto content = String((const char*) data, stats.st_size);
+        munmap(data, stats.st_size);
+        ::close(fd);
+        return content;
+      }
+    }
+
+    ::close(fd);
+  }
+#endif
+
   std::ifstream stream(path.c_str());
   String content;
   auto buffer = std::istreambuf_iterator<char>(stream);
@@ -133,7 +188,51 @@ inline String readFile (fs::path path) {
   return content;
 }
 
+// memoized `readFile()` for template and config files that are read
+// repeatedly within one build and across watch-mode rebuilds - entries
+// invalidate when the file's size or mtime changes
+inline String readCachedFile (const Path& path) {
+  struct Entry {
+    fs::file_time_type mtime;
+    uintmax_t size;
+    String content;
+  };
+
+  static std::map<String, Entry> cache;
+  static std::mutex mutex;
+
+  std::error_code err;
+  const auto mtime = fs::last_write_time(path, err);
+  const auto size = err ? 0 : fs::file_size(path, err);
+
+  if (err) {
+    return readFile(path);
+  }
+
+  const auto key = path.string();
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto entry = cache.find(key);
+    if (entry != cache.end() && entry->second.mtime == mtime && entry->second.size == size) {
+      return entry->second.content;
+    }
+  }
+
+  auto content = readFile(path);
+  std::lock_guard<std::mutex> lock(mutex);
+  cache[key] = Entry { mtime, size, content };
+  return content;
+}
+
 inline void writeFile (fs::path path, String s) {
+  // skip rewriting identical content so output mtimes only move when
+  // the content does - re-expanded templates become no-ops and
+  // downstream incremental tooling sees fewer changes
+  if (fs::is_regular_file(path) && readFile(path) == s) {
+    return;
+  }
+
   std::ofstream stream(path.string());
   stream << s;
   stream.close();
@@ -150,7 +249,26 @@ bool equal (const String& s1, const String& s2) {
   return s1.compare(s2) == 0;
 };
 
-const Map SSC::getUserConfig () {
+// escapes `source` for embedding in a generated C string literal
+String escapeStringLiteral (const String& source) {
+  String output;
+  output.reserve(source.size());
+
+  for (const auto character : source) {
+    switch (character) {
+      case '\\': output += "\\\\"; break;
+      case '"': output += "\\\""; break;
+      case '\n': output += "\\n"; break;
+      case '\r': output += "\\r"; break;
+      case '\t': output += "\\t"; break;
+      default: output += character;
+    }
+  }
+
+  return output;
+}
+
+const Map& SSC::getUserConfig () {
   return settings;
 }
 
@@ -173,6 +291,8 @@ bool SSC::isDebugEnabled () {
 void printHelp (const String& command) {
   if (command == "ssc") {
     std::cout << tmpl(gHelpText, defaultTemplateAttrs) << std::endl;
+  } else if (command == "bench") {
+    std::cout << tmpl(gHelpTextBench, defaultTemplateAttrs) << std::endl;
   } else if (command == "build") {
     std::cout << tmpl(gHelpTextBuild, defaultTemplateAttrs) << std::endl;
   } else if (command == "list-devices") {
@@ -187,6 +307,8 @@ void printHelp (const String& command) {
     std::cout << tmpl(gHelpTextRun, defaultTemplateAttrs) << std::endl;
   } else if (command == "setup") {
     std::cout << tmpl(gHelpTextSetup, defaultTemplateAttrs) << std::endl;
+  } else if (command == "fetch") {
+    std::cout << tmpl(gHelpTextFetch, defaultTemplateAttrs) << std::endl;
   }
 }
 
@@ -302,13 +424,767 @@ inline String prefixFile () {
   return socketHome;
 }
 
+// a single artifact for `ssc fetch`: downloaded with resume through
+// `curl`, validated against `sha256` when given and kept in a shared
+// on-disk cache keyed by `version`
+struct FetchSpec {
+  String url;
+  String sha256;
+  String version = "default";
+  String filename; // basename of `url` when empty
+};
+
+String fetchCacheDirectory () {
+  auto cache = Env::get("SSC_FETCH_CACHE");
+
+  if (cache.size() > 0) {
+    return cache;
+  }
+
+  return (Path(getSocketHome(false)) / "cache").string();
+}
+
+String sha256OfFile (const Path& path) {
+  String command;
+
+  if (platform.win) {
+    command = "certutil -hashfile \"" + path.string() + "\" SHA256";
+  } else if (platform.mac) {
+    command = "shasum -a 256 \"" + path.string() + "\"";
+  } else {
+    command = "sha256sum \"" + path.string() + "\"";
+  }
+
+  auto r = exec(command);
+
+  if (r.exitCode != 0) {
+    return "";
+  }
+
+  // every tool prints the digest as the only 64-character hex token
+  for (auto& token : split(replace(r.output, "\r\n", "\n"), '\n')) {
+    for (auto& word : split(trim(token), ' ')) {
+      auto candidate = trim(word);
+
+      if (candidate.size() != 64) {
+        continue;
+      }
+
+      auto isHex = true;
+      for (auto& c : candidate) {
+        c = (char) std::tolower(c);
+        if (!std::isxdigit(c)) {
+          isHex = false;
+          break;
+        }
+      }
+
+      if (isHex) {
+        return candidate;
+      }
+    }
+  }
+
+  return "";
+}
+
+// downloads one spec into the cache, reusing a valid cached copy and
+// resuming a previous partial download - returns the cached path, or
+// an empty string on failure
+String fetchArtifact (const FetchSpec& spec) {
+  auto filename = spec.filename;
+
+  if (filename.size() == 0) {
+    filename = Path(spec.url).filename().string();
+    const auto query = filename.find('?');
+
+    if (query != String::npos) {
+      filename = filename.substr(0, query);
+    }
+  }
+
+  if (filename.size() == 0 || spec.url.size() == 0) {
+    return "";
+  }
+
+  auto expected = spec.sha256;
+  for (auto& c : expected) {
+    c = (char) std::tolower(c);
+  }
+
+  const auto directory = Path(fetchCacheDirectory()) / spec.version;
+  const auto destination = directory / filename;
+  const auto partial = directory / (filename + ".part");
+
+  fs::create_directories(directory);
+
+  if (fs::exists(destination)) {
+    if (expected.size() == 0 || sha256OfFile(destination) == expected) {
+      return destination.string();
+    }
+
+    // stale or corrupt - refetch
+    fs::remove(destination);
+  }
+
+  // `-C -` resumes a partial download left by an interrupted run
+  // instead of starting from zero
+  const auto command = (
+    "curl --fail --location --silent --show-error --retry 3 -C - "
+    "--output \"" + partial.string() + "\" \"" + spec.url + "\""
+  );
+
+  auto r = exec(command);
+
+  if (r.exitCode != 0 && fs::exists(partial)) {
+    // some servers refuse range requests against a stale partial -
+    // drop it and retry once from the beginning
+    fs::remove(partial);
+    r = exec(command);
+  }
+
+  if (r.exitCode != 0) {
+    log("ERROR: download failed: " + spec.url + "\n" + trim(r.output));
+    return "";
+  }
+
+  if (expected.size() > 0) {
+    const auto hash = sha256OfFile(partial);
+
+    if (hash != expected) {
+      log("ERROR: sha256 mismatch for " + spec.url + " (expected " + expected + ", got " + hash + ")");
+      fs::remove(partial);
+      return "";
+    }
+  }
+
+  fs::rename(partial, destination); // atomic publish for concurrent agents
+  return destination.string();
+}
+
+// downloads every spec with up to `concurrency` connections in flight;
+// the result vector matches `specs` by index, with empty strings for
+// failures
+Vector<String> fetchArtifacts (const Vector<FetchSpec>& specs, int concurrency) {
+  Vector<String> results(specs.size());
+  std::atomic<size_t> cursor = 0;
+  Vector<std::future<void>> workers;
+
+  const auto count = std::max(1, std::min(concurrency, (int) specs.size()));
+
+  for (int i = 0; i < count; i++) {
+    workers.push_back(std::async(std::launch::async, [&] {
+      while (true) {
+        const auto index = cursor.fetch_add(1);
+
+        if (index >= specs.size()) {
+          return;
+        }
+
+        results[index] = fetchArtifact(specs[index]);
+      }
+    }));
+  }
+
+  for (auto& worker : workers) {
+    worker.get();
+  }
+
+  return results;
+}
+
 static Process::id_type appPid = 0;
 static Process* appProcess = nullptr;
 static std::atomic<int> appStatus = -1;
 static std::mutex appMutex;
 
+// `--profile` instrumentation: build phases and compiler invocations
+// record spans here, and at exit a chrome://tracing compatible JSON
+// trace is written next to the project along with a summary table
+// through `log()`, so regressions can be attributed to specific phases
+class BuildProfiler {
+  public:
+    struct Span {
+      String name;
+      int64_t start; // microseconds since the profiler was created
+      int64_t duration;
+      size_t thread;
+    };
+
+    // RAII span - a no-op unless `--profile` was given
+    class Scope {
+      public:
+        Scope (const String& name) : name(name) {
+          if (flagProfileMode) {
+            this->started = std::chrono::steady_clock::now();
+          }
+        }
+
+        ~Scope () {
+          if (flagProfileMode) {
+            BuildProfiler::instance().record(this->name, this->started);
+          }
+        }
+
+      private:
+        String name;
+        std::chrono::steady_clock::time_point started;
+    };
+
+    static BuildProfiler& instance () {
+      static BuildProfiler profiler;
+      return profiler;
+    }
+
+    void record (
+      const String& name,
+      const std::chrono::steady_clock::time_point started
+    ) {
+      const auto now = std::chrono::steady_clock::now();
+      std::lock_guard<std::mutex> lock(this->mutex);
+
+      const auto id = std::this_thread::get_id();
+      if (this->threads.find(id) == this->threads.end()) {
+        this->threads[id] = this->threads.size() + 1;
+      }
+
+      this->spans.push_back(Span {
+        name,
+        std::chrono::duration_cast<std::chrono::microseconds>(started - this->epoch).count(),
+        std::chrono::duration_cast<std::chrono::microseconds>(now - started).count(),
+        this->threads[id]
+      });
+    }
+
+    // writes `ssc-build-trace.json` (load it via chrome://tracing or
+    // https://ui.perfetto.dev) and logs a per-phase summary; spans
+    // named "<phase> :: <detail>" aggregate under "<phase>"
+    void write () {
+      if (!flagProfileMode || this->spans.size() == 0) {
+        return;
+      }
+
+      auto trace = StringStream();
+      trace << "{ \"traceEvents\": [\n";
+
+      for (size_t i = 0; i < this->spans.size(); i++) {
+        const auto& span = this->spans[i];
+        trace
+          << "  { \"name\": \"" << escapeStringLiteral(span.name) << "\","
+          << " \"ph\": \"X\","
+          << " \"ts\": " << span.start << ","
+          << " \"dur\": " << span.duration << ","
+          << " \"pid\": 1,"
+          << " \"tid\": " << span.thread << " }"
+          << (i + 1 < this->spans.size() ? ",\n" : "\n");
+      }
+
+      trace << "] }\n";
+      writeFile(targetPath / "ssc-build-trace.json", trace.str());
+
+      struct Total { int64_t duration = 0; size_t count = 0; };
+      std::map<String, Total> totals;
+
+      for (const auto& span : this->spans) {
+        const auto separator = span.name.find(" :: ");
+        const auto phase = separator == String::npos
+          ? span.name
+          : span.name.substr(0, separator);
+
+        totals[phase].duration += span.duration;
+        totals[phase].count++;
+      }
+
+      Vector<std::pair<String, Total>> sorted(totals.begin(), totals.end());
+      std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+        return a.second.duration > b.second.duration;
+      });
+
+      log("profile: phase totals (wall clock, concurrent spans overlap)");
+      for (const auto& total : sorted) {
+        log(
+          "profile: " + total.first + " - " +
+          std::to_string(total.second.duration / 1000) + "ms over " +
+          std::to_string(total.second.count) + " span(s)"
+        );
+      }
+
+      log("profile: trace written to " + (targetPath / "ssc-build-trace.json").string());
+    }
+
+  private:
+    std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+    std::mutex mutex;
+    Vector<Span> spans;
+    std::map<std::thread::id, size_t> threads;
+};
+
+// `exec()` wrapped in a profiler span named after the build step
+inline ExecOutput profiledExec (const String& name, const String& command) {
+  const auto scope = BuildProfiler::Scope(name);
+  return exec(command);
+}
+
+// shared warm-worker pool for repeated short-lived tool probes
+// (adb, simctl, etc.) - constructed on first use so commands that
+// never probe a device don't pay for the workers
+static ProcessPool& getProcessPool () {
+  static ProcessPool pool;
+  return pool;
+}
+
+// disk-cached device/toolchain discovery probe: results live under
+// `$SOCKET_HOME/cache/` keyed by `key` plus a hash of the command (so
+// SDK or flag changes miss) and expire after `ttl` seconds. the device
+// set rarely changes between runs, so repeated `simctl list` and
+// `adb devices` probes become a file read; `--refresh-devices`
+// bypasses the cache, and failures are never cached
+inline ExecOutput cachedDeviceProbe (
+  const String& key,
+  const String& command,
+  const int ttl = 30
+) {
+  auto suffix = StringStream();
+  suffix << std::hex << std::hash<String>{}(command);
+
+  const auto cacheDirectory = Path(getSocketHome(false)) / "cache";
+  const auto cachePath = cacheDirectory / (key + "-" + suffix.str());
+  const auto now = std::chrono::duration_cast<std::chrono::seconds>(
+    std::chrono::system_clock::now().time_since_epoch()
+  ).count();
+
+  if (!flagRefreshDevices && fs::exists(cachePath)) {
+    const auto cached = readFile(cachePath);
+    const auto newline = cached.find('\n');
+
+    if (newline != String::npos) {
+      const auto timestamp = std::atoll(cached.c_str());
+
+      if (now - timestamp <= ttl) {
+        ExecOutput eo;
+        eo.output = cached.substr(newline + 1);
+        return eo;
+      }
+    }
+  }
+
+  auto r = getProcessPool().run(command).get();
+
+  if (r.exitCode == 0) {
+    fs::create_directories(cacheDirectory);
+    writeFile(cachePath, std::to_string(now) + "\n" + r.output);
+  }
+
+  return r;
+}
+
+// runs independent compile steps concurrently with `-j` style
+// parallelism (`--jobs`, default: one per hardware thread). `push()`
+// queues a command and starts it as soon as a slot frees up; a
+// dependent link step calls `wait()` first, which joins everything
+// queued and aborts the build like the serial `exec()` path did - the
+// failure reported is the earliest-pushed one, with its output
+// interleaved through `log()`. one scheduler per fan-out: construct,
+// push, wait
+class BuildJobScheduler {
+  public:
+    BuildJobScheduler (size_t concurrency = flagBuildJobs) {
+      if (concurrency == 0) {
+        concurrency = std::thread::hardware_concurrency();
+      }
+
+      this->concurrency = concurrency > 0 ? concurrency : 1;
+    }
+
+    ~BuildJobScheduler () {
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->done = true;
+      }
+
+      this->signal.notify_all();
+
+      for (auto& thread : this->threads) {
+        if (thread.joinable()) {
+          thread.join();
+        }
+      }
+    }
+
+    void push (
+      const String& command,
+      const String& error,
+      const String& label = "compile"
+    ) {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->jobs.push_back(Job { this->pushed++, command, error, label });
+
+      if (this->threads.size() < this->concurrency) {
+        this->threads.emplace_back([this] { this->work(); });
+      }
+
+      this->signal.notify_one();
+    }
+
+    void wait () {
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->done = true;
+      }
+
+      this->signal.notify_all();
+
+      for (auto& thread : this->threads) {
+        thread.join();
+      }
+
+      this->threads.clear();
+
+      if (this->failed) {
+        exit(this->failedCode);
+      }
+    }
+
+  private:
+    struct Job {
+      size_t index;
+      String command;
+      String error;
+      String label;
+    };
+
+    void work () {
+      while (true) {
+        Job job;
+
+        {
+          std::unique_lock<std::mutex> lock(this->mutex);
+          this->signal.wait(lock, [this] {
+            return this->done || this->jobs.size() > 0;
+          });
+
+          if (this->jobs.size() == 0) {
+            return;
+          }
+
+          job = std::move(this->jobs.front());
+          this->jobs.pop_front();
+        }
+
+        auto r = profiledExec("compile :: " + job.label, job.command);
+
+        if (r.exitCode != 0) {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          log(job.error);
+          log(r.output);
+
+          if (!this->failed || job.index < this->failedIndex) {
+            this->failedIndex = job.index;
+            this->failedCode = r.exitCode;
+          }
+
+          this->failed = true;
+        }
+      }
+    }
+
+    size_t concurrency = 1;
+    size_t pushed = 0;
+    std::mutex mutex;
+    std::condition_variable signal;
+    std::deque<Job> jobs;
+    Vector<std::thread> threads;
+    bool done = false;
+    bool failed = false;
+    size_t failedIndex = 0;
+    int failedCode = 1;
+};
+
+// copies one file with the fastest primitive the platform offers -
+// `clonefile()` on macOS (a constant-time reflink on APFS) and
+// `copy_file_range()` on linux (reflinks on supporting filesystems,
+// in-kernel copying otherwise, without bouncing bytes through
+// userspace) - falling back to `fs::copy` everywhere else
+inline void copyFileFast (const Path& src, const Path& dst) {
+#if defined(__APPLE__)
+  // clonefile requires that the destination does not exist
+  fs::remove(dst);
+
+  if (clonefile(src.c_str(), dst.c_str(), 0) == 0) {
+    return;
+  }
+#elif defined(__linux__)
+  const auto input = ::open(src.c_str(), O_RDONLY);
+
+  if (input >= 0) {
+    struct stat stats;
+
+    if (fstat(input, &stats) == 0) {
+      const auto output = ::open(dst.c_str(), O_WRONLY | O_CREAT | O_TRUNC, stats.st_mode & 07777);
+
+      if (output >= 0) {
+        auto remaining = (off_t) stats.st_size;
+
+        while (remaining > 0) {
+          const auto copied = copy_file_range(input, nullptr, output, nullptr, remaining, 0);
+
+          if (copied <= 0) {
+            break;
+          }
+
+          remaining -= copied;
+        }
+
+        ::close(output);
+        ::close(input);
+
+        if (remaining == 0) {
+          return;
+        }
+      } else {
+        ::close(input);
+      }
+    } else {
+      ::close(input);
+    }
+  }
+#endif
+
+  fs::copy(src, dst, fs::copy_options::overwrite_existing);
+}
+
+// content-hash build cache backing the copy and compile phases. the
+// manifest maps an output path to the FNV-1a hash of the inputs that
+// produced it; a step whose input hash matches its manifest entry is
+// skipped, so a no-op rebuild only reads inputs instead of copying or
+// compiling them again. `prune()` removes outputs whose entries went
+// untouched this run - their inputs no longer exist - so deletes
+// propagate to the output tree. the manifest goes through
+// `writeFile()`, which already short-circuits unchanged content
+class BuildCache {
+  public:
+    static constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325;
+    static constexpr uint64_t FNV_PRIME = 0x100000001b3;
+
+    static uint64_t hashBytes (const String& bytes, uint64_t hash = FNV_OFFSET_BASIS) {
+      for (const unsigned char byte : bytes) {
+        hash = (hash ^ byte) * FNV_PRIME;
+      }
+
+      return hash;
+    }
+
+    static uint64_t hashFile (const Path& path, uint64_t hash = FNV_OFFSET_BASIS) {
+      char buffer[65536];
+      std::ifstream stream(path.string(), std::ios::binary);
+
+      while (stream.read(buffer, sizeof(buffer)) || stream.gcount() > 0) {
+        const auto count = stream.gcount();
+        for (std::streamsize i = 0; i < count; i++) {
+          hash = (hash ^ (unsigned char) buffer[i]) * FNV_PRIME;
+        }
+      }
+
+      return hash;
+    }
+
+    BuildCache (const Path& manifestPath, const String& salt = "")
+      : manifestPath(manifestPath)
+    {
+      this->salt = hashBytes(salt);
+
+      for (const auto& line : split(readFile(this->manifestPath), '\n')) {
+        const auto index = line.find(' ');
+        if (index != String::npos && index > 0) {
+          this->entries[line.substr(index + 1)] = line.substr(0, index);
+        }
+      }
+    }
+
+    // returns true when `output` was produced from inputs hashing to
+    // `inputHash` by an earlier run and still exists on disk; records
+    // the entry as live either way
+    bool isFresh (const Path& output, uint64_t inputHash) {
+      auto hash = StringStream();
+      hash << std::hex << ((inputHash ^ this->salt) * FNV_PRIME);
+
+      const auto key = output.string();
+      const auto entry = this->entries.find(key);
+      const auto fresh = (
+        entry != this->entries.end() &&
+        entry->second == hash.str() &&
+        fs::exists(output)
+      );
+
+      this->touched.insert(key);
+      this->entries[key] = hash.str();
+      return fresh;
+    }
+
+    // copies `src` (a file or a directory tree) into `dst` like
+    // `fs::copy` with `update_existing | recursive`, but per file:
+    // files whose content hash matches the manifest are skipped, and
+    // every copied file is recorded so `prune()` can delete-detect at
+    // file granularity
+    void copy (const Path& src, const Path& dst) {
+      if (!fs::is_directory(src)) {
+        const auto target = fs::is_directory(dst) ? dst / src.filename() : dst;
+
+        if (!this->isFresh(target, hashFile(src))) {
+          fs::create_directories(target.parent_path());
+          copyFileFast(src, target);
+        }
+
+        return;
+      }
+
+      // scan serially for manifest bookkeeping, then fan the stale
+      // byte copies out across one thread per hardware thread - media
+      // heavy asset trees are pure wall-clock win here
+      Vector<std::pair<Path, Path>> stale;
+      uintmax_t staleBytes = 0;
+
+      for (const auto& entry : fs::recursive_directory_iterator(src)) {
+        if (!entry.is_regular_file()) {
+          continue;
+        }
+
+        const auto target = dst / fs::relative(entry.path(), src);
+
+        if (!this->isFresh(target, hashFile(entry.path()))) {
+          fs::create_directories(target.parent_path());
+          staleBytes += entry.file_size();
+          stale.push_back({ entry.path(), target });
+        }
+      }
+
+      if (stale.size() == 0) {
+        return;
+      }
+
+      auto concurrency = (size_t) std::thread::hardware_concurrency();
+      concurrency = std::max((size_t) 1, std::min(concurrency, stale.size()));
+
+      std::atomic<size_t> next = 0;
+      std::atomic<size_t> copied = 0;
+      Vector<std::thread> threads;
+
+      for (size_t i = 0; i < concurrency; i++) {
+        threads.emplace_back([&] {
+          while (true) {
+            const auto index = next++;
+
+            if (index >= stale.size()) {
+              return;
+            }
+
+            copyFileFast(stale[index].first, stale[index].second);
+            const auto count = ++copied;
+
+            if (count % 500 == 0) {
+              log(
+                "copied " + std::to_string(count) + "/" +
+                std::to_string(stale.size()) + " files"
+              );
+            }
+          }
+        });
+      }
+
+      for (auto& thread : threads) {
+        thread.join();
+      }
+
+      log(
+        "copied " + std::to_string(stale.size()) + " files (" +
+        std::to_string(staleBytes / 1048576) + " MB) to " + dst.string()
+      );
+    }
+
+    // removes outputs whose manifest entries went untouched this run -
+    // only outputs this cache itself recorded are ever deleted
+    void prune () {
+      auto entry = this->entries.begin();
+      while (entry != this->entries.end()) {
+        if (this->touched.find(entry->first) == this->touched.end()) {
+          if (fs::exists(entry->first)) {
+            fs::remove_all(entry->first);
+          }
+
+          entry = this->entries.erase(entry);
+        } else {
+          entry++;
+        }
+      }
+    }
+
+    void commit () {
+      auto output = StringStream();
+      for (const auto& entry : this->entries) {
+        output << entry.second << " " << entry.first << "\n";
+      }
+
+      writeFile(this->manifestPath, output.str());
+    }
+
+  private:
+    Path manifestPath;
+    uint64_t salt;
+    Map entries;
+    std::unordered_set<String> touched;
+};
+
 #if defined(__APPLE__)
-void pollOSLogStream (bool isForDesktop, String bundleIdentifier, int processIdentifier) {
+// forwards one complete `log stream --style compact` line: the level
+// token is the second whitespace separated field and the message
+// follows the closing bracket of the `[subsystem:category]` column
+static void forwardOSLogLine (const String& line) {
+  if (line.size() == 0 || line.starts_with("Filtering the log data")) {
+    return;
+  }
+
+  auto message = line;
+  auto level = String("");
+
+  const auto meta = line.find("] ");
+  if (meta != String::npos) {
+    message = line.substr(meta + 2);
+  }
+
+  const auto space = line.find(' ');
+  if (space != String::npos && line.size() > space + 2) {
+    level = line.substr(space + 1, 2);
+  }
+
+  // the stream may redact log messages the user does not have access
+  // to, filter them out
+  if (message == "<private>") {
+    return;
+  }
+
+  if (message.starts_with("__EXIT_SIGNAL__")) {
+    if (appStatus == -1) {
+      appStatus = std::stoi(replace(message, "__EXIT_SIGNAL__=", ""));
+    }
+    return;
+  }
+
+  if (level == "Db") {
+    if (flagDebugMode) {
+      std::cerr << message << std::endl;
+    }
+  } else if (level == "Er" || level == "Fa") {
+    std::cerr << message << std::endl;
+  } else {
+    std::cout << message << std::endl;
+  }
+}
+
+// streams the app's OS log output by tailing a `log stream` subprocess
+// instead of re-querying `OSLogStore` snapshots on a backoff timer —
+// lines are forwarded the moment the subprocess emits them, with no
+// poll interval of latency and no CPU burned while the app is quiet
+void streamOSLog (bool isForDesktop, String bundleIdentifier, int processIdentifier) {
   // It appears there is a bug with `:predicateWithFormat:` as the
   // following does not appear to work:
   //
@@ -320,181 +1196,83 @@ void pollOSLogStream (bool isForDesktop, String bundleIdentifier, int processIde
   //
   // We can build the predicate query string manually, instead.
   auto queryStream = StringStream {};
-  auto pid = std::to_string(processIdentifier);
-  auto bid = bundleIdentifier.c_str();
   queryStream
     << "("
     << (isForDesktop
         ? "category == 'socket.runtime.desktop'"
         : "category == 'socket.runtime.mobile'")
     << " OR category == 'socket.runtime.debug'"
-    << ") AND ";
-
-    if (processIdentifier > 0) {
-      queryStream << "processIdentifier == " << pid << " AND ";
-    }
-
-  queryStream << "subsystem == '" << bid << "'";
-  // log store query and predicate for filtering logs based on the currently
-  // running application that was just launched and those of a subsystem
-  // directly related to the application's bundle identifier which allows us
-  // to just get logs that came from the application (not foundation/cocoa/webkit)
-  const auto query = [NSString stringWithUTF8String: queryStream.str().c_str()];
-  const auto predicate = [NSPredicate predicateWithFormat: query];
-
-  // use the launch date as the initial marker
-  const auto now = [NSDate now];
-  // and offset it by 1 second in the past as the initial position in the eumeration
-  auto offset = [now dateByAddingTimeInterval: -1];
-
-  // tracks the latest log entry date so we ignore older ones
-  NSDate* latest = nil;
-  NSError* error = nil;
-
-  int pollsAfterTermination = 16;
-  int backoffIndex = 0;
-
-  // lucas series of backoffs
-  static int backoffs[] = {
-    16*2,
-    16*1,
-    16*3,
-    16*4,
-    16*7,
-    16*11,
-    16*18,
-    16*29,
-    32*2,
-    32*1,
-    32*3,
-    32*4,
-    32*7,
-    32*11,
-    32*18,
-    32*29,
-    64*2,
-    64*1,
-    64*3,
-    64*4,
-    64*7,
-    64*11,
-    64*18,
-    64*29,
-  };
+    << ") AND ";
 
   if (processIdentifier > 0) {
-    dispatch_async(queue, ^{
-      while (kill(processIdentifier, 0) == 0) {
-        msleep(256);
-      }
-    });
+    queryStream << "processIdentifier == " << std::to_string(processIdentifier) << " AND ";
   }
 
-  while (appStatus < 0 || pollsAfterTermination > 0) {
-    if (appStatus >= 0) {
-      pollsAfterTermination = pollsAfterTermination - 1;
-      checkLogStore = true;
-    }
-
-    if (!checkLogStore) {
-      auto backoff = backoffs[backoffIndex];
-      backoffIndex = (
-        (backoffIndex + 1) %
-        (sizeof(backoffs) / sizeof(backoffs[0]))
-      );
-
-      msleep(backoff);
-      if (processIdentifier > 0) {
-        continue;
-      }
+  // filter logs to the currently running application that was just
+  // launched and the subsystem directly related to the application's
+  // bundle identifier, which gives us just the logs that came from the
+  // application (not foundation/cocoa/webkit)
+  queryStream << "subsystem == '" << bundleIdentifier << "'";
+
+  auto argv = StringStream {};
+  argv
+    << " stream"
+    << " --level debug"
+    << " --style compact"
+    << " --predicate '" << queryStream.str() << "'";
+
+  // chunks arrive on the subprocess reader thread and carry no line
+  // guarantees — buffer and emit only complete lines, leaving any
+  // partial tail for the next chunk
+  auto buffer = std::make_shared<String>();
+  auto process = SSC::Process(
+    "log",
+    argv.str(),
+    "",
+    [buffer](SSC::String const& chunk) {
+      *buffer += chunk;
+      size_t start = 0;
+      size_t end;
+
+      while ((end = buffer->find('\n', start)) != String::npos) {
+        forwardOSLogLine(buffer->substr(start, end - start));
+        start = end + 1;
+      }
+
+      buffer->erase(0, start);
+    },
+    [](SSC::String const& chunk) {
+      // `log stream` reports its own failures here (a bad predicate,
+      // sandbox denial) — surface them instead of hiding them
+      std::cerr << chunk;
     }
+  );
 
-    // this is may be set to `true` from a `SIGUSR1` signal
-    checkLogStore = false;
-    @autoreleasepool {
-      // We need a new `OSLogStore` in each so we can keep enumeratoring
-      // the logs until the application terminates. This is required because
-      // each `OSLogStore` instance is a snapshot of the system's universal
-      // log archive at the time of instantiation.
-      auto logs = [OSLogStore
-        storeWithScope: OSLogStoreSystem
-        error: &error
-      ];
+  process.open();
 
-      if (error) {
-        appStatus = 1;
-        debug(
-          "ERROR: OSLogStore: (code=%lu, domain=%@) %@",
-          error.code,
-          error.domain,
-          error.localizedDescription
-        );
-        break;
+  // watch the app itself and stop streaming shortly after it exits —
+  // the grace period lets the tail of the log (including the exit
+  // signal line) flush through the subprocess first
+  if (processIdentifier > 0) {
+    dispatch_async(queue, ^{
+      while (kill(processIdentifier, 0) == 0) {
+        msleep(256);
       }
 
-      auto position = [logs positionWithDate: offset];
-      auto enumerator = [logs
-        entriesEnumeratorWithOptions: 0
-        position: position
-        predicate: predicate
-        error: &error
-      ];
+      msleep(1024);
 
-      if (error) {
-        appStatus = 1;
-        debug(
-          "ERROR: OSLogEnumerator: (code=%lu, domain=%@) %@",
-          error.code,
-          error.domain,
-          error.localizedDescription
-        );
-        break;
+      if (appStatus == -1) {
+        appStatus = 0;
       }
+    });
+  }
 
-      // Enumerate all the logs in this loop and print unredacted and most
-      // recently log entries to stdout
-      for (OSLogEntryLog* entry in enumerator) {
-        if (
-          entry.composedMessage &&
-          (processIdentifier == 0 || entry.processIdentifier == processIdentifier)
-        ) {
-          // visit latest log
-          if (!latest || [latest compare: entry.date] == NSOrderedAscending) {
-            auto message = entry.composedMessage.UTF8String;
-
-            // the OSLogStore may redact log messages the user does not
-            // have access to, filter them out
-            if (String(message) != "<private>") {
-              if (String(message).starts_with("__EXIT_SIGNAL__")) {
-                if (appStatus == -1) {
-                  appStatus = std::stoi(replace(String(message), "__EXIT_SIGNAL__=", ""));
-                }
-              } else if (
-                entry.level == OSLogEntryLogLevelDebug ||
-                entry.level == OSLogEntryLogLevelError ||
-                entry.level == OSLogEntryLogLevelFault
-              ) {
-                if (entry.level == OSLogEntryLogLevelDebug) {
-                  if (flagDebugMode) {
-                    std::cerr << message << std::endl;
-                  }
-                } else {
-                  std::cerr << message << std::endl;
-                }
-              } else {
-                std::cout << message << std::endl;
-              }
-            }
-
-            backoffIndex = 0;
-            latest = entry.date;
-            offset = latest;
-          }
-        }
-      }
-    }
+  while (appStatus < 0) {
+    msleep(64);
   }
 
+  msleep(256);
+  process.kill();
   appMutex.unlock();
 }
 #endif
@@ -506,6 +1284,8 @@ void handleBuildPhaseForUserScript (
   const Path& cwd,
   bool performAfterLifeCycle
 ) {
+  const auto profile = BuildProfiler::Scope("user script phase");
+
   do {
     char prefix[4096] = {0};
     std::memcpy(
@@ -599,8 +1379,18 @@ Vector<Path> handleBuildPhaseForCopyMappedFiles (
   const Path pathResourcesRelativeToUserBuild,
   bool includeBuildCopyFiles = true
 ) {
+  const auto profile = BuildProfiler::Scope("copy phase");
+
   Vector<Path> copyMapFiles;
 
+  // unchanged files are skipped via the content-hash manifest kept
+  // beside the resources directory; `prune()` below propagates source
+  // deletes to the output tree
+  BuildCache cache(
+    pathResourcesRelativeToUserBuild.parent_path() / ".ssc-copy-manifest",
+    targetPlatform + (flagDebugMode ? "-debug" : "-prod")
+  );
+
   if (includeBuildCopyFiles && settings.contains("build_copy")) {
     const Path pathInput = settings.contains("build_copy") && settings.at("build_copy").size() > 0
       ? settings.at("build_copy")
@@ -623,11 +1413,7 @@ Vector<Path> handleBuildPhaseForCopyMappedFiles (
         fs::create_directories(dst.parent_path());
       }
 
-      fs::copy(
-        src,
-        dst,
-        fs::copy_options::update_existing | fs::copy_options::recursive
-      );
+      cache.copy(src, dst);
     }
   }
 
@@ -677,11 +1463,7 @@ Vector<Path> handleBuildPhaseForCopyMappedFiles (
       }
     }
 
-    fs::copy(
-      src,
-      dst,
-      fs::copy_options::update_existing | fs::copy_options::recursive
-    );
+    cache.copy(src, dst);
   }
 
   // copy map file for all platforms
@@ -736,7 +1518,7 @@ Vector<Path> handleBuildPhaseForCopyMappedFiles (
     if (!fs::exists(fs::status(copyMapFile)) || !fs::is_regular_file(copyMapFile)) {
       log("WARNING: file specified in [build] copy_map does not exist");
     } else {
-      auto copyMap = INI::parse(tmpl(trim(readFile(copyMapFile)), settings));
+      auto copyMap = INI::parse(tmpl(trim(readCachedFile(copyMapFile)), settings));
       auto copyMapFileDirectory = fs::absolute(copyMapFile.parent_path());
 
       for (const auto& tuple : copyMap) {
@@ -821,15 +1603,20 @@ Vector<Path> handleBuildPhaseForCopyMappedFiles (
           }
         }
 
-        fs::copy(
-          src,
-          dst,
-          fs::copy_options::update_existing | fs::copy_options::recursive
-        );
+        cache.copy(src, dst);
       }
     }
   }
 
+  // partial runs (`includeBuildCopyFiles == false`) leave the
+  // `[build] copy` entries untouched, so only full runs may treat
+  // untouched entries as deleted sources
+  if (includeBuildCopyFiles) {
+    cache.prune();
+  }
+
+  cache.commit();
+
   return copyMapFiles;
 }
 
@@ -909,7 +1696,7 @@ void checkIosSimulatorDeviceAvailability (const String& device) {
     log("ERROR: [ios] simulator_device option is empty");
     exit(1);
   }
-  auto const rDevices = exec("xcrun simctl list devices available | grep -e \"  \"");
+  auto const rDevices = cachedDeviceProbe("simctl-devices", "xcrun simctl list devices available | grep -e \"  \"");
   auto isDeviceFound = rDevices.output.find(device) != String::npos;
 
   if (!isDeviceFound) {
@@ -1030,7 +1817,7 @@ int runApp (const Path& path, const String& args, bool headless) {
 
       appPid = app.processIdentifier;
 
-      pollOSLogStream(
+      streamOSLog(
         true,
         String(bundle.bundleIdentifier.UTF8String),
         app.processIdentifier
@@ -1097,7 +1884,19 @@ void runIOSSimulator (const Path& path, Map& settings) {
     << " simctl"
     << " list devicetypes";
 
-  auto rListDeviceTypes = exec(listDeviceTypesCommand.str().c_str());
+  // the available-devices probe below is needed on every success path -
+  // run it concurrently with the device type listing
+  StringStream listDevicesCommand;
+  listDevicesCommand
+    << "xcrun"
+    << " simctl"
+    << " list devices available";
+  auto rListDevicesFuture = std::async(std::launch::async, [&] {
+    return cachedDeviceProbe("simctl-devices", listDevicesCommand.str());
+  });
+
+  // device types only change with the installed SDK - cache them long
+  auto rListDeviceTypes = cachedDeviceProbe("simctl-devicetypes", listDeviceTypesCommand.str(), 3600);
   if (rListDeviceTypes.exitCode != 0) {
     log("failed to list device types using \"" + listDeviceTypesCommand.str() + "\"");
     if (rListDeviceTypes.output.size() > 0) {
@@ -1125,12 +1924,7 @@ void runIOSSimulator (const Path& path, Map& settings) {
     exit(rListDevices.exitCode);
   }
 
-  StringStream listDevicesCommand;
-  listDevicesCommand
-    << "xcrun"
-    << " simctl"
-    << " list devices available";
-  auto rListDevices = exec(listDevicesCommand.str().c_str());
+  auto rListDevices = rListDevicesFuture.get();
   if (rListDevices.exitCode != 0) {
     log("failed to list available devices using \"" + listDevicesCommand.str() + "\"");
     if (rListDevices.output.size() > 0) {
@@ -1164,7 +1958,7 @@ void runIOSSimulator (const Path& path, Map& settings) {
       << "xcrun"
       << " simctl"
       << " list runtimes available";
-    auto rListRuntimes = exec(listRuntimesCommand.str().c_str());
+    auto rListRuntimes = cachedDeviceProbe("simctl-runtimes", listRuntimesCommand.str(), 3600);
     if (rListRuntimes.exitCode != 0) {
       log("failed to list available runtimes using \"" + listRuntimesCommand.str() + "\"");
       if (rListRuntimes.output.size() > 0) {
@@ -1338,7 +2132,7 @@ bool getAdbPath (AndroidCliState &state) {
   // run adb from androidHome to prevent file lock issues in app build folder on windows
   auto cwd = fs::current_path();
   fs::current_path(state.androidHome);
-  auto deviceQuery = exec(state.adb.str() + " devices");
+  auto deviceQuery = cachedDeviceProbe("adb-devices", state.adb.str() + " devices");
   state.emulatorRunning = (deviceQuery.output.find("emulator") != SSC::String::npos);
   fs::current_path(cwd);
 
@@ -1931,6 +2725,13 @@ optionsAndEnv parseCommandLineOptions (
 }
 
 int main (const int argc, const char* argv[]) {
+  // buffer log output - `flushLog()` is the explicit flush point and
+  // runs on every `exit()` path via `atexit()`
+  static char logBuffer[65536];
+  std::cerr.unsetf(std::ios::unitbuf);
+  setvbuf(stderr, logBuffer, _IOFBF, sizeof(logBuffer));
+  atexit(flushLog);
+
   defaultTemplateAttrs = {
     { "ssc_version", SSC::VERSION_FULL_STRING },
     { "project_name", "beepboop" }
@@ -1940,6 +2741,30 @@ int main (const int argc, const char* argv[]) {
     exit(0);
   }
 
+  // `ssc dev` is the resident development loop: `build --run --watch`.
+  // the process stays alive, so parsed settings, memoized template and
+  // config reads, toolchain probe results and the build caches all stay
+  // warm between rebuilds and only invalidated phases rerun on change
+  if (equal(argv[1], "dev")) {
+    flagDevMode = true;
+    argv[1] = "build";
+  }
+
+  // detected before subcommand dispatch so spans recorded during
+  // settings parsing are captured too; the option itself is validated
+  // by the subcommand's option parser as usual
+  for (auto i = 2; i < argc; i++) {
+    if (equal(argv[i], "--profile")) {
+      flagProfileMode = true;
+    }
+
+    if (equal(argv[i], "--refresh-devices")) {
+      flagRefreshDevices = true;
+    }
+  }
+
+  atexit([] { BuildProfiler::instance().write(); });
+
   auto const subcommand = argv[1];
 
 #ifndef _WIN32
@@ -2154,9 +2979,35 @@ int main (const int argc, const char* argv[]) {
           code = String(
             "constexpr unsigned char __ssc_config_bytes["+ std::to_string(size) +"] = {\n" + bytes.str() + "\n};"
           );
+
+          // also emit the parsed key/value table so the runtime can build
+          // its user config map directly instead of re-parsing the INI
+          // bytes on startup - `std::map` keeps the keys sorted, so the
+          // generated table is sorted too
+          const auto parsed = INI::parse(ini);
+
+          if (parsed.size() > 0) {
+            auto table = StringStream();
+
+            for (const auto& entry : parsed) {
+              table
+                << "  { \"" << escapeStringLiteral(entry.first) << "\", \""
+                << escapeStringLiteral(entry.second) << "\" },\n";
+            }
+
+            code += String(
+              "\n#define SSC_CONFIG_TABLE 1\n"
+              "static constexpr const char* __ssc_config_table[][2] = {\n" +
+              table.str() +
+              "};"
+            );
+          }
         }
 
-        settings = INI::parse(ini);
+        do {
+          const auto profile = BuildProfiler::Scope("settings parse");
+          settings = INI::parse(ini);
+        } while (0);
 
         if (settings["meta_type"] == "extension" || settings["build_type"] == "extension") {
           auto extension = settings["build_name"];
@@ -2318,13 +3169,264 @@ int main (const int argc, const char* argv[]) {
     exit(0);
   });
 
+  // first flag indicating whether option is optional
+  // second flag indicating whether option should be followed by a value
+  Options benchOptions = {
+    { { "--files", "-f" }, true, true },
+    { { "--assets", "-a" }, true, true },
+    { { "--extension-units", "-e" }, true, true },
+    { { "--runs", "-r" }, true, true },
+    { { "--keep", "-k" }, true, false }
+  };
+  createSubcommand("bench", benchOptions, false, [&](Map optionsWithValue, std::unordered_set<String> optionsWithoutValue) -> void {
+    const auto files = optionsWithValue["--files"].size() > 0 ? std::stoi(optionsWithValue["--files"]) : 50;
+    const auto assets = optionsWithValue["--assets"].size() > 0 ? std::stoi(optionsWithValue["--assets"]) : 20;
+    const auto extensionUnits = optionsWithValue["--extension-units"].size() > 0 ? std::stoi(optionsWithValue["--extension-units"]) : 0;
+    const auto runs = optionsWithValue["--runs"].size() > 0 ? std::stoi(optionsWithValue["--runs"]) : 3;
+    const auto keepFixture = optionsWithoutValue.find("--keep") != optionsWithoutValue.end();
+
+    if (files < 1 || assets < 0 || extensionUnits < 0 || runs < 1) {
+      log("ERROR: bench sizes must not be negative (and at least one file and one run)");
+      exit(1);
+    }
+
+    // the fixture lives under the system temporary directory so repeated
+    // benchmarks never touch a real project; every generated file is
+    // deterministic, so two invocations with the same sizes build
+    // byte-identical input
+    const auto stamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::system_clock::now().time_since_epoch()
+    ).count();
+    const auto fixture = fs::temp_directory_path() / ("ssc-bench-" + std::to_string(stamp));
+
+    fs::create_directories(fixture / "src");
+
+    defaultTemplateAttrs["project_name"] = "ssc-bench-fixture";
+    writeFile(fixture / "socket.ini", tmpl(gDefaultConfig, defaultTemplateAttrs));
+    writeFile(fixture / "src" / "index.html", gHelloWorld);
+    fs::copy(trim(prefixFile("assets/icon.png")), fixture / "src" / "icon.png", fs::copy_options::overwrite_existing);
+
+    if (platform.win) {
+      fs::copy(trim(prefixFile("assets/icon.ico")), fixture / "src" / "icon.ico", fs::copy_options::overwrite_existing);
+    }
+
+    // enough distinct small scripts to exercise the copy and hashing
+    // paths the way a real project tree does
+    for (int i = 0; i < files; i++) {
+      auto source = StringStream();
+      source << "// generated by `ssc bench`\n";
+      source << "export const module" << i << " = {\n";
+      for (int j = 0; j < 32; j++) {
+        source << "  key" << j << ": 'value-" << i << "-" << j << "',\n";
+      }
+      source << "};\n";
+      writeFile(fixture / "src" / ("module-" + std::to_string(i) + ".js"), source.str());
+    }
+
+    // larger assets with deterministic pseudo-random printable contents
+    for (int i = 0; i < assets; i++) {
+      String bytes(16384, ' ');
+      uint32_t state = 0x9e3779b9u + (uint32_t) i;
+      for (auto& byte : bytes) {
+        state = state * 1664525u + 1013904223u;
+        byte = (char) (0x20 + ((state >> 24) % 0x5f));
+      }
+      writeFile(fixture / "src" / ("asset-" + std::to_string(i) + ".bin"), bytes);
+    }
+
+    // an optional native extension: unit 0 registers the extension and
+    // calls into the remaining units so nothing is dead code
+    if (extensionUnits > 0) {
+      fs::create_directories(fixture / "src" / "extension");
+      auto sources = StringStream();
+
+      for (int i = 0; i < extensionUnits; i++) {
+        auto unit = StringStream();
+
+        if (i == 0) {
+          unit << "#include <socket/extension.h>\n\n";
+          for (int j = 1; j < extensionUnits; j++) {
+            unit << "extern int benchUnit" << j << " (int value);\n";
+          }
+          unit << "\nstatic bool initialize (sapi_context_t* context, const void* data) {\n";
+          unit << "  int value = 0;\n";
+          for (int j = 1; j < extensionUnits; j++) {
+            unit << "  value += benchUnit" << j << "(value);\n";
+          }
+          unit << "  return value >= 0 || value < 0;\n";
+          unit << "}\n\n";
+          unit << "SOCKET_RUNTIME_REGISTER_EXTENSION(\n";
+          unit << "  \"bench\",\n";
+          unit << "  initialize\n";
+          unit << ");\n";
+        } else {
+          unit << "int benchUnit" << i << " (int value) {\n";
+          unit << "  for (int i = 0; i < " << (i * 31 + 7) << "; i++) {\n";
+          unit << "    value = value * 31 + i;\n";
+          unit << "  }\n";
+          unit << "  return value;\n";
+          unit << "}\n";
+        }
+
+        const auto name = "unit-" + std::to_string(i) + ".cc";
+        writeFile(fixture / "src" / "extension" / name, unit.str());
+        sources << "src/extension/" << name << (i + 1 < extensionUnits ? " " : "");
+      }
+
+      appendFile(fixture / "socket.ini", "\n[build.extensions]\nbench = " + sources.str() + "\n");
+    }
+
+    log("bench: fixture " + fixture.string());
+    log(
+      "bench: " + std::to_string(files) + " source file(s), " +
+      std::to_string(assets) + " asset(s), " +
+      std::to_string(extensionUnits) + " extension unit(s), " +
+      std::to_string(runs) + " run(s) per variant"
+    );
+
+    // the child build records per-phase spans through `--profile`; each
+    // run's trace is parsed back out of `ssc-build-trace.json`
+    const auto command =
+      "\"" + String(argv[0]) + "\" build --only-build --profile \"" +
+      fixture.string() + "\"";
+
+    auto cleanup = [&]() {
+      if (keepFixture) {
+        log("bench: fixture kept at " + fixture.string());
+      } else {
+        fs::remove_all(fixture);
+      }
+    };
+
+    auto runBuild = [&](const String& label, int run) -> int64_t {
+      const auto started = std::chrono::steady_clock::now();
+      const auto process = exec(command);
+      const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - started
+      ).count();
+
+      if (process.exitCode != 0) {
+        log(process.output);
+        log("ERROR: bench build failed (exit code " + std::to_string(process.exitCode) + ")");
+        cleanup();
+        exit(1);
+      }
+
+      log("bench: " + label + " " + std::to_string(run) + "/" + std::to_string(runs) + " - " + std::to_string(duration) + "ms");
+      return duration;
+    };
+
+    // spans are named "<phase> :: <detail>" - sum the details so each
+    // run contributes one value per phase
+    std::map<String, Vector<int64_t>> coldPhases;
+    std::map<String, Vector<int64_t>> warmPhases;
+    Vector<int64_t> coldTotals;
+    Vector<int64_t> warmTotals;
+
+    auto parseTrace = [&](std::map<String, Vector<int64_t>>& phases) {
+      const auto trace = readFile(fixture / "ssc-build-trace.json");
+      const std::regex pattern("\"name\": \"([^\"]*)\",[^\\n]*\"dur\": (\\d+)");
+      std::map<String, int64_t> totals;
+
+      for (
+        auto it = std::sregex_iterator(trace.begin(), trace.end(), pattern);
+        it != std::sregex_iterator();
+        ++it
+      ) {
+        const auto name = (*it)[1].str();
+        const auto separator = name.find(" :: ");
+        const auto phase = separator == String::npos ? name : name.substr(0, separator);
+        totals[phase] += std::stoll((*it)[2].str());
+      }
+
+      for (const auto& total : totals) {
+        phases[total.first].push_back(total.second);
+      }
+    };
+
+    for (int run = 0; run < runs; run++) {
+      fs::remove_all(fixture / "build");
+      coldTotals.push_back(runBuild("cold build", run + 1));
+      parseTrace(coldPhases);
+    }
+
+    for (int run = 0; run < runs; run++) {
+      warmTotals.push_back(runBuild("warm build", run + 1));
+      parseTrace(warmPhases);
+    }
+
+    struct Stats { double mean; double deviation; int64_t min; int64_t max; };
+    auto summarize = [](const Vector<int64_t>& values) -> Stats {
+      Stats stats { 0, 0, values[0], values[0] };
+
+      for (const auto value : values) {
+        stats.mean += (double) value;
+        stats.min = std::min(stats.min, value);
+        stats.max = std::max(stats.max, value);
+      }
+
+      stats.mean /= (double) values.size();
+
+      for (const auto value : values) {
+        stats.deviation += ((double) value - stats.mean) * ((double) value - stats.mean);
+      }
+
+      stats.deviation = std::sqrt(stats.deviation / (double) values.size());
+      return stats;
+    };
+
+    auto report = [&](
+      const String& label,
+      std::map<String, Vector<int64_t>>& phases,
+      const Vector<int64_t>& totals
+    ) {
+      log("bench: " + label + " phases (mean +/- stddev, min..max, over " + std::to_string(runs) + " run(s))");
+
+      Vector<std::pair<String, Stats>> sorted;
+      for (const auto& phase : phases) {
+        sorted.push_back({ phase.first, summarize(phase.second) });
+      }
+
+      std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+        return a.second.mean > b.second.mean;
+      });
+
+      for (const auto& entry : sorted) {
+        const auto& stats = entry.second;
+        log(
+          "bench:   " + entry.first + " - " +
+          std::to_string((int64_t) (stats.mean / 1000)) + "ms +/- " +
+          std::to_string((int64_t) (stats.deviation / 1000)) + "ms (" +
+          std::to_string(stats.min / 1000) + ".." +
+          std::to_string(stats.max / 1000) + "ms)"
+        );
+      }
+
+      const auto wall = summarize(totals);
+      log(
+        "bench: " + label + " total - " +
+        std::to_string((int64_t) wall.mean) + "ms +/- " +
+        std::to_string((int64_t) wall.deviation) + "ms (" +
+        std::to_string(wall.min) + ".." +
+        std::to_string(wall.max) + "ms)"
+      );
+    };
+
+    report("cold", coldPhases, coldTotals);
+    report("warm", warmPhases, warmTotals);
+
+    cleanup();
+    exit(0);
+  });
+
   // first flag indicating whether option is optional
   // second flag indicating whether option should be followed by a value
   Options listDevicesOptions = {
     { { "--platform" }, false, true },
     { { "--ecid" }, true, false },
     { { "--udid" }, true, false },
-    { { "--only" }, true, false }
+    { { "--only" }, true, false },
+    { { "--refresh-devices" }, true, false }
   };
   createSubcommand("list-devices", listDevicesOptions, false, [&](Map optionsWithValue, std::unordered_set<String> optionsWithoutValue) -> void {
     bool isUdid =
@@ -2401,7 +3503,7 @@ int main (const int argc, const char* argv[]) {
         adb << androidHome << "\\platform-tools\\";
       }
 
-      auto r = exec(adb.str() + "adb devices | tail -n +2");
+      auto r = cachedDeviceProbe("adb-devices", adb.str() + "adb devices | tail -n +2", 10);
       std::regex re(R"((.*)\s*device)");
       std::smatch matches;
 
@@ -2675,7 +3777,8 @@ int main (const int argc, const char* argv[]) {
     { { "--verbose", "-V" }, true, false },
     { { "--env", "-E" }, true, true },
     { { "--port" }, true, true },
-    { { "--host"}, true, true }
+    { { "--host"}, true, true },
+    { { "--refresh-devices" }, true, false }
   };
 
   Options buildOptions = {
@@ -2686,7 +3789,9 @@ int main (const int argc, const char* argv[]) {
     { { "--package", "-p" }, true, false },
     { { "--package-format", "-f" }, true, true },
     { { "--codesign", "-c" }, true, false },
-    { { "--notarize", "-n" }, true, false }
+    { { "--notarize", "-n" }, true, false },
+    { { "--jobs", "-j" }, true, true },
+    { { "--profile" }, true, false }
   };
 
   // Insert the elements of runOptions into buildOptions
@@ -2716,7 +3821,7 @@ int main (const int argc, const char* argv[]) {
     bool flagCodeSign = optionsWithoutValue.find("--codesign") != optionsWithoutValue.end() || equal(rc["build_codesign"], "true");
     bool flagBuildHeadless = settings["build_headless"] == "true";
     bool flagRunHeadless = optionsWithoutValue.find("--headless") != optionsWithoutValue.end();
-    bool flagShouldRun = optionsWithoutValue.find("--run") != optionsWithoutValue.end() || equal(rc["build_run"], "true");
+    bool flagShouldRun = optionsWithoutValue.find("--run") != optionsWithoutValue.end() || equal(rc["build_run"], "true") || flagDevMode;
     bool flagShouldNotarize = optionsWithoutValue.find("--notarize") != optionsWithoutValue.end() || equal(rc["build_notarize"], "true");
     bool flagShouldPackage = optionsWithoutValue.find("--package") != optionsWithoutValue.end() || equal(rc["build_package"], "true");
     bool flagBuildForIOS = false;
@@ -2724,13 +3829,17 @@ int main (const int argc, const char* argv[]) {
     bool flagBuildForAndroidEmulator = false;
     bool flagBuildForSimulator = false;
     bool flagBuildTest = optionsWithoutValue.find("--test") != optionsWithoutValue.end() || optionsWithValue["--test"].size() > 0;
-    bool flagShouldWatch = optionsWithoutValue.find("--watch") != optionsWithoutValue.end() || equal(rc["build_watch"], "true");
+    bool flagShouldWatch = optionsWithoutValue.find("--watch") != optionsWithoutValue.end() || equal(rc["build_watch"], "true") || flagDevMode;
     String testFile = optionsWithValue["--test"];
 
     if (optionsWithValue["--package-format"].size() > 0) {
       flagShouldPackage = true;
     }
 
+    if (optionsWithValue["--jobs"].size() > 0) {
+      flagBuildJobs = std::stoi(optionsWithValue["--jobs"]);
+    }
+
     if (flagBuildTest && testFile.size() == 0) {
       log("ERROR: --test value is required.");
       exit(1);
@@ -3552,7 +4661,7 @@ int main (const int argc, const char* argv[]) {
 
             if (fs::exists(target)) {
               auto configFile = target / "socket.ini";
-              auto config = INI::parse(fs::exists(configFile) ? readFile(configFile) : "");
+              auto config = INI::parse(fs::exists(configFile) ? readCachedFile(configFile) : "");
               settings["build_extensions_" + extension + "_path"] = target.string();
 
               for (const auto& entry : config) {
@@ -3953,7 +5062,7 @@ int main (const int argc, const char* argv[]) {
       writeFile(
         jni  / "android" / "internal.hh",
         std::regex_replace(
-          convertWStringToString(readFile(trim(prefixFile("src/android/internal.hh")))),
+          convertWStringToString(readCachedFile(trim(prefixFile("src/android/internal.hh")))),
           std::regex("__BUNDLE_IDENTIFIER__"),
           bundle_path_underscored
         )
@@ -3962,7 +5071,7 @@ int main (const int argc, const char* argv[]) {
       writeFile(
         pkg / "bridge.kt",
         std::regex_replace(
-          convertWStringToString(readFile(trim(prefixFile("src/android/bridge.kt")))),
+          convertWStringToString(readCachedFile(trim(prefixFile("src/android/bridge.kt")))),
           std::regex("__BUNDLE_IDENTIFIER__"),
           settings["android_bundle_identifier"]
         )
@@ -3971,7 +5080,7 @@ int main (const int argc, const char* argv[]) {
       writeFile(
         pkg / "main.kt",
         std::regex_replace(
-          convertWStringToString(readFile(trim(prefixFile("src/android/main.kt")))),
+          convertWStringToString(readCachedFile(trim(prefixFile("src/android/main.kt")))),
           std::regex("__BUNDLE_IDENTIFIER__"),
           settings["android_bundle_identifier"]
         )
@@ -3980,7 +5089,7 @@ int main (const int argc, const char* argv[]) {
       writeFile(
         pkg / "runtime.kt",
         std::regex_replace(
-          convertWStringToString(readFile(trim(prefixFile("src/android/runtime.kt")))),
+          convertWStringToString(readCachedFile(trim(prefixFile("src/android/runtime.kt")))),
           std::regex("__BUNDLE_IDENTIFIER__"),
           settings["android_bundle_identifier"]
         )
@@ -3989,7 +5098,7 @@ int main (const int argc, const char* argv[]) {
       writeFile(
         pkg / "window.kt",
         std::regex_replace(
-          convertWStringToString(readFile(trim(prefixFile("src/android/window.kt")))),
+          convertWStringToString(readCachedFile(trim(prefixFile("src/android/window.kt")))),
           std::regex("__BUNDLE_IDENTIFIER__"),
           settings["android_bundle_identifier"]
         )
@@ -3998,7 +5107,7 @@ int main (const int argc, const char* argv[]) {
       writeFile(
         pkg / "webview.kt",
         std::regex_replace(
-          convertWStringToString(readFile(trim(prefixFile("src/android/webview.kt")))),
+          convertWStringToString(readCachedFile(trim(prefixFile("src/android/webview.kt")))),
           std::regex("__BUNDLE_IDENTIFIER__"),
           settings["android_bundle_identifier"]
         )
@@ -4211,7 +5320,7 @@ int main (const int argc, const char* argv[]) {
 
             if (fs::exists(target)) {
               auto configFile = target / "socket.ini";
-              auto config = INI::parse(fs::exists(configFile) ? readFile(configFile) : "");
+              auto config = INI::parse(fs::exists(configFile) ? readCachedFile(configFile) : "");
               settings["build_extensions_" + extension + "_path"] = target.string();
 
               for (const auto& entry : config) {
@@ -4292,6 +5401,9 @@ int main (const int argc, const char* argv[]) {
           auto CXX = Env::get("CXX");
           auto CC = Env::get("CC");
 
+          BuildJobScheduler scheduler;
+          BuildCache cache(paths.platformSpecificOutputPath / ".ssc-compile-manifest");
+
           for (auto source : sources) {
             if (Env::get("DEBUG") == "1" || Env::get("VERBOSE") == "1") {
               log("extension source: " + source);
@@ -4395,21 +5507,31 @@ int main (const int argc, const char* argv[]) {
               << " -o " << object.string()
             ;
 
+            // the input hash covers the source content and the full
+            // command line, so flag changes recompile too
+            const auto inputHash = BuildCache::hashBytes(
+              compileExtensionObjectCommand.str(),
+              BuildCache::hashFile(source)
+            );
+
+            if (cache.isFresh(object, inputHash)) {
+              continue;
+            }
+
             if (Env::get("DEBUG") == "1" || Env::get("VERBOSE") == "1") {
               log(compileExtensionObjectCommand.str());
             }
 
-            do {
-              auto r = exec(compileExtensionObjectCommand.str());
-
-              if (r.exitCode != 0) {
-                log("Unable to build extension object (" + object.string() + ")");
-                log(r.output);
-                exit(r.exitCode);
-              }
-            } while (0);
+            scheduler.push(
+              compileExtensionObjectCommand.str(),
+              "Unable to build extension object (" + object.string() + ")",
+              object.filename().string()
+            );
           }
 
+          scheduler.wait();
+          cache.commit();
+
           if (target == "wasm32") {
             String compiler;
             auto compilerFlags = (
@@ -5068,7 +6190,7 @@ int main (const int argc, const char* argv[]) {
       }
 
       // log(archiveCommand.str().c_str());
-      auto rArchive = exec(archiveCommand.str().c_str());
+      auto rArchive = profiledExec("packaging :: xcodebuild archive", archiveCommand.str().c_str());
 
       if (rArchive.exitCode != 0) {
         log("ERROR: failed to archive project");
@@ -5432,7 +6554,7 @@ int main (const int argc, const char* argv[]) {
               target = fs::canonical(target);
 
               auto configFile = target / "socket.ini";
-              auto config = INI::parse(fs::exists(configFile) ? readFile(configFile) : "");
+              auto config = INI::parse(fs::exists(configFile) ? readCachedFile(configFile) : "");
               settings["build_extensions_" + extension + "_path"] = target.string();
               fs::current_path(target);
 
@@ -5600,6 +6722,9 @@ int main (const int argc, const char* argv[]) {
           auto CXX = Env::get("CXX");
           auto CC = Env::get("CC");
 
+          BuildJobScheduler scheduler;
+          BuildCache cache(paths.platformSpecificOutputPath / ".ssc-compile-manifest");
+
           for (auto source : sources) {
             if (Env::get("DEBUG") == "1" || Env::get("VERBOSE") == "1") {
               log("extension source: " + source);
@@ -5751,43 +6876,31 @@ int main (const int argc, const char* argv[]) {
               << quote
             ;
 
-            struct stat sourceStats;
-            struct stat objectStats;
-            struct stat libraryStats;
-
-            if (fs::exists(object)) {
-              if (stat(convertWStringToString(source).c_str(), &sourceStats) == 0) {
-                if (stat(convertWStringToString(object).c_str(), &objectStats) == 0) {
-                  if (objectStats.st_mtime > sourceStats.st_mtime) {
-                    continue;
-                  }
-                }
-              }
+            // the input hash covers the source content and the full
+            // command line, so flag changes recompile too
+            const auto inputHash = BuildCache::hashBytes(
+              compileExtensionObjectCommand.str(),
+              BuildCache::hashFile(source)
+            );
 
-              if (stat(convertWStringToString(source).c_str(), &sourceStats) == 0) {
-                if (stat(convertWStringToString(lib).c_str(), &libraryStats) == 0) {
-                  if (libraryStats.st_mtime > sourceStats.st_mtime) {
-                    continue;
-                  }
-                }
-              }
+            if (cache.isFresh(object, inputHash)) {
+              continue;
             }
 
             if (Env::get("DEBUG") == "1" || Env::get("VERBOSE") == "1") {
               log(compileExtensionObjectCommand.str());
             }
 
-            do {
-              auto r = exec(compileExtensionObjectCommand.str());
-
-              if (r.exitCode != 0) {
-                log("Unable to build extension object (" + object.string() + ")");
-                log(r.output);
-                exit(r.exitCode);
-              }
-            } while (0);
+            scheduler.push(
+              compileExtensionObjectCommand.str(),
+              "Unable to build extension object (" + object.string() + ")",
+              object.filename().string()
+            );
           }
 
+          scheduler.wait();
+          cache.commit();
+
           if (target == "wasm32") {
             String compiler;
             auto compilerFlags = (
@@ -6092,7 +7205,7 @@ int main (const int argc, const char* argv[]) {
           log(archiveCommand.str());
         }
 
-        auto r = exec(archiveCommand.str());
+        auto r = profiledExec("packaging :: deb", archiveCommand.str());
 
         if (r.exitCode != 0) {
           log("ERROR: Build packaging failed for Linux");
@@ -6114,7 +7227,7 @@ int main (const int argc, const char* argv[]) {
           log(zipCommand.str());
         }
 
-        auto r = exec(zipCommand.str());
+        auto r = profiledExec("packaging :: zip", zipCommand.str());
 
         if (r.exitCode != 0) {
           log("ERROR: Build packaging failed for Linux");
@@ -6344,7 +7457,7 @@ int main (const int argc, const char* argv[]) {
         log(signCommand.str());
       }
 
-      auto r = exec(signCommand.str());
+      auto r = profiledExec("signing :: codesign", signCommand.str());
 
       if (r.output.size() > 0) {
         if (r.exitCode != 0) {
@@ -6405,7 +7518,7 @@ int main (const int argc, const char* argv[]) {
           << " "
           << pathToArchive.string();
 
-        auto r = exec(zipCommand.str());
+        auto r = profiledExec("packaging :: zip", zipCommand.str());
 
         if (r.exitCode != 0) {
           log("ERROR: Build packaging fails for macOS");
@@ -6442,7 +7555,7 @@ int main (const int argc, const char* argv[]) {
           log(productBuildCommand.str());
         }
 
-        auto r = exec(productBuildCommand.str());
+        auto r = profiledExec("packaging :: productbuild", productBuildCommand.str());
 
         if (r.exitCode != 0) {
           log("ERROR: Failed to package macOS application with 'productbuild'");
@@ -6876,7 +7989,7 @@ int main (const int argc, const char* argv[]) {
         << "\"";
 
       log(signCommand.str());
-      auto r = exec(signCommand.str().c_str());
+      auto r = profiledExec("signing :: signtool", signCommand.str().c_str());
 
       if (r.exitCode != 0) {
         log("Unable to sign");
@@ -6938,7 +8051,7 @@ int main (const int argc, const char* argv[]) {
 
         extendMap(
           settingsForSourcesWatcher,
-          INI::parse(readFile(targetPath / "socket.ini"))
+          INI::parse(readCachedFile(targetPath / "socket.ini"))
         );
 
         handleBuildPhaseForUserScript(
@@ -7073,6 +8186,101 @@ int main (const int argc, const char* argv[]) {
 
   // first flag indicating whether option is optional
   // second flag indicating whether option should be followed by a value
+  Options fetchOptions = {
+    { { "--url" }, true, true },
+    { { "--sha256" }, true, true },
+    { { "--manifest" }, true, true },
+    { { "--fetch-version" }, true, true },
+    { { "--concurrency" }, true, true },
+    { { "--quiet", "-q" }, true, false },
+    { { "--debug", "-D" }, true, false },
+    { { "--verbose", "-V" }, true, false },
+  };
+  createSubcommand("fetch", fetchOptions, false, [&](Map optionsWithValue, std::unordered_set<String> optionsWithoutValue) -> void {
+    if (optionsWithoutValue.find("--quiet") != optionsWithoutValue.end()) {
+      flagQuietMode = true;
+    }
+
+    auto concurrency = 4;
+
+    if (optionsWithValue["--concurrency"].size() > 0) {
+      try {
+        concurrency = std::max(1, std::stoi(optionsWithValue["--concurrency"]));
+      } catch (...) {
+        log("ERROR: invalid --concurrency value");
+        exit(1);
+      }
+    }
+
+    Vector<FetchSpec> specs;
+
+    if (optionsWithValue["--manifest"].size() > 0) {
+      auto manifest = Path(optionsWithValue["--manifest"]);
+
+      if (!fs::exists(manifest)) {
+        log("ERROR: manifest not found: '" + manifest.string() + "'");
+        exit(1);
+      }
+
+      // one entry per line: `<url> [sha256] [version] [filename]`,
+      // `-` skips a field, `#` starts a comment
+      for (const auto& line : split(replace(readFile(manifest), "\r\n", "\n"), '\n')) {
+        auto entry = trim(line);
+
+        if (entry.size() == 0 || entry.starts_with("#")) {
+          continue;
+        }
+
+        Vector<String> fields;
+        for (const auto& field : split(entry, ' ')) {
+          if (trim(field).size() > 0) {
+            fields.push_back(trim(field));
+          }
+        }
+
+        FetchSpec spec;
+        spec.url = fields[0];
+        if (fields.size() > 1 && fields[1] != "-") spec.sha256 = fields[1];
+        if (fields.size() > 2 && fields[2] != "-") spec.version = fields[2];
+        if (fields.size() > 3) spec.filename = fields[3];
+        specs.push_back(spec);
+      }
+    } else if (optionsWithValue["--url"].size() > 0) {
+      FetchSpec spec;
+      spec.url = optionsWithValue["--url"];
+      spec.sha256 = optionsWithValue["--sha256"];
+
+      if (optionsWithValue["--fetch-version"].size() > 0) {
+        spec.version = optionsWithValue["--fetch-version"];
+      }
+
+      specs.push_back(spec);
+    } else {
+      printHelp("fetch");
+      exit(1);
+    }
+
+    const auto results = fetchArtifacts(specs, concurrency);
+    auto failures = 0;
+
+    for (size_t i = 0; i < results.size(); i++) {
+      if (results[i].size() == 0) {
+        failures++;
+        continue;
+      }
+
+      // cached paths go to stdout so scripts can consume them
+      std::cout << results[i] << std::endl;
+    }
+
+    if (failures > 0) {
+      log("ERROR: " + std::to_string(failures) + " of " + std::to_string(results.size()) + " downloads failed");
+      exit(1);
+    }
+
+    exit(0);
+  });
+
   Options setupOptions = {
     { { "--platform" }, true, true },
     { { "--yes", "-y" }, true, false },
@@ -7169,6 +8377,17 @@ int main (const int argc, const char* argv[]) {
     }
 
     log("Running setup for platform '" + targetPlatform + "' in " + "SOCKET_HOME (" + prefixFile() + ")");
+
+    // hand the install scripts the shared download cache so re-running
+    // setup after a failure resumes instead of starting from zero
+    if (Env::get("SSC_FETCH_CACHE").size() == 0) {
+      #ifdef _WIN32
+      Env::set((String("SSC_FETCH_CACHE=") + fetchCacheDirectory()).c_str());
+      #else
+      setenv("SSC_FETCH_CACHE", fetchCacheDirectory().c_str(), 1);
+      #endif
+    }
+
     String command = scriptHost + " \"" + script.string() + "\" " + argument + " " + yesArg;
     auto r = std::system(command.c_str());
 
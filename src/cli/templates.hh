@@ -9,13 +9,16 @@ usage:
   ssc [SUBCOMMAND] -h
 
 subcommands:
+  bench                                benchmark the build pipeline against a generated project
   build                                build project
+  dev                                  build, run and watch the project, rebuilding on change
   list-devices                         get the list of connected devices
   init                                 create a new project (in the current directory)
   install-app                          install app to the device
   print-build-dir                      print build path to stdout
   run                                  run application
   env                                  print relavent environment variables
+  fetch                                download build artifacts into a shared cache
   setup                                install build dependencies
 
 general options:
@@ -45,10 +48,13 @@ options:
   --prod                               build for production (disables debugging info, inspector, etc.)
   -D, --debug                          enable debug mode
   -E, --env                            add environment variables
+  -j, --jobs=<count>                   number of concurrent compile jobs (defaults to hardware concurrency)
   -o, --only-build                     only run build step,
   -p, --package                        package the app for distribution
+  --profile                            record phase timings and write a chrome://tracing trace
   -q, --quiet                          hint for less log output
   -r, --run                            run after building
+  --refresh-devices                    bypass the cached device and simulator discovery results
   -V, --verbose                        enable verbose output
   -w, --watch                          watch for changes to rerun build step
 
@@ -73,6 +79,32 @@ Windows options:
                                          - appx (default)
 )TEXT";
 
+constexpr auto gHelpTextBench = R"TEXT(
+ssc v{{ssc_version}}
+
+Benchmark the build pipeline against a generated fixture project.
+
+Generates a throwaway project of configurable size under the system
+temporary directory and builds it repeatedly with `--profile` enabled,
+then reports per-phase timings with mean, spread and extremes across
+the runs. The first set of runs is cold (the output directory is
+removed between builds); the second set reuses the output directory so
+cached and incremental paths are measured too. The generated contents
+are deterministic, so two invocations with the same sizes benchmark
+byte-identical input.
+
+usage:
+  ssc bench [options]
+
+options:
+  --files=<n>                          number of generated source files (default: 50)
+  --assets=<n>                         number of generated binary assets (default: 20)
+  --extension-units=<n>                translation units in a generated native extension
+                                       (default: 0; building them requires the host toolchain)
+  --runs=<n>                           builds per variant (default: 3)
+  --keep                               keep the generated fixture project
+)TEXT";
+
 constexpr auto gHelpTextRun = R"TEXT(
 ssc v{{ssc_version}}
 
@@ -91,6 +123,7 @@ options:
   --port=<port>                        load "index.html" from a specific port (if host is not specified, defaults to localhost)
   --host=<host>                        load "index.html" from a specific host (if port is not specified, defaults to 80)
   --prod                               build for production (disables debugging info, inspector, etc.)
+  --refresh-devices                    bypass the cached device and simulator discovery results
   --test[=path]                        indicate test mode, optionally importing a test file relative to resource files
   -D, --debug                          enable debug mode
   -E, --env                            add environment variables
@@ -112,6 +145,7 @@ options:
   --ecid                               show device ECID (ios only)
   --udid                               show device UDID (ios only)
   --only                               only show ECID or UDID of the first device (ios only)
+  --refresh-devices                    bypass the cached device discovery results
 )TEXT";
 
 constexpr auto gHelpTextInit = R"TEXT(
@@ -187,6 +221,33 @@ options:
 
 )TEXT";
 
+constexpr auto gHelpTextFetch = R"TEXT(
+ssc v{{ssc_version}}
+
+Download build artifacts into a shared on-disk cache.
+
+Downloads run concurrently with resume support: an interrupted transfer
+continues where it left off on the next run, and a file already in the
+cache with a matching sha256 is never fetched again. The cache lives in
+SOCKET_HOME/cache (override with SSC_FETCH_CACHE) and can be shared
+between machines, so a fleet of CI agents behind one cache directory
+populates once. Cached paths are printed to stdout, one per line.
+
+usage:
+  ssc fetch --url=<url> [--sha256=<hash>] [--fetch-version=<key>]
+  ssc fetch --manifest=<file> [--concurrency=<n>]
+
+options:
+  --url=<url>                          url of a single artifact to download
+  --sha256=<hash>                      expected sha256 of the artifact
+  --fetch-version=<key>                cache key, usually the component version (default: default)
+  --manifest=<file>                    file with one `<url> [sha256] [version] [filename]` entry
+                                       per line; `-` skips a field, `#` starts a comment
+  --concurrency=<n>                    maximum downloads in flight (default: 4)
+  -q, --quiet                          hint for less log output
+
+)TEXT";
+
 // Validate CSP using Google's CSP Evaluator
 // https://csp-evaluator.withgoogle.com
 constexpr auto gHelloWorld = R"HTML(
@@ -1971,6 +2032,11 @@ width = 50%
 ; default value: false
 ; utility = false
 
+; If a hidden pre-initialized window should be kept warm so 'window.create'
+; hands out a ready webview instead of paying webview startup on demand.
+; default value: false
+; prewarm = false
+
 
 [window.alert]
 ; The title that appears in the 'alert', 'prompt', and 'confirm' dialogs. If this value is not present, then the application title is used instead. Currently only supported on iOS/macOS.
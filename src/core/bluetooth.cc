@@ -361,31 +361,18 @@ using namespace SSC;
   }
 
   auto bytes = (char*) characteristic.value.bytes;
-  auto length = (int) characteristic.value.length;
-  auto headers = Headers {{
-    {"content-type", "application/octet-stream"},
-    {"content-length", length}
-  }};
-
-  Post post = {0};
-  post.id = rand64();
-  post.body = bytes;
-  post.length = length;
-  post.headers = headers.str();
-
-  auto json = JSON::Object::Entries {
-    {"data", JSON::Object::Entries {
-      {"event", "data"},
-      {"source", "bluetooth"},
-      {"characteristicId", characteristicId},
-      {"serviceId", sid},
-      {"name", name},
-      {"uuid", uuid}
-    }}
-  };
-
-  auto result = SSC::IPC::Result(json);
-  self.bluetooth->send(result.seq, result.json(), post);
+  auto length = (size_t) characteristic.value.length;
+
+  // copies out of the CoreBluetooth owned value; delivery is coalesced
+  // per peripheral into a single post per flush interval
+  self.bluetooth->enqueueCharacteristicValue(
+    uuid,
+    name,
+    sid,
+    characteristicId,
+    bytes,
+    length
+  );
 }
 
 -                          (void) peripheral: (CBPeripheral*) peripheral
@@ -462,6 +449,96 @@ namespace SSC {
     return false;
   }
 
+  void Bluetooth::enqueueCharacteristicValue (
+    const String& uuid,
+    const String& name,
+    const String& serviceId,
+    const String& characteristicId,
+    const char* bytes,
+    size_t size
+  ) {
+    bool shouldSchedule = false;
+
+    do {
+      Lock lock(this->batchMutex);
+      auto& batch = this->characteristicBatches[uuid];
+      batch.uuid = uuid;
+      batch.name = name;
+      batch.entries.push_back(CharacteristicBatch::Entry {
+        characteristicId,
+        serviceId,
+        batch.body.size(),
+        size
+      });
+      batch.body.insert(batch.body.end(), bytes, bytes + size);
+      shouldSchedule = !this->isBatchFlushScheduled.exchange(true);
+    } while (0);
+
+    if (!shouldSchedule) {
+      return;
+    }
+
+    // everything that lands inside one interval goes out as one
+    // delivery per peripheral; without a core there is no timer to
+    // defer on, so flush inline
+    if (this->core != nullptr) {
+      this->core->setTimeout(CHARACTERISTIC_BATCH_INTERVAL, [this]() {
+        this->flushCharacteristicBatches();
+      });
+    } else {
+      this->flushCharacteristicBatches();
+    }
+  }
+
+  void Bluetooth::flushCharacteristicBatches () {
+    std::map<String, CharacteristicBatch> batches;
+
+    do {
+      Lock lock(this->batchMutex);
+      batches = std::move(this->characteristicBatches);
+      this->characteristicBatches.clear();
+      this->isBatchFlushScheduled = false;
+    } while (0);
+
+    for (auto& tuple : batches) {
+      auto& batch = tuple.second;
+      auto headers = Headers {{
+        {"content-type", "application/octet-stream"},
+        {"content-length", (int) batch.body.size()}
+      }};
+
+      Post post = {0};
+      post.id = rand64();
+      post.body = BufferPool::instance()->acquire(batch.body.size());
+      post.length = (int) batch.body.size();
+      post.headers = headers;
+      memcpy(post.body.get(), batch.body.data(), batch.body.size());
+
+      JSON::Array::Entries entries;
+      for (const auto& entry : batch.entries) {
+        entries.push_back(JSON::Object::Entries {
+          {"characteristicId", entry.characteristicId},
+          {"serviceId", entry.serviceId},
+          {"offset", (int) entry.offset},
+          {"length", (int) entry.length}
+        });
+      }
+
+      auto json = JSON::Object::Entries {
+        {"data", JSON::Object::Entries {
+          {"event", "data"},
+          {"source", "bluetooth"},
+          {"name", batch.name},
+          {"uuid", batch.uuid},
+          {"batch", entries}
+        }}
+      };
+
+      auto result = SSC::IPC::Result(json);
+      this->send(result.seq, result.json(), post);
+    }
+  }
+
   void Bluetooth::startScanning () {
     #if defined(__APPLE__)
     if (this->controller == nullptr) {
@@ -0,0 +1,234 @@
+#include "checksum.hh"
+#include <string.h>
+
+#if defined(__SSE4_2__) || (defined(_M_X64) && !defined(_M_ARM64EC))
+#define SSC_CHECKSUM_SSE42 1
+#include <nmmintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+#define SSC_CHECKSUM_ARM_CRC32 1
+#include <arm_acle.h>
+#endif
+
+namespace SSC {
+  static String toHex (const uint8_t* bytes, size_t size) {
+    static const char table[] = "0123456789abcdef";
+    String result;
+    result.reserve(size * 2);
+
+    for (size_t i = 0; i < size; i++) {
+      result += table[bytes[i] >> 4];
+      result += table[bytes[i] & 0x0F];
+    }
+
+    return result;
+  }
+
+#if !defined(SSC_CHECKSUM_SSE42) && !defined(SSC_CHECKSUM_ARM_CRC32)
+  // reflected Castagnoli table, generated once per process
+  static const uint32_t* crc32cTable () {
+    static uint32_t table[256] = {0};
+    static bool generated = false;
+
+    if (!generated) {
+      for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int j = 0; j < 8; j++) {
+          crc = (crc >> 1) ^ (0x82F63B78u & (~(crc & 1) + 1));
+        }
+        table[i] = crc;
+      }
+      generated = true;
+    }
+
+    return table;
+  }
+#endif
+
+  void CRC32C::update (const char* bytes, size_t size) {
+    auto data = reinterpret_cast<const uint8_t*>(bytes);
+    auto crc = this->state;
+
+  #if defined(SSC_CHECKSUM_SSE42)
+    uint64_t wide = crc;
+    while (size >= 8) {
+      uint64_t chunk;
+      memcpy(&chunk, data, 8);
+      wide = _mm_crc32_u64(wide, chunk);
+      data += 8;
+      size -= 8;
+    }
+    crc = (uint32_t) wide;
+    while (size > 0) {
+      crc = _mm_crc32_u8(crc, *data++);
+      size--;
+    }
+  #elif defined(SSC_CHECKSUM_ARM_CRC32)
+    while (size >= 8) {
+      uint64_t chunk;
+      memcpy(&chunk, data, 8);
+      crc = __crc32cd(crc, chunk);
+      data += 8;
+      size -= 8;
+    }
+    while (size > 0) {
+      crc = __crc32cb(crc, *data++);
+      size--;
+    }
+  #else
+    auto table = crc32cTable();
+    while (size > 0) {
+      crc = (crc >> 8) ^ table[(crc ^ *data++) & 0xFF];
+      size--;
+    }
+  #endif
+
+    this->state = crc;
+  }
+
+  String CRC32C::digest () const {
+    const auto value = this->state ^ 0xFFFFFFFFu;
+    const uint8_t bytes[4] = {
+      (uint8_t) (value >> 24),
+      (uint8_t) (value >> 16),
+      (uint8_t) (value >> 8),
+      (uint8_t) value
+    };
+
+    return toHex(bytes, sizeof(bytes));
+  }
+
+  static const uint32_t SHA256_K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+  };
+
+  static inline uint32_t rotr (uint32_t value, int bits) {
+    return (value >> bits) | (value << (32 - bits));
+  }
+
+  static void sha256Transform (uint32_t state[8], const uint8_t block[64]) {
+    uint32_t w[64];
+
+    for (int i = 0; i < 16; i++) {
+      w[i] = (uint32_t) block[i * 4] << 24
+        | (uint32_t) block[i * 4 + 1] << 16
+        | (uint32_t) block[i * 4 + 2] << 8
+        | (uint32_t) block[i * 4 + 3];
+    }
+
+    for (int i = 16; i < 64; i++) {
+      const auto s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+      const auto s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+      w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    auto a = state[0];
+    auto b = state[1];
+    auto c = state[2];
+    auto d = state[3];
+    auto e = state[4];
+    auto f = state[5];
+    auto g = state[6];
+    auto h = state[7];
+
+    for (int i = 0; i < 64; i++) {
+      const auto s1 = rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25);
+      const auto ch = (e & f) ^ (~e & g);
+      const auto temp1 = h + s1 + ch + SHA256_K[i] + w[i];
+      const auto s0 = rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22);
+      const auto maj = (a & b) ^ (a & c) ^ (b & c);
+      const auto temp2 = s0 + maj;
+
+      h = g;
+      g = f;
+      f = e;
+      e = d + temp1;
+      d = c;
+      c = b;
+      b = a;
+      a = temp1 + temp2;
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+  }
+
+  void SHA256::update (const char* bytes, size_t size) {
+    auto data = reinterpret_cast<const uint8_t*>(bytes);
+    auto buffered = (size_t) (this->length % 64);
+
+    this->length += size;
+
+    if (buffered > 0) {
+      const auto take = size < 64 - buffered ? size : 64 - buffered;
+      memcpy(this->block + buffered, data, take);
+      data += take;
+      size -= take;
+
+      if (buffered + take < 64) {
+        return;
+      }
+
+      sha256Transform(this->state, this->block);
+    }
+
+    while (size >= 64) {
+      sha256Transform(this->state, data);
+      data += 64;
+      size -= 64;
+    }
+
+    if (size > 0) {
+      memcpy(this->block, data, size);
+    }
+  }
+
+  String SHA256::digest () {
+    const auto bits = this->length * 8;
+    const uint8_t padding = 0x80;
+    const uint8_t zero = 0x00;
+
+    this->update((const char*) &padding, 1);
+
+    while (this->length % 64 != 56) {
+      this->update((const char*) &zero, 1);
+    }
+
+    uint8_t encoded[8];
+    for (int i = 0; i < 8; i++) {
+      encoded[i] = (uint8_t) (bits >> (56 - i * 8));
+    }
+
+    this->update((const char*) encoded, 8);
+
+    uint8_t bytes[32];
+    for (int i = 0; i < 8; i++) {
+      bytes[i * 4] = (uint8_t) (this->state[i] >> 24);
+      bytes[i * 4 + 1] = (uint8_t) (this->state[i] >> 16);
+      bytes[i * 4 + 2] = (uint8_t) (this->state[i] >> 8);
+      bytes[i * 4 + 3] = (uint8_t) this->state[i];
+    }
+
+    return toHex(bytes, sizeof(bytes));
+  }
+}
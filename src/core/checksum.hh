@@ -0,0 +1,50 @@
+#ifndef SSC_CORE_CHECKSUM_H
+#define SSC_CORE_CHECKSUM_H
+
+#include "types.hh"
+
+namespace SSC {
+  /**
+   * Incremental digest primitives backing `fs.checksum`. Both expose the
+   * same `update()`/`digest()` shape so the file hashing loop in
+   * `Core::FS` can stream pooled buffers through either without caring
+   * which algorithm was requested.
+   */
+
+  /**
+   * CRC32C (Castagnoli). Uses the SSE4.2 / ARMv8 CRC instructions when
+   * the build targets them and falls back to a table-driven software
+   * implementation otherwise.
+   */
+  struct CRC32C {
+    uint32_t state = 0xFFFFFFFFu;
+
+    void update (const char* bytes, size_t size);
+
+    // the finalized checksum as 8 lowercase hex characters
+    String digest () const;
+  };
+
+  /**
+   * SHA-256 (FIPS 180-4). A compact portable implementation - the
+   * runtime links no crypto library, and hashing throughput here is
+   * bounded by the disk, not the compression function.
+   */
+  struct SHA256 {
+    uint32_t state[8] = {
+      0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+      0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    };
+
+    uint8_t block[64] = {0};
+    uint64_t length = 0;
+
+    void update (const char* bytes, size_t size);
+
+    // finalizes and returns the digest as 64 lowercase hex characters -
+    // the instance must not be updated afterwards
+    String digest ();
+  };
+}
+
+#endif
@@ -1,6 +1,14 @@
 #include "codec.hh"
-#include "string.hh"
 #include <math.h>
+#include <string.h>
+
+#if defined(__SSE2__) || (defined(_M_X64) && !defined(_M_ARM64EC))
+#define SSC_CODEC_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define SSC_CODEC_NEON 1
+#include <arm_neon.h>
+#endif
 
 #define UNSIGNED_IN_RANGE(value, min, max) (                                   \
   (unsigned char) (value) >= (unsigned char) (min) &&                          \
@@ -60,6 +68,206 @@ static const char SAFE[256] = {
   /* F */ 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0
 };
 
+// how many input bytes the vectorized codec paths classify per iteration
+static constexpr size_t CODEC_BLOCK_SIZE = 16;
+
+//
+// Classifies a 16 byte block at `input` and returns the number of bytes
+// that need escaping. Safe bytes are exactly [0-9A-Za-z] (see SAFE) so
+// the vector paths get away with three range compares - bytes with the
+// high bit set read as negative in the signed compares and correctly
+// fail every range.
+//
+#if defined(SSC_CODEC_SSE2)
+static inline size_t countUnsafeBlock (const unsigned char* input) {
+  const auto block = _mm_loadu_si128((const __m128i *) input);
+  const auto digits = _mm_and_si128(
+    _mm_cmpgt_epi8(block, _mm_set1_epi8('0' - 1)),
+    _mm_cmplt_epi8(block, _mm_set1_epi8('9' + 1))
+  );
+  const auto uppercase = _mm_and_si128(
+    _mm_cmpgt_epi8(block, _mm_set1_epi8('A' - 1)),
+    _mm_cmplt_epi8(block, _mm_set1_epi8('Z' + 1))
+  );
+  const auto lowercase = _mm_and_si128(
+    _mm_cmpgt_epi8(block, _mm_set1_epi8('a' - 1)),
+    _mm_cmplt_epi8(block, _mm_set1_epi8('z' + 1))
+  );
+
+  const auto safe = _mm_or_si128(digits, _mm_or_si128(uppercase, lowercase));
+  const auto mask = (uint32_t) _mm_movemask_epi8(safe);
+  return (size_t) __builtin_popcount(~mask & 0xFFFF);
+}
+
+static inline bool hasEscapeOrPlusBlock (const unsigned char* input) {
+  const auto block = _mm_loadu_si128((const __m128i *) input);
+  const auto mask = _mm_or_si128(
+    _mm_cmpeq_epi8(block, _mm_set1_epi8('%')),
+    _mm_cmpeq_epi8(block, _mm_set1_epi8('+'))
+  );
+
+  return _mm_movemask_epi8(mask) != 0;
+}
+
+// maps 16 nibble values (0-15) to their uppercase hex digits, matching
+// DEC2HEX
+static inline __m128i hexDigitBlock (const __m128i nibbles) {
+  const auto alpha = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+  return _mm_add_epi8(
+    _mm_add_epi8(nibbles, _mm_set1_epi8('0')),
+    _mm_and_si128(alpha, _mm_set1_epi8('A' - '0' - 10))
+  );
+}
+
+// encodes 16 input bytes into 32 hex characters
+static inline void encodeHexBlock (const unsigned char* input, unsigned char* output) {
+  const auto block = _mm_loadu_si128((const __m128i *) input);
+  const auto mask = _mm_set1_epi8(0x0F);
+  const auto hi = hexDigitBlock(_mm_and_si128(_mm_srli_epi16(block, 4), mask));
+  const auto lo = hexDigitBlock(_mm_and_si128(block, mask));
+
+  _mm_storeu_si128((__m128i *) output, _mm_unpacklo_epi8(hi, lo));
+  _mm_storeu_si128((__m128i *) (output + 16), _mm_unpackhi_epi8(hi, lo));
+}
+
+// maps hex characters to their nibble values - for [0-9] the low nibble
+// of the character already is the value, for [A-Fa-f] it is off by 9
+static inline __m128i hexNibbleBlock (const __m128i characters) {
+  const auto alpha = _mm_cmpgt_epi8(characters, _mm_set1_epi8('9'));
+  return _mm_add_epi8(
+    _mm_and_si128(characters, _mm_set1_epi8(0x0F)),
+    _mm_and_si128(alpha, _mm_set1_epi8(9))
+  );
+}
+
+// decodes 32 hex characters into 16 output bytes
+static inline void decodeHexBlock (const unsigned char* input, unsigned char* output) {
+  const auto a = hexNibbleBlock(_mm_loadu_si128((const __m128i *) input));
+  const auto b = hexNibbleBlock(_mm_loadu_si128((const __m128i *) (input + 16)));
+  const auto mask = _mm_set1_epi16(0x00FF);
+
+  // each 16 bit lane holds a (hi, lo) nibble pair - fold it into one
+  // byte in the low half of the lane and pack both registers
+  const auto foldedA = _mm_or_si128(
+    _mm_slli_epi16(_mm_and_si128(a, mask), 4),
+    _mm_srli_epi16(a, 8)
+  );
+  const auto foldedB = _mm_or_si128(
+    _mm_slli_epi16(_mm_and_si128(b, mask), 4),
+    _mm_srli_epi16(b, 8)
+  );
+
+  _mm_storeu_si128((__m128i *) output, _mm_packus_epi16(foldedA, foldedB));
+}
+#elif defined(SSC_CODEC_NEON)
+static inline size_t countUnsafeBlock (const unsigned char* input) {
+  const auto block = vld1q_u8(input);
+  const auto digits = vandq_u8(
+    vcgeq_u8(block, vdupq_n_u8('0')),
+    vcleq_u8(block, vdupq_n_u8('9'))
+  );
+  const auto uppercase = vandq_u8(
+    vcgeq_u8(block, vdupq_n_u8('A')),
+    vcleq_u8(block, vdupq_n_u8('Z'))
+  );
+  const auto lowercase = vandq_u8(
+    vcgeq_u8(block, vdupq_n_u8('a')),
+    vcleq_u8(block, vdupq_n_u8('z'))
+  );
+
+  // safe lanes are 0xFF - count the lanes left at zero
+  const auto safe = vorrq_u8(digits, vorrq_u8(uppercase, lowercase));
+  return CODEC_BLOCK_SIZE - (size_t) vaddvq_u8(vshrq_n_u8(safe, 7));
+}
+
+static inline bool hasEscapeOrPlusBlock (const unsigned char* input) {
+  const auto block = vld1q_u8(input);
+  const auto mask = vorrq_u8(
+    vceqq_u8(block, vdupq_n_u8('%')),
+    vceqq_u8(block, vdupq_n_u8('+'))
+  );
+
+  return vmaxvq_u8(mask) != 0;
+}
+
+// maps 16 nibble values (0-15) to their uppercase hex digits, matching
+// DEC2HEX
+static inline uint8x16_t hexDigitBlock (const uint8x16_t nibbles) {
+  const auto alpha = vcgtq_u8(nibbles, vdupq_n_u8(9));
+  return vaddq_u8(
+    vaddq_u8(nibbles, vdupq_n_u8('0')),
+    vandq_u8(alpha, vdupq_n_u8('A' - '0' - 10))
+  );
+}
+
+// encodes 16 input bytes into 32 hex characters
+static inline void encodeHexBlock (const unsigned char* input, unsigned char* output) {
+  const auto block = vld1q_u8(input);
+  uint8x16x2_t pair;
+
+  pair.val[0] = hexDigitBlock(vshrq_n_u8(block, 4));
+  pair.val[1] = hexDigitBlock(vandq_u8(block, vdupq_n_u8(0x0F)));
+
+  vst2q_u8(output, pair);
+}
+
+// maps hex characters to their nibble values - for [0-9] the low nibble
+// of the character already is the value, for [A-Fa-f] it is off by 9
+static inline uint8x16_t hexNibbleBlock (const uint8x16_t characters) {
+  const auto alpha = vcgtq_u8(characters, vdupq_n_u8('9'));
+  return vaddq_u8(
+    vandq_u8(characters, vdupq_n_u8(0x0F)),
+    vandq_u8(alpha, vdupq_n_u8(9))
+  );
+}
+
+// decodes 32 hex characters into 16 output bytes
+static inline void decodeHexBlock (const unsigned char* input, unsigned char* output) {
+  const auto pair = vld2q_u8(input);
+  const auto hi = hexNibbleBlock(pair.val[0]);
+  const auto lo = hexNibbleBlock(pair.val[1]);
+
+  vst1q_u8(output, vorrq_u8(vshlq_n_u8(hi, 4), lo));
+}
+#else
+static inline size_t countUnsafeBlock (const unsigned char* input) {
+  size_t count = 0;
+
+  for (size_t i = 0; i < CODEC_BLOCK_SIZE; ++i) {
+    count += SAFE[input[i]] ? 0 : 1;
+  }
+
+  return count;
+}
+
+static inline bool hasEscapeOrPlusBlock (const unsigned char* input) {
+  for (size_t i = 0; i < CODEC_BLOCK_SIZE; ++i) {
+    if (input[i] == '%' || input[i] == '+') {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// encodes 16 input bytes into 32 hex characters
+static inline void encodeHexBlock (const unsigned char* input, unsigned char* output) {
+  for (size_t i = 0; i < CODEC_BLOCK_SIZE; ++i) {
+    *output++ = DEC2HEX[input[i] >> 4];
+    *output++ = DEC2HEX[input[i] & 15];
+  }
+}
+
+// decodes 32 hex characters into 16 output bytes
+static inline void decodeHexBlock (const unsigned char* input, unsigned char* output) {
+  for (size_t i = 0; i < CODEC_BLOCK_SIZE; ++i) {
+    const int hi = HEX2DEC[*input++];
+    const int lo = HEX2DEC[*input++];
+    *output++ = hi << 4 | lo;
+  }
+}
+#endif
+
 namespace SSC {
   const Array<uint8_t, 8> toBytes (const uint64_t input) {
     Array<uint8_t, 8> bytes;
@@ -76,25 +284,64 @@ namespace SSC {
   }
 
   String encodeURIComponent (const String& input) {
-    auto pointer = (unsigned char*) input.c_str();
-    const auto length = (int) input.length();
-    auto const start = new unsigned char[length* 3];
-    auto end = start;
+    auto pointer = (const unsigned char*) input.c_str();
+    const auto length = input.length();
     const unsigned char* const maxLength = pointer + length;
 
-    for (; pointer < maxLength; ++pointer) {
+    // precompute the exact output size so the result is allocated once
+    size_t unsafe = 0;
+    auto cursor = pointer;
+
+    while (cursor + CODEC_BLOCK_SIZE <= maxLength) {
+      unsafe += countUnsafeBlock(cursor);
+      cursor += CODEC_BLOCK_SIZE;
+    }
+
+    while (cursor < maxLength) {
+      unsafe += SAFE[*cursor++] ? 0 : 1;
+    }
+
+    String result(length + 2 * unsafe, 0);
+    auto output = (unsigned char*) result.data();
+
+    if (unsafe == 0) {
+      memcpy(output, pointer, length);
+      return result;
+    }
+
+    // bulk-copy safe runs a block at a time, escape byte-wise otherwise
+    while (pointer + CODEC_BLOCK_SIZE <= maxLength) {
+      if (countUnsafeBlock(pointer) == 0) {
+        memcpy(output, pointer, CODEC_BLOCK_SIZE);
+        output += CODEC_BLOCK_SIZE;
+        pointer += CODEC_BLOCK_SIZE;
+        continue;
+      }
+
+      for (size_t i = 0; i < CODEC_BLOCK_SIZE; ++i, ++pointer) {
+        if (SAFE[*pointer]) {
+          *output++ = *pointer;
+        } else {
+          // escape this char
+          *output++ = '%';
+          *output++ = DEC2HEX[*pointer >> 4];
+          *output++ = DEC2HEX[*pointer & 0x0F];
+        }
+      }
+    }
+
+    while (pointer < maxLength) {
       if (SAFE[*pointer]) {
-        *end++ = *pointer;
+        *output++ = *pointer++;
       } else {
         // escape this char
-        *end++ = '%';
-        *end++ = DEC2HEX[*pointer >> 4];
-        *end++ = DEC2HEX[*pointer & 0x0F];
+        *output++ = '%';
+        *output++ = DEC2HEX[*pointer >> 4];
+        *output++ = DEC2HEX[*pointer & 0x0F];
+        pointer++;
       }
     }
 
-    String result((char*) start, (char*) end);
-    delete [] start;
     return result;
   }
 
@@ -103,16 +350,50 @@ namespace SSC {
     // but are not followed by two hexadecimal characters (0-9, A-F) are reserved
     // for future extension"
 
-    const auto string = replace(input, "\\+", " ");
-    auto pointer = (const unsigned char *) string.c_str();
-    const auto length = (int) string.length();
+    auto pointer = (const unsigned char *) input.c_str();
+    const auto length = input.length();
     const auto maxLength = pointer + length;
 
-    char* const start = new char[length];
-    char* end = start;
+    // decoding only ever shrinks, so `length` bytes is the exact upper
+    // bound and the final resize never reallocates
+    String result(length, 0);
+    auto start = (char*) result.data();
+    auto end = start;
+
+    while (pointer + CODEC_BLOCK_SIZE <= maxLength) {
+      // blocks with no '%' escape and no '+' pass through untouched
+      if (!hasEscapeOrPlusBlock(pointer)) {
+        memcpy(end, pointer, CODEC_BLOCK_SIZE);
+        end += CODEC_BLOCK_SIZE;
+        pointer += CODEC_BLOCK_SIZE;
+        continue;
+      }
+
+      const auto blockEnd = pointer + CODEC_BLOCK_SIZE;
+      while (pointer < blockEnd) {
+        if (*pointer == '%' && pointer + 2 < maxLength) {
+          char dec1, dec2;
+          if (-1 != (dec1 = HEX2DEC[*(pointer + 1)])
+              && -1 != (dec2 = HEX2DEC[*(pointer + 2)])) {
+
+              *end++ = (dec1 << 4) + dec2;
+              pointer += 3;
+              continue;
+          }
+        }
+
+        if (*pointer == '+') {
+          *end++ = ' ';
+          pointer++;
+          continue;
+        }
+
+        *end++ = *pointer++;
+      }
+    }
 
-    while (pointer < maxLength - 2) {
-      if (*pointer == '%') {
+    while (pointer < maxLength) {
+      if (*pointer == '%' && pointer + 2 < maxLength) {
         char dec1, dec2;
         if (-1 != (dec1 = HEX2DEC[*(pointer + 1)])
             && -1 != (dec2 = HEX2DEC[*(pointer + 2)])) {
@@ -123,45 +404,69 @@ namespace SSC {
         }
       }
 
-      *end++ = *pointer++;
-    }
+      if (*pointer == '+') {
+        *end++ = ' ';
+        pointer++;
+        continue;
+      }
 
-    // the last 2- chars
-    while (pointer < maxLength) {
       *end++ = *pointer++;
     }
 
-    String result(start, end);
-    delete [] start;
+    result.resize(end - start);
     return result;
   }
 
-  String encodeHexString (const String& input) {
-    String output;
-    auto length = 2 * input.length();
+  size_t encodeHexBytes (char *output, const char *input, size_t length) {
+    auto pointer = (const unsigned char *) input;
+    auto out = (unsigned char *) output;
+    const auto maxLength = pointer + length;
 
-    output.reserve(length);
+    while (pointer + CODEC_BLOCK_SIZE <= maxLength) {
+      encodeHexBlock(pointer, out);
+      pointer += CODEC_BLOCK_SIZE;
+      out += 2 * CODEC_BLOCK_SIZE;
+    }
 
-    for (unsigned char character : input) {
-      output.push_back(DEC2HEX[character >> 4]);
-      output.push_back(DEC2HEX[character & 15]);
+    while (pointer < maxLength) {
+      *out++ = DEC2HEX[*pointer >> 4];
+      *out++ = DEC2HEX[*pointer & 15];
+      pointer++;
     }
 
-    return output;
+    return out - (unsigned char *) output;
   }
 
-  String decodeHexString (const String& input) {
-    const auto length = input.length() / 2;
-    String output;
+  size_t decodeHexBytes (char *output, const char *input, size_t length) {
+    auto pointer = (const unsigned char *) input;
+    auto out = (unsigned char *) output;
+    // a trailing odd character has no pair and is ignored
+    const auto maxLength = pointer + (length & ~(size_t) 1);
 
-    output.reserve(length);
+    while (pointer + 2 * CODEC_BLOCK_SIZE <= maxLength) {
+      decodeHexBlock(pointer, out);
+      pointer += 2 * CODEC_BLOCK_SIZE;
+      out += CODEC_BLOCK_SIZE;
+    }
 
-    for (auto character = input.begin(); character != input.end();) {
-      const int hi = HEX2DEC[(unsigned char) *character++];
-      const int lo = HEX2DEC[(unsigned char) *character++];
-      output.push_back(hi << 4 | lo);
+    while (pointer < maxLength) {
+      const int hi = HEX2DEC[*pointer++];
+      const int lo = HEX2DEC[*pointer++];
+      *out++ = hi << 4 | lo;
     }
 
+    return out - (unsigned char *) output;
+  }
+
+  String encodeHexString (const String& input) {
+    String output(2 * input.length(), 0);
+    encodeHexBytes(output.data(), input.data(), input.length());
+    return output;
+  }
+
+  String decodeHexString (const String& input) {
+    String output(input.length() / 2, 0);
+    decodeHexBytes(output.data(), input.data(), input.length());
     return output;
   }
 
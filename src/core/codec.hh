@@ -34,6 +34,29 @@ namespace SSC {
    */
   String decodeHexString (const String& input);
 
+  /**
+   * Encodes `length` bytes in `input` as hex characters written to
+   * `output`, which must hold at least `2 * length` bytes. Lets callers
+   * encode into preallocated (eg. pooled) buffers without an
+   * intermediate string.
+   * @param output Pointer owned by caller to write encoded output to
+   * @param input Pointer owned by caller to encode `length` bytes
+   * @param length Size of `input` in bytes
+   * @return The number of bytes written to `output`
+   */
+  size_t encodeHexBytes (char *output, const char *input, size_t length);
+
+  /**
+   * Decodes `length` hex characters in `input` to bytes written to
+   * `output`, which must hold at least `length / 2` bytes. A trailing
+   * unpaired character is ignored.
+   * @param output Pointer owned by caller to write decoded output to
+   * @param input Pointer owned by caller to decode `length` characters
+   * @param length Size of `input` in bytes
+   * @return The number of bytes written to `output`
+   */
+  size_t decodeHexBytes (char *output, const char *input, size_t length);
+
   /**
    * Decodes UTF8 byte string of variable `length` size in `input` to
    * `output` returning `size_t` bytes written to `output`.
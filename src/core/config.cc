@@ -10,38 +10,91 @@ namespace SSC {
 
   Config::Config (const String& source) {
     this->map = INI::parse(source, NAMESPACE_SEPARATOR_STRING);
+    this->reindex();
   }
 
   Config::Config (const Config& source) : prefix(source.prefix) {
     this->map = source.data();
+    // the index views key storage owned by `map` — it is never shared
+    // between instances, so a copy builds its own
+    this->reindex();
   }
 
   Config::Config (const Map& source) {
     this->map = source;
+    this->reindex();
   }
 
   Config::Config (const String& prefix, const Map& source) : prefix(prefix) {
     this->map = source;
+    this->reindex();
   }
 
   Config::Config (const String& prefix, const Config& source) : prefix(prefix) {
     this->map = source.data();
+    this->reindex();
+  }
+
+  void Config::reindex () noexcept {
+    this->index.clear();
+    this->index.reserve(this->map.size());
+
+    for (auto it = this->map.begin(); it != this->map.end(); ++it) {
+      this->index.emplace(StringView(it->first), it);
+    }
+
+    this->sections.clear();
+    this->sectionsBuilt = false;
+  }
+
+  void Config::ensureSections () const noexcept {
+    if (this->sectionsBuilt) {
+      return;
+    }
+
+    this->sections.clear();
+
+    for (const auto& tuple : this->map) {
+      const auto cut = tuple.first.find(NAMESPACE_SEPARATOR);
+
+      if (cut == String::npos || tuple.second.size() == 0) {
+        continue;
+      }
+
+      this->sections[tuple.first.substr(0, cut)].insert_or_assign(
+        tuple.first.substr(cut + 1),
+        tuple.second
+      );
+    }
+
+    this->sectionsBuilt = true;
   }
 
   const String Config::get (const String& key) const noexcept {
-    if (this->contains(key)) {
-      return this->at(key);
+    const auto entry = this->index.find(StringView(key));
+
+    if (entry != this->index.end()) {
+      return entry->second->second;
     }
 
     return "";
   }
 
   const String& Config::at (const String& key) const {
+    const auto entry = this->index.find(StringView(key));
+
+    if (entry != this->index.end()) {
+      return entry->second->second;
+    }
+
     return this->map.at(key);
   }
 
   void Config::set (const String& key, const String& value) noexcept {
-    this->map.insert_or_assign(key, value);
+    const auto entry = this->map.insert_or_assign(key, value).first;
+    this->index.insert_or_assign(StringView(entry->first), entry);
+    this->sections.clear();
+    this->sectionsBuilt = false;
   }
 
   const std::size_t Config::size () const noexcept {
@@ -49,7 +102,17 @@ namespace SSC {
   }
 
   bool Config::contains (const String& key) const noexcept {
-    if (this->map.contains(key) && this->map.at(key).size() > 0) {
+    const auto entry = this->index.find(StringView(key));
+
+    if (entry != this->index.end() && entry->second->second.size() > 0) {
+      return true;
+    }
+
+    // a precomputed section hit answers the common "does this section
+    // exist" probe without parsing the key as a query
+    this->ensureSections();
+
+    if (this->sections.contains(key)) {
       return true;
     }
 
@@ -58,7 +121,10 @@ namespace SSC {
 
   bool Config::erase (const String& key) noexcept {
     if (this->map.contains(key)) {
+      this->index.erase(StringView(key));
       this->map.erase(key);
+      this->sections.clear();
+      this->sectionsBuilt = false;
       return true;
     }
 
@@ -72,6 +138,10 @@ namespace SSC {
       }
     }
 
+    if (erased) {
+      this->reindex();
+    }
+
     return erased;
   }
 
@@ -80,17 +150,28 @@ namespace SSC {
   }
 
   const Config Config::slice (const String& key) const noexcept {
-    const auto view = this->query("[" + key + "]");
+    if (key.find(NAMESPACE_SEPARATOR) == String::npos) {
+      this->ensureSections();
+      const auto entry = this->sections.find(key);
+
+      if (entry != this->sections.end()) {
+        return Config { key, entry->second };
+      }
+
+      return Config { key, Map{} };
+    }
+
+    // deeper prefixes are not precomputed — range scan the ordered map
+    const auto prefix = key + NAMESPACE_SEPARATOR;
     Map slice;
 
-    for (const auto& tuple : view) {
-      if (
-        tuple.first.starts_with(key + NAMESPACE_SEPARATOR) &&
-        tuple.second.size() > 0
-      ) {
-        const auto k = tuple.first.substr(key.size() + 1, tuple.first.size());
-        const auto v = tuple.second;
-        slice.insert_or_assign(k, v);
+    for (
+      auto it = this->map.lower_bound(prefix);
+      it != this->map.end() && it->first.starts_with(prefix);
+      ++it
+    ) {
+      if (it->second.size() > 0) {
+        slice.insert_or_assign(it->first.substr(prefix.size()), it->second);
       }
     }
 
@@ -262,11 +343,20 @@ namespace SSC {
   }
 
   const String Config::operator [] (const String& key) const {
-    return this->map.at(key);
+    return this->at(key);
   }
 
   const String& Config::operator [] (const String& key) {
-    return this->map[key];
+    auto entry = this->map.find(key);
+
+    if (entry == this->map.end()) {
+      entry = this->map.insert_or_assign(key, "").first;
+      this->index.emplace(StringView(entry->first), entry);
+      this->sections.clear();
+      this->sectionsBuilt = false;
+    }
+
+    return entry->second;
   }
 
   const Config::Iterator Config::begin () const noexcept {
@@ -282,7 +372,10 @@ namespace SSC {
       return false;
     }
 
+    this->index.clear();
     this->map.clear();
+    this->sections.clear();
+    this->sectionsBuilt = false;
     return true;
   }
 
@@ -41,7 +41,7 @@
 
 namespace SSC {
   // implemented in `init.cc`
-  extern const Map getUserConfig ();
+  extern const Map& getUserConfig ();
   extern bool isDebugEnabled ();
   extern const String getDevHost ();
   extern int getDevPort ();
@@ -56,6 +56,38 @@ namespace SSC {
      * caller in `Config::data()`
      */
     Map map;
+
+    /**
+     * Hash index over `map`, keyed by views of the canonical key strings
+     * the tree already owns (`std::map` node storage is stable), so hot
+     * reads are a single hash probe instead of a tree walk with
+     * per-level string comparisons — and no query parse when the key is
+     * exact. Maintained incrementally by the mutators and rebuilt
+     * whenever `map` is replaced wholesale.
+     */
+    std::unordered_map<StringView, Map::const_iterator> index;
+
+    /**
+     * Per-section sub-views, precomputed in one pass over `map` the
+     * first time a slice is requested after a mutation, so `slice()`
+     * never re-parses a query or concatenates a prefix per entry.
+     * Only top-level sections are precomputed — deeper prefixes range
+     * scan the ordered map directly.
+     */
+    mutable std::map<String, Map> sections;
+    mutable bool sectionsBuilt = false;
+
+    /**
+     * Rebuilds `index` from scratch and invalidates `sections`.
+     */
+    void reindex () noexcept;
+
+    /**
+     * Builds `sections` when a mutation (or construction) has
+     * invalidated it.
+     */
+    void ensureSections () const noexcept;
+
     public:
       using Iterator = Map::const_iterator;
       using Path = Vector<String>;
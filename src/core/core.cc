@@ -1,23 +1,64 @@
 #include "core.hh"
 
-#define IMAX_BITS(m) ((m)/((m) % 255+1) / 255 % 255 * 8 + 7-86 / ((m) % 255+12))
-#define RAND_MAX_WIDTH IMAX_BITS(RAND_MAX)
+#if defined(__linux__) && !defined(__ANDROID__)
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <netioapi.h>
+#endif
+
+#include <random>
+
+#if defined(__APPLE__) || (defined(__linux__) && !defined(__ANDROID__))
+#include <execinfo.h>
+#include <csignal>
+#endif
 
 namespace SSC {
-  uint64_t rand64 () {
-    uint64_t r = 0;
-    static bool init = false;
+  static inline uint64_t rotl64 (uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+  }
 
-    if (!init) {
-      init = true;
-      srand(time(0));
-    }
+  // expands seed material so weak `std::random_device` output still
+  // yields well mixed, non-zero generator state
+  static uint64_t splitmix64 (uint64_t& state) {
+    uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+  }
 
-    for (int i = 0; i < 64; i += RAND_MAX_WIDTH) {
-      r <<= RAND_MAX_WIDTH;
-      r ^= (unsigned) rand();
+  // a per-thread xoshiro256** generator seeded from the OS entropy
+  // source — `rand64` mints post, peer and message ids from several
+  // threads at once, where glibc's `rand()` serializes on a global lock
+  // and its low bits collide far too often for values used as map keys
+  uint64_t rand64 () {
+    static thread_local uint64_t state[4] = {0, 0, 0, 0};
+    static thread_local bool seeded = false;
+
+    if (!seeded) {
+      seeded = true;
+      std::random_device device;
+      auto seed = (uint64_t(device()) << 32) ^ uint64_t(device());
+      for (auto& word : state) {
+        word = splitmix64(seed);
+      }
     }
-    return r;
+
+    const uint64_t result = rotl64(state[1] * 5, 7) * 9;
+    const uint64_t t = state[1] << 17;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotl64(state[3], 45);
+
+    return result;
   }
 
 
@@ -26,14 +67,41 @@ namespace SSC {
     std::this_thread::sleep_for(std::chrono::milliseconds(ms));
   }
 
+  // the small fixed set of header keys the runtime itself emits - keys
+  // are interned against this table when a `Header` is constructed
+  static const char* WELL_KNOWN_HEADER_KEYS[] = {
+    "content-type",
+    "content-length",
+    "content-location",
+    "content-disposition",
+    "cache-control",
+    "connection"
+  };
+
+  static int internHeaderKey (const String& key) {
+    constexpr auto count = (int) (
+      sizeof(WELL_KNOWN_HEADER_KEYS) / sizeof(WELL_KNOWN_HEADER_KEYS[0])
+    );
+
+    for (int i = 0; i < count; ++i) {
+      if (key == WELL_KNOWN_HEADER_KEYS[i]) {
+        return i;
+      }
+    }
+
+    return -1;
+  }
+
   Headers::Header::Header (const Header& header) {
     this->key = header.key;
     this->value = header.value;
+    this->interned = header.interned;
   }
 
   Headers::Header::Header (const String& key, const Value& value) {
     this->key = trim(key);
     this->value = trim(value.str());
+    this->interned = internHeaderKey(this->key);
   }
 
   Headers::Headers (const String& source) {
@@ -49,14 +117,6 @@ namespace SSC {
     this->entries = headers.entries;
   }
 
-  Headers::Headers (const Vector<std::map<String, Value>>& entries) {
-    for (const auto& entry : entries) {
-      for (const auto& pair : entry) {
-        this->entries.push_back(Header { pair.first, pair.second });
-      }
-    }
-  }
-
   Headers::Headers (const Entries& entries) {
     for (const auto& entry : entries) {
       this->entries.push_back(entry);
@@ -69,7 +129,10 @@ namespace SSC {
 
   void Headers::set (const Header& header) {
     for (auto& entry : entries) {
-      if (header.key == entry.key) {
+      if (header.interned != -1
+        ? header.interned == entry.interned
+        : header.key == entry.key
+      ) {
         entry.value = header.value;
         return;
       }
@@ -79,8 +142,10 @@ namespace SSC {
   }
 
   bool Headers::has (const String& name) const {
+    const auto interned = internHeaderKey(name);
+
     for (const auto& header : entries) {
-      if (header.key == name) {
+      if (interned != -1 ? header.interned == interned : header.key == name) {
         return true;
       }
     }
@@ -90,9 +155,10 @@ namespace SSC {
 
   const Headers::Header& Headers::get (const String& name) const {
     static const auto empty = Header();
+    const auto interned = internHeaderKey(name);
 
     for (const auto& header : entries) {
-      if (header.key == name) {
+      if (interned != -1 ? header.interned == interned : header.key == name) {
         return header;
       }
     }
@@ -105,15 +171,34 @@ namespace SSC {
   }
 
   String Headers::str () const {
-    StringStream headers;
+    size_t size = 0;
+
+    for (const auto& entry : this->entries) {
+      // "<key>: <value>\n"
+      size += entry.key.size() + 2 + entry.value.str().size() + 1;
+    }
+
+    String headers;
+    headers.reserve(size);
+
     auto count = this->size();
     for (const auto& entry : this->entries) {
-      headers << entry.key << ": " << entry.value.str();;
+      headers += entry.key;
+      headers += ": ";
+      headers += entry.value.str();
       if (--count > 0) {
-        headers << "\n";
+        headers += '\n';
       }
     }
-    return headers.str();
+
+    return headers;
+  }
+
+  Headers Headers::forPostBody (size_t contentLength) {
+    return Headers {{
+      {"content-type", "application/octet-stream"},
+      {"content-length", (uint64_t) contentLength}
+    }};
   }
 
   Headers::Value::Value (const String& value) {
@@ -133,28 +218,28 @@ namespace SSC {
   }
 
   Headers::Value::Value (int value) {
-    this->string = std::to_string(value);
+    this->string = formatNumber((int64_t) value);
   }
 
   Headers::Value::Value (float value) {
-    this->string = std::to_string(value);
+    this->string = formatNumber((double) value);
   }
 
   Headers::Value::Value (int64_t value) {
-    this->string = std::to_string(value);
+    this->string = formatNumber(value);
   }
 
   Headers::Value::Value (uint64_t value) {
-    this->string = std::to_string(value);
+    this->string = formatNumber(value);
   }
 
   Headers::Value::Value (double_t value) {
-    this->string = std::to_string(value);
+    this->string = formatNumber((double) value);
   }
 
 #if defined(__APPLE__)
   Headers::Value::Value (ssize_t value) {
-    this->string = std::to_string(value);
+    this->string = formatNumber((int64_t) value);
   }
 #endif
 
@@ -167,39 +252,40 @@ namespace SSC {
   }
 
   Post Core::getPost (uint64_t id) {
-    Lock lock(postsMutex);
-    if (posts->find(id) == posts->end()) return Post{};
-    return posts->at(id);
+    return posts.get(id);
   }
 
   bool Core::hasPost (uint64_t id) {
-    Lock lock(postsMutex);
-    return posts->find(id) != posts->end();
+    return posts.has(id);
   }
 
   bool Core::hasPostBody (const char* body) {
-    Lock lock(postsMutex);
     if (body == nullptr) return false;
-    for (auto const &tuple : *posts) {
-      auto post = tuple.second;
-      if (post.body == body) return true;
-    }
-    return false;
+    Lock lock(postExpiryMutex);
+    return postBodies.find(body) != postBodies.end();
   }
 
   void Core::expirePosts () {
-    Lock lock(postsMutex);
     std::vector<uint64_t> ids;
-    auto now = std::chrono::system_clock::now()
+    auto now = (uint64_t) std::chrono::time_point_cast<std::chrono::milliseconds>(
+      std::chrono::system_clock::now()
+    )
       .time_since_epoch()
       .count();
 
-    for (auto const &tuple : *posts) {
-      auto id = tuple.first;
-      auto post = tuple.second;
+    {
+      Lock lock(postExpiryMutex);
+      while (!postExpiryQueue.empty() && postExpiryQueue.top().first <= now) {
+        auto entry = postExpiryQueue.top();
+        postExpiryQueue.pop();
+
+        // skip entries made stale by a `putPost` that refreshed the ttl
+        auto post = posts.get(entry.second);
+        if (post.id != 0 && post.ttl > entry.first) {
+          continue;
+        }
 
-      if (post.ttl < now) {
-        ids.push_back(id);
+        ids.push_back(entry.second);
       }
     }
 
@@ -209,31 +295,61 @@ namespace SSC {
   }
 
   void Core::putPost (uint64_t id, Post p) {
-    Lock lock(postsMutex);
+    p.id = id;
     p.ttl = std::chrono::time_point_cast<std::chrono::milliseconds>(
       std::chrono::system_clock::now() +
       std::chrono::milliseconds(32 * 1024)
     )
       .time_since_epoch()
       .count();
-    posts->insert_or_assign(id, p);
+
+    {
+      Lock lock(postExpiryMutex);
+      auto existing = posts.get(id);
+      if (existing.body != nullptr && existing.body != p.body) {
+        postBodies.erase(existing.body.get());
+        Heap::untrack(Heap::Tag::posts, existing.length);
+      }
+
+      if (p.body != nullptr) {
+        postBodies.insert(p.body.get());
+
+        if (existing.body != p.body) {
+          Heap::track(Heap::Tag::posts, p.length);
+        }
+      }
+
+      postExpiryQueue.push({ p.ttl, id });
+    }
+
+    posts.set(id, p);
   }
 
   void Core::removePost (uint64_t id) {
-    Lock lock(postsMutex);
-    if (posts->find(id) == posts->end()) return;
-    auto post = getPost(id);
+    Post post;
+
+    if (!posts.extract(id, post)) {
+      return;
+    }
 
     if (post.body) {
-      delete [] post.body;
+      Lock lock(postExpiryMutex);
+      postBodies.erase(post.body.get());
+      Heap::untrack(Heap::Tag::posts, post.length);
     }
+  }
 
-    posts->erase(id);
+  uint64_t Core::registerPost (Post post) {
+    if (post.id == 0) {
+      post.id = rand64();
+    }
+
+    const auto id = post.id;
+    putPost(id, post);
+    return id;
   }
 
   String Core::createPost (String seq, String params, Post post) {
-    Lock lock(postsMutex);
-
     if (post.id == 0) {
       post.id = rand64();
     }
@@ -244,7 +360,7 @@ namespace SSC {
       "const id = `" + sid + "`;                                             \n"
       "const seq = `" + seq + "`;                                            \n"
       "const workerId = `" + post.workerId + "`.trim() || null;              \n"
-      "const headers = `" + trim(post.headers) + "`                          \n"
+      "const headers = `" + post.headers.str() + "`                          \n"
       "  .trim()                                                             \n"
       "  .split(/[\\r\\n]+/)                                                 \n"
       "  .filter(Boolean)                                                    \n"
@@ -271,23 +387,366 @@ namespace SSC {
   }
 
   void Core::removeAllPosts () {
-    Lock lock(postsMutex);
-    std::vector<uint64_t> ids;
+    for (auto const id : posts.ids()) {
+      removePost(id);
+    }
+  }
+
+  uint64_t Core::Diagnostics::Histogram::estimate (double quantile) const {
+    const auto total = this->count.load(std::memory_order_relaxed);
 
-    for (auto const &tuple : *posts) {
-      auto id = tuple.first;
-      ids.push_back(id);
+    if (total == 0) {
+      return 0;
     }
 
-    for (auto const id : ids) {
-      removePost(id);
+    uint64_t seen = 0;
+
+    for (size_t i = 0; i < BUCKETS; ++i) {
+      seen += this->buckets[i].load(std::memory_order_relaxed);
+
+      if ((double) seen >= quantile * (double) total) {
+        // the upper bound of bucket `i` - values land in the bucket of
+        // their floored log2, so bucket `i` covers up to `2^(i + 1) - 1`
+        return (uint64_t(1) << (i + 1)) - 1;
+      }
+    }
+
+    return (uint64_t(1) << BUCKETS) - 1;
+  }
+
+  JSON::Object Core::Diagnostics::Histogram::json () const {
+    const auto count = this->count.load(std::memory_order_relaxed);
+    const auto sum = this->sum.load(std::memory_order_relaxed);
+
+    return JSON::Object::Entries {
+      {"count", count},
+      {"mean", count > 0 ? sum / count : 0},
+      {"p50", this->estimate(0.50)},
+      {"p90", this->estimate(0.90)},
+      {"p99", this->estimate(0.99)}
+    };
+  }
+
+  JSON::Object Core::Diagnostics::CallMetrics::json () const {
+    return JSON::Object::Entries {
+      {"calls", this->calls.load(std::memory_order_relaxed)},
+      {"latency", this->latency.json()} // in nanoseconds
+    };
+  }
+
+  Core::Diagnostics::CallMetrics* Core::Diagnostics::metricsForRoute (
+    const String& name
+  ) {
+    if (name.compare(0, 3, "fs.") == 0) return &this->fs;
+    if (name.compare(0, 4, "udp.") == 0) return &this->udp;
+    if (name.compare(0, 4, "dns.") == 0) return &this->dns;
+    return nullptr;
+  }
+
+  JSON::Object Core::Diagnostics::json () {
+    const auto pool = BufferPool::instance();
+
+    auto watchdog = JSON::Object {};
+
+    do {
+      Lock lock(this->stallMutex);
+      auto frames = JSON::Array {};
+
+      for (const auto& frame : this->lastStall.frames) {
+        frames.push(frame);
+      }
+
+      watchdog.set("enabled", this->watchdogRunning.load());
+      watchdog.set("stalls", this->stallCount.load(std::memory_order_relaxed));
+      watchdog.set("lastStall", JSON::Object::Entries {
+        {"timestamp", this->lastStall.timestamp},
+        {"duration", this->lastStall.duration},
+        {"route", this->lastStall.route},
+        {"frames", frames}
+      });
+    } while (0);
+
+    return JSON::Object::Entries {
+      {"eventLoop", JSON::Object::Entries {
+        {"dispatchQueueDepth", this->core->eventLoopDispatchQueue.size()},
+        {"lag", this->eventLoopLag.json()} // in nanoseconds
+      }},
+      {"tables", JSON::Object::Entries {
+        {"posts", this->core->posts.size()},
+        {"peers", this->core->peers.size()},
+        {"descriptors", this->core->fs.descriptors.size()}
+      }},
+      {"modules", JSON::Object::Entries {
+        {"fs", this->fs.json()},
+        {"udp", this->udp.json()},
+        {"dns", this->dns.json()}
+      }},
+      {"bufferPool", JSON::Object::Entries {
+        {"acquires", pool->acquires.load(std::memory_order_relaxed)},
+        {"reuses", pool->reuses.load(std::memory_order_relaxed)},
+        {"allocations", pool->allocations.load(std::memory_order_relaxed)},
+        {"recycles", pool->recycles.load(std::memory_order_relaxed)},
+        {"frees", pool->frees.load(std::memory_order_relaxed)}
+      }},
+      {"heap", Heap::snapshot()},
+      {"watchdog", watchdog}
+    };
+  }
+
+  // milliseconds on the monotonic clock the watchdog and the loop
+  // heartbeat are both stamped with
+  static uint64_t monotonicMilliseconds () {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()
+    ).count();
+  }
+
+  void Core::Diagnostics::setActiveRoute (const char* name) {
+    this->activeRouteVersion.fetch_add(1, std::memory_order_acq_rel);
+
+    if (name == nullptr) {
+      this->activeRoute[0] = 0;
+    } else {
+      strncpy(this->activeRoute, name, ACTIVE_ROUTE_SIZE - 1);
+      this->activeRoute[ACTIVE_ROUTE_SIZE - 1] = 0;
+    }
+
+    this->activeRouteVersion.fetch_add(1, std::memory_order_release);
+  }
+
+  String Core::Diagnostics::getActiveRoute () {
+    char copy[ACTIVE_ROUTE_SIZE];
+
+    // bounded seqlock read - an odd or moved version means a writer
+    // raced the copy, and after a few attempts an empty attribution
+    // beats spinning against a hot invoke stream
+    for (int attempt = 0; attempt < 8; ++attempt) {
+      const auto before = this->activeRouteVersion.load(std::memory_order_acquire);
+
+      if (before & 1) {
+        continue;
+      }
+
+      memcpy(copy, this->activeRoute, ACTIVE_ROUTE_SIZE);
+      std::atomic_thread_fence(std::memory_order_acquire);
+
+      if (this->activeRouteVersion.load(std::memory_order_acquire) == before) {
+        copy[ACTIVE_ROUTE_SIZE - 1] = 0;
+        return String(copy);
+      }
+    }
+
+    return "";
+  }
+
+#if defined(__APPLE__) || (defined(__linux__) && !defined(__ANDROID__))
+  // backtrace capture protocol between the watchdog and the signal
+  // handler it lands on the loop thread: `1` requests a capture, the
+  // handler fills the frame buffer and publishes `2`. `backtrace()` is
+  // not formally async-signal-safe but is the established practice for
+  // sampling profilers; symbolization happens on the watchdog thread
+  static std::atomic<int> watchdogCaptureState = 0;
+  static void* watchdogCaptureFrames[64];
+  static int watchdogCaptureCount = 0;
+
+  static void onWatchdogSignal (int) {
+    if (watchdogCaptureState.load(std::memory_order_acquire) == 1) {
+      watchdogCaptureCount = backtrace(
+        watchdogCaptureFrames,
+        sizeof(watchdogCaptureFrames) / sizeof(watchdogCaptureFrames[0])
+      );
+      watchdogCaptureState.store(2, std::memory_order_release);
+    }
+  }
+#endif
+
+  void Core::Diagnostics::captureStall (uint64_t duration) {
+    auto stall = Stall {};
+
+    stall.timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::system_clock::now().time_since_epoch()
+    ).count();
+    stall.duration = duration;
+    stall.route = this->getActiveRoute();
+
+  #if defined(__APPLE__) || (defined(__linux__) && !defined(__ANDROID__))
+    const auto thread = this->core->eventLoopThreadId.load(std::memory_order_relaxed);
+
+    watchdogCaptureState.store(1, std::memory_order_release);
+
+    // SIGURG because its default disposition is ignore, so the handler
+    // is harmless to anything else that raises it, and profilers keep
+    // SIGPROF to themselves
+    if (pthread_kill(thread, SIGURG) == 0) {
+      // the loop thread is blocked, not dead - the kernel delivers the
+      // signal on top of whatever it is stuck in almost immediately
+      for (int waited = 0; waited < 100; ++waited) {
+        if (watchdogCaptureState.load(std::memory_order_acquire) == 2) {
+          break;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+
+    if (watchdogCaptureState.load(std::memory_order_acquire) == 2) {
+      auto symbols = backtrace_symbols(watchdogCaptureFrames, watchdogCaptureCount);
+
+      if (symbols != nullptr) {
+        for (int i = 0; i < watchdogCaptureCount; ++i) {
+          stall.frames.push_back(symbols[i]);
+        }
+
+        free(symbols);
+      }
+    }
+
+    watchdogCaptureState.store(0, std::memory_order_release);
+  #endif
+
+    debug(
+      "core: event loop stalled for %llums (route: %s)",
+      (unsigned long long) duration,
+      stall.route.size() > 0 ? stall.route.c_str() : "unknown"
+    );
+
+    do {
+      Lock lock(this->stallMutex);
+      this->lastStall = std::move(stall);
+    } while (0);
+
+    this->stallCount.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void Core::Diagnostics::startWatchdog (uint64_t threshold) {
+    if (this->watchdogRunning.exchange(true)) {
+      return;
+    }
+
+    this->watchdogThreshold = threshold > 0 ? threshold : 250;
+
+  #if defined(__APPLE__) || (defined(__linux__) && !defined(__ANDROID__))
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = onWatchdogSignal;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGURG, &action, nullptr);
+  #endif
+
+    this->watchdogThread = new Thread([this]() {
+      // one report per stall episode: the heartbeat only moves when the
+      // loop comes back, so an unchanged value is the same stall growing
+      uint64_t reportedHeartbeat = 0;
+      const auto interval = std::max(this->watchdogThreshold / 4, uint64_t(25));
+
+      while (this->watchdogRunning) {
+        do {
+          std::unique_lock<std::mutex> lock(this->watchdogMutex);
+          this->watchdogWakeup.wait_for(
+            lock,
+            std::chrono::milliseconds(interval),
+            [this]() { return !this->watchdogRunning.load(); }
+          );
+        } while (0);
+
+        if (!this->watchdogRunning || !this->core->isLoopRunning) {
+          continue;
+        }
+
+        // a loop parked in the backend poll is idle, not stalled
+        if (this->core->eventLoopInPoll.load(std::memory_order_relaxed)) {
+          continue;
+        }
+
+        const auto heartbeat = this->core->eventLoopHeartbeat.load(
+          std::memory_order_relaxed
+        );
+        const auto now = monotonicMilliseconds();
+
+        if (heartbeat == 0 || now - heartbeat < this->watchdogThreshold) {
+          continue;
+        }
+
+        if (heartbeat == reportedHeartbeat) {
+          continue;
+        }
+
+        reportedHeartbeat = heartbeat;
+        this->captureStall(now - heartbeat);
+      }
+    });
+  }
+
+  void Core::Diagnostics::stopWatchdog () {
+    if (!this->watchdogRunning.exchange(false)) {
+      return;
+    }
+
+    this->watchdogWakeup.notify_one();
+
+    if (this->watchdogThread != nullptr) {
+      if (this->watchdogThread->joinable()) {
+        this->watchdogThread->join();
+      }
+
+      delete this->watchdogThread;
+      this->watchdogThread = nullptr;
+    }
+  }
+
+  void Core::Diagnostics::query (const String seq, Module::Callback cb) {
+    // every metric is an atomic counter or a sharded table size, so the
+    // snapshot is assembled on the calling thread without touching the
+    // event loop
+    auto json = JSON::Object::Entries {
+      {"source", "diagnostics.query"},
+      {"data", this->json()}
+    };
+
+    cb(seq, json, Post{});
+  }
+
+  bool Core::OS::getCachedInfo (const String& key, String& payload) {
+    Lock lock(this->infoCacheMutex);
+    const auto entry = this->infoCache.find(key);
+
+    if (entry == this->infoCache.end()) {
+      return false;
+    }
+
+    if (std::chrono::steady_clock::now() >= entry->second.expiry) {
+      this->infoCache.erase(entry);
+      return false;
     }
+
+    payload = entry->second.payload;
+    return true;
+  }
+
+  void Core::OS::putCachedInfo (const String& key, const String& payload) {
+    Lock lock(this->infoCacheMutex);
+    this->infoCache[key] = InfoCacheEntry {
+      payload,
+      std::chrono::steady_clock::now() + INFO_CACHE_TTL
+    };
+  }
+
+  void Core::OS::invalidateCachedInfo (const String& key) {
+    Lock lock(this->infoCacheMutex);
+    this->infoCache.erase(key);
   }
 
   void Core::OS::cpus (
     const String seq,
     Module::Callback cb
   ) {
+    String cached;
+    if (this->getCachedInfo("os.cpus", cached)) {
+      cb(seq, JSON::Raw(cached), Post{});
+      return;
+    }
+
     this->core->dispatchEventLoop([=, this]() {
     #if defined(__ANDROID__)
       {
@@ -333,46 +792,31 @@ namespace SSC {
         };
       }
 
-      auto json = JSON::Object::Entries {
+      auto json = JSON::Object(JSON::Object::Entries {
         {"source", "os.cpus"},
         {"data", entries}
-      };
+      });
 
       uv_free_cpu_info(infos, count);
+      this->putCachedInfo("os.cpus", json.str());
       cb(seq, json, Post{});
     });
   }
 
-  void Core::OS::networkInterfaces (
-    const String seq,
-    Module::Callback cb
-  ) const {
+  int Core::OS::enumerateNetworkInterfaces (
+    JSON::Object& ipv4,
+    JSON::Object& ipv6,
+    Map& flat
+  ) {
     uv_interface_address_t *infos = nullptr;
-    StringStream value;
-    StringStream v4;
-    StringStream v6;
     int count = 0;
 
     int status = uv_interface_addresses(&infos, &count);
 
     if (status != 0) {
-      auto json = JSON::Object(JSON::Object::Entries {
-        {"source", "os.networkInterfaces"},
-        {"err", JSON::Object::Entries {
-          {"type", "InternalError"},
-          {"message",
-            String("Unable to get network interfaces: ") + String(uv_strerror(status))
-          }
-        }}
-      });
-
-      return cb(seq, json, Post{});
+      return status;
     }
 
-    JSON::Object::Entries ipv4;
-    JSON::Object::Entries ipv6;
-    JSON::Object::Entries data;
-
     for (int i = 0; i < count; ++i) {
       uv_interface_address_t info = infos[i];
       struct sockaddr_in *addr = (struct sockaddr_in*) &info.address.address4;
@@ -386,40 +830,356 @@ namespace SSC {
         (unsigned char) info.phys_addr[5]
       );
 
+      const auto internal = info.is_internal == 0 ? "false" : "true";
+
       if (addr->sin_family == AF_INET) {
-        JSON::Object::Entries entries;
-        entries["internal"] = info.is_internal == 0 ? "false" : "true";
-        entries["address"] = addrToIPv4(addr);
-        entries["mac"] = String(mac, 17);
-        ipv4[String(info.name)] = entries;
+        const auto address = addrToIPv4(addr);
+        ipv4.set(String(info.name), JSON::Object::Entries {
+          {"internal", internal},
+          {"address", address},
+          {"mac", String(mac, 17)}
+        });
+
+        flat["ipv4:" + String(info.name)] =
+          address + "|" + String(mac, 17) + "|" + internal;
       }
 
       if (addr->sin_family == AF_INET6) {
-        JSON::Object::Entries entries;
-        entries["internal"] = info.is_internal == 0 ? "false" : "true";
-        entries["address"] = addrToIPv6((struct sockaddr_in6*) addr);
-        entries["mac"] = String(mac, 17);
-        ipv6[String(info.name)] = entries;
+        const auto address = addrToIPv6((struct sockaddr_in6*) addr);
+        ipv6.set(String(info.name), JSON::Object::Entries {
+          {"internal", internal},
+          {"address", address},
+          {"mac", String(mac, 17)}
+        });
+
+        flat["ipv6:" + String(info.name)] =
+          address + "|" + String(mac, 17) + "|" + internal;
+      }
+    }
+
+    uv_free_interface_addresses(infos, count);
+    return 0;
+  }
+
+  void Core::OS::networkInterfaces (
+    const String seq,
+    Module::Callback cb
+  ) {
+    String cached;
+    if (this->getCachedInfo("os.networkInterfaces", cached)) {
+      cb(seq, JSON::Raw(cached), Post{});
+      return;
+    }
+
+    JSON::Object ipv4;
+    JSON::Object ipv6;
+    JSON::Object data;
+    Map flat;
+
+    const auto status = this->enumerateNetworkInterfaces(ipv4, ipv6, flat);
+
+    if (status != 0) {
+      auto json = JSON::Object(JSON::Object::Entries {
+        {"source", "os.networkInterfaces"},
+        {"err", JSON::Object::Entries {
+          {"type", "InternalError"},
+          {"message",
+            String("Unable to get network interfaces: ") + String(uv_strerror(status))
+          }
+        }}
+      });
+
+      return cb(seq, json, Post{});
+    }
+
+    data.set("ipv4", std::move(ipv4));
+    data.set("ipv6", std::move(ipv6));
+
+    auto json = JSON::Object(JSON::Object::Entries {
+      {"source", "os.networkInterfaces"},
+      {"data", data}
+    });
+
+    this->putCachedInfo("os.networkInterfaces", json.str());
+    cb(seq, json, Post{});
+  }
+
+  void Core::OS::subscribeNetworkInterfaces (
+    const String seq,
+    uint64_t id,
+    Module::Callback cb
+  ) {
+  #if defined(__ANDROID__)
+    auto json = JSON::Object::Entries {
+      {"source", "os.networkInterfaces.subscribe"},
+      {"err", JSON::Object::Entries {
+        {"message", "Not supported"}
+      }}
+    };
+
+    cb(seq, json, Post{});
+  #else
+    do {
+      Lock lock(this->interfaceSubscribersMutex);
+      this->interfaceSubscribers[id] = cb;
+
+      // seed the diff baseline so the first change notification reports
+      // deltas against the state at subscription time
+      if (this->lastInterfaceSnapshot.empty()) {
+        JSON::Object ipv4;
+        JSON::Object ipv6;
+        this->enumerateNetworkInterfaces(ipv4, ipv6, this->lastInterfaceSnapshot);
+      }
+    } while (0);
+
+    this->startInterfaceObserver();
+
+    auto json = JSON::Object::Entries {
+      {"source", "os.networkInterfaces.subscribe"},
+      {"data", JSON::Object::Entries {
+        {"id", std::to_string(id)}
+      }}
+    };
+
+    cb(seq, json, Post{});
+  #endif
+  }
+
+  void Core::OS::unsubscribeNetworkInterfaces (
+    const String seq,
+    uint64_t id,
+    Module::Callback cb
+  ) {
+    bool isEmpty = false;
+
+    do {
+      Lock lock(this->interfaceSubscribersMutex);
+      this->interfaceSubscribers.erase(id);
+      isEmpty = this->interfaceSubscribers.empty();
+    } while (0);
+
+    // the last subscriber leaving tears the platform observer down so an
+    // idle process is not woken by interface churn
+    if (isEmpty) {
+      this->stopInterfaceObserver();
+    }
+
+    auto json = JSON::Object::Entries {
+      {"source", "os.networkInterfaces.unsubscribe"},
+      {"data", JSON::Object::Entries {
+        {"id", std::to_string(id)}
+      }}
+    };
+
+    cb(seq, json, Post{});
+  }
+
+  void Core::OS::startInterfaceObserver () {
+    if (this->isInterfaceObserverActive.exchange(true)) {
+      return;
+    }
+
+  #if defined(__APPLE__)
+    static auto queue = dispatch_queue_create(
+      "co.socketsupply.queue.core.network-interface-observer",
+      DISPATCH_QUEUE_SERIAL
+    );
+
+    this->interfacePathMonitor = nw_path_monitor_create();
+    nw_path_monitor_set_queue(this->interfacePathMonitor, queue);
+    nw_path_monitor_set_update_handler(this->interfacePathMonitor, ^(nw_path_t path) {
+      if (path != nullptr) {
+        this->notifyInterfaceChange();
+      }
+    });
+
+    nw_path_monitor_start(this->interfacePathMonitor);
+  #elif defined(__linux__) && !defined(__ANDROID__)
+    this->interfaceNetlinkFd = socket(
+      AF_NETLINK,
+      SOCK_RAW | SOCK_CLOEXEC,
+      NETLINK_ROUTE
+    );
+
+    if (this->interfaceNetlinkFd < 0) {
+      this->isInterfaceObserverActive = false;
+      return;
+    }
+
+    struct sockaddr_nl address;
+    memset(&address, 0, sizeof(address));
+    address.nl_family = AF_NETLINK;
+    address.nl_groups = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+
+    if (bind(
+      this->interfaceNetlinkFd,
+      (struct sockaddr *) &address,
+      sizeof(address)
+    ) < 0) {
+      close(this->interfaceNetlinkFd);
+      this->interfaceNetlinkFd = -1;
+      this->isInterfaceObserverActive = false;
+      return;
+    }
+
+    this->interfaceObserverThread = new std::thread([this]() {
+      char buffer[4096];
+
+      while (this->isInterfaceObserverActive) {
+        struct pollfd pfd = { this->interfaceNetlinkFd, POLLIN, 0 };
+        const auto events = poll(&pfd, 1, 512);
+
+        if (events < 0) {
+          break;
+        }
+
+        // timeout: just recheck the run flag
+        if (events == 0) {
+          continue;
+        }
+
+        if (recv(this->interfaceNetlinkFd, buffer, sizeof(buffer), 0) <= 0) {
+          break;
+        }
+
+        // a change usually arrives as a burst of netlink messages -
+        // drain what is already queued and rebuild the snapshot once
+        while (recv(this->interfaceNetlinkFd, buffer, sizeof(buffer), MSG_DONTWAIT) > 0);
+
+        this->notifyInterfaceChange();
+      }
+    });
+  #elif defined(_WIN32)
+    const auto status = NotifyIpInterfaceChange(
+      AF_UNSPEC,
+      [](PVOID context, PMIB_IPINTERFACE_ROW row, MIB_NOTIFICATION_TYPE type) {
+        reinterpret_cast<Core::OS *>(context)->notifyInterfaceChange();
+      },
+      this,
+      FALSE,
+      &this->interfaceChangeHandle
+    );
+
+    if (status != NO_ERROR) {
+      this->interfaceChangeHandle = nullptr;
+      this->isInterfaceObserverActive = false;
+    }
+  #endif
+  }
+
+  void Core::OS::stopInterfaceObserver () {
+    if (!this->isInterfaceObserverActive.exchange(false)) {
+      return;
+    }
+
+  #if defined(__APPLE__)
+    if (this->interfacePathMonitor != nullptr) {
+      nw_path_monitor_cancel(this->interfacePathMonitor);
+      this->interfacePathMonitor = nullptr;
+    }
+  #elif defined(__linux__) && !defined(__ANDROID__)
+    // the reader polls with a timeout, so clearing the run flag above is
+    // enough to let it wind down before the socket is closed
+    if (this->interfaceObserverThread != nullptr) {
+      if (this->interfaceObserverThread->joinable()) {
+        this->interfaceObserverThread->join();
+      }
+
+      delete this->interfaceObserverThread;
+      this->interfaceObserverThread = nullptr;
+    }
+
+    if (this->interfaceNetlinkFd >= 0) {
+      close(this->interfaceNetlinkFd);
+      this->interfaceNetlinkFd = -1;
+    }
+  #elif defined(_WIN32)
+    if (this->interfaceChangeHandle != nullptr) {
+      CancelMibChangeNotify2(this->interfaceChangeHandle);
+      this->interfaceChangeHandle = nullptr;
+    }
+  #endif
+  }
+
+  void Core::OS::notifyInterfaceChange () {
+    // whatever the diff below decides, the platform says something
+    // changed, so the cached enumeration is stale
+    this->invalidateCachedInfo("os.networkInterfaces");
+
+    JSON::Object ipv4;
+    JSON::Object ipv6;
+    Map snapshot;
+
+    if (this->enumerateNetworkInterfaces(ipv4, ipv6, snapshot) != 0) {
+      return;
+    }
+
+    JSON::Array::Entries added;
+    JSON::Array::Entries removed;
+    JSON::Array::Entries changed;
+    Vector<Module::Callback> subscribers;
+
+    do {
+      Lock lock(this->interfaceSubscribersMutex);
+
+      for (const auto& entry : snapshot) {
+        const auto previous = this->lastInterfaceSnapshot.find(entry.first);
+
+        if (previous == this->lastInterfaceSnapshot.end()) {
+          added.push_back(entry.first);
+        } else if (previous->second != entry.second) {
+          changed.push_back(entry.first);
+        }
+      }
+
+      for (const auto& entry : this->lastInterfaceSnapshot) {
+        if (!snapshot.contains(entry.first)) {
+          removed.push_back(entry.first);
+        }
+      }
+
+      this->lastInterfaceSnapshot = std::move(snapshot);
+
+      // path monitors report more than address changes - suppress
+      // notifications that do not alter the enumeration
+      if (added.empty() && removed.empty() && changed.empty()) {
+        return;
       }
-    }
 
-    uv_free_interface_addresses(infos, count);
+      for (const auto& entry : this->interfaceSubscribers) {
+        subscribers.push_back(entry.second);
+      }
+    } while (0);
 
-    data["ipv4"] = ipv4;
-    data["ipv6"] = ipv6;
+    JSON::Object data;
+    data.set("ipv4", std::move(ipv4));
+    data.set("ipv6", std::move(ipv6));
 
     auto json = JSON::Object::Entries {
-      {"source", "os.networkInterfaces"},
-      {"data", data}
+      {"source", "os.networkInterfaces.subscribe"},
+      {"data", JSON::Object::Entries {
+        {"added", added},
+        {"removed", removed},
+        {"changed", changed},
+        {"interfaces", data}
+      }}
     };
 
-    cb(seq, json, Post{});
+    for (const auto& subscriber : subscribers) {
+      subscriber("-1", json, Post{});
+    }
   }
 
   void Core::OS::rusage (
     const String seq,
     Module::Callback cb
   ) {
+    String cached;
+    if (this->getCachedInfo("os.rusage", cached)) {
+      cb(seq, JSON::Raw(cached), Post{});
+      return;
+    }
+
     uv_rusage_t usage;
     auto status = uv_getrusage(&usage);
 
@@ -435,13 +1195,14 @@ namespace SSC {
       return;
     }
 
-    auto json = JSON::Object::Entries {
+    auto json = JSON::Object(JSON::Object::Entries {
       {"source", "os.rusage"},
       {"data", JSON::Object::Entries {
         {"ru_maxrss", usage.ru_maxrss}
       }}
-    };
+    });
 
+    this->putCachedInfo("os.rusage", json.str());
     cb(seq, json, Post{});
   }
 
@@ -512,11 +1273,10 @@ namespace SSC {
     auto bytes = toBytes(hrtime);
     auto size = bytes.size();
     auto post = Post {};
-    auto body = new char[size]{0};
     auto json = JSON::Object {};
-    post.body = body;
+    post.body = BufferPool::instance()->acquire(size);
     post.length = size;
-    memcpy(body, bytes.data(), size);
+    memcpy(post.body.get(), bytes.data(), size);
     cb(seq, json, post);
   }
 
@@ -528,11 +1288,10 @@ namespace SSC {
     auto bytes = toBytes(memory);
     auto size = bytes.size();
     auto post = Post {};
-    auto body = new char[size]{0};
     auto json = JSON::Object {};
-    post.body = body;
+    post.body = BufferPool::instance()->acquire(size);
     post.length = size;
-    memcpy(body, bytes.data(), size);
+    memcpy(post.body.get(), bytes.data(), size);
     cb(seq, json, post);
   }
 
@@ -611,14 +1370,12 @@ namespace SSC {
       if (event == "domcontentloaded") {
         Lock lock(this->core->fs.mutex);
 
-        for (auto const &tuple : this->core->fs.descriptors) {
-          auto desc = tuple.second;
+        this->core->fs.descriptors.each([this](uint64_t id, FS::Descriptor*& desc) {
           if (desc != nullptr) {
             desc->stale = true;
-          } else {
-            this->core->fs.descriptors.erase(tuple.first);
+            this->core->fs.trackWeakDescriptor(desc);
           }
-        }
+        });
 
         #if !defined(__ANDROID__)
         for (auto const &tuple : this->core->fs.watchers) {
@@ -856,91 +1613,183 @@ namespace SSC {
     LookupOptions options,
     Core::Module::Callback cb
   ) {
-    this->core->dispatchEventLoop([=, this]() {
-      auto ctx = new Core::Module::RequestContext(seq, cb);
-      auto loop = this->core->getEventLoop();
+    const auto key = options.hostname + ":" + std::to_string(options.family);
 
-      struct addrinfo hints = {0};
+    // a fresh cached result - positive or negative - answers right here
+    // without touching the resolver threadpool
+    do {
+      Lock lock(this->cacheMutex);
+      const auto entry = this->cache.find(key);
 
-      if (options.family == 6) {
-        hints.ai_family = AF_INET6;
-      } else if (options.family == 4) {
-        hints.ai_family = AF_INET;
-      } else {
-        hints.ai_family = AF_UNSPEC;
+      if (entry != this->cache.end()) {
+        if (std::chrono::steady_clock::now() < entry->second.expiry) {
+          return cb(seq, entry->second.json, Post{});
+        }
+
+        this->cache.erase(entry);
       }
+    } while (0);
 
-      hints.ai_socktype = 0; // `0` for any
-      hints.ai_protocol = 0; // `0` for any
+    this->core->dispatchEventLoop([=, this]() {
+      // the stub resolver engine answers over the loop's own sockets;
+      // `uv_getaddrinfo` - which parks a threadpool slot for the whole
+      // resolution - only runs when the engine cannot serve the lookup
+      if (this->resolveWithEngine(seq, options, key, cb)) {
+        return;
+      }
 
-      auto resolver = new uv_getaddrinfo_t;
-      resolver->data = ctx;
+      this->lookupWithThreadPool(seq, options, key, cb);
+    });
+  }
 
-      auto err = uv_getaddrinfo(loop, resolver, [](uv_getaddrinfo_t *resolver, int status, struct addrinfo *res) {
-        auto ctx = (Core::DNS::RequestContext*) resolver->data;
+  void Core::DNS::lookupWithThreadPool (
+    const String seq,
+    const LookupOptions options,
+    const String key,
+    Core::Module::Callback cb
+  ) {
+    // pooled: a lookup burst recycles contexts instead of paying an
+    // allocation per query
+    struct LookupContext :
+      Core::Module::RequestContext,
+      Pooled<LookupContext>
+    {
+      String key;
+      Core::DNS *dns;
+
+      LookupContext (String seq, Core::Module::Callback cb, String key, Core::DNS *dns) {
+        this->seq = seq;
+        this->cb = cb;
+        this->key = key;
+        this->dns = dns;
+      }
+    };
 
-        if (status < 0) {
-          auto result = JSON::Object::Entries {
-            {"source", "dns.lookup"},
-            {"err", JSON::Object::Entries {
-              {"code", std::to_string(status)},
-              {"message", String(uv_strerror(status))}
-            }}
-          };
+    auto ctx = new LookupContext(seq, cb, key, this);
+    auto loop = this->core->getEventLoop();
 
-          ctx->cb(ctx->seq, result, Post{});
-          uv_freeaddrinfo(res);
-          delete resolver;
-          delete ctx;
-          return;
-        }
+    struct addrinfo hints = {0};
 
-        String address = "";
+    if (options.family == 6) {
+      hints.ai_family = AF_INET6;
+    } else if (options.family == 4) {
+      hints.ai_family = AF_INET;
+    } else {
+      hints.ai_family = AF_UNSPEC;
+    }
 
-        if (res->ai_family == AF_INET) {
-          char addr[17] = {'\0'};
-          uv_ip4_name((struct sockaddr_in*)(res->ai_addr), addr, 16);
-          address = String(addr, 17);
-        } else if (res->ai_family == AF_INET6) {
-          char addr[40] = {'\0'};
-          uv_ip6_name((struct sockaddr_in6*)(res->ai_addr), addr, 39);
-          address = String(addr, 40);
-        }
+    hints.ai_socktype = 0; // `0` for any
+    hints.ai_protocol = 0; // `0` for any
 
-        address = address.erase(address.find('\0'));
+    auto resolver = new uv_getaddrinfo_t;
+    resolver->data = ctx;
 
-        auto family = res->ai_family == AF_INET
-          ? 4
-          : res->ai_family == AF_INET6
-            ? 6
-            : 0;
+    auto err = uv_getaddrinfo(loop, resolver, [](uv_getaddrinfo_t *resolver, int status, struct addrinfo *res) {
+      auto ctx = (LookupContext*) resolver->data;
 
+      if (status < 0) {
         auto result = JSON::Object::Entries {
           {"source", "dns.lookup"},
-          {"data", JSON::Object::Entries {
-            {"address", address},
-            {"family", family}
+          {"err", JSON::Object::Entries {
+            {"code", std::to_string(status)},
+            {"message", String(uv_strerror(status))}
           }}
         };
 
+        // only a definitive "no such name" is cached - transient
+        // resolver failures retry on the next lookup
+        if (status == UV_EAI_NONAME || status == UV_EAI_NODATA) {
+          Lock lock(ctx->dns->cacheMutex);
+          ctx->dns->cache[ctx->key] = {
+            JSON::Object(result),
+            std::chrono::steady_clock::now() + Core::DNS::NEGATIVE_CACHE_TTL
+          };
+        }
+
         ctx->cb(ctx->seq, result, Post{});
         uv_freeaddrinfo(res);
         delete resolver;
         delete ctx;
-      }, options.hostname.c_str(), nullptr, &hints);
+        return;
+      }
 
-      if (err < 0) {
-        auto result = JSON::Object::Entries {
-          {"source", "dns.lookup"},
-          {"err", JSON::Object::Entries {
-            {"code", std::to_string(err)},
-            {"message", String(uv_strerror(err))}
-          }}
-        };
+      String address = "";
 
-        ctx->cb(seq, result, Post{});
-        delete ctx;
+      if (res->ai_family == AF_INET) {
+        char addr[17] = {'\0'};
+        uv_ip4_name((struct sockaddr_in*)(res->ai_addr), addr, 16);
+        address = String(addr, 17);
+      } else if (res->ai_family == AF_INET6) {
+        char addr[40] = {'\0'};
+        uv_ip6_name((struct sockaddr_in6*)(res->ai_addr), addr, 39);
+        address = String(addr, 40);
       }
+
+      address = address.erase(address.find('\0'));
+
+      auto family = res->ai_family == AF_INET
+        ? 4
+        : res->ai_family == AF_INET6
+          ? 6
+          : 0;
+
+      auto result = JSON::Object::Entries {
+        {"source", "dns.lookup"},
+        {"data", JSON::Object::Entries {
+          {"address", address},
+          {"family", family}
+        }}
+      };
+
+      do {
+        Lock lock(ctx->dns->cacheMutex);
+        ctx->dns->cache[ctx->key] = {
+          JSON::Object(result),
+          std::chrono::steady_clock::now() + Core::DNS::CACHE_TTL
+        };
+      } while (0);
+
+      ctx->cb(ctx->seq, result, Post{});
+      uv_freeaddrinfo(res);
+      delete resolver;
+      delete ctx;
+    }, options.hostname.c_str(), nullptr, &hints);
+
+    if (err < 0) {
+      auto result = JSON::Object::Entries {
+        {"source", "dns.lookup"},
+        {"err", JSON::Object::Entries {
+          {"code", std::to_string(err)},
+          {"message", String(uv_strerror(err))}
+        }}
+      };
+
+      ctx->cb(seq, result, Post{});
+      delete ctx;
+    }
+  }
+
+  void Core::DNS::prefetch (
+    const String seq,
+    LookupOptions options,
+    Core::Module::Callback cb
+  ) {
+    // resolve through `lookup` so the result lands in the cache, then
+    // report whether the name resolved - the addresses themselves are
+    // served from the cache by later lookups
+    this->lookup("-1", options, [=](auto _, auto json, auto post) {
+      const auto failed = json.type == JSON::Type::Object &&
+        json.template as<JSON::Object>().has("err");
+
+      auto result = JSON::Object::Entries {
+        {"source", "dns.prefetch"},
+        {"data", JSON::Object::Entries {
+          {"hostname", options.hostname},
+          {"resolved", !failed}
+        }}
+      };
+
+      cb(seq, result, Post{});
     });
   }
 
@@ -976,6 +1825,14 @@ namespace SSC {
       Lock lock(core->loopMutex);
       auto loop = core->getEventLoop();
       uv_run(loop, UV_RUN_NOWAIT);
+      // back under the glib poll - the check handle marked the loop
+      // busy when callbacks started, so mark it idle again for the
+      // watchdog now that this turn's callbacks are done
+      core->eventLoopHeartbeat.store(
+        monotonicMilliseconds(),
+        std::memory_order_relaxed
+      );
+      core->eventLoopInPoll.store(true, std::memory_order_relaxed);
       return G_SOURCE_CONTINUE;
     }
   };
@@ -988,19 +1845,111 @@ namespace SSC {
 
     didLoopInit = true;
     Lock lock(loopMutex);
+    SSC_TRACE_SPAN("launch", "Core::initEventLoop");
+
+    // threadpool sizing from `[runtime]` in the user config: libuv reads
+    // `UV_THREADPOOL_SIZE` exactly once, before its pool starts, so it
+    // has to be in the environment ahead of the first submitted request -
+    // an explicit environment variable still wins over the config
+    static const auto userConfig = getUserConfig();
+
+    if (
+      !Env::has("UV_THREADPOOL_SIZE") &&
+      userConfig.contains("runtime_uv_threadpool_size")
+    ) {
+      Env::set("UV_THREADPOOL_SIZE", userConfig.at("runtime_uv_threadpool_size"));
+    }
+
+    if (userConfig.contains("runtime_worker_pool_size")) {
+      this->workerPool.setConcurrency(
+        std::atoi(userConfig.at("runtime_worker_pool_size").c_str())
+      );
+    }
+
+    if (userConfig.contains("runtime_long_running_worker_pool_size")) {
+      this->longRunningWorkerPool.setConcurrency(
+        std::atoi(userConfig.at("runtime_long_running_worker_pool_size").c_str())
+      );
+    }
+
+    // opt-in multi-loop mode: `[runtime] event_loop_count` loops in
+    // total, handles pinned to one of them by id - see the
+    // `SecondaryEventLoop` doc comment
+    if (userConfig.contains("runtime_event_loop_count")) {
+      static constexpr int MAX_EVENT_LOOP_COUNT = 64;
+      const auto count = std::atoi(userConfig.at("runtime_event_loop_count").c_str());
+
+      for (int i = 1; i < std::min(count, MAX_EVENT_LOOP_COUNT); ++i) {
+        auto secondary = std::make_unique<SecondaryEventLoop>();
+
+        uv_loop_init(&secondary->loop);
+        secondary->async.data = (void *) secondary.get();
+        uv_async_init(&secondary->loop, &secondary->async, [](uv_async_t* handle) {
+          auto secondary = reinterpret_cast<SecondaryEventLoop *>(handle->data);
+          EventLoopDispatchCallback dispatch;
+
+          while (secondary->queue.pop(dispatch)) {
+            if (dispatch != nullptr) dispatch();
+          }
+
+          if (!secondary->isRunning) {
+            uv_stop(&secondary->loop);
+          }
+        });
+
+        this->secondaryEventLoops.push_back(std::move(secondary));
+      }
+    }
+
     uv_loop_init(&eventLoop);
+
+    // heartbeat for the stall watchdog - see the member doc comment
+    eventLoopWatchdogPrepare.data = (void *) this;
+    uv_prepare_init(&eventLoop, &eventLoopWatchdogPrepare);
+    uv_prepare_start(&eventLoopWatchdogPrepare, [](uv_prepare_t* handle) {
+      auto core = reinterpret_cast<SSC::Core *>(handle->data);
+    #if !defined(_WIN32)
+      core->eventLoopThreadId.store(pthread_self(), std::memory_order_relaxed);
+    #endif
+      core->eventLoopHeartbeat.store(
+        monotonicMilliseconds(),
+        std::memory_order_relaxed
+      );
+      core->eventLoopInPoll.store(true, std::memory_order_relaxed);
+    });
+    uv_unref((uv_handle_t *) &eventLoopWatchdogPrepare);
+
+    eventLoopWatchdogCheck.data = (void *) this;
+    uv_check_init(&eventLoop, &eventLoopWatchdogCheck);
+    uv_check_start(&eventLoopWatchdogCheck, [](uv_check_t* handle) {
+      auto core = reinterpret_cast<SSC::Core *>(handle->data);
+      core->eventLoopHeartbeat.store(
+        monotonicMilliseconds(),
+        std::memory_order_relaxed
+      );
+      core->eventLoopInPoll.store(false, std::memory_order_relaxed);
+    });
+    uv_unref((uv_handle_t *) &eventLoopWatchdogCheck);
+
+    if (userConfig.contains("runtime_watchdog") && userConfig.at("runtime_watchdog") == "true") {
+      uint64_t threshold = 250;
+
+      if (userConfig.contains("runtime_watchdog_threshold")) {
+        threshold = std::atoi(userConfig.at("runtime_watchdog_threshold").c_str());
+      }
+
+      this->diagnostics.startWatchdog(threshold);
+    }
+
     eventLoopAsync.data = (void *) this;
     uv_async_init(&eventLoop, &eventLoopAsync, [](uv_async_t *handle) {
       auto core = reinterpret_cast<SSC::Core  *>(handle->data);
-      while (true) {
-        std::function<void()> dispatch;
-        {
-          Lock lock(core->loopMutex);
-          if (core->eventLoopDispatchQueue.size() == 0) break;
-          dispatch = core->eventLoopDispatchQueue.front();
-          core->eventLoopDispatchQueue.pop();
+      EventLoopDispatchCallback dispatch;
+      while (core->eventLoopDispatchQueue.pop(dispatch)) {
+        if (dispatch != nullptr) {
+          SSC_TRACE_SPAN("loop", "eventLoop.dispatch");
+          dispatch();
         }
-        if (dispatch != nullptr) dispatch();
       }
     });
 
@@ -1023,6 +1972,22 @@ namespace SSC {
     return &eventLoop;
   }
 
+  uv_loop_t* Core::getEventLoop (uint64_t id) {
+    initEventLoop();
+
+    if (this->secondaryEventLoops.size() == 0) {
+      return &eventLoop;
+    }
+
+    const auto slot = id % (this->secondaryEventLoops.size() + 1);
+
+    if (slot == 0) {
+      return &eventLoop;
+    }
+
+    return &this->secondaryEventLoops[slot - 1]->loop;
+  }
+
   int Core::getEventLoopTimeout () {
     auto loop = getEventLoop();
     uv_update_time(loop);
@@ -1035,6 +2000,26 @@ namespace SSC {
 
   void Core::stopEventLoop() {
     isLoopRunning = false;
+
+    this->diagnostics.stopWatchdog();
+
+    // the async callback sees `isRunning == false` and stops its loop
+    for (auto& secondary : this->secondaryEventLoops) {
+      if (secondary->isRunning.exchange(false)) {
+        uv_async_send(&secondary->async);
+
+        if (secondary->thread != nullptr) {
+          if (secondary->thread->joinable()) {
+            secondary->thread->join();
+          }
+
+          delete secondary->thread;
+          secondary->thread = nullptr;
+        }
+      }
+    }
+
+    eventLoopWakeup.notify_one();
     uv_stop(&eventLoop);
   #if defined(__ANDROID__) || defined(_WIN32)
     if (eventLoopThread != nullptr) {
@@ -1060,30 +2045,77 @@ namespace SSC {
     sleepEventLoop(getEventLoopTimeout());
   }
 
+  void Core::waitEventLoop () {
+    std::unique_lock<std::mutex> lock(eventLoopWakeupMutex);
+    eventLoopWakeup.wait(lock, [this]() {
+      return eventLoopHasPendingWakeup.load() || !isLoopRunning;
+    });
+    eventLoopHasPendingWakeup = false;
+  }
+
   void Core::signalDispatchEventLoop () {
     initEventLoop();
     runEventLoop();
+    {
+      std::lock_guard<std::mutex> lock(eventLoopWakeupMutex);
+      eventLoopHasPendingWakeup = true;
+    }
+    eventLoopWakeup.notify_one();
     uv_async_send(&eventLoopAsync);
   }
 
   void Core::dispatchEventLoop (EventLoopDispatchCallback callback) {
-    {
-      Lock lock(loopMutex);
-      eventLoopDispatchQueue.push(callback);
+    SSC_TRACE_INSTANT("loop", "Core::dispatchEventLoop");
+    eventLoopDispatchQueue.push(callback);
+    signalDispatchEventLoop();
+  }
+
+  void Core::dispatchEventLoop (uint64_t id, EventLoopDispatchCallback callback) {
+    if (this->secondaryEventLoops.size() == 0) {
+      return this->dispatchEventLoop(callback);
     }
 
-    signalDispatchEventLoop();
+    const auto slot = id % (this->secondaryEventLoops.size() + 1);
+
+    if (slot == 0) {
+      return this->dispatchEventLoop(callback);
+    }
+
+    SSC_TRACE_INSTANT("loop", "Core::dispatchEventLoop");
+    // mirrors `signalDispatchEventLoop` - the loop threads start on the
+    // first dispatch
+    this->runEventLoop();
+
+    auto& secondary = this->secondaryEventLoops[slot - 1];
+    secondary->queue.push(callback);
+    uv_async_send(&secondary->async);
+  }
+
+  void Core::dispatchWorkerPool (EventLoopDispatchCallback callback) {
+    this->workerPool.dispatch(callback);
+  }
+
+  void Core::dispatchLongRunningWorkerPool (EventLoopDispatchCallback callback) {
+    this->longRunningWorkerPool.dispatch(callback);
   }
 
   void pollEventLoop (Core *core) {
     auto loop = core->getEventLoop();
 
     while (core->isLoopRunning) {
-      core->sleepEventLoop(EVENT_LOOP_POLL_TIMEOUT);
-
+      // `uv_run` blocks in the backend until the nearest pending timer or a
+      // wakeup through `eventLoopAsync` — there is no fixed poll interval
       do {
         uv_run(loop, UV_RUN_DEFAULT);
       } while (core->isLoopRunning && core->isLoopAlive());
+
+      if (!core->isLoopRunning) {
+        break;
+      }
+
+      // the loop has no live handles or requests left —
+      // park until the next dispatch/timer/handle registration
+      core->waitEventLoop();
     }
 
     core->isLoopRunning = false;
@@ -1096,7 +2128,19 @@ namespace SSC {
 
     isLoopRunning = true;
 
+    SSC_TRACE_SPAN("launch", "Core::runEventLoop");
     initEventLoop();
+
+    // secondary loops park inside `uv_run` on their referenced async
+    // handles until stopped, so each thread is just the blocking run
+    for (auto& secondary : this->secondaryEventLoops) {
+      if (!secondary->isRunning.exchange(true)) {
+        secondary->thread = new std::thread([loop = &secondary->loop]() {
+          uv_run(loop, UV_RUN_DEFAULT);
+        });
+      }
+    }
+
     dispatchEventLoop([=, this]() {
       initTimers();
       startTimers();
@@ -1121,29 +2165,43 @@ namespace SSC {
 #endif
   }
 
+  // releases descriptors that have gone weak (stale and unretained).
+  // `FS::trackWeakDescriptor` links candidates into `FS::weakDescriptors`
+  // at the moment they go weak and starts this timer on demand, so the
+  // timer only ever walks candidates - never the whole descriptor table -
+  // and stays stopped while the list is empty
   static Timer releaseWeakDescriptors = {
+    .repeated = true,
     .timeout = 256, // in milliseconds
+    .interval = 256,
     .invoke = [](uv_timer_t *handle) {
       auto core = reinterpret_cast<Core *>(handle->data);
-      Vector<uint64_t> ids;
-      String msg = "";
+      auto candidates = Vector<uint64_t> {};
 
-      {
+      do {
         Lock lock(core->fs.mutex);
-        for (auto const &tuple : core->fs.descriptors) {
-          ids.push_back(tuple.first);
-        }
-      }
+        candidates.assign(
+          core->fs.weakDescriptors.begin(),
+          core->fs.weakDescriptors.end()
+        );
+      } while (0);
 
-      for (auto const id : ids) {
-        Lock lock(core->fs.mutex);
-        auto desc = core->fs.descriptors.at(id);
+      for (auto const id : candidates) {
+        auto desc = core->fs.descriptors.get(id);
 
         if (desc == nullptr) {
+          // should not happen - descriptors untrack themselves before
+          // deletion - but never leave a dangling candidate behind
+          Lock lock(core->fs.mutex);
+          core->fs.weakDescriptors.remove(id);
           core->fs.descriptors.erase(id);
           continue;
         }
 
+        // unlink before closing: the close completion deletes the
+        // descriptor and a retained descriptor is no longer a candidate
+        core->fs.untrackWeakDescriptor(desc);
+
         if (desc->isRetained() || !desc->isStale()) {
           continue;
         }
@@ -1154,13 +2212,253 @@ namespace SSC {
           core->fs.close("", id, [](auto seq, auto msg, auto post) {});
         } else {
           // free
-          core->fs.descriptors.erase(id);
+          core->fs.removeDescriptor(id);
           delete desc;
         }
       }
+
+      do {
+        Lock lock(core->fs.mutex);
+        if (core->fs.weakDescriptors.empty()) {
+          uv_timer_stop(handle);
+        }
+      } while (0);
+    }
+  };
+
+  // samples event loop lag for `Core::Diagnostics`: the timer asks for a
+  // fixed interval and any overshoot past the due date is time the loop
+  // spent busy (or blocked) in callbacks. the handle is unreferenced in
+  // `initTimers` so sampling never keeps the loop alive on its own.
+  static constexpr uint64_t EVENT_LOOP_LAG_SAMPLE_INTERVAL = 512; // in milliseconds
+  static Timer sampleEventLoopLag = {
+    .repeated = true,
+    .timeout = EVENT_LOOP_LAG_SAMPLE_INTERVAL,
+    .interval = EVENT_LOOP_LAG_SAMPLE_INTERVAL,
+    .invoke = [](uv_timer_t *handle) {
+      auto core = reinterpret_cast<Core *>(handle->data);
+      const auto now = uv_hrtime();
+      const auto last = core->diagnostics.lastEventLoopSample.exchange(
+        now,
+        std::memory_order_relaxed
+      );
+
+      if (last == 0) {
+        return;
+      }
+
+      const auto expected = EVENT_LOOP_LAG_SAMPLE_INTERVAL * 1000000ull;
+      const auto elapsed = now - last;
+
+      // a sample spanning a parked loop (no referenced handles) measures
+      // idle time, not lag - treat it as a discontinuity and drop it
+      if (elapsed > 64 * expected) {
+        return;
+      }
+
+      core->diagnostics.eventLoopLag.record(
+        elapsed > expected ? elapsed - expected : 0
+      );
+    }
+  };
+
+  // drives `Core::timerWheel` - started on demand when the first
+  // deadline is scheduled and stopped again once the wheel drains, so
+  // an idle wheel costs nothing and never keeps the loop awake
+  static Timer timerWheelTick = {
+    .repeated = true,
+    .timeout = TimerWheel::TICK_INTERVAL,
+    .interval = TimerWheel::TICK_INTERVAL,
+    .invoke = [](uv_timer_t* handle) {
+      auto core = reinterpret_cast<Core *>(handle->data);
+
+      core->timerWheel.tick();
+
+      if (!core->timerWheel.isActive()) {
+        uv_timer_stop(handle);
+      }
     }
   };
 
+  TimerWheel::ID TimerWheel::setTimeout (
+    uint64_t timeout,
+    const Callback& callback
+  ) {
+    return this->schedule(timeout, 0, callback);
+  }
+
+  TimerWheel::ID TimerWheel::setInterval (
+    uint64_t interval,
+    const Callback& callback
+  ) {
+    return this->schedule(interval, interval, callback);
+  }
+
+  TimerWheel::ID TimerWheel::schedule (
+    uint64_t timeout,
+    uint64_t interval,
+    const Callback& callback
+  ) {
+    Lock lock(this->mutex);
+
+    // deadlines round up to a whole tick and fire at tick granularity
+    const auto ticks = std::max(
+      uint64_t(1),
+      (timeout + TICK_INTERVAL - 1) / TICK_INTERVAL
+    );
+
+    const auto slot = (this->cursor + ticks) & (SLOTS - 1);
+    const auto id = this->nextId++;
+
+    auto& bucket = this->wheel[slot];
+    bucket.push_back(Entry {
+      .id = id,
+      .callback = callback,
+      // the slot is first visited `((ticks - 1) % SLOTS) + 1` ticks from
+      // now, so a deadline of exactly N revolutions waits N - 1 rounds
+      .remainingRounds = (ticks - 1) / SLOTS,
+      .interval = interval == 0
+        ? 0
+        : std::max(uint64_t(1), (interval + TICK_INTERVAL - 1) / TICK_INTERVAL)
+    });
+
+    this->entries[id] = &bucket.back();
+    return id;
+  }
+
+  bool TimerWheel::clearTimer (ID id) {
+    Lock lock(this->mutex);
+    const auto entry = this->entries.find(id);
+
+    if (entry == this->entries.end()) {
+      return false;
+    }
+
+    // the node itself is removed lazily when its slot next comes up
+    entry->second->cancelled = true;
+    entry->second->callback = nullptr;
+    this->entries.erase(entry);
+    return true;
+  }
+
+  bool TimerWheel::isActive () {
+    Lock lock(this->mutex);
+    return this->entries.size() > 0;
+  }
+
+  void TimerWheel::tick () {
+    Vector<Callback> due;
+
+    do {
+      Lock lock(this->mutex);
+
+      this->cursor++;
+
+      const auto currentSlot = this->cursor & (SLOTS - 1);
+      auto& bucket = this->wheel[currentSlot];
+
+      // repeating entries that land back in the slot being walked are
+      // parked here so the walk does not revisit them this tick
+      std::list<Entry> requeue;
+
+      auto it = bucket.begin();
+
+      while (it != bucket.end()) {
+        if (it->cancelled) {
+          it = bucket.erase(it);
+          continue;
+        }
+
+        if (it->remainingRounds > 0) {
+          it->remainingRounds--;
+          ++it;
+          continue;
+        }
+
+        due.push_back(it->callback);
+
+        if (it->interval > 0) {
+          // reschedule with a splice - the entry pointer in the id
+          // index stays valid
+          const auto slot = (this->cursor + it->interval) & (SLOTS - 1);
+          auto& target = slot == currentSlot ? requeue : this->wheel[slot];
+          it->remainingRounds = (it->interval - 1) / SLOTS;
+          const auto next = std::next(it);
+          target.splice(target.end(), bucket, it);
+          it = next;
+        } else {
+          this->entries.erase(it->id);
+          it = bucket.erase(it);
+        }
+      }
+
+      bucket.splice(bucket.end(), requeue);
+    } while (0);
+
+    // callbacks run outside the lock so they can schedule and cancel
+    for (const auto& callback : due) {
+      if (callback != nullptr) {
+        callback();
+      }
+    }
+  }
+
+  TimerWheel::ID Core::setTimeout (
+    uint64_t timeout,
+    const TimerWheel::Callback& callback
+  ) {
+    const auto id = this->timerWheel.setTimeout(timeout, callback);
+    this->startTimerWheel();
+    return id;
+  }
+
+  TimerWheel::ID Core::setInterval (
+    uint64_t interval,
+    const TimerWheel::Callback& callback
+  ) {
+    const auto id = this->timerWheel.setInterval(interval, callback);
+    this->startTimerWheel();
+    return id;
+  }
+
+  bool Core::clearTimer (TimerWheel::ID id) {
+    return this->timerWheel.clearTimer(id);
+  }
+
+  void Core::startTimerWheel () {
+    this->dispatchEventLoop([this]() {
+      this->initTimers();
+
+      Lock lock(this->timersMutex);
+
+      if (!uv_is_active((uv_handle_t *) &timerWheelTick.handle)) {
+        uv_timer_start(
+          &timerWheelTick.handle,
+          timerWheelTick.invoke,
+          TimerWheel::TICK_INTERVAL,
+          TimerWheel::TICK_INTERVAL
+        );
+      }
+    });
+  }
+
+  void Core::startWeakDescriptorTimer () {
+    this->dispatchEventLoop([this]() {
+      this->initTimers();
+
+      Lock lock(this->timersMutex);
+
+      if (!uv_is_active((uv_handle_t *) &releaseWeakDescriptors.handle)) {
+        uv_timer_start(
+          &releaseWeakDescriptors.handle,
+          releaseWeakDescriptors.invoke,
+          releaseWeakDescriptors.timeout,
+          releaseWeakDescriptors.interval
+        );
+      }
+    });
+  }
+
   void Core::initTimers () {
     if (didTimersInit) {
       return;
@@ -1171,7 +2469,9 @@ namespace SSC {
     auto loop = getEventLoop();
 
     std::vector<Timer *> timersToInit = {
-      &releaseWeakDescriptors
+      &releaseWeakDescriptors,
+      &sampleEventLoopLag,
+      &timerWheelTick
     };
 
     for (const auto& timer : timersToInit) {
@@ -1179,6 +2479,8 @@ namespace SSC {
       timer->handle.data = (void *) this;
     }
 
+    uv_unref((uv_handle_t *) &sampleEventLoopLag.handle);
+
     didTimersInit = true;
   }
 
@@ -1186,7 +2488,7 @@ namespace SSC {
     Lock lock(timersMutex);
 
     std::vector<Timer *> timersToStart = {
-      &releaseWeakDescriptors
+      &sampleEventLoopLag
     };
 
     for (const auto &timer : timersToStart) {
@@ -1217,7 +2519,9 @@ namespace SSC {
     Lock lock(timersMutex);
 
     std::vector<Timer *> timersToStop = {
-      &releaseWeakDescriptors
+      &releaseWeakDescriptors,
+      &sampleEventLoopLag,
+      &timerWheelTick
     };
 
     for (const auto& timer : timersToStop) {
@@ -1226,6 +2530,16 @@ namespace SSC {
       }
     }
 
+    // the wheel tick and the weak descriptor release timer are started
+    // on demand rather than by `startTimers`
+    if (uv_is_active((uv_handle_t *) &timerWheelTick.handle)) {
+      uv_timer_stop(&timerWheelTick.handle);
+    }
+
+    if (uv_is_active((uv_handle_t *) &releaseWeakDescriptors.handle)) {
+      uv_timer_stop(&releaseWeakDescriptors.handle);
+    }
+
     didTimersStart = false;
   }
 }
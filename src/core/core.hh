@@ -5,17 +5,21 @@
 #include "config.hh"
 #include "debug.hh"
 #include "env.hh"
+#include "heap.hh"
 #include "ini.hh"
 #include "io.hh"
 #include "json.hh"
 #include "platform.hh"
 #include "preload.hh"
 #include "string.hh"
+#include "trace.hh"
 #include "types.hh"
 #include "version.hh"
 
 #if !defined(__ANDROID__)
 #include "file_system_watcher.hh"
+#else
+#include <android/asset_manager.h>
 #endif
 
 #if defined(__APPLE__)
@@ -38,8 +42,6 @@
 #endif
 
 namespace SSC {
-  constexpr int EVENT_LOOP_POLL_TIMEOUT = 32; // in milliseconds
-
   uint64_t rand64 ();
   void msleep (uint64_t ms);
 
@@ -82,6 +84,10 @@ namespace SSC {
         public:
           String key;
           Value value;
+          // index into the well-known runtime header key table, -1 for
+          // everything else - interned once at construction so lookups
+          // against runtime headers compare an integer, not a string
+          int interned = -1;
           Header () = default;
           Header (const Header& header);
           Header (const String& key, const Value& value);
@@ -92,7 +98,6 @@ namespace SSC {
       Headers () = default;
       Headers (const Headers& headers);
       Headers (const String& source);
-      Headers (const Vector<std::map<String, Value>>& entries);
       Headers (const Entries& entries);
       size_t size () const;
       String str () const;
@@ -101,22 +106,708 @@ namespace SSC {
       void set (const Header& header);
       bool has (const String& name) const;
       const Header& get (const String& name) const;
+
+      // headers for a binary `Post` body - the hot per-packet paths
+      // (udp recv, tcp read, fs read) ship the same two headers on
+      // every message, so only the content length varies
+      static Headers forPostBody (size_t contentLength);
+  };
+
+  /**
+   * A pool of reusable byte buffers for `Post` bodies. Buffers are handed
+   * out as reference counted `std::shared_ptr<char[]>` values so a body can
+   * travel from a libuv callback through the router to a webview scheme
+   * handler without copies, and storage is recycled into per-size-class
+   * free lists when the last reference drops instead of hitting the
+   * allocator on every message.
+   */
+  class BufferPool {
+    public:
+      using Buffer = std::shared_ptr<char[]>;
+
+      static constexpr size_t MIN_SIZE_CLASS = 64;
+      static constexpr size_t MAX_SIZE_CLASS = 1024 * 1024;
+      static constexpr size_t MAX_FREE_PER_CLASS = 64;
+
+      // size classes at or above this boundary are allocated on it, so
+      // any pooled buffer of at least a page can back unbuffered
+      // (`O_DIRECT`) file IO without a separate aligned allocator
+      static constexpr size_t DIRECT_ALIGNMENT = 4096;
+
+      static BufferPool* instance () {
+        static BufferPool pool;
+        return &pool;
+      }
+
+      // rounds `size` up to the next power-of-two size class
+      static size_t sizeClass (size_t size) {
+        size_t result = MIN_SIZE_CLASS;
+        while (result < size) result <<= 1;
+        return result;
+      }
+
+      // allocation counters for `Core::Diagnostics` - recorded relaxed,
+      // never read on the acquire/release paths themselves
+      std::atomic<uint64_t> acquires = 0; // total acquisitions
+      std::atomic<uint64_t> reuses = 0; // served from a free list
+      std::atomic<uint64_t> allocations = 0; // hit the allocator
+      std::atomic<uint64_t> recycles = 0; // returned to a free list
+      std::atomic<uint64_t> frees = 0; // released to the allocator
+
+      // acquires raw pooled storage of at least `size` bytes — intended for
+      // APIs like `uv_buf_t` that need a raw pointer, pair with `adopt()`
+      char* acquireRaw (size_t size) {
+        auto klass = sizeClass(size);
+
+        this->acquires.fetch_add(1, std::memory_order_relaxed);
+
+        if (klass <= MAX_SIZE_CLASS) {
+          Lock lock(this->mutex);
+          auto& list = this->freeLists[klass];
+          if (!list.empty()) {
+            auto bytes = list.back();
+            list.pop_back();
+            this->reuses.fetch_add(1, std::memory_order_relaxed);
+            return bytes;
+          }
+        }
+
+        // callers always track how many bytes were actually filled, so
+        // fresh allocations skip the zero-fill just like recycled buffers
+        this->allocations.fetch_add(1, std::memory_order_relaxed);
+        Heap::track(Heap::Tag::bufferPool, klass);
+
+        if (klass >= DIRECT_ALIGNMENT) {
+          return (char*) ::operator new[](klass, std::align_val_t(DIRECT_ALIGNMENT));
+        }
+
+        return new char[klass];
+      }
+
+      // wraps storage previously returned by `acquireRaw(size)` in a
+      // reference counted buffer that recycles it when the count drops
+      Buffer adopt (char* bytes, size_t size) {
+        if (bytes == nullptr) return nullptr;
+        return Buffer(bytes, [this, size](char* pointer) {
+          this->release(pointer, size);
+        });
+      }
+
+      Buffer acquire (size_t size) {
+        return this->adopt(this->acquireRaw(size), size);
+      }
+
+      void release (char* bytes, size_t size) {
+        auto klass = sizeClass(size);
+
+        if (klass <= MAX_SIZE_CLASS) {
+          Lock lock(this->mutex);
+          auto& list = this->freeLists[klass];
+          if (list.size() < MAX_FREE_PER_CLASS) {
+            list.push_back(bytes);
+            this->recycles.fetch_add(1, std::memory_order_relaxed);
+            return;
+          }
+        }
+
+        this->frees.fetch_add(1, std::memory_order_relaxed);
+        Heap::untrack(Heap::Tag::bufferPool, klass);
+
+        if (klass >= DIRECT_ALIGNMENT) {
+          ::operator delete[]((void*) bytes, std::align_val_t(DIRECT_ALIGNMENT));
+          return;
+        }
+
+        delete [] bytes;
+      }
+
+    private:
+      Mutex mutex;
+      std::unordered_map<size_t, Vector<char*>> freeLists;
+  };
+
+  /**
+   * A bounded FIFO of pooled body chunks connecting a streaming producer
+   * to the scheme handler draining a chunked `Post` response. `write()`
+   * returns `false` once the buffered byte count crosses the high-water
+   * mark (or the stream has been cancelled) so the producer can pause —
+   * stop a `uv_read`, delay the next `fs.read` — and the `onDrain`
+   * callback fires once the consumer drains the queue back below the
+   * low-water mark. Callbacks are invoked without the stream lock held.
+   */
+  class PostChunkStream {
+    public:
+      struct Chunk {
+        BufferPool::Buffer body = nullptr;
+        size_t size = 0;
+        bool finished = false;
+      };
+
+      static constexpr size_t HIGH_WATER_MARK = 4 * 1024 * 1024;
+      static constexpr size_t LOW_WATER_MARK = HIGH_WATER_MARK / 2;
+
+      using Callback = std::function<void()>;
+
+      // set by the producer before writing and by the consumer before
+      // reading, respectively
+      Callback onDrain = nullptr;
+      Callback onReadable = nullptr;
+
+      bool write (BufferPool::Buffer body, size_t size, bool finished = false) {
+        Callback readable = nullptr;
+        bool wantsMore = false;
+
+        do {
+          Lock lock(this->mutex);
+
+          if (this->ended) {
+            return false;
+          }
+
+          this->chunks.push(Chunk { body, size, finished });
+          this->buffered += size;
+
+          if (finished) {
+            this->ended = true;
+          }
+
+          wantsMore = this->buffered < HIGH_WATER_MARK;
+
+          if (!wantsMore && !this->ended) {
+            this->saturated = true;
+          }
+
+          readable = this->onReadable;
+        } while (0);
+
+        if (readable != nullptr) {
+          readable();
+        }
+
+        return wantsMore;
+      }
+
+      bool read (Chunk& chunk) {
+        Callback drain = nullptr;
+
+        do {
+          Lock lock(this->mutex);
+
+          if (this->chunks.size() == 0) {
+            return false;
+          }
+
+          chunk = this->chunks.front();
+          this->chunks.pop();
+          this->buffered -= chunk.size;
+
+          if (this->saturated && this->buffered <= LOW_WATER_MARK) {
+            this->saturated = false;
+            drain = this->onDrain;
+          }
+        } while (0);
+
+        if (drain != nullptr) {
+          drain();
+        }
+
+        return true;
+      }
+
+      // `true` once the final chunk was written or the consumer tore the
+      // stream down — producers should stop when this flips
+      bool isClosed () {
+        Lock lock(this->mutex);
+        return this->ended;
+      }
+
+      // tears the stream down from the consumer side (e.g. the webview
+      // task went away) so subsequent writes report failure
+      void cancel () {
+        Lock lock(this->mutex);
+        this->ended = true;
+        this->onReadable = nullptr;
+        while (this->chunks.size() > 0) {
+          this->chunks.pop();
+        }
+        this->buffered = 0;
+      }
+
+    private:
+      Mutex mutex;
+      Queue<Chunk> chunks;
+      size_t buffered = 0;
+      bool ended = false;
+      bool saturated = false;
   };
 
   struct Post {
+    using Body = BufferPool::Buffer;
     uint64_t id = 0;
     uint64_t ttl = 0;
-    char* body = nullptr;
+    Body body = nullptr;
     size_t length = 0;
-    String headers = "";
+    // carried structured end to end - scheme handlers emit each entry
+    // natively instead of reparsing a preformatted header string
+    Headers headers;
     String workerId = "";
     std::shared_ptr<std::function<bool(const char*, const char*, bool)>> event_stream;
     std::shared_ptr<std::function<bool(const char*, size_t, bool)>> chunk_stream;
+    // buffered alternative to `chunk_stream` with backpressure — see
+    // `PostChunkStream`
+    std::shared_ptr<PostChunkStream> stream = nullptr;
+  };
+
+  /**
+   * Serializes a JSON array incrementally into a `PostChunkStream` so
+   * results with unbounded cardinality never hold a full `JSON::Any`
+   * tree in memory. Producers `push()` one row at a time; rows are
+   * written into a pending buffer that is flushed to the stream as a
+   * pooled chunk once it crosses `CHUNK_SIZE`, and `end()` emits the
+   * closing bracket with the final chunk. `push()` returns `false` when
+   * the producer should pause (stream saturated) or stop — check
+   * `isClosed()` on the stream to tell the two apart.
+   */
+  class JSONArrayStream {
+    public:
+      static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+      std::shared_ptr<PostChunkStream> stream = nullptr;
+
+      JSONArrayStream (std::shared_ptr<PostChunkStream> stream)
+        : stream(stream)
+      {
+        this->pending.reserve(CHUNK_SIZE);
+        this->pending += '[';
+      }
+
+      bool push (const JSON::Any& row) {
+        if (this->ended || this->stream->isClosed()) {
+          return false;
+        }
+
+        if (!this->first) {
+          this->pending += ',';
+        }
+
+        this->first = false;
+        row.write(this->pending);
+
+        if (this->pending.size() >= CHUNK_SIZE) {
+          return this->flush(false);
+        }
+
+        return true;
+      }
+
+      bool end () {
+        if (this->ended) {
+          return false;
+        }
+
+        this->ended = true;
+        this->pending += ']';
+        return this->flush(true);
+      }
+
+    private:
+      String pending;
+      bool first = true;
+      bool ended = false;
+
+      bool flush (bool finished) {
+        const auto size = this->pending.size();
+        auto body = size > 0
+          ? BufferPool::instance()->acquire(size)
+          : Post::Body(nullptr);
+
+        if (body != nullptr) {
+          memcpy(body.get(), this->pending.data(), size);
+        }
+
+        this->pending.clear();
+        return this->stream->write(body, size, finished);
+      }
+  };
+
+  /**
+   * A shared flag connecting an abortable IPC request (a scheme task the
+   * webview has stopped) to the in-flight work it started. The module
+   * servicing the request may install an `oncancel` hook to pull still
+   * queued work back out (`uv_cancel`); `cancel()` flips the flag and
+   * runs the hook exactly once — if the token was already cancelled when
+   * the hook is installed, `setHandler` runs it immediately instead.
+   */
+  struct CancellationToken {
+    using Handler = std::function<void()>;
+
+    std::atomic<bool> cancelled = false;
+    Mutex mutex;
+    Handler oncancel = nullptr;
+
+    bool isCancelled () const {
+      return this->cancelled.load(std::memory_order_acquire);
+    }
+
+    void cancel () {
+      Handler handler = nullptr;
+
+      do {
+        Lock lock(this->mutex);
+        this->cancelled.store(true, std::memory_order_release);
+        handler = std::move(this->oncancel);
+        this->oncancel = nullptr;
+      } while (0);
+
+      if (handler != nullptr) {
+        handler();
+      }
+    }
+
+    void setHandler (const Handler& handler) {
+      bool wasCancelled = false;
+
+      do {
+        Lock lock(this->mutex);
+        wasCancelled = this->isCancelled();
+        if (!wasCancelled) {
+          this->oncancel = handler;
+        }
+      } while (0);
+
+      if (wasCancelled && handler != nullptr) {
+        handler();
+      }
+    }
+  };
+
+  using CancellationTokenPointer = std::shared_ptr<CancellationToken>;
+
+  /**
+   * A per-type freelist for the fixed-size request contexts the modules
+   * allocate per async call. FS/DNS/OS issue these at rates of hundreds
+   * of thousands per minute, all identically sized — a context class
+   * opts in by also deriving `Pooled<itself>`, which overrides its
+   * `operator new`/`operator delete` to recycle raw blocks, so issuing
+   * an op allocates nothing in steady state (short seq strings stay in
+   * SSO storage inside the recycled block). The freelist is bounded;
+   * bursts beyond `MAX_POOLED` fall back to the heap. Must only be
+   * derived by the most-derived context class — the freelist hands out
+   * blocks of exactly `sizeof(T)`.
+   */
+  template <typename T> struct Pooled {
+    static constexpr size_t MAX_POOLED = 256;
+
+    static inline Mutex poolMutex;
+    static inline Vector<void*> pool;
+
+    static void* operator new (size_t size) {
+      if (size == sizeof(T)) {
+        Lock lock(poolMutex);
+
+        if (!pool.empty()) {
+          auto block = pool.back();
+          pool.pop_back();
+          return block;
+        }
+      }
+
+      return ::operator new(size);
+    }
+
+    static void operator delete (void* block, size_t size) {
+      if (size == sizeof(T)) {
+        Lock lock(poolMutex);
+
+        if (pool.size() < MAX_POOLED) {
+          pool.push_back(block);
+          return;
+        }
+      }
+
+      ::operator delete(block);
+    }
+
+    static void operator delete (void* block) {
+      operator delete(block, sizeof(T));
+    }
   };
 
-  using Posts = std::map<uint64_t, Post>;
   using EventLoopDispatchCallback = std::function<void()>;
 
+  /**
+   * A lock-free multi-producer single-consumer FIFO queue for event loop
+   * dispatch callbacks (Vyukov-style intrusive queue with a stub node).
+   * Producers (`push`) may be called from any thread and never block the
+   * consumer. `pop` MUST only be called from the loop thread. A `false`
+   * return from `pop` while a producer is mid-push is fine: producers
+   * always signal `eventLoopAsync` after a completed push, so the loop
+   * is woken again and drains the remainder.
+   */
+  class EventLoopDispatchQueue {
+    public:
+      struct Node {
+        std::atomic<Node*> next = nullptr;
+        EventLoopDispatchCallback callback = nullptr;
+      };
+
+      EventLoopDispatchQueue () :
+        head(&this->stub),
+        tail(&this->stub)
+      {}
+
+      ~EventLoopDispatchQueue () {
+        EventLoopDispatchCallback callback;
+        while (this->pop(callback));
+      }
+
+      void push (EventLoopDispatchCallback callback) {
+        auto node = new Node();
+        node->callback = callback;
+        this->depth.fetch_add(1, std::memory_order_relaxed);
+        auto prev = this->head.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+      }
+
+      // approximate pending callback count - maintained with relaxed
+      // counters for `Core::Diagnostics`, not for synchronization
+      size_t size () const {
+        return this->depth.load(std::memory_order_relaxed);
+      }
+
+      bool pop (EventLoopDispatchCallback& callback) {
+        auto tail = this->tail;
+        auto next = tail->next.load(std::memory_order_acquire);
+
+        if (tail == &this->stub) {
+          if (next == nullptr) {
+            return false;
+          }
+
+          this->tail = next;
+          tail = next;
+          next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next != nullptr) {
+          this->tail = next;
+          callback = std::move(tail->callback);
+          delete tail;
+          this->depth.fetch_sub(1, std::memory_order_relaxed);
+          return true;
+        }
+
+        if (tail != this->head.load(std::memory_order_acquire)) {
+          // a producer is mid-push, let the next wakeup drain it
+          return false;
+        }
+
+        this->pushStub();
+        next = tail->next.load(std::memory_order_acquire);
+
+        if (next != nullptr) {
+          this->tail = next;
+          callback = std::move(tail->callback);
+          delete tail;
+          this->depth.fetch_sub(1, std::memory_order_relaxed);
+          return true;
+        }
+
+        return false;
+      }
+
+    private:
+      void pushStub () {
+        this->stub.next.store(nullptr, std::memory_order_relaxed);
+        auto prev = this->head.exchange(&this->stub, std::memory_order_acq_rel);
+        prev->next.store(&this->stub, std::memory_order_release);
+      }
+
+      std::atomic<Node*> head;
+      Node* tail;
+      Node stub;
+      std::atomic<uint64_t> depth = 0;
+  };
+
+  /**
+   * A small fixed pool of worker threads for blocking work that does not
+   * touch loop-affine libuv state, such as `uv_fs_*` requests executed
+   * synchronously (`NULL` callback). Dispatching here skips the hop
+   * through the event loop that `Core::dispatchEventLoop` takes before
+   * libuv would hand the request to its own threadpool anyway. Work that
+   * must run on the loop thread still belongs on `dispatchEventLoop`.
+   * Threads start lazily on first dispatch and join on destruction.
+   */
+  class WorkerPool {
+    public:
+      static constexpr int CONCURRENCY = 4;
+
+      WorkerPool () = default;
+      WorkerPool (int concurrency) : concurrency(concurrency) {}
+      WorkerPool (const WorkerPool&) = delete;
+
+      ~WorkerPool () {
+        do {
+          std::unique_lock<std::mutex> lock(this->mutex);
+          this->stopped = true;
+        } while (0);
+
+        this->available.notify_all();
+
+        for (auto& thread : this->threads) {
+          if (thread.joinable()) {
+            thread.join();
+          }
+        }
+      }
+
+      /**
+       * Applies until the first dispatch starts the threads - later
+       * calls and non-positive sizes are ignored.
+       */
+      void setConcurrency (int concurrency) {
+        std::unique_lock<std::mutex> lock(this->mutex);
+
+        if (this->threads.size() == 0 && concurrency > 0) {
+          this->concurrency = concurrency;
+        }
+      }
+
+      void dispatch (EventLoopDispatchCallback callback) {
+        std::unique_lock<std::mutex> lock(this->mutex);
+
+        if (this->threads.size() == 0) {
+          for (auto i = 0; i < this->concurrency; ++i) {
+            this->threads.emplace_back([this]() {
+              while (true) {
+                EventLoopDispatchCallback work = nullptr;
+
+                do {
+                  std::unique_lock<std::mutex> lock(this->mutex);
+                  this->available.wait(lock, [this]() {
+                    return this->stopped || this->queue.size() > 0;
+                  });
+
+                  if (this->stopped && this->queue.size() == 0) {
+                    return;
+                  }
+
+                  work = this->queue.front();
+                  this->queue.pop();
+                } while (0);
+
+                work();
+              }
+            });
+          }
+        }
+
+        this->queue.push(callback);
+        lock.unlock();
+        this->available.notify_one();
+      }
+
+    private:
+      int concurrency = CONCURRENCY;
+      std::mutex mutex;
+      std::condition_variable available;
+      Queue<EventLoopDispatchCallback> queue;
+      Vector<Thread> threads;
+      bool stopped = false;
+  };
+
+  /**
+   * A hash map keyed on `uint64_t` ids, split into independently locked
+   * shards so lookups and mutations on unrelated ids do not contend on a
+   * single mutex. Intended for id-to-entry tables with high churn such as
+   * the peers and posts tables on `Core`.
+   */
+  template <typename V, size_t SHARD_COUNT = 16>
+  class ShardedMap {
+    public:
+      struct Shard {
+        Mutex mutex;
+        std::unordered_map<uint64_t, V> entries;
+      };
+
+      bool has (uint64_t id) {
+        auto& shard = this->shard(id);
+        Lock lock(shard.mutex);
+        return shard.entries.find(id) != shard.entries.end();
+      }
+
+      V get (uint64_t id) {
+        auto& shard = this->shard(id);
+        Lock lock(shard.mutex);
+        auto entry = shard.entries.find(id);
+        if (entry == shard.entries.end()) return V{};
+        return entry->second;
+      }
+
+      void set (uint64_t id, V value) {
+        auto& shard = this->shard(id);
+        Lock lock(shard.mutex);
+        shard.entries.insert_or_assign(id, value);
+      }
+
+      bool erase (uint64_t id) {
+        auto& shard = this->shard(id);
+        Lock lock(shard.mutex);
+        return shard.entries.erase(id) > 0;
+      }
+
+      // removes the entry for `id` and moves it into `value`,
+      // returning `false` when there is no such entry
+      bool extract (uint64_t id, V& value) {
+        auto& shard = this->shard(id);
+        Lock lock(shard.mutex);
+        auto entry = shard.entries.find(id);
+        if (entry == shard.entries.end()) return false;
+        value = std::move(entry->second);
+        shard.entries.erase(entry);
+        return true;
+      }
+
+      // visits every entry, holding only one shard lock at a time
+      void each (std::function<void(uint64_t, V&)> visit) {
+        for (auto& shard : this->shards) {
+          Lock lock(shard.mutex);
+          for (auto& entry : shard.entries) {
+            visit(entry.first, entry.second);
+          }
+        }
+      }
+
+      Vector<uint64_t> ids () {
+        Vector<uint64_t> results;
+        for (auto& shard : this->shards) {
+          Lock lock(shard.mutex);
+          for (auto& entry : shard.entries) {
+            results.push_back(entry.first);
+          }
+        }
+        return results;
+      }
+
+      size_t size () {
+        size_t count = 0;
+        for (auto& shard : this->shards) {
+          Lock lock(shard.mutex);
+          count += shard.entries.size();
+        }
+        return count;
+      }
+
+    private:
+      Shard& shard (uint64_t id) {
+        return this->shards[id % SHARD_COUNT];
+      }
+
+      Array<Shard, SHARD_COUNT> shards;
+  };
+
+  using Posts = ShardedMap<Post>;
+
   struct Timer {
     uv_timer_t handle;
     bool repeated = false;
@@ -126,6 +817,57 @@ namespace SSC {
     uv_timer_cb invoke;
   };
 
+  /**
+   * A hashed-timing-wheel timer service. Every pending deadline lives in
+   * one of `SLOTS` buckets keyed by its due tick, so schedule and cancel
+   * are O(1) and all deadlines share one underlying `uv_timer_t` on the
+   * core loop that only runs while entries are pending. Resolution is
+   * `TICK_INTERVAL` milliseconds - coarse on purpose; this serves DNS
+   * cache TTLs, send-queue deadlines, and watch debounce, not animation.
+   * Scheduled through `Core::setTimeout`/`Core::setInterval` and exposed
+   * to extensions as `sapi_context_set_timeout()` and friends.
+   */
+  class TimerWheel {
+    public:
+      using ID = uint64_t;
+      using Callback = std::function<void()>;
+
+      static constexpr uint64_t TICK_INTERVAL = 16; // in milliseconds
+      static constexpr size_t SLOTS = 512; // must be a power of two
+
+      struct Entry {
+        ID id = 0;
+        Callback callback = nullptr;
+        // full wheel revolutions left before the entry is due
+        uint64_t remainingRounds = 0;
+        uint64_t interval = 0; // in ticks, `0` when not repeating
+        bool cancelled = false;
+      };
+
+      ID setTimeout (uint64_t timeout, const Callback& callback);
+      ID setInterval (uint64_t interval, const Callback& callback);
+      bool clearTimer (ID id);
+
+      /**
+       * Advances the wheel one tick and fires everything due - called
+       * from the underlying timer on the core loop.
+       */
+      void tick ();
+
+      bool isActive ();
+
+    private:
+      ID schedule (uint64_t timeout, uint64_t interval, const Callback& callback);
+
+      Mutex mutex;
+      // buckets are lists so firing reschedules with an O(1) splice and
+      // `Entry` pointers in the id index stay stable
+      Array<std::list<Entry>, SLOTS> wheel;
+      std::unordered_map<ID, Entry*> entries;
+      uint64_t cursor = 0;
+      ID nextId = 1;
+  };
+
   typedef enum {
     PEER_TYPE_NONE = 0,
     PEER_TYPE_TCP = 1 << 1,
@@ -135,7 +877,10 @@ namespace SSC {
 
   typedef enum {
     PEER_FLAG_NONE = 0,
-    PEER_FLAG_EPHEMERAL = 1 << 1
+    PEER_FLAG_EPHEMERAL = 1 << 1,
+    // opt-out of the background/foreground pause/resume cycle — the
+    // socket keeps receiving while the app is backgrounded
+    PEER_FLAG_KEEP_ALIVE = 1 << 2
   } peer_flag_t;
 
   typedef enum {
@@ -150,6 +895,8 @@ namespace SSC {
     // tcp states (20)
     PEER_STATE_TCP_BOUND = 1 << 20,
     PEER_STATE_TCP_CONNECTED = 1 << 21,
+    PEER_STATE_TCP_LISTENING = 1 << 22,
+    PEER_STATE_TCP_READ_STARTED = 1 << 23,
     PEER_STATE_TCP_PAUSED = 1 << 13,
     PEER_STATE_MAX = 1 << 0xF
   } peer_state_t;
@@ -194,12 +941,46 @@ namespace SSC {
         RequestContext (Callback cb) { this->cb = cb; }
       };
 
+      // an async send request reused across `send()` calls so the
+      // fallback path does not allocate per datagram
+      struct SendRequest {
+        uv_udp_send_t req;
+        RequestContext::Callback cb = nullptr;
+        Peer *peer = nullptr;
+      };
+
+      // upper bound on completed send requests kept for reuse
+      static constexpr size_t MAX_POOLED_SEND_REQUESTS = 16;
+
+      // an async stream write request reused across `write()` calls on
+      // TCP peers, mirroring `SendRequest`
+      struct WriteRequest {
+        uv_write_t req;
+        RequestContext::Callback cb = nullptr;
+        Peer *peer = nullptr;
+      };
+
       using UDPReceiveCallback = std::function<void(
         ssize_t,
         const uv_buf_t*,
         const struct sockaddr*
       )>;
 
+      using TCPReceiveCallback = std::function<void(ssize_t, const uv_buf_t*)>;
+      using TCPAcceptCallback = std::function<void(int, uint64_t)>;
+      using TCPConnectCallback = std::function<void(int)>;
+
+      // a datagram waiting in the outbound queue - bytes are copied into
+      // a pooled buffer since the caller's storage does not outlive the
+      // enqueueing call
+      struct OutboundPacket {
+        Post::Body body = nullptr;
+        size_t size = 0;
+        struct sockaddr_in addr;
+        bool hasAddr = false;
+        RequestContext::Callback cb = nullptr;
+      };
+
       // uv handles
       union {
         uv_udp_t udp;
@@ -209,10 +990,38 @@ namespace SSC {
       // sockaddr
       struct sockaddr_in addr;
 
+      // the last destination `send()` resolved - repeated sends to the
+      // same address:port reuse the packed sockaddr instead of parsing
+      // the address string per datagram. `sendAddrPort < 0` means
+      // nothing is cached yet
+      struct sockaddr_in sendAddr;
+      String sendAddrAddress;
+      int sendAddrPort = -1;
+
       // callbacks
       UDPReceiveCallback receiveCallback;
+      TCPReceiveCallback streamReceiveCallback;
+      TCPAcceptCallback acceptCallback;
       std::vector<std::function<void()>> onclose;
 
+      // free lists of completed send and stream write requests
+      Vector<SendRequest*> sendRequestPool;
+      Vector<WriteRequest*> writeRequestPool;
+
+      // segment size currently configured on the socket for
+      // kernel segmentation offload, `0` when disabled
+      size_t gsoSegmentSize = 0;
+
+      // bounded outbound queue - packets wait here instead of piling up
+      // as unbounded send requests inside libuv when the socket cannot
+      // keep up. `outboundDepth == 0` disables the queue
+      Deque<OutboundPacket> outbound;
+      size_t outboundDepth = 0;
+      bool outboundDropNewest = false;
+      size_t outboundInflight = 0;
+      size_t outboundDropped = 0;
+      size_t outboundCoalesced = 0;
+
       // instance state
       uint64_t id = 0;
       std::recursive_mutex mutex;
@@ -249,6 +1058,8 @@ namespace SSC {
       bool isUDP ();
       bool isTCP ();
       bool isEphemeral ();
+      bool isKeepAlive ();
+      void setKeepAlive (bool enabled);
       bool isBound ();
       bool isActive ();
       bool isClosing ();
@@ -261,6 +1072,18 @@ namespace SSC {
       int rebind ();
       int connect (String address, int port);
       int disconnect ();
+      // multicast membership — `source` selects source-specific
+      // membership (SSM) when non-empty, `iface` the local interface
+      // address (any when empty)
+      int setMembership (
+        const String group,
+        const String iface,
+        const String source,
+        uv_membership membership
+      );
+      int setMulticastInterface (const String iface);
+      int setMulticastTTL (int ttl);
+      int setMulticastLoopback (bool enabled);
       void send (
         char *buf,
         size_t size,
@@ -268,6 +1091,48 @@ namespace SSC {
         const String address,
         Peer::RequestContext::Callback cb
       );
+      void send (
+        char *buf,
+        size_t size,
+        int port,
+        const String address,
+        size_t segmentSize,
+        Peer::RequestContext::Callback cb
+      );
+      void write (
+        char *buf,
+        size_t size,
+        struct sockaddr *sockaddr,
+        Peer::RequestContext::Callback cb
+      );
+      int setSegmentSize (size_t segmentSize);
+      void configureQueue (size_t depth, bool dropNewest);
+      void enqueueOutbound (
+        char *buf,
+        size_t size,
+        bool hasAddr,
+        RequestContext::Callback cb
+      );
+      void drainOutbound ();
+      SendRequest* acquireSendRequest (RequestContext::Callback cb);
+      void releaseSendRequest (SendRequest* request);
+      int listen (
+        const String address,
+        int port,
+        int backlog,
+        TCPAcceptCallback onaccept
+      );
+      void connect (const String address, int port, TCPConnectCallback cb);
+      int shutdown (std::function<void(int)> cb);
+      int readstart (TCPReceiveCallback onread);
+      int readstop ();
+      void write (char *buf, size_t size, Peer::RequestContext::Callback cb);
+      void write (
+        const Vector<uv_buf_t>& buffers,
+        Peer::RequestContext::Callback cb
+      );
+      WriteRequest* acquireWriteRequest (RequestContext::Callback cb);
+      void releaseWriteRequest (WriteRequest* request);
       int recvstart ();
       int recvstart (UDPReceiveCallback onrecv);
       int recvstop ();
@@ -309,11 +1174,45 @@ namespace SSC {
       SendFunction sendFunction;
       EmitFunction emitFunction;
 
+      // coalesces characteristic notifications per peripheral: values
+      // accumulate for one flush interval and are delivered as a single
+      // post whose body is the concatenated payloads, with per-entry
+      // extents in the json, instead of one router event per BLE
+      // notification
+      struct CharacteristicBatch {
+        struct Entry {
+          String characteristicId;
+          String serviceId;
+          size_t offset;
+          size_t length;
+        };
+
+        Vector<Entry> entries;
+        Vector<char> body;
+        String name;
+        String uuid;
+      };
+
+      static constexpr uint64_t CHARACTERISTIC_BATCH_INTERVAL = 16; // in milliseconds
+
+      Mutex batchMutex;
+      std::map<String, CharacteristicBatch> characteristicBatches;
+      std::atomic<bool> isBatchFlushScheduled = false;
+
       Bluetooth ();
       ~Bluetooth ();
       bool send (const String& seq, JSON::Any json, Post post);
       bool send (const String& seq, JSON::Any json);
       bool emit (const String& seq, JSON::Any json);
+      void enqueueCharacteristicValue (
+        const String& uuid,
+        const String& name,
+        const String& serviceId,
+        const String& characteristicId,
+        const char* bytes,
+        size_t size
+      );
+      void flushCharacteristicBatches ();
       void startScanning ();
       void publishCharacteristic (
         const String& seq,
@@ -344,11 +1243,22 @@ namespace SSC {
           struct RequestContext {
             String seq;
             Module::Callback cb;
+            // set when the originating IPC request can be aborted —
+            // completion paths consult this to skip serializing results
+            // nobody will consume
+            CancellationTokenPointer cancellation = nullptr;
             RequestContext () = default;
             RequestContext (String seq, Module::Callback cb) {
               this->seq = seq;
               this->cb = cb;
             }
+
+            bool isCancelled () const {
+              return (
+                this->cancellation != nullptr &&
+                this->cancellation->isCancelled()
+              );
+            }
           };
 
           Core *core = nullptr;
@@ -357,9 +1267,116 @@ namespace SSC {
           }
       };
 
+      /**
+       * Always-on sampled runtime metrics. Hot paths record with relaxed
+       * atomic increments and aggregation (percentiles, table sizes) only
+       * happens at query time, so the steady-state cost is a few
+       * uncontended atomic adds per call. Scraped over the bridge with
+       * the `diagnostics.query` route.
+       */
       class Diagnostics : public Module {
         public:
+          // a power-of-two bucketed histogram - `record` is three relaxed
+          // atomic adds, percentiles are estimated from bucket upper
+          // bounds at query time
+          struct Histogram {
+            static constexpr size_t BUCKETS = 40;
+
+            Array<std::atomic<uint64_t>, BUCKETS> buckets {};
+            std::atomic<uint64_t> count = 0;
+            std::atomic<uint64_t> sum = 0;
+
+            void record (uint64_t value) {
+              auto bucket = size_t(0);
+              auto bits = value;
+
+              while (bits >>= 1) {
+                bucket++;
+              }
+
+              if (bucket >= BUCKETS) {
+                bucket = BUCKETS - 1;
+              }
+
+              this->buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+              this->count.fetch_add(1, std::memory_order_relaxed);
+              this->sum.fetch_add(value, std::memory_order_relaxed);
+            }
+
+            uint64_t estimate (double quantile) const;
+            JSON::Object json () const;
+          };
+
+          // per-module call count and dispatch-to-reply latency, recorded
+          // against the route name prefix in `Router::invoke`
+          struct CallMetrics {
+            std::atomic<uint64_t> calls = 0;
+            Histogram latency;
+
+            JSON::Object json () const;
+          };
+
+          CallMetrics fs;
+          CallMetrics udp;
+          CallMetrics dns;
+
+          // event loop lag sampled by an unreferenced repeating timer -
+          // overshoot past the timer due date is time the loop spent busy
+          Histogram eventLoopLag;
+          std::atomic<uint64_t> lastEventLoopSample = 0;
+
+          /**
+           * One captured event loop stall - what the watchdog saw when
+           * the loop thread stayed out of the backend poll past the
+           * configured threshold.
+           */
+          struct Stall {
+            uint64_t timestamp = 0; // ms since epoch, when captured
+            uint64_t duration = 0; // ms the loop had been busy so far
+            String route; // the route executing when the stall began
+            Vector<String> frames; // loop thread backtrace, if captured
+          };
+
+          std::atomic<uint64_t> stallCount = 0;
+          Mutex stallMutex;
+          Stall lastStall;
+
+          // the route a handler is currently executing for, written by
+          // `Router::invoke` through a tiny seqlock so the hot path is
+          // two relaxed increments and a bounded copy, never a lock -
+          // the watchdog reads it to attribute a stall
+          static constexpr size_t ACTIVE_ROUTE_SIZE = 64;
+          std::atomic<uint32_t> activeRouteVersion = 0;
+          char activeRoute[ACTIVE_ROUTE_SIZE] = {0};
+
           Diagnostics (auto core) : Module(core) {}
+
+          void setActiveRoute (const char* name); // `nullptr` clears
+          String getActiveRoute ();
+
+          /**
+           * Starts the stall watchdog: a sibling thread samples the
+           * loop heartbeat (see `eventLoopHeartbeat`) and captures the
+           * loop thread's backtrace and the active route when the loop
+           * stays busy past `threshold` milliseconds. Enabled with
+           * `[runtime] watchdog = true`, threshold from
+           * `[runtime] watchdog_threshold` (default 250ms).
+           */
+          void startWatchdog (uint64_t threshold);
+          void stopWatchdog ();
+
+          CallMetrics* metricsForRoute (const String& name);
+          JSON::Object json ();
+          void query (const String seq, Module::Callback cb);
+
+        private:
+          void captureStall (uint64_t duration);
+
+          std::atomic<bool> watchdogRunning = false;
+          uint64_t watchdogThreshold = 250; // in milliseconds
+          std::mutex watchdogMutex;
+          std::condition_variable watchdogWakeup;
+          Thread* watchdogThread = nullptr;
       };
 
       class DNS : public Module {
@@ -373,17 +1390,87 @@ namespace SSC {
             // - all
             // -verbatim
           };
+          // a cached lookup result - `getaddrinfo` exposes no record
+          // TTLs, so entries age out on a fixed TTL and failures are
+          // kept briefly (negative caching) so a dead name does not
+          // hammer the resolver
+          struct CacheEntry {
+            JSON::Object json;
+            std::chrono::steady_clock::time_point expiry;
+          };
+
+          static constexpr auto CACHE_TTL = std::chrono::seconds(60);
+          static constexpr auto NEGATIVE_CACHE_TTL = std::chrono::seconds(5);
+
+          Mutex cacheMutex;
+          std::map<String, CacheEntry> cache;
+
+          // implemented in `dns.cc`: a stub resolver speaking DNS
+          // directly over the event loop's own UDP sockets, so lookups
+          // never occupy a threadpool slot the way `uv_getaddrinfo`
+          // does; loop-thread-affine and created lazily on first use
+          struct ResolverEngine;
+          ResolverEngine* resolverEngine = nullptr;
+
           void lookup (
             const String seq,
             LookupOptions options,
             Module::Callback cb
           );
+
+          /**
+           * Resolves `options.hostname` without blocking - address
+           * literals and hosts-file entries answer inline, everything
+           * else becomes concurrent A/AAAA queries with per-attempt
+           * timeout and nameserver rotation. Must run on the loop
+           * thread. Returns `false` when the engine cannot serve the
+           * lookup (no nameservers, single-label or invalid names) and
+           * the caller should take the threadpool path instead.
+           */
+          bool resolveWithEngine (
+            const String seq,
+            const LookupOptions options,
+            const String key,
+            Module::Callback cb
+          );
+
+          /**
+           * The `uv_getaddrinfo` path - also the fallback the engine
+           * takes at runtime for answers it cannot produce itself
+           * (timeouts, truncation, server failures). Must run on the
+           * loop thread.
+           */
+          void lookupWithThreadPool (
+            const String seq,
+            const LookupOptions options,
+            const String key,
+            Module::Callback cb
+          );
+          void prefetch (
+            const String seq,
+            LookupOptions options,
+            Module::Callback cb
+          );
       };
 
       class FS : public Module {
         public:
           FS (auto core) : Module(core) {}
 
+          // flush a descriptor's write coalescer once this many bytes
+          // are buffered, or after this many milliseconds — whichever
+          // comes first
+          static constexpr size_t WRITE_COALESCE_SIZE = 64 * 1024;
+          static constexpr uint64_t WRITE_COALESCE_INTERVAL = 16;
+
+          // a buffered `fs.write` waiting in a descriptor's coalescer —
+          // its callback is answered when the combined write settles
+          struct PendingWrite {
+            String seq;
+            size_t size;
+            Module::Callback cb;
+          };
+
           struct Descriptor {
             uint64_t id;
             std::atomic<bool> retained = false;
@@ -393,6 +1480,46 @@ namespace SSC {
             uv_file fd = 0;
             Core *core;
 
+            // position in `FS::weakDescriptors` while this descriptor is
+            // linked there as a release candidate (guarded by `FS::mutex`)
+            std::list<uint64_t>::iterator weakLink;
+            bool isWeakLinked = false;
+
+            // opt-in write coalescer state (`coalesce=true` on
+            // `fs.write`), guarded by `mutex`: sequential writes
+            // accumulate in `writeBuffer` and flush as one write when a
+            // threshold, the timer, a non-contiguous offset, or an
+            // explicit `fs.flush`/close/fsync forces it
+            Vector<char> writeBuffer;
+            Vector<PendingWrite> pendingWrites;
+            int64_t writeBase = 0; // offset of `writeBuffer[0]`, `-1` in append mode
+            int64_t writeNext = 0; // expected offset of the next sequential write
+            bool hasCoalesced = false;
+            bool isFlushScheduled = false;
+
+            // access-pattern advice requested on `fs.open`, applied to
+            // the descriptor once it has a file handle; `dontneed`
+            // also drops each read's pages right after they post
+            String advice = "";
+            bool dropCacheAfterRead = false;
+
+            // opened for unbuffered IO (`O_DIRECT` on Linux,
+            // `F_NOCACHE` on macOS) — writes stage through aligned
+            // pooled buffers and the coalescer is bypassed
+            bool isDirect = false;
+
+          #if defined(__ANDROID__)
+            // set when this descriptor is backed by an app bundle asset
+            // instead of a real file (`fs.open` falls back to
+            // `AAssetManager_open` on `ENOENT`) — reads serve zero-copy
+            // from the asset's mapped buffer and `fd` stays `-1`
+            std::shared_ptr<AAsset> asset = nullptr;
+
+            bool isAsset () const {
+              return this->asset != nullptr;
+            }
+          #endif
+
             Descriptor (Core *core, uint64_t id);
             bool isDirectory ();
             bool isFile ();
@@ -400,16 +1527,29 @@ namespace SSC {
             bool isStale ();
           };
 
-          struct RequestContext : Module::RequestContext {
+          struct RequestContext :
+            Module::RequestContext,
+            Pooled<RequestContext>
+          {
             uint64_t id;
             Descriptor *desc = nullptr;
             uv_fs_t req;
             uv_buf_t buf;
+            // scatter/gather extents for `readv`/`writev` — slices into
+            // the storage tracked by `buf`
+            Vector<uv_buf_t> iovs;
             // 256 which corresponds to DirectoryHandle.MAX_BUFFER_SIZE
             uv_dirent_t dirents[256];
             int offset = 0;
             int result = 0;
             bool recursive;  // A place to stash recursive options when needed
+            // when non-zero, `buf.base` is a pooled staging copy of the
+            // caller's bytes (unbuffered descriptors need block aligned
+            // source memory) and must be released with this size
+            size_t stagedSize = 0;
+            // spans uv threadpool submit to completion - a no-op shell
+            // unless built with `SSC_ENABLE_TRACING`
+            Trace::Span trace { "fs", "uv_fs request" };
 
             RequestContext () = default;
             RequestContext (Descriptor *desc)
@@ -430,7 +1570,6 @@ namespace SSC {
             }
 
             void setBuffer (char* base, uint32_t len);
-            void freeBuffer ();
             char* getBuffer ();
             uint32_t getBufferSize ();
           };
@@ -439,12 +1578,54 @@ namespace SSC {
           std::map<uint64_t, FileSystemWatcher*> watchers;
         #endif
 
-          std::map<uint64_t, Descriptor*> descriptors;
+          // sharded so concurrent lookups on unrelated descriptors do not
+          // convoy on a single table mutex; `mutex` still guards `watchers`
+          ShardedMap<Descriptor*> descriptors;
           Mutex mutex;
 
+          // in-flight request contexts whose IPC message can still be
+          // aborted, keyed by `RequestContext::id` so a cancellation can
+          // reach the queued `uv_fs_t` with `uv_cancel` — only ever
+          // touched on the event loop thread
+          std::map<uint64_t, RequestContext*> cancelableRequests;
+
+          // descriptors that have gone weak (stale and unretained): the
+          // release timer walks only this list instead of sweeping the
+          // whole descriptor table, and stays stopped while it is empty
+          std::list<uint64_t> weakDescriptors;
+
+          // opt-in stat cache (`cache=true` on `fs.stat`/`fs.lstat`):
+          // entries expire after a short TTL and are dropped eagerly when
+          // a watcher reports a change at or under the cached path
+          struct StatCacheEntry {
+            JSON::Object json;
+            std::chrono::steady_clock::time_point expiry;
+          };
+
+          static constexpr auto STAT_CACHE_TTL = std::chrono::milliseconds(500);
+
+          Mutex statCacheMutex;
+          std::unordered_map<String, StatCacheEntry> statCache;
+
+        #if defined(__ANDROID__)
+          // the app bundle's native asset manager, installed over JNI at
+          // runtime startup — lets `fs.open` fall back to bundled assets
+          // for paths that do not exist on the real filesystem
+          AAssetManager* assetManager = nullptr;
+
+          void setAssetManager (AAssetManager* assetManager);
+        #endif
+
           Descriptor * getDescriptor (uint64_t id);
           void removeDescriptor (uint64_t id);
           bool hasDescriptor (uint64_t id);
+          void trackWeakDescriptor (Descriptor *desc);
+          void untrackWeakDescriptor (Descriptor *desc);
+          void trackCancelableRequest (
+            RequestContext *ctx,
+            const CancellationTokenPointer& cancellation
+          );
+          void untrackCancelableRequest (RequestContext *ctx);
 
           void constants (const String seq, Module::Callback cb);
           void access (
@@ -473,6 +1654,17 @@ namespace SSC {
             uv_gid_t gid,
             Module::Callback cb
           );
+          // digests the file at `path` (or, for a directory, every
+          // regular file under it, hashed across parallel worker
+          // threads) with `algorithm` ("crc32c" or "sha256") and
+          // replies with all digests in a single JSON result - no file
+          // bytes cross the bridge
+          void checksum (
+            const String seq,
+            const String path,
+            const String algorithm,
+            Module::Callback cb
+          );
           void close (const String seq, uint64_t id, Module::Callback cb);
           void copyFile (
             const String seq,
@@ -481,6 +1673,13 @@ namespace SSC {
             int flags,
             Module::Callback cb
           );
+          void copy (
+            const String seq,
+            const String src,
+            const String dst,
+            int flags,
+            Module::Callback cb
+          );
           void closedir (const String seq, uint64_t id, Module::Callback cb);
           void closeOpenDescriptor (
             const String seq,
@@ -495,14 +1694,52 @@ namespace SSC {
           );
           void fstat (const String seq, uint64_t id, Module::Callback cb);
           void fsync (const String seq, uint64_t id, Module::Callback cb);
+          // a group durability barrier: flushes every listed descriptor
+          // with one fan-out — the syncs run in parallel on the
+          // threadpool and the callback fires once when the last one
+          // lands, instead of one round trip per file; `metadata`
+          // upgrades the flush from `fdatasync(2)` to `fsync(2)`
+          void syncGroup (
+            const String seq,
+            const Vector<uint64_t> ids,
+            bool metadata,
+            Module::Callback cb
+          );
           void ftruncate (
             const String seq,
             uint64_t id,
             int64_t offset,
             Module::Callback cb
           );
+          // reserves `[offset, offset + length)` on disk up front
+          // (`posix_fallocate(2)` / `F_PREALLOCATE` / file allocation
+          // info) so a file grown by many appending writes lands in
+          // contiguous extents instead of fragmenting
+          void allocate (
+            const String seq,
+            uint64_t id,
+            int64_t offset,
+            int64_t length,
+            Module::Callback cb
+          );
+          // returns `[offset, offset + length)` to the file system as a
+          // sparse hole without changing the file size
+          void punchHole (
+            const String seq,
+            uint64_t id,
+            int64_t offset,
+            int64_t length,
+            Module::Callback cb
+          );
           void getOpenDescriptors (const String seq, Module::Callback cb);
           void lstat (const String seq, const String path, Module::Callback cb);
+          void lstat (
+            const String seq,
+            const String path,
+            bool cache,
+            Module::Callback cb
+          );
+          void invalidateStatCache (const String& path);
 					void link (
             const String seq,
             const String src,
@@ -533,13 +1770,24 @@ namespace SSC {
             const String path,
             Module::Callback cb
           );
+          // `advice` hints the kernel at the descriptor's access
+          // pattern: "sequential" or "random" tune readahead
+          // (`posix_fadvise(2)`, `F_RDAHEAD` on macOS) and "dontneed"
+          // additionally drops just-consumed pages after every read so
+          // streaming a large file stops evicting the page cache.
+          // `direct` opens the descriptor for unbuffered IO — reads of
+          // at least `BufferPool::DIRECT_ALIGNMENT` bytes land in
+          // aligned pooled buffers automatically and the caller is
+          // expected to issue block aligned sizes and offsets
           void open (
             const String seq,
             uint64_t id,
             const String path,
             int flags,
             int mode,
-            Module::Callback cb
+            Module::Callback cb,
+            const String advice = "",
+            bool direct = false
           );
           void opendir (
             const String seq,
@@ -552,12 +1800,35 @@ namespace SSC {
             uint64_t id,
             size_t len,
             size_t offset,
-            Module::Callback cb
+            Module::Callback cb,
+            const CancellationTokenPointer cancellation = nullptr
+          );
+          void readv (
+            const String seq,
+            uint64_t id,
+            const Vector<size_t> sizes,
+            size_t offset,
+            Module::Callback cb,
+            const CancellationTokenPointer cancellation = nullptr
           );
           void readdir (
             const String seq,
             uint64_t id,
             size_t entries,
+            Module::Callback cb,
+            const CancellationTokenPointer cancellation = nullptr
+          );
+          // streams `size` bytes of `path` starting at `offset` (until
+          // EOF when `size` is 0) as a chunked `Post` response - one
+          // IPC call starts a worker-thread pipeline that reads ahead
+          // into pooled chunks and parks on the stream's high-water
+          // mark, so throughput is bounded by the disk instead of a
+          // webview roundtrip per read
+          void readStream (
+            const String seq,
+            const String path,
+            size_t size,
+            size_t offset,
             Module::Callback cb
           );
           void retainOpenDescriptor (
@@ -581,6 +1852,12 @@ namespace SSC {
             const String path,
             Module::Callback cb
           );
+          void stat (
+            const String seq,
+            const String path,
+            bool cache,
+            Module::Callback cb
+          );
           void stopWatch (
             const String seq,
             uint64_t id,
@@ -591,20 +1868,50 @@ namespace SSC {
             const String path,
             Module::Callback cb
           );
+          void walk (
+            const String seq,
+            const String path,
+            Module::Callback cb
+          );
           void watch (
             const String seq,
             uint64_t id,
             const String path,
             Module::Callback cb
           );
+          // a negative `offset` writes at the kernel-tracked position
+          // (append mode for descriptors opened with `O_APPEND`);
+          // `coalesce` routes the write through the descriptor's
+          // coalescer instead of issuing it immediately
           void write (
             const String seq,
             uint64_t id,
             char *bytes,
             size_t size,
-            size_t offset,
+            int64_t offset,
+            Module::Callback cb,
+            const CancellationTokenPointer cancellation = nullptr,
+            bool coalesce = false
+          );
+          void writev (
+            const String seq,
+            uint64_t id,
+            char *bytes,
+            const Vector<size_t> sizes,
+            int64_t offset,
+            Module::Callback cb,
+            const CancellationTokenPointer cancellation = nullptr
+          );
+          void flush (const String seq, uint64_t id, Module::Callback cb);
+          void coalesceWrite (
+            Descriptor *desc,
+            const String seq,
+            char *bytes,
+            size_t size,
+            int64_t offset,
             Module::Callback cb
           );
+          void flushCoalescedWrites (Descriptor *desc, bool sync);
       };
 
       class OS : public Module {
@@ -612,7 +1919,68 @@ namespace SSC {
           static const int RECV_BUFFER = 1;
           static const int SEND_BUFFER = 0;
 
+          // short-ttl cache for poll-heavy info routes (`os.cpus`,
+          // `os.networkInterfaces`, `os.rusage`): dashboards poll these
+          // once per second per window, so repeat calls inside the ttl
+          // hand back the already serialized reply instead of enumerating
+          // through syscalls and rebuilding a JSON tree every time.
+          // platform change notifications (`nw_path_monitor` on apple
+          // platforms) drop the interface entry eagerly
+          struct InfoCacheEntry {
+            String payload;
+            std::chrono::steady_clock::time_point expiry;
+          };
+
+          static constexpr auto INFO_CACHE_TTL = std::chrono::milliseconds(500);
+
+          Mutex infoCacheMutex;
+          std::unordered_map<String, InfoCacheEntry> infoCache;
+
+          // network interface change subscriptions
+          // (`os.networkInterfaces.subscribe`): one platform observer per
+          // process (netlink on linux, `NotifyIpInterfaceChange` on
+          // win32, `nw_path_monitor` on apple platforms) pushes deltas to
+          // every subscriber instead of each window polling the route.
+          // the snapshot is a flat `family:name -> serialized entry` map
+          // diffed against the previous enumeration on every notification
+          Mutex interfaceSubscribersMutex;
+          std::map<uint64_t, Module::Callback> interfaceSubscribers;
+          Map lastInterfaceSnapshot;
+          std::atomic<bool> isInterfaceObserverActive = false;
+
+        #if defined(__APPLE__)
+          nw_path_monitor_t interfacePathMonitor = nullptr;
+        #elif defined(__linux__) && !defined(__ANDROID__)
+          Thread* interfaceObserverThread = nullptr;
+          int interfaceNetlinkFd = -1;
+        #elif defined(_WIN32)
+          HANDLE interfaceChangeHandle = nullptr;
+        #endif
+
           OS (auto core) : Module(core) {}
+
+          bool getCachedInfo (const String& key, String& payload);
+          void putCachedInfo (const String& key, const String& payload);
+          void invalidateCachedInfo (const String& key);
+
+          int enumerateNetworkInterfaces (
+            JSON::Object& ipv4,
+            JSON::Object& ipv6,
+            Map& flat
+          );
+          void subscribeNetworkInterfaces (
+            const String seq,
+            uint64_t id,
+            Module::Callback cb
+          );
+          void unsubscribeNetworkInterfaces (
+            const String seq,
+            uint64_t id,
+            Module::Callback cb
+          );
+          void startInterfaceObserver ();
+          void stopInterfaceObserver ();
+          void notifyInterfaceChange ();
           void bufferSize (
             const String seq,
             uint64_t peerId,
@@ -624,7 +1992,7 @@ namespace SSC {
             const String seq,
             Module::Callback cb
           );
-          void networkInterfaces (const String seq, Module::Callback cb) const;
+          void networkInterfaces (const String seq, Module::Callback cb);
           void rusage (
             const String seq,
             Module::Callback cb
@@ -669,6 +2037,50 @@ namespace SSC {
           );
       };
 
+      class TCP : public Module {
+        public:
+          TCP (auto core) : Module(core) {}
+
+          struct ListenOptions {
+            String address;
+            int port;
+            int backlog = 128;
+          };
+
+          struct ConnectOptions {
+            String address;
+            int port;
+          };
+
+          struct SendOptions {
+            char *bytes = nullptr;
+            size_t size = 0;
+          };
+
+          void listen (
+            const String seq,
+            uint64_t id,
+            ListenOptions options,
+            Module::Callback cb
+          );
+          void connect (
+            const String seq,
+            uint64_t id,
+            ConnectOptions options,
+            Module::Callback cb
+          );
+          void shutdown (const String seq, uint64_t id, Module::Callback cb);
+          void readStart (const String seq, uint64_t id, Module::Callback cb);
+          void readStop (const String seq, uint64_t id, Module::Callback cb);
+          void send (
+            const String seq,
+            uint64_t id,
+            SendOptions options,
+            Module::Callback cb
+          );
+          void close (const String seq, uint64_t id, Module::Callback cb);
+      };
+
       class UDP : public Module {
         public:
           UDP (auto core) : Module(core) {}
@@ -677,6 +2089,9 @@ namespace SSC {
             String address;
             int port;
             bool reuseAddr = false;
+            // keepalive sockets skip the background/foreground
+            // pause/resume cycle entirely
+            bool keepAlive = false;
           };
 
           struct ConnectOptions {
@@ -690,8 +2105,43 @@ namespace SSC {
             char *bytes = nullptr;
             size_t size = 0;
             bool ephemeral = false;
+            // when non-zero, `bytes` is a super-buffer split into
+            // datagrams of this size (kernel segmentation offload where
+            // available, a userspace loop otherwise)
+            size_t segmentSize = 0;
+            // set when the originating IPC request can be aborted — the
+            // send and its completion are skipped once cancelled
+            CancellationTokenPointer cancellation = nullptr;
           };
 
+          struct QueueOptions {
+            size_t depth = 0; // `0` disables the outbound queue
+            bool dropNewest = false; // drop-oldest by default
+          };
+
+          struct MembershipOptions {
+            String group = "";
+            // local interface address the membership applies to — the
+            // OS picks one when empty
+            String iface = "";
+            // source address for source-specific membership (SSM),
+            // any-source membership when empty
+            String source = "";
+          };
+
+          struct MulticastOptions {
+            String iface = "";
+            int ttl = -1; // `-1` leaves the socket TTL unchanged
+            int loopback = -1; // tri-state: `-1` leaves it unchanged
+          };
+
+          void configureQueue (
+            const String seq,
+            uint64_t id,
+            QueueOptions options,
+            Module::Callback cb
+          );
+
           void bind (
             const String seq,
             uint64_t id,
@@ -709,7 +2159,31 @@ namespace SSC {
           void getPeerName (const String seq, uint64_t id, Module::Callback cb);
           void getSockName (const String seq, uint64_t id, Module::Callback cb);
           void getState (const String seq, uint64_t id,  Module::Callback cb);
+          void joinGroup (
+            const String seq,
+            uint64_t id,
+            MembershipOptions options,
+            Module::Callback cb
+          );
+          void leaveGroup (
+            const String seq,
+            uint64_t id,
+            MembershipOptions options,
+            Module::Callback cb
+          );
+          void setMulticastInterface (
+            const String seq,
+            uint64_t id,
+            MulticastOptions options,
+            Module::Callback cb
+          );
           void readStart (const String seq, uint64_t id, Module::Callback cb);
+          void readStart (
+            const String seq,
+            uint64_t id,
+            bool batched,
+            Module::Callback cb
+          );
           void readStop (const String seq, uint64_t id, Module::Callback cb);
           void send (
             const String seq,
@@ -724,16 +2198,28 @@ namespace SSC {
       FS fs;
       OS os;
       Platform platform;
+      TCP tcp;
       UDP udp;
 
-      std::shared_ptr<Posts> posts;
-      std::map<uint64_t, Peer*> peers;
+      Posts posts;
+      ShardedMap<Peer*> peers;
+
+      // a min-heap of `(ttl, id)` pairs so expiry only touches posts that
+      // are actually due, plus a pointer index for `hasPostBody` — entries
+      // for posts that were replaced or already removed are skipped lazily
+      Mutex postExpiryMutex;
+      std::priority_queue<
+        std::pair<uint64_t, uint64_t>,
+        Vector<std::pair<uint64_t, uint64_t>>,
+        std::greater<std::pair<uint64_t, uint64_t>>
+      > postExpiryQueue;
+      std::unordered_set<const char*> postBodies;
 
       std::recursive_mutex loopMutex;
-      std::recursive_mutex peersMutex;
-      std::recursive_mutex postsMutex;
       std::recursive_mutex timersMutex;
 
+      TimerWheel timerWheel;
+
       std::atomic<bool> didLoopInit = false;
       std::atomic<bool> didTimersInit = false;
       std::atomic<bool> didTimersStart = false;
@@ -742,7 +2228,52 @@ namespace SSC {
 
       uv_loop_t eventLoop;
       uv_async_t eventLoopAsync;
-      std::queue<EventLoopDispatchCallback> eventLoopDispatchQueue;
+      EventLoopDispatchQueue eventLoopDispatchQueue;
+
+      // heartbeat for the stall watchdog: the prepare handle marks the
+      // loop idle as it enters the backend poll and the check handle
+      // marks it busy as callbacks start, so time spent blocked in the
+      // poll (an empty loop) never reads as a stall - both handles are
+      // unreferenced and keep nothing alive
+      uv_prepare_t eventLoopWatchdogPrepare;
+      uv_check_t eventLoopWatchdogCheck;
+      std::atomic<uint64_t> eventLoopHeartbeat = 0; // ms, monotonic
+      std::atomic<bool> eventLoopInPoll = true;
+    #if !defined(_WIN32)
+      std::atomic<pthread_t> eventLoopThreadId {};
+    #endif
+
+      /**
+       * One additional event loop for the opt-in multi-loop mode
+       * (`[runtime] event_loop_count` > 1 in the user config). Each
+       * secondary loop runs `uv_run` on its own thread - the referenced
+       * async handle keeps it alive between dispatches - and handles are
+       * pinned to a loop by id (`id % loop count`, slot `0` being the
+       * primary loop), so completion processing for data-heavy peers
+       * scales across cores without app-visible changes.
+       */
+      struct SecondaryEventLoop {
+        uv_loop_t loop;
+        uv_async_t async;
+        EventLoopDispatchQueue queue;
+        std::atomic<bool> isRunning = false;
+        Thread* thread = nullptr;
+      };
+
+      Vector<std::unique_ptr<SecondaryEventLoop>> secondaryEventLoops;
+
+      WorkerPool workerPool;
+
+      // a separate, smaller pool for long-running blocking work
+      // (extension calls, recursive directory walks) so a slow disk or
+      // extension cannot starve the short blocking calls - stats, small
+      // reads - that share `workerPool`
+      WorkerPool longRunningWorkerPool {2};
+
+      // wakes the loop thread when it is parked between uv_run cycles
+      std::mutex eventLoopWakeupMutex;
+      std::condition_variable eventLoopWakeup;
+      std::atomic<bool> eventLoopHasPendingWakeup = false;
 
     #if defined(__APPLE__)
       dispatch_queue_attr_t eventLoopQueueAttrs = dispatch_queue_attr_make_with_qos_class(
@@ -759,20 +2290,36 @@ namespace SSC {
       std::thread *eventLoopThread = nullptr;
     #endif
 
+      // loop, worker pool and config initialization is deferred to the
+      // first dispatch (see `signalDispatchEventLoop`/`getEventLoop`),
+      // so constructing a `Core` on the launch path costs field
+      // initialization only - no uv state exists until the preload
+      // makes its first IPC call
       Core () :
         diagnostics(this),
         dns(this),
         fs(this),
         os(this),
         platform(this),
+        tcp(this),
         udp(this)
-      {
-        this->posts = std::shared_ptr<Posts>(new Posts());
-        initEventLoop();
-      }
+      {}
+
+      // peers transitioned per background/foreground cycle before the
+      // next batch is deferred to a later loop tick, so one transition
+      // never occupies a whole loop iteration (or the lifecycle callback
+      // that triggered it)
+      static constexpr size_t PEER_LIFECYCLE_BATCH_SIZE = 32;
+      static constexpr uint64_t PEER_LIFECYCLE_BATCH_INTERVAL = 16;
 
       void resumeAllPeers ();
       void pauseAllPeers ();
+      void transitionAllPeers (bool resume);
+      void processPeerTransitionBatch (
+        std::shared_ptr<Vector<uint64_t>> ids,
+        size_t offset,
+        bool resume
+      );
       bool hasPeer (uint64_t id);
       void removePeer (uint64_t id);
       void removePeer (uint64_t id, bool autoClose);
@@ -787,24 +2334,39 @@ namespace SSC {
       void removeAllPosts ();
       void expirePosts ();
       void putPost (uint64_t id, Post p);
+      // registers a post for retrieval without building the script
+      // announcement - used when delivery is notified out of band
+      uint64_t registerPost (Post post);
       String createPost (String seq, String params, Post post);
 
       // timers
       void initTimers ();
       void startTimers ();
       void stopTimers ();
+      void startWeakDescriptorTimer ();
+
+      // timer wheel - general timeouts for modules and extensions
+      TimerWheel::ID setTimeout (uint64_t timeout, const TimerWheel::Callback& callback);
+      TimerWheel::ID setInterval (uint64_t interval, const TimerWheel::Callback& callback);
+      bool clearTimer (TimerWheel::ID id);
+      void startTimerWheel ();
 
       // loop
       uv_loop_t* getEventLoop ();
+      uv_loop_t* getEventLoop (uint64_t id);
       int getEventLoopTimeout ();
       bool isLoopAlive ();
       void initEventLoop ();
       void runEventLoop ();
       void stopEventLoop ();
       void dispatchEventLoop (EventLoopDispatchCallback dispatch);
+      void dispatchEventLoop (uint64_t id, EventLoopDispatchCallback dispatch);
+      void dispatchWorkerPool (EventLoopDispatchCallback dispatch);
+      void dispatchLongRunningWorkerPool (EventLoopDispatchCallback dispatch);
       void signalDispatchEventLoop ();
       void sleepEventLoop (int64_t ms);
       void sleepEventLoop ();
+      void waitEventLoop ();
   };
 
   String createJavaScript (const String& name, const String& source);
@@ -0,0 +1,266 @@
+#include "deflate.hh"
+#include <string.h>
+
+namespace SSC::Deflate {
+  static constexpr size_t WINDOW_SIZE = 32768;
+  static constexpr size_t MIN_MATCH = 3;
+  static constexpr size_t MAX_MATCH = 258;
+  static constexpr size_t HASH_BITS = 15;
+  static constexpr size_t HASH_SIZE = 1 << HASH_BITS;
+  // bounds the hash chain walk per position - compression here trades a
+  // little ratio for predictable throughput on the reply path
+  static constexpr size_t MAX_CHAIN = 128;
+
+  // bits accumulate LSB-first per RFC 1951; `fail` latches when the
+  // output capacity is exceeded so the caller can fall back
+  struct BitWriter {
+    char* output;
+    size_t capacity;
+    size_t size = 0;
+    uint32_t bits = 0;
+    int count = 0;
+    bool fail = false;
+
+    BitWriter (char* output, size_t capacity)
+      : output(output),
+        capacity(capacity)
+    {}
+
+    void put (uint32_t value, int width) {
+      this->bits |= value << this->count;
+      this->count += width;
+
+      while (this->count >= 8) {
+        if (this->size >= this->capacity) {
+          this->fail = true;
+          return;
+        }
+
+        this->output[this->size++] = (char) (this->bits & 0xFF);
+        this->bits >>= 8;
+        this->count -= 8;
+      }
+    }
+
+    // Huffman codes are emitted most significant bit first
+    void putCode (uint32_t code, int width) {
+      uint32_t reversed = 0;
+
+      for (int i = 0; i < width; i++) {
+        reversed = (reversed << 1) | ((code >> i) & 1);
+      }
+
+      this->put(reversed, width);
+    }
+
+    void flush () {
+      if (this->count > 0) {
+        if (this->size >= this->capacity) {
+          this->fail = true;
+          return;
+        }
+
+        this->output[this->size++] = (char) (this->bits & 0xFF);
+        this->bits = 0;
+        this->count = 0;
+      }
+    }
+
+    void putByte (uint8_t value) {
+      if (this->size >= this->capacity) {
+        this->fail = true;
+        return;
+      }
+
+      this->output[this->size++] = (char) value;
+    }
+  };
+
+  // fixed literal/length codes (RFC 1951 section 3.2.6)
+  static void putLiteral (BitWriter& out, int literal) {
+    if (literal < 144) {
+      out.putCode(0x30 + literal, 8);
+    } else {
+      out.putCode(0x190 + (literal - 144), 9);
+    }
+  }
+
+  static void putLengthCode (BitWriter& out, int code) {
+    if (code < 280) {
+      out.putCode(code - 256, 7);
+    } else {
+      out.putCode(0xC0 + (code - 280), 8);
+    }
+  }
+
+  static void putLength (BitWriter& out, size_t length) {
+    // codes 257..284 cover 3..257 in ranges of 2^extra, 285 is 258
+    if (length == MAX_MATCH) {
+      return putLengthCode(out, 285);
+    }
+
+    int code = 257;
+    int extra = 0;
+    size_t base = MIN_MATCH;
+
+    while (base + ((size_t) 4 << extra) <= length) {
+      base += (size_t) 4 << extra;
+      if (code >= 261) extra++;
+      code += 4;
+    }
+
+    const auto step = (size_t) 1 << extra;
+    const auto offset = length - base;
+
+    code += (int) (offset / step);
+    putLengthCode(out, code);
+
+    if (extra > 0) {
+      out.put((uint32_t) (offset % step), extra);
+    }
+  }
+
+  static void putDistance (BitWriter& out, size_t distance) {
+    int code = 0;
+    int extra = 0;
+    size_t base = 1;
+
+    while (base + ((size_t) 2 << extra) <= distance) {
+      base += (size_t) 2 << extra;
+      if (code >= 2) extra++;
+      code += 2;
+    }
+
+    const auto step = (size_t) 1 << extra;
+    const auto offset = distance - base;
+
+    code += (int) (offset / step);
+    out.putCode(code, 5);
+
+    if (extra > 0) {
+      out.put((uint32_t) (offset % step), extra);
+    }
+  }
+
+  static inline uint32_t hash (const uint8_t* data) {
+    // multiplicative hash over the 3-byte minimum match
+    const uint32_t value = (uint32_t) data[0]
+      | ((uint32_t) data[1] << 8)
+      | ((uint32_t) data[2] << 16);
+    return (value * 2654435761u) >> (32 - HASH_BITS);
+  }
+
+  size_t compress (
+    const char* input,
+    size_t size,
+    char* output,
+    size_t capacity
+  ) {
+    if (input == nullptr || output == nullptr || capacity < 8) {
+      return 0;
+    }
+
+    auto data = reinterpret_cast<const uint8_t*>(input);
+    BitWriter out(output, capacity);
+
+    // zlib header: deflate, 32K window, fastest compression hint
+    out.putByte(0x78);
+    out.putByte(0x01);
+
+    // one final block, fixed Huffman codes
+    out.put(1, 1);
+    out.put(1, 2);
+
+    // head/prev hash chains over absolute positions, greedy matching
+    static thread_local Vector<int32_t> head;
+    static thread_local Vector<int32_t> prev;
+    head.assign(HASH_SIZE, -1);
+    prev.assign(WINDOW_SIZE, -1);
+
+    size_t position = 0;
+
+    while (position < size && !out.fail) {
+      size_t bestLength = 0;
+      size_t bestDistance = 0;
+
+      if (position + MIN_MATCH <= size) {
+        const auto slot = hash(data + position);
+        auto candidate = head[slot];
+        size_t chain = MAX_CHAIN;
+
+        while (
+          candidate >= 0 &&
+          position - (size_t) candidate <= WINDOW_SIZE &&
+          chain-- > 0
+        ) {
+          const auto limit = size - position < MAX_MATCH
+            ? size - position
+            : MAX_MATCH;
+          size_t length = 0;
+
+          while (
+            length < limit &&
+            data[candidate + length] == data[position + length]
+          ) {
+            length++;
+          }
+
+          if (length > bestLength) {
+            bestLength = length;
+            bestDistance = position - (size_t) candidate;
+
+            if (length == MAX_MATCH) {
+              break;
+            }
+          }
+
+          candidate = prev[candidate % WINDOW_SIZE];
+        }
+
+        prev[position % WINDOW_SIZE] = head[slot];
+        head[slot] = (int32_t) position;
+      }
+
+      if (bestLength >= MIN_MATCH) {
+        putLength(out, bestLength);
+        putDistance(out, bestDistance);
+
+        // index the skipped positions so later matches can reach them
+        const auto end = position + bestLength;
+        position++;
+
+        while (position < end) {
+          if (position + MIN_MATCH <= size) {
+            const auto slot = hash(data + position);
+            prev[position % WINDOW_SIZE] = head[slot];
+            head[slot] = (int32_t) position;
+          }
+          position++;
+        }
+      } else {
+        putLiteral(out, data[position]);
+        position++;
+      }
+    }
+
+    // end of block, then the adler32 trailer on a byte boundary
+    putLengthCode(out, 256);
+    out.flush();
+
+    uint32_t s1 = 1;
+    uint32_t s2 = 0;
+
+    for (size_t i = 0; i < size; i++) {
+      s1 = (s1 + data[i]) % 65521;
+      s2 = (s2 + s1) % 65521;
+    }
+
+    const auto adler = (s2 << 16) | s1;
+    out.putByte((uint8_t) (adler >> 24));
+    out.putByte((uint8_t) (adler >> 16));
+    out.putByte((uint8_t) (adler >> 8));
+    out.putByte((uint8_t) adler);
+
+    return out.fail ? 0 : out.size;
+  }
+}
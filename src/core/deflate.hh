@@ -0,0 +1,27 @@
+#ifndef SSC_CORE_DEFLATE_H
+#define SSC_CORE_DEFLATE_H
+
+#include "types.hh"
+
+namespace SSC::Deflate {
+  /**
+   * Compresses `size` bytes of `input` into `output` as a zlib
+   * (RFC 1950) stream - a single fixed-Huffman DEFLATE block with LZ77
+   * matching, decodable by `DecompressionStream('deflate')` in the
+   * webview and by any zlib inflate. The runtime links no compression
+   * library; this is enough for the large, repetitive JSON bodies the
+   * opt-in Post compression stage targets.
+   *
+   * Returns the compressed byte count, or `0` when the result would not
+   * fit in `capacity` - callers pass the input size as the capacity and
+   * fall back to the uncompressed body when compression does not help.
+   */
+  size_t compress (
+    const char* input,
+    size_t size,
+    char* output,
+    size_t capacity
+  );
+}
+
+#endif
@@ -0,0 +1,870 @@
+#include "core.hh"
+
+#include <algorithm>
+#include <cctype>
+#include <string.h>
+
+/**
+ * A stub DNS resolver for `Core::DNS::lookup` that speaks the wire
+ * format (RFC 1035) directly over the event loop's own UDP sockets.
+ *
+ * `uv_getaddrinfo` parks a threadpool slot for the entire resolution -
+ * a handful of slow lookups can starve all file I/O sharing the default
+ * 4-thread pool. This engine keeps every step on the loop thread:
+ * address literals and hosts-file entries answer inline, everything
+ * else becomes concurrent A/AAAA queries with a per-attempt timeout
+ * that rotates through the configured nameservers. Anything the engine
+ * cannot answer definitively - truncated responses, server failures,
+ * exhausted retries, single-label names that need search-domain
+ * handling - falls back to the `uv_getaddrinfo` path, so behavior only
+ * ever degrades to what it was before.
+ *
+ * All engine state is loop-thread-affine; nothing here takes a lock.
+ */
+namespace SSC {
+  static constexpr uint16_t DNS_TYPE_A = 1;
+  static constexpr uint16_t DNS_TYPE_AAAA = 28;
+  static constexpr uint16_t DNS_CLASS_IN = 1;
+  static constexpr int DNS_PORT = 53;
+
+  // per-attempt timeout; each expiry retransmits through the next
+  // nameserver until the attempt budget is spent
+  static constexpr uint64_t DNS_QUERY_TIMEOUT = 2000;
+  static constexpr int DNS_MAX_ATTEMPTS = 3;
+
+  // `/etc/resolv.conf` and `/etc/hosts` are re-read at most this often
+  static constexpr auto DNS_CONFIG_TTL = std::chrono::seconds(30);
+
+  // record TTLs from responses are honored, clamped to this range so a
+  // zero TTL does not thrash and a huge one does not pin a stale entry
+  static constexpr uint32_t DNS_MIN_RECORD_TTL = 1;
+  static constexpr uint32_t DNS_MAX_RECORD_TTL = 600;
+
+  struct Core::DNS::ResolverEngine {
+    struct Nameserver {
+      sockaddr_storage address;
+      bool ipv6 = false;
+    };
+
+    struct HostsEntry {
+      String ipv4 = "";
+      String ipv6 = "";
+    };
+
+    struct Request;
+
+    // one outstanding question (A or AAAA) of a request
+    struct Question {
+      Request* request = nullptr;
+      uint16_t id = 0;
+      uint16_t type = DNS_TYPE_A;
+      String message = "";
+      int attempts = 0;
+      bool active = false;
+      bool done = false;
+      // a definitive outcome (an address, no-data, or no-such-name) is
+      // final - anything else routes the request to the fallback
+      bool definitive = false;
+      String address = "";
+      uint32_t ttl = 0;
+    };
+
+    // one `lookup()` call in flight through the engine
+    struct Request {
+      Core::DNS* dns = nullptr;
+      String seq;
+      String key;
+      Core::DNS::LookupOptions options;
+      Core::Module::Callback cb = nullptr;
+      Question a;
+      Question aaaa;
+      uv_timer_t timer;
+      int outstanding = 0;
+    };
+
+    Core::DNS* dns = nullptr;
+    uv_udp_t udp4;
+    uv_udp_t udp6;
+    bool udp4Started = false;
+    bool udp6Started = false;
+
+    Vector<Nameserver> nameservers;
+    std::map<String, HostsEntry> hosts;
+    std::chrono::steady_clock::time_point configExpiry;
+    bool configLoaded = false;
+
+    std::unordered_map<uint16_t, Question*> inflight;
+  };
+
+  using Engine = Core::DNS::ResolverEngine;
+
+  static void finishRequest (Engine::Request* request);
+
+  static uint16_t nextQueryId (Engine* engine) {
+    // the id is the main off-path spoofing defence on a long-lived
+    // socket, so every query draws one independently from `rand64`
+    // rather than stepping a sequence an observer could extrapolate;
+    // uniqueness is enforced against the inflight table
+    uint16_t id;
+
+    do {
+      id = (uint16_t) rand64();
+    } while (id == 0 || engine->inflight.contains(id));
+
+    return id;
+  }
+
+  static bool encodeQuery (Engine::Question& question, const String& hostname) {
+    if (hostname.size() == 0 || hostname.size() > 253) {
+      return false;
+    }
+
+    auto& message = question.message;
+    message.clear();
+    message.reserve(hostname.size() + 18);
+
+    message += (char) (question.id >> 8);
+    message += (char) (question.id & 0xFF);
+    message += '\x01'; // RD
+    message += '\0';
+    message += '\0';
+    message += '\x01'; // one question
+    message.append(6, '\0'); // no answer/authority/additional entries
+
+    size_t start = 0;
+    while (start <= hostname.size()) {
+      auto end = hostname.find('.', start);
+      if (end == String::npos) {
+        end = hostname.size();
+      }
+
+      const auto length = end - start;
+      if (length == 0 || length > 63) {
+        // permits a single trailing dot, rejects empty labels otherwise
+        if (length == 0 && end == hostname.size()) break;
+        return false;
+      }
+
+      message += (char) length;
+      message.append(hostname, start, length);
+      start = end + 1;
+    }
+
+    message += '\0';
+    message += (char) (question.type >> 8);
+    message += (char) (question.type & 0xFF);
+    message += '\0';
+    message += (char) DNS_CLASS_IN;
+    return true;
+  }
+
+  // advances `offset` past a possibly compressed name, bounds-checked
+  static bool skipName (const uint8_t* data, size_t size, size_t& offset) {
+    auto cursor = offset;
+    size_t jumps = 0;
+    bool jumped = false;
+
+    while (cursor < size) {
+      const size_t length = data[cursor];
+
+      if ((length & 0xC0) == 0xC0) {
+        if (cursor + 1 >= size || ++jumps > 32) {
+          return false;
+        }
+
+        if (!jumped) {
+          offset = cursor + 2;
+          jumped = true;
+        }
+
+        cursor = ((length & 0x3F) << 8) | data[cursor + 1];
+      } else if (length == 0) {
+        if (!jumped) {
+          offset = cursor + 1;
+        }
+
+        return true;
+      } else {
+        cursor += length + 1;
+      }
+    }
+
+    return false;
+  }
+
+  enum class DNSParseResult {
+    Answer,
+    NoData,
+    NoSuchName,
+    Failure
+  };
+
+  static DNSParseResult parseResponse (
+    const uint8_t* data,
+    size_t size,
+    uint16_t type,
+    String& address,
+    uint32_t& ttl
+  ) {
+    if (size < 12) {
+      return DNSParseResult::Failure;
+    }
+
+    const auto flags = ((size_t) data[2] << 8) | data[3];
+
+    if ((flags & 0x8000) == 0 || (flags & 0x0200) != 0) {
+      // not a response, or truncated - the fallback resolver retries
+      // over whatever transport the system deems fit
+      return DNSParseResult::Failure;
+    }
+
+    const auto rcode = flags & 0x000F;
+
+    if (rcode == 3) {
+      return DNSParseResult::NoSuchName;
+    }
+
+    if (rcode != 0) {
+      return DNSParseResult::Failure;
+    }
+
+    const size_t questions = ((size_t) data[4] << 8) | data[5];
+    const size_t answers = ((size_t) data[6] << 8) | data[7];
+    size_t offset = 12;
+
+    for (size_t i = 0; i < questions; i++) {
+      if (!skipName(data, size, offset) || offset + 4 > size) {
+        return DNSParseResult::Failure;
+      }
+
+      offset += 4;
+    }
+
+    for (size_t i = 0; i < answers; i++) {
+      if (!skipName(data, size, offset) || offset + 10 > size) {
+        return DNSParseResult::Failure;
+      }
+
+      const auto rrtype = ((size_t) data[offset] << 8) | data[offset + 1];
+      const auto rrclass = ((size_t) data[offset + 2] << 8) | data[offset + 3];
+      const auto rrttl = ((uint32_t) data[offset + 4] << 24)
+        | ((uint32_t) data[offset + 5] << 16)
+        | ((uint32_t) data[offset + 6] << 8)
+        | (uint32_t) data[offset + 7];
+      const auto rdlength = ((size_t) data[offset + 8] << 8) | data[offset + 9];
+      offset += 10;
+
+      if (offset + rdlength > size) {
+        return DNSParseResult::Failure;
+      }
+
+      if (rrtype == type && rrclass == DNS_CLASS_IN) {
+        char buffer[46] = {0};
+
+        if (type == DNS_TYPE_A && rdlength == 4) {
+          if (uv_inet_ntop(AF_INET, data + offset, buffer, sizeof(buffer)) == 0) {
+            address = buffer;
+            ttl = rrttl;
+            return DNSParseResult::Answer;
+          }
+        } else if (type == DNS_TYPE_AAAA && rdlength == 16) {
+          if (uv_inet_ntop(AF_INET6, data + offset, buffer, sizeof(buffer)) == 0) {
+            address = buffer;
+            ttl = rrttl;
+            return DNSParseResult::Answer;
+          }
+        }
+      }
+
+      offset += rdlength;
+    }
+
+    // a clean NOERROR response without a usable record (CNAME chains
+    // that dead-end, wrong-type answers) - definitive "no data"
+    return DNSParseResult::NoData;
+  }
+
+#if !defined(_WIN32)
+  // small synchronous read - both files are a few hundred bytes and
+  // this runs at most once per `DNS_CONFIG_TTL` on the loop thread
+  static String readSmallFile (const char* path) {
+    uv_fs_t req;
+    const auto fd = uv_fs_open(nullptr, &req, path, UV_FS_O_RDONLY, 0, nullptr);
+    uv_fs_req_cleanup(&req);
+
+    if (fd < 0) {
+      return "";
+    }
+
+    String contents;
+    char buffer[4096];
+
+    while (true) {
+      auto buf = uv_buf_init(buffer, sizeof(buffer));
+      const auto size = uv_fs_read(nullptr, &req, fd, &buf, 1, -1, nullptr);
+      uv_fs_req_cleanup(&req);
+
+      if (size <= 0) {
+        break;
+      }
+
+      contents.append(buffer, size);
+    }
+
+    uv_fs_close(nullptr, &req, fd, nullptr);
+    uv_fs_req_cleanup(&req);
+    return contents;
+  }
+
+  // both files separate fields with arbitrary runs of spaces or tabs
+  static Vector<String> tokenize (const String& line) {
+    Vector<String> tokens;
+    size_t i = 0;
+
+    while (i < line.size()) {
+      while (i < line.size() && (line[i] == ' ' || line[i] == '\t' || line[i] == '\r')) {
+        i++;
+      }
+
+      const auto start = i;
+      while (i < line.size() && line[i] != ' ' && line[i] != '\t' && line[i] != '\r') {
+        i++;
+      }
+
+      if (i > start) {
+        tokens.push_back(line.substr(start, i - start));
+      }
+    }
+
+    return tokens;
+  }
+
+  static void loadResolverConfig (Engine* engine) {
+    engine->nameservers.clear();
+    engine->hosts.clear();
+    engine->configLoaded = true;
+    engine->configExpiry = std::chrono::steady_clock::now() + DNS_CONFIG_TTL;
+
+    for (const auto& line : splitc(readSmallFile("/etc/resolv.conf"), '\n')) {
+      const auto parts = tokenize(line);
+
+      if (parts.size() < 2 || parts[0] != "nameserver") {
+        continue;
+      }
+
+      const auto& host = parts[1];
+      Engine::Nameserver nameserver;
+
+      if (uv_ip4_addr(host.c_str(), DNS_PORT, (sockaddr_in*) &nameserver.address) == 0) {
+        engine->nameservers.push_back(nameserver);
+      } else if (uv_ip6_addr(host.c_str(), DNS_PORT, (sockaddr_in6*) &nameserver.address) == 0) {
+        nameserver.ipv6 = true;
+        engine->nameservers.push_back(nameserver);
+      }
+    }
+
+    for (const auto& line : splitc(readSmallFile("/etc/hosts"), '\n')) {
+      auto entry = line;
+      const auto comment = entry.find('#');
+
+      if (comment != String::npos) {
+        entry = entry.substr(0, comment);
+      }
+
+      const auto parts = tokenize(entry);
+      if (parts.size() < 2) {
+        continue;
+      }
+
+      const auto& address = parts[0];
+      sockaddr_storage scratch;
+      bool ipv6 = false;
+
+      if (uv_ip4_addr(address.c_str(), 0, (sockaddr_in*) &scratch) != 0) {
+        if (uv_ip6_addr(address.c_str(), 0, (sockaddr_in6*) &scratch) != 0) {
+          continue;
+        }
+
+        ipv6 = true;
+      }
+
+      for (size_t i = 1; i < parts.size(); i++) {
+        auto name = parts[i];
+        std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+        auto& hostsEntry = engine->hosts[name];
+
+        if (ipv6 && hostsEntry.ipv6.size() == 0) {
+          hostsEntry.ipv6 = address;
+        } else if (!ipv6 && hostsEntry.ipv4.size() == 0) {
+          hostsEntry.ipv4 = address;
+        }
+      }
+    }
+  }
+#endif
+
+  static bool isConfiguredNameserver (Engine* engine, const sockaddr* addr) {
+    if (addr == nullptr) {
+      return false;
+    }
+
+    for (const auto& nameserver : engine->nameservers) {
+      if (!nameserver.ipv6 && addr->sa_family == AF_INET) {
+        const auto a = (const sockaddr_in*) addr;
+        const auto b = (const sockaddr_in*) &nameserver.address;
+
+        if (
+          a->sin_port == b->sin_port &&
+          a->sin_addr.s_addr == b->sin_addr.s_addr
+        ) {
+          return true;
+        }
+      } else if (nameserver.ipv6 && addr->sa_family == AF_INET6) {
+        const auto a = (const sockaddr_in6*) addr;
+        const auto b = (const sockaddr_in6*) &nameserver.address;
+
+        if (
+          a->sin6_port == b->sin6_port &&
+          memcmp(&a->sin6_addr, &b->sin6_addr, sizeof(a->sin6_addr)) == 0
+        ) {
+          return true;
+        }
+      }
+    }
+
+    return false;
+  }
+
+  static void completeQuestion (Engine* engine, Engine::Question* question) {
+    if (question->done) {
+      return;
+    }
+
+    question->done = true;
+
+    if (question->active) {
+      engine->inflight.erase(question->id);
+      question->active = false;
+    }
+
+    auto request = question->request;
+
+    if (--request->outstanding == 0) {
+      finishRequest(request);
+    }
+  }
+
+  static void handleResponse (Engine* engine, const uint8_t* data, size_t size) {
+    if (size < 2) {
+      return;
+    }
+
+    const auto id = (uint16_t) (((size_t) data[0] << 8) | data[1]);
+    const auto entry = engine->inflight.find(id);
+
+    if (entry == engine->inflight.end()) {
+      return;
+    }
+
+    auto question = entry->second;
+    const auto result = parseResponse(
+      data,
+      size,
+      question->type,
+      question->address,
+      question->ttl
+    );
+
+    switch (result) {
+      case DNSParseResult::Answer:
+      case DNSParseResult::NoData:
+      case DNSParseResult::NoSuchName:
+        question->definitive = true;
+        break;
+      case DNSParseResult::Failure:
+        break;
+    }
+
+    completeQuestion(engine, question);
+  }
+
+  static uv_udp_t* ensureSocket (Core* core, Engine* engine, bool ipv6) {
+    auto handle = ipv6 ? &engine->udp6 : &engine->udp4;
+    auto& started = ipv6 ? engine->udp6Started : engine->udp4Started;
+
+    if (started) {
+      return handle;
+    }
+
+    if (uv_udp_init(core->getEventLoop(), handle) != 0) {
+      return nullptr;
+    }
+
+    handle->data = engine;
+
+    auto allocate = [](uv_handle_t* handle, size_t size, uv_buf_t* buf) {
+      if (size > 0) {
+        buf->base = BufferPool::instance()->acquireRaw(size);
+        buf->len = size;
+      }
+    };
+
+    auto receive = [](
+      uv_udp_t* handle,
+      ssize_t nread,
+      const uv_buf_t* buf,
+      const struct sockaddr* addr,
+      unsigned flags
+    ) {
+      auto engine = (Engine*) handle->data;
+
+      // a response from an address that is not a configured nameserver
+      // is dropped outright
+      if (nread > 0 && isConfiguredNameserver(engine, addr)) {
+        handleResponse(engine, (const uint8_t*) buf->base, (size_t) nread);
+      }
+
+      if (buf != nullptr && buf->base != nullptr) {
+        BufferPool::instance()->release(buf->base, buf->len);
+      }
+    };
+
+    if (uv_udp_recv_start(handle, allocate, receive) != 0) {
+      uv_close((uv_handle_t*) handle, nullptr);
+      return nullptr;
+    }
+
+    started = true;
+    return handle;
+  }
+
+  static void sendQuestion (Engine* engine, Engine::Question* question) {
+    auto request = question->request;
+
+    // the periodic config re-read can leave the nameserver list briefly
+    // empty (an unreadable or transiently empty resolv.conf) while a
+    // request is in flight; settle the question as non-definitive so
+    // the request falls back to the system resolver instead of
+    // computing a modulo over an empty list
+    if (engine->nameservers.size() == 0) {
+      return completeQuestion(engine, question);
+    }
+
+    const auto& nameserver = engine->nameservers[
+      question->attempts % engine->nameservers.size()
+    ];
+
+    auto handle = ensureSocket(request->dns->core, engine, nameserver.ipv6);
+
+    if (handle == nullptr) {
+      return;
+    }
+
+    auto send = new uv_udp_send_t;
+    auto buffer = uv_buf_init(
+      (char*) question->message.data(),
+      (unsigned int) question->message.size()
+    );
+
+    const auto err = uv_udp_send(
+      send,
+      handle,
+      &buffer,
+      1,
+      (const sockaddr*) &nameserver.address,
+      [](uv_udp_send_t* send, int status) {
+        delete send;
+      }
+    );
+
+    // a synchronous send failure never invokes the callback; the
+    // question stays inflight and the timeout drives the retry
+    if (err != 0) {
+      delete send;
+    }
+  }
+
+  static void destroyRequest (Engine::Request* request) {
+    auto engine = request->dns->resolverEngine;
+
+    for (auto question : { &request->a, &request->aaaa }) {
+      if (question->active) {
+        engine->inflight.erase(question->id);
+        question->active = false;
+      }
+    }
+
+    uv_timer_stop(&request->timer);
+    uv_close((uv_handle_t*) &request->timer, [](uv_handle_t* handle) {
+      delete (Engine::Request*) handle->data;
+    });
+  }
+
+  static void answerRequest (
+    Engine::Request* request,
+    const String& address,
+    int family,
+    uint32_t ttl
+  ) {
+    auto result = JSON::Object::Entries {
+      {"source", "dns.lookup"},
+      {"data", JSON::Object::Entries {
+        {"address", address},
+        {"family", family}
+      }}
+    };
+
+    do {
+      const auto clamped = std::max(
+        DNS_MIN_RECORD_TTL,
+        std::min(ttl, DNS_MAX_RECORD_TTL)
+      );
+
+      Lock lock(request->dns->cacheMutex);
+      request->dns->cache[request->key] = {
+        JSON::Object(result),
+        std::chrono::steady_clock::now() + std::chrono::seconds(clamped)
+      };
+    } while (0);
+
+    request->cb(request->seq, result, Post{});
+    destroyRequest(request);
+  }
+
+  static void finishRequest (Engine::Request* request) {
+    const auto family = request->options.family;
+
+    if ((family == 0 || family == 4) && request->a.address.size() > 0) {
+      return answerRequest(request, request->a.address, 4, request->a.ttl);
+    }
+
+    if ((family == 0 || family == 6) && request->aaaa.address.size() > 0) {
+      return answerRequest(request, request->aaaa.address, 6, request->aaaa.ttl);
+    }
+
+    bool definitive = true;
+    for (const auto question : { &request->a, &request->aaaa }) {
+      if (question->done && !question->definitive) {
+        definitive = false;
+      }
+    }
+
+    if (!definitive) {
+      // a timeout, truncation or server failure somewhere - let the
+      // system resolver have the final word before reporting an error
+      request->dns->lookupWithThreadPool(
+        request->seq,
+        request->options,
+        request->key,
+        request->cb
+      );
+
+      return destroyRequest(request);
+    }
+
+    // every question settled on "no such name" or "no data" - report
+    // it the way the `uv_getaddrinfo` path would, negative cache and all
+    auto result = JSON::Object::Entries {
+      {"source", "dns.lookup"},
+      {"err", JSON::Object::Entries {
+        {"code", std::to_string(UV_EAI_NONAME)},
+        {"message", String(uv_strerror(UV_EAI_NONAME))}
+      }}
+    };
+
+    do {
+      Lock lock(request->dns->cacheMutex);
+      request->dns->cache[request->key] = {
+        JSON::Object(result),
+        std::chrono::steady_clock::now() + Core::DNS::NEGATIVE_CACHE_TTL
+      };
+    } while (0);
+
+    request->cb(request->seq, result, Post{});
+    destroyRequest(request);
+  }
+
+  static void onRequestTimeout (uv_timer_t* timer) {
+    auto request = (Engine::Request*) timer->data;
+    auto engine = request->dns->resolverEngine;
+
+    for (auto question : { &request->a, &request->aaaa }) {
+      if (question->done) {
+        continue;
+      }
+
+      if (++question->attempts >= DNS_MAX_ATTEMPTS) {
+        // exhausted - settles as a non-definitive failure so the
+        // request falls back once the other question resolves too
+        completeQuestion(engine, question);
+      } else {
+        sendQuestion(engine, question);
+      }
+    }
+  }
+
+  bool Core::DNS::resolveWithEngine (
+    const String seq,
+    const LookupOptions options,
+    const String key,
+    Core::Module::Callback cb
+  ) {
+    const auto& hostname = options.hostname;
+
+    // address literals answer inline on any platform
+    do {
+      sockaddr_storage scratch;
+
+      if (
+        options.family != 6 &&
+        uv_ip4_addr(hostname.c_str(), 0, (sockaddr_in*) &scratch) == 0
+      ) {
+        cb(seq, JSON::Object::Entries {
+          {"source", "dns.lookup"},
+          {"data", JSON::Object::Entries {
+            {"address", hostname},
+            {"family", 4}
+          }}
+        }, Post{});
+        return true;
+      }
+
+      if (
+        options.family != 4 &&
+        hostname.find(':') != String::npos &&
+        uv_ip6_addr(hostname.c_str(), 0, (sockaddr_in6*) &scratch) == 0
+      ) {
+        cb(seq, JSON::Object::Entries {
+          {"source", "dns.lookup"},
+          {"data", JSON::Object::Entries {
+            {"address", hostname},
+            {"family", 6}
+          }}
+        }, Post{});
+        return true;
+      }
+    } while (0);
+
+  #if defined(_WIN32)
+    // no `/etc/resolv.conf` to seed the engine from - the threadpool
+    // path stays the backend here
+    return false;
+  #else
+    if (this->resolverEngine == nullptr) {
+      this->resolverEngine = new ResolverEngine();
+      this->resolverEngine->dns = this;
+    }
+
+    auto engine = this->resolverEngine;
+
+    if (
+      !engine->configLoaded ||
+      std::chrono::steady_clock::now() >= engine->configExpiry
+    ) {
+      loadResolverConfig(engine);
+    }
+
+    auto lowered = hostname;
+    std::transform(lowered.begin(), lowered.end(), lowered.begin(), ::tolower);
+
+    // hosts-file entries answer inline and are not cached - the map
+    // itself is the cache and follows `DNS_CONFIG_TTL`
+    const auto hostsEntry = engine->hosts.find(lowered);
+    if (hostsEntry != engine->hosts.end()) {
+      const auto& entry = hostsEntry->second;
+
+      if (options.family != 6 && entry.ipv4.size() > 0) {
+        cb(seq, JSON::Object::Entries {
+          {"source", "dns.lookup"},
+          {"data", JSON::Object::Entries {
+            {"address", entry.ipv4},
+            {"family", 4}
+          }}
+        }, Post{});
+        return true;
+      }
+
+      if (options.family != 4 && entry.ipv6.size() > 0) {
+        cb(seq, JSON::Object::Entries {
+          {"source", "dns.lookup"},
+          {"data", JSON::Object::Entries {
+            {"address", entry.ipv6},
+            {"family", 6}
+          }}
+        }, Post{});
+        return true;
+      }
+    }
+
+    // single-label names need search-domain handling and `.local` names
+    // need mDNS - both only the system resolver provides
+    if (
+      engine->nameservers.size() == 0 ||
+      hostname.find('.') == String::npos ||
+      lowered.ends_with(".local") ||
+      lowered.ends_with(".local.")
+    ) {
+      return false;
+    }
+
+    auto request = new ResolverEngine::Request();
+    request->dns = this;
+    request->seq = seq;
+    request->key = key;
+    request->options = options;
+    request->cb = cb;
+
+    const auto wantsA = options.family == 0 || options.family == 4;
+    const auto wantsAAAA = options.family == 0 || options.family == 6;
+
+    for (auto question : { &request->a, &request->aaaa }) {
+      const auto wanted = question == &request->a ? wantsA : wantsAAAA;
+      if (!wanted) {
+        question->done = true;
+        question->definitive = true;
+        continue;
+      }
+
+      question->request = request;
+      question->type = question == &request->a ? DNS_TYPE_A : DNS_TYPE_AAAA;
+      question->id = nextQueryId(engine);
+
+      if (!encodeQuery(*question, hostname)) {
+        for (auto active : { &request->a, &request->aaaa }) {
+          if (active->active) {
+            engine->inflight.erase(active->id);
+          }
+        }
+
+        delete request;
+        return false;
+      }
+
+      // registered before the sibling question draws its id so the two
+      // can never collide
+      engine->inflight[question->id] = question;
+      question->active = true;
+      request->outstanding++;
+    }
+
+    uv_timer_init(this->core->getEventLoop(), &request->timer);
+    request->timer.data = request;
+    uv_timer_start(
+      &request->timer,
+      onRequestTimeout,
+      DNS_QUERY_TIMEOUT,
+      DNS_QUERY_TIMEOUT
+    );
+
+    // both questions go out back to back - concurrent A/AAAA instead of
+    // the sequential resolution `getaddrinfo` implementations tend to do
+    for (auto question : { &request->a, &request->aaaa }) {
+      if (!question->done) {
+        sendQuestion(engine, question);
+      }
+    }
+
+    return true;
+  #endif
+  }
+}
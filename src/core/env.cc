@@ -5,71 +5,70 @@
 #include "string.hh"
 
 namespace SSC {
-  bool Env::has (const char* name) {
+  // process-wide snapshot of observed environment variables: a name is
+  // resolved against the `env_` user config overlay and the process
+  // environment once, then served from the snapshot with no `getenv`
+  // call per read. `Env::set` refreshes the entry it names — environment
+  // changes made behind `Env`'s back (a raw `setenv`) are invisible by
+  // design. values are returned by value, copied under the lock: a
+  // reference into the snapshot would race the in-place refresh in
+  // `Env::set` and could be observed mid-mutation from another thread
+  static Mutex mutex;
+  static std::unordered_map<String, String> snapshot;
+
+  static String lookup (const char* name) {
     static auto userConfig = getUserConfig();
 
-    if (userConfig[String("env_") + name].size() > 0) {
-      return true;
-    }
-
-  #if defined(_WIN32)
-    char* value = nullptr;
-    size_t size = 0;
-    auto result = _dupenv_s(&value, &size, name);
-
-    if (value && value[0] == '\0') {
-      free(value);
-      return false;
-    }
-
-    free(value);
-
-    if (size == 0 || result != 0) {
-      return false;
-    }
-  #else
-    auto value = getenv(name);
-
-    if (value == nullptr || value[0] == '\0') {
-      return false;
-    }
-  #endif
-
-    return true;
-  }
+    do {
+      Lock lock(mutex);
+      const auto entry = snapshot.find(name);
 
-  bool Env::has (const String& name) {
-    return has(name.c_str());
-  }
+      if (entry != snapshot.end()) {
+        return entry->second;
+      }
+    } while (0);
 
-  String Env::get (const char* name) {
-    static auto userConfig = getUserConfig();
-
-    if (userConfig[String("env_") + name].size() > 0) {
-      return userConfig[String("env_") + name];
-    }
+    auto value = String("");
+    const auto key = String("env_") + name;
 
+    if (userConfig.contains(key) && userConfig.at(key).size() > 0) {
+      value = userConfig.at(key);
+    } else {
     #if defined(_WIN32)
       char* variableValue = nullptr;
       std::size_t valueSize = 0;
       auto query = _dupenv_s(&variableValue, &valueSize, name);
 
-      String result;
       if (query == 0 && variableValue != nullptr && valueSize > 0) {
-        result.assign(variableValue, valueSize - 1);
-        free(variableValue);
+        value.assign(variableValue, valueSize - 1);
       }
 
-      return result;
+      if (variableValue != nullptr) {
+        free(variableValue);
+      }
     #else
-      auto v = getenv(name);
+      const auto v = getenv(name);
 
       if (v != nullptr) {
-        return String(v);
+        value = v;
       }
-
-      return String("");
     #endif
+    }
+
+    Lock lock(mutex);
+    return snapshot.emplace(name, std::move(value)).first->second;
+  }
+
+  bool Env::has (const char* name) {
+    return lookup(name).size() > 0;
+  }
+
+  bool Env::has (const String& name) {
+    return has(name.c_str());
+  }
+
+  String Env::get (const char* name) {
+    return lookup(name);
   }
 
   String Env::get (const String& name) {
@@ -77,7 +76,7 @@ namespace SSC {
   }
 
   String Env::get (const String& name, const String& fallback) {
-    const auto value = get(name);
+    auto value = get(name);
 
     if (value.size() == 0) {
       return fallback;
@@ -92,11 +91,23 @@ namespace SSC {
   #else
     setenv(name.c_str(), value.c_str(), 1);
   #endif
+
+    // refresh the snapshot so subsequent `get` calls observe the new
+    // value — copies already handed out are unaffected
+    Lock lock(mutex);
+    snapshot.insert_or_assign(name, value);
   }
 
   void Env::set (const char* name) {
   #if defined(_WIN32)
     _putenv(name);
+
+    const auto parts = split(String(name), '=');
+
+    if (parts.size() == 2) {
+      Lock lock(mutex);
+      snapshot.insert_or_assign(parts[0], parts[1]);
+    }
   #else
     auto parts = split(String(name), '=');
     set(parts[0], parts[1]);
@@ -9,6 +9,11 @@ namespace SSC {
       static bool has (const char* name);
       static bool has (const String& name);
 
+      // served from a process-wide snapshot populated on first access
+      // and refreshed by `Env::set`; returned by value so a caller's
+      // copy cannot race a concurrent refresh of the snapshot entry
+      // (the fallback overload returns `fallback` when the variable is
+      // unset)
       static String get (const char* name);
       static String get (const String& name);
       static String get (const String& name, const String& fallback);
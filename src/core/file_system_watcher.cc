@@ -27,11 +27,30 @@ namespace SSC {
       return;
     }
 
+  #if defined(__linux__)
+    // inotify has no kernel-level recursion - when a new directory shows
+    // up under a watched root, start tracking it too. this runs before
+    // the debounce check so directory creation is never missed
+    if (
+      context->watcher->options.recursive &&
+      context->isDirectory &&
+      std::filesystem::is_directory(path)
+    ) {
+      context->watcher->watchChildDirectory(path.string());
+    }
+  #endif
+
     const auto delta = std::chrono::duration_cast<std::chrono::milliseconds>(
       now - context->lastUpdated
     );
 
-    if (delta.count() < context->watcher->options.debounce) {
+    // when coalescing is disabled, events inside the debounce window are
+    // dropped outright - with coalescing they are merged into the pending
+    // batch instead so a burst still produces a single delivery
+    if (
+      context->watcher->options.coalesceInterval <= 0 &&
+      delta.count() < context->watcher->options.debounce
+    ) {
       return;
     }
 
@@ -52,7 +71,91 @@ namespace SSC {
 
     context->lastUpdated = now;
     if (events.size() == 1) {
-      context->watcher->callback(path.string(), events, *context);
+      context->watcher->enqueueEvent(path.string(), events, context);
+    }
+  }
+
+  void FileSystemWatcher::enqueueEvent (
+    const String& path,
+    const Vector<Event>& events,
+    const Context* context
+  ) {
+    // coalescing disabled - deliver immediately, preserving the old
+    // one-callback-per-event behavior
+    if (this->options.coalesceInterval <= 0) {
+      if (this->callback != nullptr) {
+        this->callback(path, events, *context);
+      }
+      return;
+    }
+
+    bool shouldSchedule = false;
+
+    do {
+      Lock lock(this->mutex);
+      auto& pending = this->pendingEvents[path];
+      pending.context = context;
+
+      // merge, dropping duplicate event types for the same path
+      for (const auto event : events) {
+        const auto end = pending.events.end();
+        if (std::find(pending.events.begin(), end, event) == end) {
+          pending.events.push_back(event);
+        }
+      }
+
+      if (!this->flushScheduled) {
+        this->flushScheduled = true;
+        shouldSchedule = true;
+      }
+    } while (0);
+
+    // a single timer rate-limits delivery to one flush per window,
+    // no matter how many events arrive in the meantime
+    if (shouldSchedule) {
+      this->core->dispatchEventLoop([this]() {
+        uv_timer_start(
+          &this->flushTimer,
+          [](uv_timer_t* timer) {
+            auto watcher = reinterpret_cast<FileSystemWatcher*>(timer->data);
+            watcher->flushPendingEvents();
+          },
+          this->options.coalesceInterval,
+          0
+        );
+      });
+    }
+  }
+
+  void FileSystemWatcher::flushPendingEvents () {
+    std::map<String, PendingEvent> pending;
+
+    do {
+      Lock lock(this->mutex);
+      pending.swap(this->pendingEvents);
+      this->flushScheduled = false;
+    } while (0);
+
+    if (pending.size() == 0) {
+      return;
+    }
+
+    // all distinct paths accumulated during the window go out in
+    // one invocation when a batch callback is configured
+    if (this->batchCallback != nullptr) {
+      Vector<BatchEntry> batch;
+      for (const auto& entry : pending) {
+        batch.push_back({ entry.first, entry.second.events });
+      }
+
+      this->batchCallback(batch);
+      return;
+    }
+
+    if (this->callback != nullptr) {
+      for (const auto& entry : pending) {
+        this->callback(entry.first, entry.second.events, *entry.second.context);
+      }
     }
   }
 
@@ -153,6 +256,21 @@ namespace SSC {
 
     this->core->dispatchEventLoop([this]() mutable {
       auto loop = this->core->getEventLoop();
+
+      // init the timer used to flush coalesced events
+      if (!this->flushTimerInitialized) {
+        const auto status = uv_timer_init(loop, &this->flushTimer);
+        if (status != 0) {
+          debug(
+            "FileSystemWatcher: uv_timer_init: error: %s\n",
+            uv_strerror(status)
+          );
+        } else {
+          this->flushTimer.data = reinterpret_cast<void *>(this);
+          this->flushTimerInitialized = true;
+        }
+      }
+
       for (const auto &path : this->watchedPaths) {
         const bool exists = this->handles.contains(path);
         auto context = &this->contexts[path];
@@ -224,6 +342,28 @@ namespace SSC {
             );
           }
         }
+
+      #if defined(__linux__)
+        // `UV_FS_EVENT_RECURSIVE` is not supported by inotify - seed a
+        // watch for each existing subdirectory up front, new ones are
+        // picked up as their creation events arrive on the parent
+        if (this->options.recursive && context->isDirectory) {
+          std::error_code err;
+          const auto iterator = std::filesystem::recursive_directory_iterator(
+            path,
+            std::filesystem::directory_options::skip_permission_denied,
+            err
+          );
+
+          if (!err) {
+            for (const auto& entry : iterator) {
+              if (entry.is_directory(err) && !err) {
+                this->watchChildDirectory(entry.path().string());
+              }
+            }
+          }
+        }
+      #endif
       }
     });
 
@@ -239,28 +379,38 @@ namespace SSC {
 
     this->isRunning = false;
 
-    for (const auto& path : this->watchedPaths) {
-      if (this->handles.contains(path)) {
-        const auto isDirectory = std::filesystem::is_directory(path);
-        auto handle = &this->handles.at(path);
-        int status = uv_fs_event_stop(&handle->event);
+    if (this->flushTimerInitialized) {
+      uv_timer_stop(&this->flushTimer);
+    }
+
+    this->pendingEvents.clear();
+    this->flushScheduled = false;
+
+    // iterate over the handles mapping, not `watchedPaths`, so watches
+    // added dynamically for discovered subdirectories are stopped too
+    for (auto& entry : this->handles) {
+      const auto& path = entry.first;
+      const auto isDirectory = this->contexts.contains(path)
+        ? this->contexts.at(path).isDirectory
+        : std::filesystem::is_directory(path);
+      auto handle = &entry.second;
+      int status = uv_fs_event_stop(&handle->event);
+
+      if (status != 0) {
+        debug(
+          "FileSystemWatcher: uv_fs_event_stop: error: %s\n",
+          uv_strerror(status)
+        );
+      }
 
+      if (!isDirectory) {
+        status = uv_fs_poll_stop(&handle->poll);
         if (status != 0) {
           debug(
-            "FileSystemWatcher: uv_fs_event_stop: error: %s\n",
+            "FileSystemWatcher: uv_fs_poll_stop: error: %s\n",
             uv_strerror(status)
           );
         }
-
-        if (!isDirectory) {
-          status = uv_fs_poll_stop(&handle->poll);
-          if (status != 0) {
-            debug(
-              "FileSystemWatcher: uv_fs_poll_stop: error: %s\n",
-              uv_strerror(status)
-            );
-          }
-        }
       }
     }
 
@@ -271,4 +421,121 @@ namespace SSC {
 
     return true;
   }
+
+  // starts watching a directory discovered under a recursive root.
+  // must be called from the event loop thread
+  void FileSystemWatcher::watchChildDirectory (const String& path) {
+    if (this->handles.contains(path)) {
+      return;
+    }
+
+    auto loop = this->core->getEventLoop();
+    auto context = &this->contexts[path];
+    auto handle = &this->handles[path];
+
+    context->isDirectory = true;
+    context->lastUpdated = FileSystemWatcher::Clock::now();
+    context->watcher = this;
+    context->name = std::filesystem::absolute(path).string();
+
+    int status = uv_fs_event_init(loop, &handle->event);
+    if (status != 0) {
+      debug(
+        "FileSystemWatcher: uv_fs_event_init: error: %s\n",
+        uv_strerror(status)
+      );
+      return;
+    }
+
+    handle->event.data = reinterpret_cast<void *>(context);
+    handle->poll.data = reinterpret_cast<void *>(context);
+
+    status = uv_fs_event_start(
+      &handle->event,
+      FileSystemWatcher::handleEventCallback,
+      path.c_str(),
+      0
+    );
+
+    if (status != 0) {
+      debug(
+        "FileSystemWatcher: uv_fs_event_start: error: %s\n",
+        uv_strerror(status)
+      );
+    }
+  }
+
+  FileSystemWatcherService* FileSystemWatcherService::instance () {
+    static FileSystemWatcherService service;
+    return &service;
+  }
+
+  FileSystemWatcherService::Subscription FileSystemWatcherService::subscribe (
+    const String& path,
+    Core* core,
+    EventCallback callback
+  ) {
+    Lock lock(this->mutex);
+
+    const auto subscription = this->nextSubscription++;
+    auto& entry = this->entries[path];
+
+    entry.subscribers[subscription] = callback;
+    this->subscriptions[subscription] = path;
+
+    if (entry.watcher == nullptr) {
+      entry.watcher = std::make_unique<FileSystemWatcher>(path);
+      entry.watcher->core = core;
+      entry.watcher->start([this, path](
+        const auto& eventPath,
+        const auto& events,
+        const auto& context
+      ) {
+        Lock lock(this->mutex);
+        const auto entry = this->entries.find(path);
+
+        if (entry == this->entries.end()) {
+          return;
+        }
+
+        for (const auto& subscriber : entry->second.subscribers) {
+          subscriber.second(eventPath, events, context);
+        }
+      });
+    }
+
+    return subscription;
+  }
+
+  void FileSystemWatcherService::unsubscribe (Subscription subscription) {
+    std::unique_ptr<FileSystemWatcher> watcher;
+
+    do {
+      Lock lock(this->mutex);
+      const auto path = this->subscriptions.find(subscription);
+
+      if (path == this->subscriptions.end()) {
+        return;
+      }
+
+      const auto entry = this->entries.find(path->second);
+
+      if (entry != this->entries.end()) {
+        entry->second.subscribers.erase(subscription);
+
+        if (entry->second.subscribers.size() == 0) {
+          watcher = std::move(entry->second.watcher);
+          this->entries.erase(entry);
+        }
+      }
+
+      this->subscriptions.erase(path);
+    } while (0);
+
+    // stopped outside the lock: the fan-out callback takes the same
+    // mutex and `stop` waits for any in-flight delivery to finish
+    if (watcher != nullptr) {
+      watcher->stop();
+    }
+  }
 }
@@ -45,6 +45,10 @@ namespace SSC {
       struct Options {
         int debounce = 250; // in milliseconds
         bool recursive = true;
+        // events for the same path within the window are merged and all
+        // pending paths are delivered together when the window closes;
+        // `0` delivers every event immediately
+        int coalesceInterval = 100; // in milliseconds
       };
 
       using EventCallback = std::function<void(
@@ -53,14 +57,29 @@ namespace SSC {
         const Context& // event context
       )>;
 
+      using BatchEntry = std::pair<String, Vector<Event>>;
+      using BatchCallback = std::function<void(const Vector<BatchEntry>&)>;
+
       using ContextMap = std::map<String, Context>;
 
+      struct PendingEvent {
+        Vector<Event> events;
+        const Context* context = nullptr;
+      };
+
       // state
       EventCallback callback = nullptr;
+      // when set, coalesced batches are delivered here in one invocation
+      // instead of once per path through `callback`
+      BatchCallback batchCallback = nullptr;
       Vector<String> paths;
       Vector<String> watchedPaths;
       ContextMap contexts;
       HandleMap handles;
+      std::map<String, PendingEvent> pendingEvents;
+      uv_timer_t flushTimer;
+      bool flushTimerInitialized = false;
+      bool flushScheduled = false;
       Options options;
       AtomicBool ownsCore = false;
       AtomicBool isRunning = false;
@@ -88,6 +107,63 @@ namespace SSC {
       ~FileSystemWatcher ();
       bool start (EventCallback callback);
       bool stop ();
+      void watchChildDirectory (const String& path);
+      void enqueueEvent (
+        const String& path,
+        const Vector<Event>& events,
+        const Context* context
+      );
+      void flushPendingEvents ();
+  };
+
+  /**
+   * Process-wide sharing of file system watchers. Every bridge or cache
+   * that wants to observe a path subscribes here instead of creating its
+   * own `FileSystemWatcher`, so a tree watched by several windows holds
+   * one set of kernel watch handles and each coalesced batch is fanned
+   * out once per subscriber rather than delivered through duplicate
+   * subscriptions.
+   *
+   * Callbacks are invoked while the service mutex is held, which makes
+   * `unsubscribe` double as a barrier: once it returns the callback is
+   * guaranteed not to run again.
+   */
+  class FileSystemWatcherService {
+    public:
+      using EventCallback = FileSystemWatcher::EventCallback;
+      using Subscription = uint64_t;
+
+      struct Entry {
+        std::unique_ptr<FileSystemWatcher> watcher;
+        std::map<Subscription, EventCallback> subscribers;
+      };
+
+      static FileSystemWatcherService* instance ();
+
+      Mutex mutex;
+      std::map<String, Entry> entries;
+      // maps a subscription back to its watched path so callers only
+      // need to retain the token returned by `subscribe`
+      std::map<Subscription, String> subscriptions;
+      Subscription nextSubscription = 1;
+
+      /**
+       * Registers `callback` for events under `path`, starting a kernel
+       * watcher only for the first subscriber. `core` provides the event
+       * loop for that first watcher and may be `nullptr`, in which case
+       * the watcher runs its own loop.
+       */
+      Subscription subscribe (
+        const String& path,
+        Core* core,
+        EventCallback callback
+      );
+
+      /**
+       * Removes a subscription, stopping and releasing the underlying
+       * watcher when the last subscriber for its path leaves.
+       */
+      void unsubscribe (Subscription subscription);
   };
 }
 
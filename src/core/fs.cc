@@ -1,4 +1,12 @@
 #include "core.hh"
+#include "checksum.hh"
+
+#if defined(__linux__)
+#include <linux/falloc.h>
+#elif defined(_WIN32)
+#include <winioctl.h>
+#endif
+
 namespace SSC {
 
   #define SET_CONSTANT(c) constants[#c] = (c);
@@ -210,12 +218,6 @@ namespace SSC {
 		this->buf.len = len;
   }
 
-  void Core::FS::RequestContext::freeBuffer() {
-    delete[] static_cast<char*>(this->buf.base);
-    this->buf.base = nullptr;
-    this->buf.len = 0;
-  }
-
   char* Core::FS::RequestContext::getBuffer () {
     return this->buf.base;
   }
@@ -247,24 +249,99 @@ namespace SSC {
     return this->stale;
   }
 
+#if defined(__ANDROID__)
+  void Core::FS::setAssetManager (AAssetManager* assetManager) {
+    this->assetManager = assetManager;
+  }
+#endif
+
   Core::FS::Descriptor * Core::FS::getDescriptor (uint64_t id) {
-    Lock lock(this->mutex);
-    if (descriptors.find(id) != descriptors.end()) {
-      return descriptors.at(id);
-    }
-    return nullptr;
+    return descriptors.get(id);
   }
 
   void Core::FS::removeDescriptor (uint64_t id) {
+    auto desc = descriptors.get(id);
+
+    if (desc != nullptr) {
+      untrackWeakDescriptor(desc);
+    }
+
+    descriptors.erase(id);
+  }
+
+  void Core::FS::trackWeakDescriptor (Descriptor *desc) {
+    bool wasEmpty = false;
+
+    do {
+      Lock lock(this->mutex);
+
+      if (desc->isWeakLinked || desc->isRetained() || !desc->isStale()) {
+        return;
+      }
+
+      wasEmpty = this->weakDescriptors.empty();
+      this->weakDescriptors.push_back(desc->id);
+      desc->weakLink = std::prev(this->weakDescriptors.end());
+      desc->isWeakLinked = true;
+    } while (0);
+
+    // first candidate: wake the release timer back up
+    if (wasEmpty) {
+      this->core->startWeakDescriptorTimer();
+    }
+  }
+
+  void Core::FS::untrackWeakDescriptor (Descriptor *desc) {
     Lock lock(this->mutex);
-    if (descriptors.find(id) != descriptors.end()) {
-      descriptors.erase(id);
+
+    if (!desc->isWeakLinked) {
+      return;
+    }
+
+    this->weakDescriptors.erase(desc->weakLink);
+    desc->isWeakLinked = false;
+  }
+
+  /**
+   * Links an in-flight request to the cancellation token of the IPC
+   * message that started it, so an abort can pull still queued threadpool
+   * work back out with `uv_cancel` before it runs. The registry is only
+   * ever touched on the event loop thread — the token's hook hops there
+   * first, which also keeps it ordered against the completion callback
+   * that frees the context.
+   */
+  void Core::FS::trackCancelableRequest (
+    RequestContext *ctx,
+    const CancellationTokenPointer& cancellation
+  ) {
+    if (cancellation == nullptr) {
+      return;
+    }
+
+    ctx->cancellation = cancellation;
+    this->cancelableRequests[ctx->id] = ctx;
+
+    cancellation->setHandler([this, id = ctx->id]() {
+      this->core->dispatchEventLoop([this, id]() {
+        auto entry = this->cancelableRequests.find(id);
+
+        if (entry != this->cancelableRequests.end()) {
+          // a no-op (`UV_EBUSY`) when the request already started
+          // executing — the completion callback then exits early instead
+          uv_cancel((uv_req_t *) &entry->second->req);
+        }
+      });
+    });
+  }
+
+  void Core::FS::untrackCancelableRequest (RequestContext *ctx) {
+    if (ctx->cancellation != nullptr) {
+      this->cancelableRequests.erase(ctx->id);
     }
   }
 
   bool Core::FS::hasDescriptor (uint64_t id) {
-    Lock lock(this->mutex);
-    return descriptors.find(id) != descriptors.end();
+    return descriptors.has(id);
   }
 
   void Core::FS::retainOpenDescriptor (
@@ -289,6 +366,8 @@ namespace SSC {
     }
 
     desc->retained = true;
+    untrackWeakDescriptor(desc);
+
     auto json = JSON::Object::Entries {
       {"source", "fs.retainOpenDescriptor"},
       {"data", JSON::Object::Entries {
@@ -305,48 +384,32 @@ namespace SSC {
     int mode,
     Module::Callback cb
   ) {
-    this->core->dispatchEventLoop([=, this]() {
-      auto filename = path.c_str();
-      auto loop = &this->core->eventLoop;
-      auto ctx = new RequestContext(seq, cb);
-      auto req = &ctx->req;
-      auto err = uv_fs_access(loop, req, filename, mode, [](uv_fs_t* req) {
-        auto ctx = (RequestContext *) req->data;
-        auto json = JSON::Object {};
-
-        if (uv_fs_get_result(req) < 0) {
-          json = JSON::Object::Entries {
-            {"source", "fs.access"},
-            {"err", JSON::Object::Entries {
-              {"code", req->result},
-              {"message", String(uv_strerror((int) req->result))}
-            }}
-          };
-        } else {
-          json = JSON::Object::Entries {
-            {"source", "fs.access"},
-            {"data", JSON::Object::Entries {
-              {"mode", req->flags},
-            }}
-          };
-        }
-
-        ctx->cb(ctx->seq, json, Post {});
-        delete ctx;
-      });
+    // no loop-affine state is touched: run the request synchronously on a
+    // worker thread instead of hopping through the event loop first
+    this->core->dispatchWorkerPool([=, this]() {
+      auto ctx = RequestContext(seq, cb);
+      auto req = &ctx.req;
+      auto err = uv_fs_access(nullptr, req, path.c_str(), mode, nullptr);
+      auto json = JSON::Object {};
 
       if (err < 0) {
-        auto json = JSON::Object::Entries {
+        json = JSON::Object::Entries {
           {"source", "fs.access"},
           {"err", JSON::Object::Entries {
             {"code", err},
             {"message", String(uv_strerror(err))}
           }}
         };
-
-        ctx->cb(ctx->seq, json, Post{});
-        delete ctx;
+      } else {
+        json = JSON::Object::Entries {
+          {"source", "fs.access"},
+          {"data", JSON::Object::Entries {
+            {"mode", req->flags},
+          }}
+        };
       }
+
+      ctx.cb(ctx.seq, json, Post {});
     });
   }
 
@@ -525,6 +588,28 @@ namespace SSC {
         return cb(seq, json, Post{});
       }
 
+    #if defined(__ANDROID__)
+      if (desc->isAsset()) {
+        // no kernel handle to close - dropping the descriptor's asset
+        // reference releases the mapping once in-flight posts that
+        // alias it drain
+        auto json = JSON::Object::Entries {
+          {"source", "fs.close"},
+          {"data", JSON::Object::Entries {
+            {"id", std::to_string(desc->id)},
+            {"fd", -1}
+          }}
+        };
+
+        this->removeDescriptor(desc->id);
+        delete desc;
+        return cb(seq, json, Post{});
+      }
+    #endif
+
+      // settle any coalesced writes before the descriptor goes away
+      this->flushCoalescedWrites(desc, true);
+
       auto loop = &this->core->eventLoop;
       auto ctx = new RequestContext(desc, seq, cb);
       auto req = &ctx->req;
@@ -575,13 +660,42 @@ namespace SSC {
     });
   }
 
+  // applies a descriptor's requested access-pattern advice to its file
+  // handle — a best-effort hint, so a platform or filesystem that
+  // ignores it never fails the open
+  static void applyAccessPatternAdvice (Core::FS::Descriptor *desc) {
+    if (desc->advice.size() == 0) {
+      return;
+    }
+
+  #if defined(__linux__) && !defined(__ANDROID__)
+    if (desc->advice == "sequential") {
+      posix_fadvise(desc->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    } else if (desc->advice == "random") {
+      posix_fadvise(desc->fd, 0, 0, POSIX_FADV_RANDOM);
+    } else if (desc->advice == "dontneed") {
+      // streaming: readahead still helps, but consumed pages are
+      // dropped after every read (see `read`)
+      posix_fadvise(desc->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+  #elif defined(__APPLE__)
+    if (desc->advice == "sequential" || desc->advice == "dontneed") {
+      fcntl(desc->fd, F_RDAHEAD, 1);
+    } else if (desc->advice == "random") {
+      fcntl(desc->fd, F_RDAHEAD, 0);
+    }
+  #endif
+  }
+
   void Core::FS::open (
     const String seq,
     uint64_t id,
     const String path,
     int flags,
     int mode,
-    Module::Callback cb
+    Module::Callback cb,
+    const String advice,
+    bool direct
   ) {
     this->core->dispatchEventLoop([=, this]() {
       auto filename = path.c_str();
@@ -589,12 +703,71 @@ namespace SSC {
       auto loop = &this->core->eventLoop;
       auto ctx = new RequestContext(desc, seq, cb);
       auto req = &ctx->req;
-      auto err = uv_fs_open(loop, req, filename, flags, mode, [](uv_fs_t* req) {
+      auto openFlags = flags;
+
+      desc->advice = advice;
+      desc->dropCacheAfterRead = advice == "dontneed";
+      desc->isDirect = direct;
+
+    #if defined(UV_FS_O_DIRECT)
+      // `O_DIRECT` on Linux, `FILE_FLAG_NO_BUFFERING` on Windows — a
+      // no-op constant on platforms without either (macOS opts out of
+      // the cache with `F_NOCACHE` once the descriptor opens instead)
+      if (direct) {
+        openFlags |= UV_FS_O_DIRECT;
+      }
+    #endif
+
+      auto err = uv_fs_open(loop, req, filename, openFlags, mode, [](uv_fs_t* req) {
         auto ctx = (RequestContext *) req->data;
         auto desc = ctx->desc;
         auto json = JSON::Object {};
 
         if (uv_fs_get_result(req) < 0) {
+        #if defined(__ANDROID__)
+          // bundled assets are not on the real filesystem - fall back
+          // to the app bundle before reporting the failure. assets are
+          // read only; any later write on the descriptor fails with
+          // `EBADF` since `fd` stays `-1`
+          if (
+            req->result == UV_ENOENT &&
+            desc->core->fs.assetManager != nullptr &&
+            req->path != nullptr
+          ) {
+            auto assetPath = String(req->path);
+
+            while (assetPath.starts_with("/")) {
+              assetPath = assetPath.substr(1);
+            }
+
+            auto asset = AAssetManager_open(
+              desc->core->fs.assetManager,
+              assetPath.c_str(),
+              AASSET_MODE_BUFFER
+            );
+
+            if (asset != nullptr) {
+              desc->asset = std::shared_ptr<AAsset>(asset, [](AAsset* asset) {
+                AAsset_close(asset);
+              });
+              desc->fd = -1;
+              desc->core->fs.descriptors.set(desc->id, desc);
+
+              json = JSON::Object::Entries {
+                {"source", "fs.open"},
+                {"data", JSON::Object::Entries {
+                  {"id", std::to_string(desc->id)},
+                  {"fd", -1}
+                }}
+              };
+
+              ctx->cb(ctx->seq, json, Post{});
+              delete ctx;
+              return;
+            }
+          }
+        #endif
+
           json = JSON::Object::Entries {
             {"source", "fs.open"},
             {"err", JSON::Object::Entries {
@@ -615,9 +788,16 @@ namespace SSC {
           };
 
           desc->fd = (int) req->result;
+
+        #if defined(__APPLE__)
+          if (desc->isDirect) {
+            fcntl(desc->fd, F_NOCACHE, 1);
+          }
+        #endif
+
+          applyAccessPatternAdvice(desc);
           // insert into `descriptors` map
-          Lock lock(desc->core->fs.mutex);
-          desc->core->fs.descriptors.insert_or_assign(desc->id, desc);
+          desc->core->fs.descriptors.set(desc->id, desc);
         }
 
         ctx->cb(ctx->seq, json, Post{});
@@ -679,8 +859,7 @@ namespace SSC {
 
           desc->dir = (uv_dir_t *) req->ptr;
           // insert into `descriptors` map
-          Lock lock(desc->core->fs.mutex);
-          desc->core->fs.descriptors.insert_or_assign(desc->id, desc);
+          desc->core->fs.descriptors.set(desc->id, desc);
         }
 
         ctx->cb(ctx->seq, json, Post{});
@@ -708,7 +887,8 @@ namespace SSC {
     const String seq,
     uint64_t id,
     size_t nentries,
-    Module::Callback cb
+    Module::Callback cb,
+    const CancellationTokenPointer cancellation
   ) {
     this->core->dispatchEventLoop([=, this]() {
       auto desc = getDescriptor(id);
@@ -740,6 +920,20 @@ namespace SSC {
         return cb(seq, json, Post{});
       }
 
+      if (cancellation != nullptr && cancellation->isCancelled()) {
+        auto json = JSON::Object::Entries {
+          {"source", "fs.readdir"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(id)},
+            {"code", UV_ECANCELED},
+            {"type", "AbortError"},
+            {"message", String(uv_strerror(UV_ECANCELED))}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
       Lock lock(desc->mutex);
       auto loop = &this->core->eventLoop;
       auto ctx = new RequestContext(desc, seq, cb);
@@ -753,13 +947,19 @@ namespace SSC {
         auto desc = ctx->desc;
         auto json = JSON::Object {};
 
-        if (uv_fs_get_result(req) < 0) {
+        desc->core->fs.untrackCancelableRequest(ctx);
+
+        if (uv_fs_get_result(req) < 0 || ctx->isCancelled()) {
+          auto result = uv_fs_get_result(req) < 0
+            ? (int) req->result
+            : UV_ECANCELED;
+
           json = JSON::Object::Entries {
             {"source", "fs.readdir"},
             {"err", JSON::Object::Entries {
               {"id", std::to_string(desc->id)},
-              {"code", req->result},
-              {"message", String(uv_strerror((int) req->result))}
+              {"code", result},
+              {"message", String(uv_strerror(result))}
             }}
           };
         } else {
@@ -784,6 +984,12 @@ namespace SSC {
         delete ctx;
       });
 
+      if (err >= 0) {
+        // the completion callback cannot run before this loop iteration
+        // returns, so the context is registered before it can be freed
+        this->trackCancelableRequest(ctx, cancellation);
+      }
+
       if (err < 0) {
         auto json = JSON::Object::Entries {
           {"source", "fs.readdir"},
@@ -922,19 +1128,13 @@ namespace SSC {
     bool preserveRetained,
     Module::Callback cb
   ) {
-    Lock lock(this->mutex);
-
-    auto pending = descriptors.size();
+    auto ids = descriptors.ids();
+    auto pending = ids.size();
     int queued = 0;
     auto json = JSON::Object {};
-    auto ids = Vector<uint64_t> {};
-
-    for (auto const &tuple : descriptors) {
-      ids.push_back(tuple.first);
-    }
 
     for (auto const id : ids) {
-      auto desc = descriptors[id];
+      auto desc = descriptors.get(id);
       pending--;
 
       if (desc == nullptr) {
@@ -973,9 +1173,29 @@ namespace SSC {
     uint64_t id,
     size_t size,
     size_t offset,
-    Module::Callback cb
+    Module::Callback cb,
+    const CancellationTokenPointer cancellation
   ) {
-    this->core->dispatchEventLoop([=, this]() {
+    // reads on an already open descriptor are positional (`pread`) and
+    // touch no loop-affine state, so the request runs synchronously on a
+    // worker thread instead of hopping through the event loop first
+    this->core->dispatchWorkerPool([=, this]() {
+      // the requester may be gone by the time a worker picks this up —
+      // skip the read entirely instead of filling a buffer for nobody
+      if (cancellation != nullptr && cancellation->isCancelled()) {
+        auto json = JSON::Object::Entries {
+          {"source", "fs.read"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(id)},
+            {"code", UV_ECANCELED},
+            {"type", "AbortError"},
+            {"message", String(uv_strerror(UV_ECANCELED))}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
       auto desc = getDescriptor(id);
 
       if (desc == nullptr) {
@@ -992,51 +1212,53 @@ namespace SSC {
         return cb(seq, json, Post{});
       }
 
-      auto loop = &this->core->eventLoop;
-      auto ctx = new RequestContext(desc, seq, cb);
-      auto req = &ctx->req;
-      auto bytes = new char[size]{0};
-
-      ctx->setBuffer(bytes, size);
-
-      auto err = uv_fs_read(loop, req, desc->fd, &ctx->buf, 1, offset, [](uv_fs_t* req) {
-        auto ctx = static_cast<RequestContext*>(req->data);
-        auto desc = ctx->desc;
-        auto json = JSON::Object {};
-        Post post = {0};
-
-        if (uv_fs_get_result(req) < 0) {
-          json = JSON::Object::Entries {
+    #if defined(__ANDROID__)
+      if (desc->isAsset()) {
+        // serve straight from the asset's mapped buffer - the post body
+        // aliases the `AAsset` reference, so the mapping stays valid for
+        // as long as any in-flight post still points into it, even if
+        // the descriptor closes first
+        const auto buffer = (const char*) AAsset_getBuffer(desc->asset.get());
+
+        if (buffer == nullptr) {
+          auto json = JSON::Object::Entries {
             {"source", "fs.read"},
             {"err", JSON::Object::Entries {
               {"id", std::to_string(desc->id)},
-              {"code", req->result},
-              {"message", String(uv_strerror((int) req->result))}
+              {"code", UV_EIO},
+              {"message", String(uv_strerror(UV_EIO))}
             }}
           };
 
-          auto bytes = ctx->getBuffer();
-          if (bytes != nullptr) {
-            delete [] bytes;
-          }
-        } else {
-          auto headers = Headers {{
-            {"content-type" ,"application/octet-stream"},
-            {"content-length", req->result}
-          }};
-
-          post.id = SSC::rand64();
-          post.body = ctx->getBuffer();
-          post.length = (int) req->result;
-          post.headers = headers.str();
+          return cb(seq, json, Post{});
         }
 
-        ctx->cb(ctx->seq, json, post);
-        delete ctx;
-      });
+        const auto length = (size_t) AAsset_getLength64(desc->asset.get());
+        const auto position = std::min(offset, length);
+        const auto available = std::min(size, length - position);
+
+        Post post = {0};
+        post.id = SSC::rand64();
+        post.body = Post::Body(desc->asset, (char*) buffer + position);
+        post.length = available;
+        post.headers = Headers::forPostBody(available);
+
+        return cb(seq, JSON::Object {}, post);
+      }
+    #endif
+
+      auto ctx = RequestContext(desc, seq, cb);
+      auto req = &ctx.req;
+      auto bytes = BufferPool::instance()->acquireRaw(size);
+
+      ctx.setBuffer(bytes, size);
+
+      auto err = uv_fs_read(nullptr, req, desc->fd, &ctx.buf, 1, offset, nullptr);
+      auto json = JSON::Object {};
+      Post post = {0};
 
       if (err < 0) {
-        auto json = JSON::Object::Entries {
+        json = JSON::Object::Entries {
           {"source", "fs.read"},
           {"err", JSON::Object::Entries {
             {"id", std::to_string(desc->id)},
@@ -1045,103 +1267,1259 @@ namespace SSC {
           }}
         };
 
-        ctx->cb(ctx->seq, json, Post{});
-        delete [] bytes;
-        delete ctx;
+        BufferPool::instance()->release(bytes, ctx.getBufferSize());
+      } else if (cancellation != nullptr && cancellation->isCancelled()) {
+        // the request was abandoned while the read ran — return the
+        // buffer to the pool instead of posting it
+        json = JSON::Object::Entries {
+          {"source", "fs.read"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(desc->id)},
+            {"code", UV_ECANCELED},
+            {"type", "AbortError"},
+            {"message", String(uv_strerror(UV_ECANCELED))}
+          }}
+        };
+
+        BufferPool::instance()->release(bytes, ctx.getBufferSize());
+      } else {
+        post.id = SSC::rand64();
+        post.body = BufferPool::instance()->adopt(
+          ctx.getBuffer(),
+          ctx.getBufferSize()
+        );
+        post.length = (int) req->result;
+        post.headers = Headers::forPostBody(req->result);
+
+      #if defined(__linux__) && !defined(__ANDROID__)
+        // a streaming descriptor drops the pages it just consumed so a
+        // long sequential read stops evicting the rest of the cache
+        if (desc->dropCacheAfterRead && req->result > 0) {
+          posix_fadvise(desc->fd, (off_t) offset, (off_t) req->result, POSIX_FADV_DONTNEED);
+        }
+      #endif
       }
+
+      ctx.cb(ctx.seq, json, post);
     });
   }
 
-  void Core::FS::watch (
+  void Core::FS::readv (
     const String seq,
     uint64_t id,
-    const String path,
-    Module::Callback cb
+    const Vector<size_t> sizes,
+    size_t offset,
+    Module::Callback cb,
+    const CancellationTokenPointer cancellation
   ) {
-    this->core->dispatchEventLoop([=, this]() {
-    #if defined(__ANDROID__)
-      auto json = JSON::Object::Entries {
-        {"source", "fs.watch"},
-        {"err", JSON::Object::Entries {
-          {"message", "Not supported"}
-        }}
-      };
+    // like `read`, but scatters one positional `uv_fs_read` across the
+    // requested extents so record oriented readers issue a single syscall
+    this->core->dispatchWorkerPool([=, this]() {
+      if (cancellation != nullptr && cancellation->isCancelled()) {
+        auto json = JSON::Object::Entries {
+          {"source", "fs.readv"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(id)},
+            {"code", UV_ECANCELED},
+            {"type", "AbortError"},
+            {"message", String(uv_strerror(UV_ECANCELED))}
+          }}
+        };
 
-      cb(seq, json, Post{});
-      return;
-    #else
-      FileSystemWatcher* watcher;
-      {
-        Lock lock(this->mutex);
-        watcher = this->watchers[id];
+        return cb(seq, json, Post{});
       }
 
-      if (watcher == nullptr) {
-        watcher = new FileSystemWatcher(path);
-        watcher->core = this->core;
-        const auto started = watcher->start([=, this](
-          const auto& changed,
-          const auto& events,
-          const auto& context
-        ) mutable {
-          JSON::Array::Entries eventNames;
+      auto desc = getDescriptor(id);
 
-          if (std::find(events.begin(), events.end(), FileSystemWatcher::Event::RENAME) != events.end()) {
-            eventNames.push_back("rename");
-          }
+      if (desc == nullptr) {
+        auto json = JSON::Object::Entries {
+          {"source", "fs.readv"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(id)},
+            {"code", "ENOTOPEN"},
+            {"type", "NotFoundError"},
+            {"message", "No file descriptor found with that id"}
+          }}
+        };
 
-          if (std::find(events.begin(), events.end(), FileSystemWatcher::Event::CHANGE) != events.end()) {
-            eventNames.push_back("change");
-          }
+        return cb(seq, json, Post{});
+      }
 
-          auto json = JSON::Object::Entries {
-            {"source", "fs.watch"},
-            {"data", JSON::Object::Entries {
-              {"id", std::to_string(id)},
-              {"events",eventNames},
-              {"path", std::filesystem::relative(changed, path).string()}
-            }}
-          };
+      size_t size = 0;
+      for (const auto entry : sizes) {
+        size += entry;
+      }
 
-          cb("-1", json, Post{});
-        });
+      auto ctx = RequestContext(desc, seq, cb);
+      auto req = &ctx.req;
+      auto bytes = BufferPool::instance()->acquireRaw(size);
 
-        if (!started) {
-          auto json = JSON::Object::Entries {
-            {"source", "fs.watch"},
-            {"err", JSON::Object::Entries {
-              {"message", "Failed to start 'fs.Watcher'"}
-            }}
-          };
+      ctx.setBuffer(bytes, size);
 
-          cb(seq, json, Post{});
-          return;
-        }
+      size_t position = 0;
+      for (const auto entry : sizes) {
+        ctx.iovs.push_back(uv_buf_init(bytes + position, entry));
+        position += entry;
+      }
 
-        {
-          Lock lock(this->mutex);
+      auto err = uv_fs_read(
+        nullptr,
+        req,
+        desc->fd,
+        ctx.iovs.data(),
+        ctx.iovs.size(),
+        offset,
+        nullptr
+      );
+
+      auto json = JSON::Object {};
+      Post post = {0};
+
+      if (err < 0) {
+        json = JSON::Object::Entries {
+          {"source", "fs.readv"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(desc->id)},
+            {"code", err},
+            {"message", String(uv_strerror(err))}
+          }}
+        };
+
+        BufferPool::instance()->release(bytes, ctx.getBufferSize());
+      } else if (cancellation != nullptr && cancellation->isCancelled()) {
+        json = JSON::Object::Entries {
+          {"source", "fs.readv"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(desc->id)},
+            {"code", UV_ECANCELED},
+            {"type", "AbortError"},
+            {"message", String(uv_strerror(UV_ECANCELED))}
+          }}
+        };
+
+        BufferPool::instance()->release(bytes, ctx.getBufferSize());
+      } else {
+        post.id = SSC::rand64();
+        post.body = BufferPool::instance()->adopt(
+          ctx.getBuffer(),
+          ctx.getBufferSize()
+        );
+        post.length = (int) req->result;
+        post.headers = Headers::forPostBody(req->result);
+
+      #if defined(__linux__) && !defined(__ANDROID__)
+        if (desc->dropCacheAfterRead && req->result > 0) {
+          posix_fadvise(desc->fd, (off_t) offset, (off_t) req->result, POSIX_FADV_DONTNEED);
+        }
+      #endif
+      }
+
+      ctx.cb(ctx.seq, json, post);
+    });
+  }
+
+  // hashes one file with `algorithm` ("crc32c" or "sha256"), streaming
+  // a pooled buffer through the digest - `false` when it could not be
+  // read. runs on whatever worker thread the caller fanned out to
+  static bool digestFile (
+    const String& path,
+    const String& algorithm,
+    String& digest
+  ) {
+    static constexpr size_t CHUNK_SIZE = 1024 * 1024;
+
+    uv_fs_t openReq;
+    auto fd = uv_fs_open(nullptr, &openReq, path.c_str(), UV_FS_O_RDONLY, 0, nullptr);
+    uv_fs_req_cleanup(&openReq);
+
+    if (fd < 0) {
+      return false;
+    }
+
+    const auto useCRC32C = algorithm == "crc32c";
+    CRC32C crc;
+    SHA256 sha;
+
+    auto bytes = BufferPool::instance()->acquireRaw(CHUNK_SIZE);
+    int64_t position = 0;
+    bool ok = true;
+
+    while (true) {
+      auto buf = uv_buf_init(bytes, CHUNK_SIZE);
+
+      uv_fs_t readReq;
+      auto result = uv_fs_read(nullptr, &readReq, fd, &buf, 1, position, nullptr);
+      uv_fs_req_cleanup(&readReq);
+
+      if (result < 0) {
+        ok = false;
+        break;
+      }
+
+      if (result == 0) {
+        break;
+      }
+
+      if (useCRC32C) {
+        crc.update(bytes, result);
+      } else {
+        sha.update(bytes, result);
+      }
+
+      position += result;
+    }
+
+    BufferPool::instance()->release(bytes, CHUNK_SIZE);
+
+    uv_fs_t closeReq;
+    uv_fs_close(nullptr, &closeReq, fd, nullptr);
+    uv_fs_req_cleanup(&closeReq);
+
+    if (ok) {
+      digest = useCRC32C ? crc.digest() : sha.digest();
+    }
+
+    return ok;
+  }
+
+  void Core::FS::checksum (
+    const String seq,
+    const String path,
+    const String algorithm,
+    Module::Callback cb
+  ) {
+    // the updater-verification path: hash natively on worker threads
+    // and reply with digests only, instead of streaming every file byte
+    // through the bridge to hash in JS. a directory hash can scan an
+    // arbitrarily large tree, so it must not occupy a `workerPool`
+    // thread
+    this->core->dispatchLongRunningWorkerPool([=, this]() {
+      if (algorithm != "crc32c" && algorithm != "sha256") {
+        auto json = JSON::Object::Entries {
+          {"source", "fs.checksum"},
+          {"err", JSON::Object::Entries {
+            {"type", "NotSupportedError"},
+            {"message", "Unsupported algorithm '" + algorithm + "'"}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
+      uv_fs_t statReq;
+      auto err = uv_fs_stat(nullptr, &statReq, path.c_str(), nullptr);
+      const auto isDirectory = err >= 0 &&
+        (uv_fs_get_statbuf(&statReq)->st_mode & S_IFMT) == S_IFDIR;
+      uv_fs_req_cleanup(&statReq);
+
+      if (err < 0) {
+        auto json = JSON::Object::Entries {
+          {"source", "fs.checksum"},
+          {"err", JSON::Object::Entries {
+            {"code", err},
+            {"message", String(uv_strerror(err))}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
+      if (!isDirectory) {
+        String digest;
+
+        if (!digestFile(path, algorithm, digest)) {
+          auto json = JSON::Object::Entries {
+            {"source", "fs.checksum"},
+            {"err", JSON::Object::Entries {
+              {"message", "Unable to read '" + path + "'"}
+            }}
+          };
+
+          return cb(seq, json, Post{});
+        }
+
+        auto json = JSON::Object::Entries {
+          {"source", "fs.checksum"},
+          {"data", JSON::Object::Entries {
+            {"path", path},
+            {"algorithm", algorithm},
+            {"digest", digest}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
+      // directory: enumerate every regular file, then fan the hashing
+      // out across parallel worker threads pulling from a shared cursor
+      Vector<String> files;
+      Vector<String> pending = { path };
+
+      while (pending.size() > 0) {
+        auto dir = pending.back();
+        pending.pop_back();
+
+        uv_fs_t scandirReq;
+        auto scanned = uv_fs_scandir(nullptr, &scandirReq, dir.c_str(), 0, nullptr);
+
+        if (scanned < 0) {
+          uv_fs_req_cleanup(&scandirReq);
+          continue;
+        }
+
+        uv_dirent_t dirent;
+        while (uv_fs_scandir_next(&scandirReq, &dirent) != UV_EOF) {
+          auto entryPath = dir + "/" + String(dirent.name);
+
+          if (dirent.type == UV_DIRENT_DIR) {
+            pending.push_back(entryPath);
+          } else if (dirent.type == UV_DIRENT_FILE) {
+            files.push_back(entryPath);
+          }
+        }
+
+        uv_fs_req_cleanup(&scandirReq);
+      }
+
+      Vector<String> digests(files.size());
+      std::atomic<size_t> cursor = 0;
+
+      auto concurrency = std::min(
+        files.size(),
+        (size_t) std::max(2u, std::thread::hardware_concurrency())
+      );
+
+      Vector<Thread> workers;
+      workers.reserve(concurrency);
+
+      for (size_t i = 0; i < concurrency; i++) {
+        workers.emplace_back([&]() {
+          while (true) {
+            const auto index = cursor.fetch_add(1, std::memory_order_relaxed);
+
+            if (index >= files.size()) {
+              break;
+            }
+
+            String digest;
+            // unreadable entries report an empty digest instead of
+            // failing the whole tree
+            if (digestFile(files[index], algorithm, digest)) {
+              digests[index] = digest;
+            }
+          }
+        });
+      }
+
+      for (auto& worker : workers) {
+        worker.join();
+      }
+
+      auto entries = JSON::Array::Entries {};
+
+      for (size_t i = 0; i < files.size(); i++) {
+        entries.push_back(JSON::Object::Entries {
+          {"path", files[i]},
+          {"digest", digests[i]}
+        });
+      }
+
+      auto json = JSON::Object::Entries {
+        {"source", "fs.checksum"},
+        {"data", JSON::Object::Entries {
+          {"path", path},
+          {"algorithm", algorithm},
+          {"files", entries}
+        }}
+      };
+
+      cb(seq, json, Post{});
+    });
+  }
+
+  void Core::FS::readStream (
+    const String seq,
+    const String path,
+    size_t size,
+    size_t offset,
+    Module::Callback cb
+  ) {
+    // a native read pipeline replacing the JS-driven loop of `fs.read`
+    // roundtrips: the worker reads ahead into pooled chunks while the
+    // scheme handler drains them as a chunked response, with the
+    // stream's high-water mark parking the reader whenever the webview
+    // falls behind. a stream can last as long as a slow consumer keeps
+    // it open, so it must not occupy a `workerPool` thread
+    this->core->dispatchLongRunningWorkerPool([=, this]() {
+      static constexpr size_t CHUNK_SIZE = 256 * 1024;
+
+      uv_fs_t openReq;
+      auto fd = uv_fs_open(nullptr, &openReq, path.c_str(), UV_FS_O_RDONLY, 0, nullptr);
+      uv_fs_req_cleanup(&openReq);
+
+      if (fd < 0) {
+        auto json = JSON::Object::Entries {
+          {"source", "fs.readStream"},
+          {"err", JSON::Object::Entries {
+            {"code", fd},
+            {"message", String(uv_strerror(fd))}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
+      auto stream = std::make_shared<PostChunkStream>();
+      auto drainMutex = std::make_shared<std::mutex>();
+      auto drained = std::make_shared<std::condition_variable>();
+
+      stream->onDrain = [drainMutex, drained]() {
+        std::lock_guard<std::mutex> lock(*drainMutex);
+        drained->notify_one();
+      };
+
+      Post post = {0};
+      post.id = SSC::rand64();
+      post.stream = stream;
+      post.headers = Headers { Headers::Entries {
+        {"content-type", "application/octet-stream"},
+        {"transfer-encoding", "chunked"}
+      }};
+
+      auto json = JSON::Object::Entries {
+        {"source", "fs.readStream"},
+        {"data", JSON::Object::Entries {
+          {"path", path}
+        }}
+      };
+
+      cb(seq, json, post);
+
+      size_t position = offset;
+      size_t remaining = size;
+      bool done = false;
+
+      while (!done && !stream->isClosed()) {
+        auto want = size > 0 && remaining < CHUNK_SIZE ? remaining : CHUNK_SIZE;
+        auto bytes = BufferPool::instance()->acquireRaw(want);
+        auto buf = uv_buf_init(bytes, (unsigned int) want);
+
+        uv_fs_t readReq;
+        auto result = uv_fs_read(nullptr, &readReq, fd, &buf, 1, position, nullptr);
+        uv_fs_req_cleanup(&readReq);
+
+        if (result <= 0) {
+          // EOF, or an error after the headers already went out - both
+          // can only end the stream
+          BufferPool::instance()->release(bytes, want);
+          stream->write(nullptr, 0, true);
+          break;
+        }
+
+        position += result;
+
+        if (size > 0) {
+          remaining -= result;
+          done = remaining == 0;
+        }
+
+        auto body = BufferPool::instance()->adopt(bytes, want);
+
+        if (!stream->write(body, result, done) && !done) {
+          if (stream->isClosed()) {
+            break;
+          }
+
+          // saturated: park until the consumer drains below the
+          // low-water mark (or a beat passes) before reading ahead
+          std::unique_lock<std::mutex> lock(*drainMutex);
+          drained->wait_for(lock, std::chrono::milliseconds(100));
+        }
+      }
+
+      uv_fs_t closeReq;
+      uv_fs_close(nullptr, &closeReq, fd, nullptr);
+      uv_fs_req_cleanup(&closeReq);
+    });
+  }
+
+  void Core::FS::walk (
+    const String seq,
+    const String path,
+    Module::Callback cb
+  ) {
+    // recursively enumerates `path` on a long-running worker thread and
+    // streams `{path, type, size, mtime}` rows to the webview as one
+    // chunked JSON array — a single IPC call instead of an
+    // opendir/readdir/stat roundtrip per directory level, with the
+    // emitter's chunk size and the stream's high-water mark bounding
+    // memory against slow consumers regardless of how many entries the
+    // tree holds. a walk can run for the lifetime of a slow disk scan,
+    // so it must not occupy a `workerPool` thread
+    this->core->dispatchLongRunningWorkerPool([=, this]() {
+      auto stream = std::make_shared<PostChunkStream>();
+      auto drainMutex = std::make_shared<std::mutex>();
+      auto drained = std::make_shared<std::condition_variable>();
+
+      stream->onDrain = [drainMutex, drained]() {
+        std::lock_guard<std::mutex> lock(*drainMutex);
+        drained->notify_one();
+      };
+
+      Post post = {0};
+      post.id = SSC::rand64();
+      post.stream = stream;
+      post.headers = Headers { Headers::Entries {
+        {"content-type", "application/json"},
+        {"transfer-encoding", "chunked"}
+      }};
+
+      auto json = JSON::Object::Entries {
+        {"source", "fs.walk"},
+        {"data", JSON::Object::Entries {
+          {"path", path}
+        }}
+      };
+
+      cb(seq, json, post);
+
+      JSONArrayStream emitter(stream);
+
+      auto push = [&](JSON::Any&& row) {
+        if (!emitter.push(row)) {
+          if (stream->isClosed()) {
+            return false;
+          }
+
+          // saturated: park until the consumer drains below the
+          // low-water mark (or a beat passes) before producing more
+          std::unique_lock<std::mutex> lock(*drainMutex);
+          drained->wait_for(lock, std::chrono::milliseconds(100));
+        }
+
+        return !stream->isClosed();
+      };
+
+      Vector<String> pending = { path };
+      bool aborted = false;
+
+      while (pending.size() > 0 && !aborted) {
+        auto dir = pending.back();
+        pending.pop_back();
+
+        uv_fs_t scandirReq;
+        auto err = uv_fs_scandir(nullptr, &scandirReq, dir.c_str(), 0, nullptr);
+
+        if (err < 0) {
+          uv_fs_req_cleanup(&scandirReq);
+          continue;
+        }
+
+        uv_dirent_t dirent;
+        while (uv_fs_scandir_next(&scandirReq, &dirent) != UV_EOF) {
+          auto entryPath = dir + "/" + String(dirent.name);
+          auto type = dirent.type == UV_DIRENT_DIR
+            ? "directory"
+            : dirent.type == UV_DIRENT_LINK ? "link" : "file";
+
+          auto size = String("0");
+          auto mtime = String("0");
+
+          uv_fs_t statReq;
+          if (uv_fs_lstat(nullptr, &statReq, entryPath.c_str(), nullptr) >= 0) {
+            auto stats = uv_fs_get_statbuf(&statReq);
+            size = std::to_string(stats->st_size);
+            mtime = std::to_string(stats->st_mtim.tv_sec);
+          }
+          uv_fs_req_cleanup(&statReq);
+
+          if (dirent.type == UV_DIRENT_DIR) {
+            pending.push_back(entryPath);
+          }
+
+          if (!push(JSON::Object::Entries {
+            {"path", entryPath},
+            {"type", type},
+            {"size", size},
+            {"mtime", mtime}
+          })) {
+            aborted = true;
+            break;
+          }
+        }
+
+        uv_fs_req_cleanup(&scandirReq);
+      }
+
+      if (!aborted) {
+        emitter.end();
+      }
+    });
+  }
+
+  void Core::FS::watch (
+    const String seq,
+    uint64_t id,
+    const String path,
+    Module::Callback cb
+  ) {
+    this->core->dispatchEventLoop([=, this]() {
+    #if defined(__ANDROID__)
+      auto json = JSON::Object::Entries {
+        {"source", "fs.watch"},
+        {"err", JSON::Object::Entries {
+          {"message", "Not supported"}
+        }}
+      };
+
+      cb(seq, json, Post{});
+      return;
+    #else
+      FileSystemWatcher* watcher;
+      {
+        Lock lock(this->mutex);
+        watcher = this->watchers[id];
+      }
+
+      if (watcher == nullptr) {
+        watcher = new FileSystemWatcher(path);
+        watcher->core = this->core;
+        const auto started = watcher->start([=, this](
+          const auto& changed,
+          const auto& events,
+          const auto& context
+        ) mutable {
+          this->invalidateStatCache(changed);
+
+          JSON::Array::Entries eventNames;
+
+          if (std::find(events.begin(), events.end(), FileSystemWatcher::Event::RENAME) != events.end()) {
+            eventNames.push_back("rename");
+          }
+
+          if (std::find(events.begin(), events.end(), FileSystemWatcher::Event::CHANGE) != events.end()) {
+            eventNames.push_back("change");
+          }
+
+          auto json = JSON::Object::Entries {
+            {"source", "fs.watch"},
+            {"data", JSON::Object::Entries {
+              {"id", std::to_string(id)},
+              {"events",eventNames},
+              {"path", std::filesystem::relative(changed, path).string()}
+            }}
+          };
+
+          cb("-1", json, Post{});
+        });
+
+        if (!started) {
+          auto json = JSON::Object::Entries {
+            {"source", "fs.watch"},
+            {"err", JSON::Object::Entries {
+              {"message", "Failed to start 'fs.Watcher'"}
+            }}
+          };
+
+          cb(seq, json, Post{});
+          return;
+        }
+
+        {
+          Lock lock(this->mutex);
           this->watchers.insert_or_assign(id, watcher);
         }
       }
 
       auto json = JSON::Object::Entries {
-        {"source", "fs.watch"},
-        {"data", JSON::Object::Entries {
-          {"id", std::to_string(id)}
+        {"source", "fs.watch"},
+        {"data", JSON::Object::Entries {
+          {"id", std::to_string(id)}
+        }}
+      };
+
+      cb(seq, json, Post{});
+    #endif
+    });
+  }
+
+  // settles the callbacks buffered behind one coalesced write: on
+  // success each entry reports its own byte count (in order, so a short
+  // write surfaces on the trailing entries), on failure every entry
+  // receives the error
+  static void settleCoalescedWrites (
+    uint64_t id,
+    const Vector<Core::FS::PendingWrite>& entries,
+    int64_t result
+  ) {
+    if (result < 0) {
+      for (const auto& entry : entries) {
+        auto json = JSON::Object::Entries {
+          {"source", "fs.write"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(id)},
+            {"code", result},
+            {"message", String(uv_strerror((int) result))}
+          }}
+        };
+
+        entry.cb(entry.seq, json, Post{});
+      }
+
+      return;
+    }
+
+    auto remaining = (size_t) result;
+
+    for (const auto& entry : entries) {
+      const auto written = std::min(entry.size, remaining);
+      remaining -= written;
+
+      auto json = JSON::Object::Entries {
+        {"source", "fs.write"},
+        {"data", JSON::Object::Entries {
+          {"id", std::to_string(id)},
+          {"result", (int) written}
+        }}
+      };
+
+      entry.cb(entry.seq, json, Post{});
+    }
+  }
+
+  // async flush of one descriptor's coalescer — owns the moved-out
+  // buffer and callbacks until the combined write settles
+  struct CoalescedWriteContext {
+    uint64_t id;
+    uv_fs_t req;
+    uv_buf_t buf;
+    Vector<char> storage;
+    Vector<Core::FS::PendingWrite> entries;
+
+    ~CoalescedWriteContext () {
+      uv_fs_req_cleanup(&this->req);
+    }
+  };
+
+  void Core::FS::coalesceWrite (
+    Descriptor *desc,
+    const String seq,
+    char *bytes,
+    size_t size,
+    int64_t offset,
+    Module::Callback cb
+  ) {
+    bool shouldFlush = false;
+    bool shouldSchedule = false;
+
+    do {
+      Lock lock(desc->mutex);
+
+      // a write that does not continue the buffered run (or switches
+      // between positioned and append mode) flushes what is pending
+      // before starting a new run
+      const auto contiguous = !desc->hasCoalesced || (
+        offset < 0
+          ? desc->writeBase < 0
+          : desc->writeBase >= 0 && offset == desc->writeNext
+      );
+
+      if (!contiguous) {
+        this->flushCoalescedWrites(desc, false);
+      }
+
+      if (!desc->hasCoalesced) {
+        desc->writeBase = offset;
+        desc->writeNext = offset;
+        desc->hasCoalesced = true;
+      }
+
+      desc->writeBuffer.insert(desc->writeBuffer.end(), bytes, bytes + size);
+      desc->pendingWrites.push_back(PendingWrite { seq, size, cb });
+
+      if (desc->writeNext >= 0) {
+        desc->writeNext += size;
+      }
+
+      if (desc->writeBuffer.size() >= WRITE_COALESCE_SIZE) {
+        shouldFlush = true;
+      } else if (!desc->isFlushScheduled) {
+        desc->isFlushScheduled = true;
+        shouldSchedule = true;
+      }
+    } while (0);
+
+    if (shouldFlush) {
+      this->flushCoalescedWrites(desc, false);
+    } else if (shouldSchedule) {
+      const auto id = desc->id;
+      this->core->setTimeout(WRITE_COALESCE_INTERVAL, [this, id]() {
+        this->core->dispatchEventLoop([this, id]() {
+          auto desc = getDescriptor(id);
+
+          if (desc != nullptr) {
+            do {
+              Lock lock(desc->mutex);
+              desc->isFlushScheduled = false;
+            } while (0);
+
+            this->flushCoalescedWrites(desc, false);
+          }
+        });
+      });
+    }
+  }
+
+  void Core::FS::flushCoalescedWrites (Descriptor *desc, bool sync) {
+    Vector<char> storage;
+    Vector<PendingWrite> entries;
+    int64_t base = 0;
+
+    do {
+      Lock lock(desc->mutex);
+
+      if (!desc->hasCoalesced || desc->writeBuffer.size() == 0) {
+        desc->hasCoalesced = false;
+        return;
+      }
+
+      storage = std::move(desc->writeBuffer);
+      entries = std::move(desc->pendingWrites);
+      base = desc->writeBase;
+      desc->writeBuffer = Vector<char>();
+      desc->pendingWrites = Vector<PendingWrite>();
+      desc->hasCoalesced = false;
+    } while (0);
+
+    // the synchronous variant exists for close/fsync barriers, where
+    // the flush must settle before the next threadpool request can be
+    // allowed to reorder around it — the buffer is bounded by
+    // `WRITE_COALESCE_SIZE` so the loop stall is bounded too
+    if (sync) {
+      uv_fs_t req;
+      auto buf = uv_buf_init(storage.data(), storage.size());
+      const auto result = uv_fs_write(nullptr, &req, desc->fd, &buf, 1, base, nullptr);
+      uv_fs_req_cleanup(&req);
+      settleCoalescedWrites(desc->id, entries, result);
+      return;
+    }
+
+    auto ctx = new CoalescedWriteContext {};
+    ctx->id = desc->id;
+    ctx->storage = std::move(storage);
+    ctx->entries = std::move(entries);
+    ctx->buf = uv_buf_init(ctx->storage.data(), ctx->storage.size());
+    ctx->req.data = (void *) ctx;
+
+    auto loop = &this->core->eventLoop;
+    auto err = uv_fs_write(loop, &ctx->req, desc->fd, &ctx->buf, 1, base, [](uv_fs_t *req) {
+      auto ctx = (CoalescedWriteContext *) req->data;
+      settleCoalescedWrites(ctx->id, ctx->entries, (int64_t) req->result);
+      delete ctx;
+    });
+
+    if (err < 0) {
+      settleCoalescedWrites(ctx->id, ctx->entries, err);
+      delete ctx;
+    }
+  }
+
+  void Core::FS::flush (const String seq, uint64_t id, Module::Callback cb) {
+    this->core->dispatchEventLoop([=, this]() {
+      auto desc = getDescriptor(id);
+
+      if (desc == nullptr) {
+        auto json = JSON::Object::Entries {
+          {"source", "fs.flush"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(id)},
+            {"code", "ENOTOPEN"},
+            {"type", "NotFoundError"},
+            {"message", "No file descriptor found with that id"}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
+      size_t pending = 0;
+
+      do {
+        Lock lock(desc->mutex);
+        pending = desc->writeBuffer.size();
+      } while (0);
+
+      this->flushCoalescedWrites(desc, false);
+
+      auto json = JSON::Object::Entries {
+        {"source", "fs.flush"},
+        {"data", JSON::Object::Entries {
+          {"id", std::to_string(id)},
+          {"result", (int) pending}
+        }}
+      };
+
+      cb(seq, json, Post{});
+    });
+  }
+
+  void Core::FS::write (
+    const String seq,
+    uint64_t id,
+    char *bytes,
+    size_t size,
+    int64_t offset,
+    Module::Callback cb,
+    const CancellationTokenPointer cancellation,
+    bool coalesce
+  ) {
+    this->core->dispatchEventLoop([=, this]() {
+      auto desc = getDescriptor(id);
+
+      if (desc == nullptr) {
+        auto json = JSON::Object::Entries {
+          {"source", "fs.write"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(id)},
+            {"code", "ENOTOPEN"},
+            {"type", "NotFoundError"},
+            {"message", "No file descriptor found with that id"}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
+      if (cancellation != nullptr && cancellation->isCancelled()) {
+        auto json = JSON::Object::Entries {
+          {"source", "fs.write"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(id)},
+            {"code", UV_ECANCELED},
+            {"type", "AbortError"},
+            {"message", String(uv_strerror(UV_ECANCELED))}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
+      // the coalescer buffers into unaligned storage, so unbuffered
+      // descriptors always write directly
+      if (coalesce && !desc->isDirect) {
+        return this->coalesceWrite(desc, seq, bytes, size, offset, cb);
+      }
+
+      auto loop = &this->core->eventLoop;
+      auto ctx = new RequestContext(desc, seq, cb);
+      auto req = &ctx->req;
+
+      if (desc->isDirect) {
+        // the caller's bytes arrive on whatever alignment the IPC layer
+        // produced — unbuffered IO needs block aligned source memory,
+        // so stage through an aligned pooled buffer
+        ctx->stagedSize = std::max(size, BufferPool::DIRECT_ALIGNMENT);
+        auto staged = BufferPool::instance()->acquireRaw(ctx->stagedSize);
+        memcpy(staged, bytes, size);
+        ctx->setBuffer(staged, size);
+      } else {
+        ctx->setBuffer(bytes, size);
+      }
+
+      auto err = uv_fs_write(loop, req, desc->fd, &ctx->buf, 1, offset, [](uv_fs_t* req) {
+        auto ctx = static_cast<RequestContext*>(req->data);
+        auto desc = ctx->desc;
+        auto json = JSON::Object {};
+
+        desc->core->fs.untrackCancelableRequest(ctx);
+
+        if (ctx->stagedSize > 0) {
+          BufferPool::instance()->release(ctx->getBuffer(), ctx->stagedSize);
+        }
+
+        if (uv_fs_get_result(req) < 0) {
+          json = JSON::Object::Entries {
+            {"source", "fs.write"},
+            {"err", JSON::Object::Entries {
+              {"id", std::to_string(desc->id)},
+              {"code", req->result},
+              {"message", String(uv_strerror((int) req->result))}
+            }}
+          };
+        } else {
+          json = JSON::Object::Entries {
+            {"source", "fs.write"},
+            {"data", JSON::Object::Entries {
+              {"id", std::to_string(desc->id)},
+              {"result", req->result}
+            }}
+          };
+        }
+
+        ctx->cb(ctx->seq, json, Post{});
+        delete ctx;
+      });
+
+      if (err >= 0) {
+        this->trackCancelableRequest(ctx, cancellation);
+      }
+
+      if (err < 0) {
+        auto json = JSON::Object::Entries {
+          {"source", "fs.write"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(desc->id)},
+            {"code", err},
+            {"message", String(uv_strerror(err))}
+          }}
+        };
+
+        if (ctx->stagedSize > 0) {
+          BufferPool::instance()->release(ctx->getBuffer(), ctx->stagedSize);
+        }
+
+        ctx->cb(ctx->seq, json, Post{});
+        delete ctx;
+      }
+    });
+  }
+
+  void Core::FS::writev (
+    const String seq,
+    uint64_t id,
+    char *bytes,
+    const Vector<size_t> sizes,
+    int64_t offset,
+    Module::Callback cb,
+    const CancellationTokenPointer cancellation
+  ) {
+    this->core->dispatchEventLoop([=, this]() {
+      auto desc = getDescriptor(id);
+
+      if (desc == nullptr) {
+        auto json = JSON::Object::Entries {
+          {"source", "fs.writev"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(id)},
+            {"code", "ENOTOPEN"},
+            {"type", "NotFoundError"},
+            {"message", "No file descriptor found with that id"}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
+      if (cancellation != nullptr && cancellation->isCancelled()) {
+        auto json = JSON::Object::Entries {
+          {"source", "fs.writev"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(id)},
+            {"code", UV_ECANCELED},
+            {"type", "AbortError"},
+            {"message", String(uv_strerror(UV_ECANCELED))}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
+      auto loop = &this->core->eventLoop;
+      auto ctx = new RequestContext(desc, seq, cb);
+      auto req = &ctx->req;
+
+      // the extents gather slices of the single buffer carried by the
+      // message into one `uv_fs_write` call
+      size_t total = 0;
+      for (const auto entry : sizes) {
+        total += entry;
+      }
+
+      auto base = bytes;
+
+      if (desc->isDirect) {
+        // unbuffered IO needs block aligned source memory — stage the
+        // whole gather through one aligned pooled buffer
+        ctx->stagedSize = std::max(total, BufferPool::DIRECT_ALIGNMENT);
+        base = BufferPool::instance()->acquireRaw(ctx->stagedSize);
+        memcpy(base, bytes, total);
+      }
+
+      size_t size = 0;
+      for (const auto entry : sizes) {
+        ctx->iovs.push_back(uv_buf_init(base + size, entry));
+        size += entry;
+      }
+
+      ctx->setBuffer(base, size);
+
+      auto err = uv_fs_write(
+        loop,
+        req,
+        desc->fd,
+        ctx->iovs.data(),
+        ctx->iovs.size(),
+        offset,
+        [](uv_fs_t* req) {
+        auto ctx = static_cast<RequestContext*>(req->data);
+        auto desc = ctx->desc;
+        auto json = JSON::Object {};
+
+        desc->core->fs.untrackCancelableRequest(ctx);
+
+        if (ctx->stagedSize > 0) {
+          BufferPool::instance()->release(ctx->getBuffer(), ctx->stagedSize);
+        }
+
+        if (uv_fs_get_result(req) < 0) {
+          json = JSON::Object::Entries {
+            {"source", "fs.writev"},
+            {"err", JSON::Object::Entries {
+              {"id", std::to_string(desc->id)},
+              {"code", req->result},
+              {"message", String(uv_strerror((int) req->result))}
+            }}
+          };
+        } else {
+          json = JSON::Object::Entries {
+            {"source", "fs.writev"},
+            {"data", JSON::Object::Entries {
+              {"id", std::to_string(desc->id)},
+              {"result", req->result}
+            }}
+          };
+        }
+
+        ctx->cb(ctx->seq, json, Post{});
+        delete ctx;
+      });
+
+      if (err >= 0) {
+        this->trackCancelableRequest(ctx, cancellation);
+      }
+
+      if (err < 0) {
+        auto json = JSON::Object::Entries {
+          {"source", "fs.writev"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(desc->id)},
+            {"code", err},
+            {"message", String(uv_strerror(err))}
+          }}
+        };
+
+        if (ctx->stagedSize > 0) {
+          BufferPool::instance()->release(ctx->getBuffer(), ctx->stagedSize);
+        }
+
+        ctx->cb(ctx->seq, json, Post{});
+        delete ctx;
+      }
+    });
+  }
+
+  void Core::FS::stat (
+    const String seq,
+    const String path,
+    Module::Callback cb
+  ) {
+    this->stat(seq, path, false, cb);
+  }
+
+  void Core::FS::stat (
+    const String seq,
+    const String path,
+    bool cache,
+    Module::Callback cb
+  ) {
+    if (cache) {
+      Lock lock(this->statCacheMutex);
+      auto entry = this->statCache.find("stat:" + path);
+      if (
+        entry != this->statCache.end() &&
+        entry->second.expiry > std::chrono::steady_clock::now()
+      ) {
+        return cb(seq, entry->second.json, Post {});
+      }
+    }
+
+    this->core->dispatchWorkerPool([=, this]() {
+      auto ctx = RequestContext(seq, cb);
+      auto req = &ctx.req;
+      auto err = uv_fs_stat(nullptr, req, path.c_str(), nullptr);
+      auto json = JSON::Object {};
+
+      if (err < 0) {
+        json = JSON::Object::Entries {
+          {"source", "fs.stat"},
+          {"err", JSON::Object::Entries {
+            {"code", err},
+            {"message", String(uv_strerror(err))}
+          }}
+        };
+      } else {
+        json = getStatsJSON("fs.stat", uv_fs_get_statbuf(req));
+
+        if (cache) {
+          Lock lock(this->statCacheMutex);
+          this->statCache["stat:" + path] = StatCacheEntry {
+            json,
+            std::chrono::steady_clock::now() + STAT_CACHE_TTL
+          };
+        }
+      }
+
+      ctx.cb(ctx.seq, json, Post {});
+    });
+  }
+
+  void Core::FS::stopWatch (
+    const String seq,
+    uint64_t id,
+    Module::Callback cb
+  ) {
+    this->core->dispatchEventLoop([=, this]() {
+    #if defined(__ANDROID__)
+      auto json = JSON::Object::Entries {
+        {"source", "fs.stopWatch"},
+        {"err", JSON::Object::Entries {
+          {"message", "Not supported"}
         }}
       };
 
       cb(seq, json, Post{});
+      return;
+    #else
+      auto watcher = this->core->fs.watchers[id];
+      if (watcher != nullptr) {
+        watcher->stop();
+        delete watcher;
+        this->core->fs.watchers.erase(id);
+        auto json = JSON::Object::Entries {
+          {"source", "fs.stopWatch"},
+          {"data", JSON::Object::Entries {
+            {"id", std::to_string(id)},
+          }}
+        };
+        cb(seq, json, Post{});
+      } else {
+        auto json = JSON::Object::Entries {
+          {"source", "fs.stat"},
+          {"err", JSON::Object::Entries {
+            {"type", "NotFoundError"},
+            {"message", "fs.Watcher does not exist"}
+          }}
+        };
+
+        cb(seq, json, Post{});
+      }
     #endif
     });
   }
 
-  void Core::FS::write (
+  void Core::FS::fsync (
     const String seq,
     uint64_t id,
-    char *bytes,
-    size_t size,
-    size_t offset,
     Module::Callback cb
   ) {
     this->core->dispatchEventLoop([=, this]() {
@@ -1149,7 +2527,7 @@ namespace SSC {
 
       if (desc == nullptr) {
         auto json = JSON::Object::Entries {
-          {"source", "fs.write"},
+          {"source", "fs.fsync"},
           {"err", JSON::Object::Entries {
             {"id", std::to_string(id)},
             {"code", "ENOTOPEN"},
@@ -1161,31 +2539,30 @@ namespace SSC {
         return cb(seq, json, Post{});
       }
 
+      // a barrier: buffered writes must reach the kernel before the
+      // sync is queued, or it could reorder around them on the pool
+      this->flushCoalescedWrites(desc, true);
+
       auto loop = &this->core->eventLoop;
       auto ctx = new RequestContext(desc, seq, cb);
       auto req = &ctx->req;
-
-      ctx->setBuffer(bytes, size);
-      auto err = uv_fs_write(loop, req, desc->fd, &ctx->buf, 1, offset, [](uv_fs_t* req) {
-        auto ctx = static_cast<RequestContext*>(req->data);
-        auto desc = ctx->desc;
+      auto err = uv_fs_fsync(loop, req, desc->fd, [](uv_fs_t *req) {
+        auto ctx = (RequestContext *) req->data;
         auto json = JSON::Object {};
 
         if (uv_fs_get_result(req) < 0) {
           json = JSON::Object::Entries {
-            {"source", "fs.write"},
+            {"source", "fs.fsync"},
             {"err", JSON::Object::Entries {
-              {"id", std::to_string(desc->id)},
               {"code", req->result},
               {"message", String(uv_strerror((int) req->result))}
             }}
           };
         } else {
           json = JSON::Object::Entries {
-            {"source", "fs.write"},
+            {"source", "fs.fsync"},
             {"data", JSON::Object::Entries {
-              {"id", std::to_string(desc->id)},
-              {"result", req->result}
+              {"result", req->result},
             }}
           };
         }
@@ -1196,9 +2573,9 @@ namespace SSC {
 
       if (err < 0) {
         auto json = JSON::Object::Entries {
-          {"source", "fs.write"},
+          {"source", "fs.fsync"},
           {"err", JSON::Object::Entries {
-            {"id", std::to_string(desc->id)},
+            {"id", std::to_string(id)},
             {"code", err},
             {"message", String(uv_strerror(err))}
           }}
@@ -1210,30 +2587,194 @@ namespace SSC {
     });
   }
 
-  void Core::FS::stat (
+  // one descriptor's request in a group sync fan-out — every entry
+  // points back at the shared context and the last completion settles
+  // the reply
+  struct GroupSyncContext;
+
+  struct GroupSyncEntry {
+    uv_fs_t req;
+    uint64_t id;
+    GroupSyncContext *ctx;
+  };
+
+  struct GroupSyncContext {
+    String seq;
+    Core::Module::Callback cb;
+    Vector<GroupSyncEntry> entries;
+    size_t remaining = 0;
+    int64_t err = 0;
+    uint64_t errId = 0;
+  };
+
+  // all completions run on the event loop thread, so the context needs
+  // no lock — the counter only ever decrements there
+  static void settleGroupSync (GroupSyncContext *ctx) {
+    if (--ctx->remaining > 0) {
+      return;
+    }
+
+    auto json = JSON::Object {};
+
+    if (ctx->err < 0) {
+      json = JSON::Object::Entries {
+        {"source", "fs.syncGroup"},
+        {"err", JSON::Object::Entries {
+          {"id", std::to_string(ctx->errId)},
+          {"code", ctx->err},
+          {"message", String(uv_strerror((int) ctx->err))}
+        }}
+      };
+    } else {
+      json = JSON::Object::Entries {
+        {"source", "fs.syncGroup"},
+        {"data", JSON::Object::Entries {
+          {"result", (int) ctx->entries.size()}
+        }}
+      };
+    }
+
+    ctx->cb(ctx->seq, json, Post{});
+    delete ctx;
+  }
+
+  void Core::FS::syncGroup (
     const String seq,
-    const String path,
+    const Vector<uint64_t> ids,
+    bool metadata,
     Module::Callback cb
   ) {
     this->core->dispatchEventLoop([=, this]() {
-      auto filename = path.c_str();
+      auto descriptors = Vector<Descriptor*>();
+
+      for (const auto id : ids) {
+        auto desc = getDescriptor(id);
+
+        if (desc == nullptr) {
+          auto json = JSON::Object::Entries {
+            {"source", "fs.syncGroup"},
+            {"err", JSON::Object::Entries {
+              {"id", std::to_string(id)},
+              {"code", "ENOTOPEN"},
+              {"type", "NotFoundError"},
+              {"message", "No file descriptor found with that id"}
+            }}
+          };
+
+          return cb(seq, json, Post{});
+        }
+
+        descriptors.push_back(desc);
+      }
+
+      if (descriptors.size() == 0) {
+        auto json = JSON::Object::Entries {
+          {"source", "fs.syncGroup"},
+          {"data", JSON::Object::Entries {
+            {"result", 0}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
+      // a barrier: every descriptor's buffered writes must reach the
+      // kernel before its sync is queued, or they could reorder around
+      // each other on the pool
+      for (const auto desc : descriptors) {
+        this->flushCoalescedWrites(desc, true);
+      }
+
       auto loop = &this->core->eventLoop;
-      auto ctx = new RequestContext(seq, cb);
+      auto ctx = new GroupSyncContext {};
+      ctx->seq = seq;
+      ctx->cb = cb;
+      ctx->remaining = descriptors.size();
+      // submitted requests hold their address — the vector must never
+      // grow past this reservation
+      ctx->entries.reserve(descriptors.size());
+
+      for (const auto desc : descriptors) {
+        ctx->entries.push_back(GroupSyncEntry {});
+        auto entry = &ctx->entries.back();
+        entry->id = desc->id;
+        entry->ctx = ctx;
+        entry->req.data = (void *) entry;
+
+        const auto callback = [](uv_fs_t *req) {
+          auto entry = (GroupSyncEntry *) req->data;
+          auto ctx = entry->ctx;
+
+          if (uv_fs_get_result(req) < 0 && ctx->err == 0) {
+            ctx->err = req->result;
+            ctx->errId = entry->id;
+          }
+
+          uv_fs_req_cleanup(req);
+          settleGroupSync(ctx);
+        };
+
+        const auto err = metadata
+          ? uv_fs_fsync(loop, &entry->req, desc->fd, callback)
+          : uv_fs_fdatasync(loop, &entry->req, desc->fd, callback);
+
+        if (err < 0) {
+          if (ctx->err == 0) {
+            ctx->err = err;
+            ctx->errId = desc->id;
+          }
+
+          settleGroupSync(ctx);
+        }
+      }
+    });
+  }
+
+  void Core::FS::ftruncate (
+    const String seq,
+    uint64_t id,
+    int64_t offset,
+    Module::Callback cb
+  ) {
+    this->core->dispatchEventLoop([=, this]() {
+      auto desc = getDescriptor(id);
+
+      if (desc == nullptr) {
+        auto json = JSON::Object::Entries {
+          {"source", "fs.ftruncate"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(id)},
+            {"code", "ENOTOPEN"},
+            {"type", "NotFoundError"},
+            {"message", "No file descriptor found with that id"}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
+      auto loop = &this->core->eventLoop;
+      auto ctx = new RequestContext(desc, seq, cb);
       auto req = &ctx->req;
-      auto err = uv_fs_stat(loop, req, filename, [](uv_fs_t *req) {
+      auto err = uv_fs_ftruncate(loop, req, desc->fd, offset, [](uv_fs_t *req) {
         auto ctx = (RequestContext *) req->data;
         auto json = JSON::Object {};
 
         if (uv_fs_get_result(req) < 0) {
           json = JSON::Object::Entries {
-            {"source", "fs.stat"},
+            {"source", "fs.ftruncate"},
             {"err", JSON::Object::Entries {
               {"code", req->result},
               {"message", String(uv_strerror((int) req->result))}
             }}
           };
         } else {
-          json = getStatsJSON("fs.stat", uv_fs_get_statbuf(req));
+          json = JSON::Object::Entries {
+            {"source", "fs.ftruncate"},
+            {"data", JSON::Object::Entries {
+              {"result", req->result},
+            }}
+          };
         }
 
         ctx->cb(ctx->seq, json, Post{});
@@ -1242,8 +2783,9 @@ namespace SSC {
 
       if (err < 0) {
         auto json = JSON::Object::Entries {
-          {"source", "fs.stat"},
+          {"source", "fs.ftruncate"},
           {"err", JSON::Object::Entries {
+            {"id", std::to_string(id)},
             {"code", err},
             {"message", String(uv_strerror(err))}
           }}
@@ -1255,61 +2797,147 @@ namespace SSC {
     });
   }
 
-  void Core::FS::stopWatch (
-    const String seq,
-    uint64_t id,
-    Module::Callback cb
-  ) {
-    this->core->dispatchEventLoop([=, this]() {
-    #if defined(__ANDROID__)
-      auto json = JSON::Object::Entries {
-        {"source", "fs.stopWatch"},
-        {"err", JSON::Object::Entries {
-          {"message", "Not supported"}
-        }}
-      };
+  // platform backends for `fs.allocate` and `fs.punchHole` - blocking
+  // syscalls libuv has no request type for, always run on the worker
+  // pool. both return `0` or a libuv error code
+  static int allocateRange (uv_file fd, int64_t offset, int64_t length) {
+  #if defined(__APPLE__)
+    struct stat stats;
 
-      cb(seq, json, Post{});
-      return;
-    #else
-      auto watcher = this->core->fs.watchers[id];
-      if (watcher != nullptr) {
-        watcher->stop();
-        delete watcher;
-        this->core->fs.watchers.erase(id);
-        auto json = JSON::Object::Entries {
-          {"source", "fs.stopWatch"},
-          {"data", JSON::Object::Entries {
-            {"id", std::to_string(id)},
-          }}
-        };
-        cb(seq, json, Post{});
-      } else {
-        auto json = JSON::Object::Entries {
-          {"source", "fs.stat"},
-          {"err", JSON::Object::Entries {
-            {"type", "NotFoundError"},
-            {"message", "fs.Watcher does not exist"}
-          }}
-        };
+    if (::fstat(fd, &stats) == -1) {
+      return uv_translate_sys_error(errno);
+    }
+
+    // `F_PREALLOCATE` reserves past the physical end of file, so only
+    // the bytes the range adds beyond the current size are requested -
+    // contiguous first, falling back to any free space
+    const auto needed = (offset + length) - (int64_t) stats.st_size;
+
+    if (needed > 0) {
+      fstore_t store = { F_ALLOCATECONTIG, F_PEOFPOSMODE, 0, needed, 0 };
+
+      if (fcntl(fd, F_PREALLOCATE, &store) == -1) {
+        store.fst_flags = F_ALLOCATEALL;
+
+        if (fcntl(fd, F_PREALLOCATE, &store) == -1) {
+          return uv_translate_sys_error(errno);
+        }
+      }
+
+      // extend the logical size like `posix_fallocate(2)` so writes
+      // land in place - never shrinking a file that is already longer
+      if (::ftruncate(fd, offset + length) == -1) {
+        return uv_translate_sys_error(errno);
+      }
+    }
+
+    return 0;
+  #elif defined(__linux__)
+    const auto err = posix_fallocate(fd, offset, length);
+    return err == 0 ? 0 : uv_translate_sys_error(err);
+  #elif defined(_WIN32)
+    const auto handle = uv_get_osfhandle(fd);
+
+    if (handle == INVALID_HANDLE_VALUE) {
+      return UV_EBADF;
+    }
 
-        cb(seq, json, Post{});
-      }
-    #endif
-    });
+    // reserves clusters without moving the end of file, so later
+    // appending writes fill the reservation in place
+    FILE_ALLOCATION_INFO info;
+    info.AllocationSize.QuadPart = offset + length;
+
+    if (!SetFileInformationByHandle(
+      (HANDLE) handle,
+      FileAllocationInfo,
+      &info,
+      sizeof(info)
+    )) {
+      return uv_translate_sys_error(GetLastError());
+    }
+
+    return 0;
+  #else
+    return UV_ENOTSUP;
+  #endif
   }
 
-  void Core::FS::fsync (
+  static int punchHoleRange (uv_file fd, int64_t offset, int64_t length) {
+  #if defined(__APPLE__)
+    struct fpunchhole punchhole;
+    memset(&punchhole, 0, sizeof(punchhole));
+    punchhole.fp_offset = offset;
+    punchhole.fp_length = length;
+
+    if (fcntl(fd, F_PUNCHHOLE, &punchhole) == -1) {
+      return uv_translate_sys_error(errno);
+    }
+
+    return 0;
+  #elif defined(__linux__)
+    if (fallocate(fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, offset, length) == -1) {
+      return uv_translate_sys_error(errno);
+    }
+
+    return 0;
+  #elif defined(_WIN32)
+    const auto handle = uv_get_osfhandle(fd);
+
+    if (handle == INVALID_HANDLE_VALUE) {
+      return UV_EBADF;
+    }
+
+    DWORD returned = 0;
+
+    // best effort: zeroing deallocates only on sparse files, and a file
+    // already marked sparse just succeeds again
+    DeviceIoControl(
+      (HANDLE) handle,
+      FSCTL_SET_SPARSE,
+      nullptr,
+      0,
+      nullptr,
+      0,
+      &returned,
+      nullptr
+    );
+
+    FILE_ZERO_DATA_INFORMATION zero;
+    zero.FileOffset.QuadPart = offset;
+    zero.BeyondFinalZero.QuadPart = offset + length;
+
+    if (!DeviceIoControl(
+      (HANDLE) handle,
+      FSCTL_SET_ZERO_DATA,
+      &zero,
+      sizeof(zero),
+      nullptr,
+      0,
+      &returned,
+      nullptr
+    )) {
+      return uv_translate_sys_error(GetLastError());
+    }
+
+    return 0;
+  #else
+    return UV_ENOTSUP;
+  #endif
+  }
+
+  void Core::FS::allocate (
     const String seq,
     uint64_t id,
+    int64_t offset,
+    int64_t length,
     Module::Callback cb
   ) {
-    this->core->dispatchEventLoop([=, this]() {
+    this->core->dispatchWorkerPool([=, this]() {
       auto desc = getDescriptor(id);
 
       if (desc == nullptr) {
         auto json = JSON::Object::Entries {
-          {"source", "fs.fsync"},
+          {"source", "fs.allocate"},
           {"err", JSON::Object::Entries {
             {"id", std::to_string(id)},
             {"code", "ENOTOPEN"},
@@ -1321,62 +2949,44 @@ namespace SSC {
         return cb(seq, json, Post{});
       }
 
-      auto loop = &this->core->eventLoop;
-      auto ctx = new RequestContext(desc, seq, cb);
-      auto req = &ctx->req;
-      auto err = uv_fs_fsync(loop, req, desc->fd, [](uv_fs_t *req) {
-        auto ctx = (RequestContext *) req->data;
-        auto json = JSON::Object {};
-
-        if (uv_fs_get_result(req) < 0) {
-          json = JSON::Object::Entries {
-            {"source", "fs.fsync"},
-            {"err", JSON::Object::Entries {
-              {"code", req->result},
-              {"message", String(uv_strerror((int) req->result))}
-            }}
-          };
-        } else {
-          json = JSON::Object::Entries {
-            {"source", "fs.fsync"},
-            {"data", JSON::Object::Entries {
-              {"result", req->result},
-            }}
-          };
-        }
-
-        ctx->cb(ctx->seq, json, Post{});
-        delete ctx;
-      });
+      const auto err = allocateRange(desc->fd, offset, length);
+      auto json = JSON::Object {};
 
       if (err < 0) {
-        auto json = JSON::Object::Entries {
-          {"source", "fs.fsync"},
+        json = JSON::Object::Entries {
+          {"source", "fs.allocate"},
           {"err", JSON::Object::Entries {
             {"id", std::to_string(id)},
             {"code", err},
             {"message", String(uv_strerror(err))}
           }}
         };
-
-        ctx->cb(ctx->seq, json, Post{});
-        delete ctx;
+      } else {
+        json = JSON::Object::Entries {
+          {"source", "fs.allocate"},
+          {"data", JSON::Object::Entries {
+            {"result", err}
+          }}
+        };
       }
+
+      cb(seq, json, Post{});
     });
   }
 
-  void Core::FS::ftruncate (
+  void Core::FS::punchHole (
     const String seq,
     uint64_t id,
     int64_t offset,
+    int64_t length,
     Module::Callback cb
   ) {
-    this->core->dispatchEventLoop([=, this]() {
+    this->core->dispatchWorkerPool([=, this]() {
       auto desc = getDescriptor(id);
 
       if (desc == nullptr) {
         auto json = JSON::Object::Entries {
-          {"source", "fs.ftruncate"},
+          {"source", "fs.punchHole"},
           {"err", JSON::Object::Entries {
             {"id", std::to_string(id)},
             {"code", "ENOTOPEN"},
@@ -1388,47 +2998,28 @@ namespace SSC {
         return cb(seq, json, Post{});
       }
 
-      auto loop = &this->core->eventLoop;
-      auto ctx = new RequestContext(desc, seq, cb);
-      auto req = &ctx->req;
-      auto err = uv_fs_ftruncate(loop, req, desc->fd, offset, [](uv_fs_t *req) {
-        auto ctx = (RequestContext *) req->data;
-        auto json = JSON::Object {};
-
-        if (uv_fs_get_result(req) < 0) {
-          json = JSON::Object::Entries {
-            {"source", "fs.ftruncate"},
-            {"err", JSON::Object::Entries {
-              {"code", req->result},
-              {"message", String(uv_strerror((int) req->result))}
-            }}
-          };
-        } else {
-          json = JSON::Object::Entries {
-            {"source", "fs.ftruncate"},
-            {"data", JSON::Object::Entries {
-              {"result", req->result},
-            }}
-          };
-        }
-
-        ctx->cb(ctx->seq, json, Post{});
-        delete ctx;
-      });
+      const auto err = punchHoleRange(desc->fd, offset, length);
+      auto json = JSON::Object {};
 
       if (err < 0) {
-        auto json = JSON::Object::Entries {
-          {"source", "fs.ftruncate"},
+        json = JSON::Object::Entries {
+          {"source", "fs.punchHole"},
           {"err", JSON::Object::Entries {
             {"id", std::to_string(id)},
             {"code", err},
             {"message", String(uv_strerror(err))}
           }}
         };
-
-        ctx->cb(ctx->seq, json, Post{});
-        delete ctx;
+      } else {
+        json = JSON::Object::Entries {
+          {"source", "fs.punchHole"},
+          {"data", JSON::Object::Entries {
+            {"result", err}
+          }}
+        };
       }
+
+      cb(seq, json, Post{});
     });
   }
 
@@ -1437,7 +3028,7 @@ namespace SSC {
     uint64_t id,
     Module::Callback cb
   ) {
-    this->core->dispatchEventLoop([=, this]() {
+    this->core->dispatchWorkerPool([=, this]() {
       auto desc = getDescriptor(id);
 
       if (desc == nullptr) {
@@ -1454,33 +3045,24 @@ namespace SSC {
         return cb(seq, json, Post{});
       }
 
-      auto loop = &this->core->eventLoop;
-      auto ctx = new RequestContext(desc, seq, cb);
-      auto req = &ctx->req;
-      auto err = uv_fs_fstat(loop, req, desc->fd, [](uv_fs_t *req) {
-        auto ctx = (RequestContext *) req->data;
-        auto desc = ctx->desc;
-        auto json = JSON::Object {};
-
-        if (uv_fs_get_result(req) < 0) {
-          json = JSON::Object::Entries {
-            {"source", "fs.fstat"},
-            {"err", JSON::Object::Entries {
-              {"id", std::to_string(desc->id)},
-              {"code", req->result},
-              {"message", String(uv_strerror((int) req->result))}
-            }}
-          };
-        } else {
-          json = getStatsJSON("fs.fstat", uv_fs_get_statbuf(req));
-        }
+    #if defined(__ANDROID__)
+      if (desc->isAsset()) {
+        // fabricate the stats an asset can answer - a read only regular
+        // file of the asset's length
+        uv_stat_t stats = {0};
+        stats.st_size = (uint64_t) AAsset_getLength64(desc->asset.get());
+        stats.st_mode = S_IFREG | 0444;
+        return cb(seq, getStatsJSON("fs.fstat", &stats), Post{});
+      }
+    #endif
 
-        ctx->cb(ctx->seq, json, Post{});
-        delete ctx;
-      });
+      auto ctx = RequestContext(desc, seq, cb);
+      auto req = &ctx.req;
+      auto err = uv_fs_fstat(nullptr, req, desc->fd, nullptr);
+      auto json = JSON::Object {};
 
       if (err < 0) {
-        auto json = JSON::Object::Entries {
+        json = JSON::Object::Entries {
           {"source", "fs.fstat"},
           {"err", JSON::Object::Entries {
             {"id", std::to_string(id)},
@@ -1488,10 +3070,11 @@ namespace SSC {
             {"message", String(uv_strerror(err))}
           }}
         };
-
-        ctx->cb(ctx->seq, json, Post{});
-        delete ctx;
+      } else {
+        json = getStatsJSON("fs.fstat", uv_fs_get_statbuf(req));
       }
+
+      ctx.cb(ctx.seq, json, Post {});
     });
   }
 
@@ -1499,14 +3082,11 @@ namespace SSC {
     const String seq,
     Module::Callback cb
   ) {
-    Lock lock(this->mutex);
     auto entries = Vector<JSON::Any> {};
 
-    for (auto const &tuple : descriptors) {
-      auto desc = tuple.second;
-
+    descriptors.each([&entries](uint64_t id, Descriptor*& desc) {
       if (!desc || (desc->isStale() && !desc->isRetained())) {
-        continue;
+        return;
       }
 
       auto entry = JSON::Object::Entries {
@@ -1516,7 +3096,7 @@ namespace SSC {
       };
 
       entries.push_back(entry);
-    }
+    });
 
     auto json = JSON::Object::Entries {
       {"source", "fs.getOpenDescriptors"},
@@ -1531,46 +3111,74 @@ namespace SSC {
     const String path,
     Module::Callback cb
   ) {
-    this->core->dispatchEventLoop([=, this]() {
-      auto filename = path.c_str();
-      auto loop = &this->core->eventLoop;
-      auto ctx = new RequestContext(seq, cb);
-      auto req = &ctx->req;
-      auto err = uv_fs_lstat(loop, req, filename, [](uv_fs_t* req) {
-        auto ctx = (RequestContext *) req->data;
-        auto json = JSON::Object {};
+    this->lstat(seq, path, false, cb);
+  }
 
-        if (uv_fs_get_result(req) < 0) {
-          json = JSON::Object::Entries {
-            {"source", "fs.stat"},
-            {"err", JSON::Object::Entries {
-              {"code", req->result},
-              {"message", String(uv_strerror((int) req->result))}
-            }}
-          };
-        } else {
-          json = getStatsJSON("fs.lstat", uv_fs_get_statbuf(req));
-        }
+  void Core::FS::lstat (
+    const String seq,
+    const String path,
+    bool cache,
+    Module::Callback cb
+  ) {
+    if (cache) {
+      Lock lock(this->statCacheMutex);
+      auto entry = this->statCache.find("lstat:" + path);
+      if (
+        entry != this->statCache.end() &&
+        entry->second.expiry > std::chrono::steady_clock::now()
+      ) {
+        return cb(seq, entry->second.json, Post {});
+      }
+    }
 
-        ctx->cb(ctx->seq, json, Post{});
-        delete ctx;
-      });
+    this->core->dispatchWorkerPool([=, this]() {
+      auto ctx = RequestContext(seq, cb);
+      auto req = &ctx.req;
+      auto err = uv_fs_lstat(nullptr, req, path.c_str(), nullptr);
+      auto json = JSON::Object {};
 
       if (err < 0) {
-        auto json = JSON::Object::Entries {
+        json = JSON::Object::Entries {
           {"source", "fs.stat"},
           {"err", JSON::Object::Entries {
             {"code", err},
             {"message", String(uv_strerror(err))}
           }}
         };
+      } else {
+        json = getStatsJSON("fs.lstat", uv_fs_get_statbuf(req));
 
-        ctx->cb(ctx->seq, json, Post{});
-        delete ctx;
+        if (cache) {
+          Lock lock(this->statCacheMutex);
+          this->statCache["lstat:" + path] = StatCacheEntry {
+            json,
+            std::chrono::steady_clock::now() + STAT_CACHE_TTL
+          };
+        }
       }
+
+      ctx.cb(ctx.seq, json, Post {});
     });
   }
 
+  void Core::FS::invalidateStatCache (const String& path) {
+    Lock lock(this->statCacheMutex);
+
+    if (this->statCache.size() == 0) {
+      return;
+    }
+
+    this->statCache.erase("stat:" + path);
+    this->statCache.erase("lstat:" + path);
+
+    // a change also touches the parent directory's metadata
+    auto parent = Path(path).parent_path().string();
+    if (parent.size() > 0) {
+      this->statCache.erase("stat:" + parent);
+      this->statCache.erase("lstat:" + parent);
+    }
+  }
+
 	void Core::FS::link (
     const String seq,
     const String src,
@@ -1776,47 +3384,30 @@ namespace SSC {
     const String path,
     const Module::Callback cb
   ) {
-    this->core->dispatchEventLoop([=, this]() {
-      auto ctx = new RequestContext(seq, cb);
-      auto uv_cb = [](uv_fs_t* req) {
-        auto ctx = static_cast<RequestContext*>(req->data);
-        auto json = JSON::Object{};
-
-        if (uv_fs_get_result(req) < 0) {
-          json = JSON::Object::Entries {
-            {"source", "fs.realpath"},
-            {"err", JSON::Object::Entries {
-              {"code", uv_fs_get_result(req)},
-              {"message", String(uv_strerror(uv_fs_get_result(req)))}
-            }}
-          };
-        } else {
-          json = JSON::Object::Entries {
-            {"source", "fs.realpath"},
-            {"data", JSON::Object::Entries {
-              {"path", String((char*) uv_fs_get_ptr(req))}
-            }}
-          };
-        }
-
-        ctx->cb(ctx->seq, json, Post {});
-        delete ctx;
-      };
-
-      auto err = uv_fs_realpath(
-          &core->eventLoop, &ctx->req, path.c_str(), uv_cb);
+    this->core->dispatchWorkerPool([=, this]() {
+      auto ctx = RequestContext(seq, cb);
+      auto req = &ctx.req;
+      auto err = uv_fs_realpath(nullptr, req, path.c_str(), nullptr);
+      auto json = JSON::Object {};
 
       if (err < 0) {
-        auto json = JSON::Object::Entries {
+        json = JSON::Object::Entries {
           {"source", "fs.realpath"},
           {"err", JSON::Object::Entries {
             {"code", err},
             {"message", String(uv_strerror(err))}
           }}
         };
-        ctx->cb(seq, json, Post{});
-        delete ctx;
+      } else {
+        json = JSON::Object::Entries {
+          {"source", "fs.realpath"},
+          {"data", JSON::Object::Entries {
+            {"path", String((char*) uv_fs_get_ptr(req))}
+          }}
+        };
       }
+
+      ctx.cb(ctx.seq, json, Post {});
     });
   }
 
@@ -1925,6 +3516,178 @@ namespace SSC {
     });
   }
 
+  void Core::FS::copy (
+    const String seq,
+    const String pathA,
+    const String pathB,
+    int flags,
+    Module::Callback cb
+  ) {
+    // kernel-side copy with progress: clone the file when the filesystem
+    // supports it, otherwise move bytes with sendfile-style requests so
+    // large copies never stream through userspace or the IPC layer.
+    // progress is delivered through the reply's `event_stream`; when the
+    // caller did not come through a scheme handler the emits are no-ops
+    this->core->dispatchWorkerPool([=, this]() {
+      auto stream = std::make_shared<std::function<bool(const char*, const char*, bool)>>(
+        [](const char* name, const char* data, bool finished) {
+          return false;
+        }
+      );
+
+      auto emit = [stream](
+        const String& name,
+        const JSON::Object& data,
+        bool finished
+      ) {
+        (*stream)(name.c_str(), data.str().c_str(), finished);
+      };
+
+      uv_fs_t statReq;
+      auto err = uv_fs_stat(nullptr, &statReq, pathA.c_str(), nullptr);
+      auto total = err < 0 ? 0 : uv_fs_get_statbuf(&statReq)->st_size;
+      uv_fs_req_cleanup(&statReq);
+
+      if (err < 0) {
+        auto json = JSON::Object::Entries {
+          {"source", "fs.copy"},
+          {"err", JSON::Object::Entries {
+            {"code", err},
+            {"message", String(uv_strerror(err))}
+          }}
+        };
+
+        return cb(seq, json, Post {});
+      }
+
+      Post post = {0};
+      post.id = SSC::rand64();
+      post.event_stream = stream;
+      post.headers = Headers { Headers::Entries {
+        {"content-type", "text/event-stream"},
+        {"cache-control", "no-store"}
+      }};
+
+      auto json = JSON::Object::Entries {
+        {"source", "fs.copy"},
+        {"data", JSON::Object::Entries {
+          {"total", std::to_string(total)}
+        }}
+      };
+
+      cb(seq, json, post);
+
+      // constant-time kernel clone first — clonefile on APFS, FICLONE on
+      // Linux filesystems with reflink support — falling back to libuv's
+      // kernel copy paths (copy_file_range, fcopyfile, CopyFile)
+      uv_fs_t cloneReq;
+      err = uv_fs_copyfile(
+        nullptr,
+        &cloneReq,
+        pathA.c_str(),
+        pathB.c_str(),
+        flags | UV_FS_COPYFILE_FICLONE,
+        nullptr
+      );
+      uv_fs_req_cleanup(&cloneReq);
+
+      if (err >= 0) {
+        emit("progress", JSON::Object(JSON::Object::Entries {
+          {"written", std::to_string(total)},
+          {"total", std::to_string(total)}
+        }), false);
+        emit("finish", JSON::Object(JSON::Object::Entries {
+          {"written", std::to_string(total)},
+          {"total", std::to_string(total)}
+        }), true);
+        return;
+      }
+
+      // chunked sendfile so progress events fire as the kernel moves
+      // bytes between the two descriptors
+      static constexpr size_t CHUNK = 4 * 1024 * 1024;
+
+      uv_fs_t openReq;
+      auto srcFd = uv_fs_open(nullptr, &openReq, pathA.c_str(), UV_FS_O_RDONLY, 0, nullptr);
+      uv_fs_req_cleanup(&openReq);
+
+      if (srcFd < 0) {
+        emit("error", JSON::Object(JSON::Object::Entries {
+          {"code", srcFd},
+          {"message", String(uv_strerror(srcFd))}
+        }), true);
+        return;
+      }
+
+      auto dstFd = uv_fs_open(
+        nullptr,
+        &openReq,
+        pathB.c_str(),
+        UV_FS_O_WRONLY | UV_FS_O_CREAT | UV_FS_O_TRUNC,
+        0644,
+        nullptr
+      );
+      uv_fs_req_cleanup(&openReq);
+
+      if (dstFd < 0) {
+        uv_fs_t closeReq;
+        uv_fs_close(nullptr, &closeReq, srcFd, nullptr);
+        uv_fs_req_cleanup(&closeReq);
+        emit("error", JSON::Object(JSON::Object::Entries {
+          {"code", dstFd},
+          {"message", String(uv_strerror(dstFd))}
+        }), true);
+        return;
+      }
+
+      int64_t written = 0;
+
+      while (written < (int64_t) total) {
+        uv_fs_t sendReq;
+        auto result = uv_fs_sendfile(
+          nullptr,
+          &sendReq,
+          dstFd,
+          srcFd,
+          written,
+          CHUNK,
+          nullptr
+        );
+        uv_fs_req_cleanup(&sendReq);
+
+        if (result <= 0) {
+          err = result;
+          break;
+        }
+
+        written += result;
+        emit("progress", JSON::Object(JSON::Object::Entries {
+          {"written", std::to_string(written)},
+          {"total", std::to_string(total)}
+        }), false);
+      }
+
+      uv_fs_t closeReq;
+      uv_fs_close(nullptr, &closeReq, srcFd, nullptr);
+      uv_fs_req_cleanup(&closeReq);
+      uv_fs_close(nullptr, &closeReq, dstFd, nullptr);
+      uv_fs_req_cleanup(&closeReq);
+
+      if (written < (int64_t) total && err < 0) {
+        emit("error", JSON::Object(JSON::Object::Entries {
+          {"code", err},
+          {"message", String(uv_strerror((int) err))}
+        }), true);
+        return;
+      }
+
+      emit("finish", JSON::Object(JSON::Object::Entries {
+        {"written", std::to_string(written)},
+        {"total", std::to_string(total)}
+      }), true);
+    });
+  }
+
   void Core::FS::rmdir (
     const String seq,
     const String path,
@@ -2078,7 +3841,7 @@ namespace SSC {
       .ttl = 0,
       .body = nullptr,
       .length = 0,
-      .headers = headers.str()
+      .headers = headers
     };
 
     cb(seq, json, post);
@@ -0,0 +1,67 @@
+#include "heap.hh"
+#include "json.hh"
+
+namespace SSC::Heap {
+#if defined(SSC_ENABLE_HEAP_PROFILING)
+  // live totals per tag - recorded relaxed like the `Diagnostics`
+  // counters, aggregation only happens at query time
+  struct Counters {
+    std::atomic<int64_t> bytes = 0;
+    std::atomic<int64_t> count = 0;
+    std::atomic<uint64_t> allocations = 0; // cumulative, never decremented
+  };
+
+  static Counters counters[size_t(Tag::COUNT)];
+
+  static const char* name (Tag tag) {
+    switch (tag) {
+      case Tag::posts: return "posts";
+      case Tag::bufferPool: return "bufferPool";
+      case Tag::json: return "json";
+      case Tag::messages: return "messages";
+      case Tag::results: return "results";
+      case Tag::extensionContexts: return "extensionContexts";
+      case Tag::COUNT: break;
+    }
+
+    return "unknown";
+  }
+
+  void track (Tag tag, int64_t bytes) {
+    auto& entry = counters[size_t(tag)];
+    entry.count.fetch_add(1, std::memory_order_relaxed);
+    entry.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    entry.allocations.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void untrack (Tag tag, int64_t bytes) {
+    auto& entry = counters[size_t(tag)];
+    entry.count.fetch_sub(1, std::memory_order_relaxed);
+    entry.bytes.fetch_sub(bytes, std::memory_order_relaxed);
+  }
+
+  JSON::Object snapshot () {
+    auto tags = JSON::Object {};
+
+    for (size_t i = 0; i < size_t(Tag::COUNT); ++i) {
+      auto& entry = counters[i];
+      tags.set(name(Tag(i)), JSON::Object::Entries {
+        {"count", entry.count.load(std::memory_order_relaxed)},
+        {"bytes", entry.bytes.load(std::memory_order_relaxed)},
+        {"allocations", entry.allocations.load(std::memory_order_relaxed)}
+      });
+    }
+
+    return JSON::Object::Entries {
+      {"enabled", true},
+      {"tags", tags}
+    };
+  }
+#else
+  JSON::Object snapshot () {
+    return JSON::Object::Entries {
+      {"enabled", false}
+    };
+  }
+#endif
+}
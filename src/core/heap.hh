@@ -0,0 +1,81 @@
+#ifndef SSC_CORE_HEAP_H
+#define SSC_CORE_HEAP_H
+
+#include "types.hh"
+
+namespace SSC::JSON {
+  // forward - `snapshot()` renders with `json.hh`, which includes this
+  // header for the `Tracked` node members
+  class Object;
+}
+
+/**
+ * Compile-time opt-in allocation accounting by subsystem. Built with
+ * `-DSSC_ENABLE_HEAP_PROFILING` (exported by `bin/cflags.sh` when
+ * `SSC_ENABLE_HEAP_PROFILING` is set in the environment) tagged
+ * allocations maintain live byte/instance totals per subsystem so
+ * steady-state RSS growth can be attributed to posts, JSON trees,
+ * message parsing, pooled buffers, or extension contexts; without the
+ * flag every tracker compiles away to nothing.
+ *
+ * Buffer-shaped tags (`posts`, `bufferPool`) record exact payload bytes
+ * through `track()`/`untrack()`. Node-shaped tags (`json`, `messages`,
+ * `results`, `extensionContexts`) count live instances with a zero-size
+ * `Tracked` member - heap owned by their string and tree fields is
+ * attributed to the tags that allocate it, so a growing live count is
+ * the leak signal, not a full deep measurement.
+ *
+ * Totals surface through `Core::Diagnostics` on the `diagnostics.query`
+ * route under the `heap` key.
+ */
+namespace SSC::Heap {
+  enum class Tag {
+    posts = 0, // `Post` bodies held in the core posts table
+    bufferPool, // storage owned by `BufferPool`, free lists included
+    json, // live `JSON::Any` nodes
+    messages, // live `IPC::Message` instances
+    results, // live `IPC::Result` instances
+    extensionContexts, // live `sapi_context_t` instances
+    COUNT
+  };
+
+#if defined(SSC_ENABLE_HEAP_PROFILING)
+  /**
+   * Records a live allocation of `bytes` bytes against `tag` - a
+   * relaxed atomic add, safe from any thread.
+   */
+  void track (Tag tag, int64_t bytes);
+
+  /**
+   * Reverses a matching `track()` when the allocation dies.
+   */
+  void untrack (Tag tag, int64_t bytes);
+
+  /**
+   * A zero-size member that counts its owner against `tag` for its
+   * whole lifetime - copies and moves each count as their own instance,
+   * so default copy/move semantics in the owner stay correct.
+   */
+  template <Tag tag> struct Tracked {
+    Tracked () { track(tag, 0); }
+    Tracked (const Tracked&) { track(tag, 0); }
+    Tracked (Tracked&&) noexcept { track(tag, 0); }
+    Tracked& operator = (const Tracked&) { return *this; }
+    Tracked& operator = (Tracked&&) noexcept { return *this; }
+    ~Tracked () { untrack(tag, 0); }
+  };
+#else
+  template <Tag tag> struct Tracked {};
+
+  inline void track (Tag, int64_t) {}
+  inline void untrack (Tag, int64_t) {}
+#endif
+
+  /**
+   * Live totals per tag as a `{"enabled": ..., "tags": {...}}` object -
+   * `{"enabled": false}` in unprofiled builds.
+   */
+  JSON::Object snapshot ();
+}
+
+#endif
@@ -6,12 +6,28 @@ namespace SSC::INI {
   }
 
   Map parse (const String& source, const String& keyPathSeparator) {
-    Vector<String> entries = split(source, '\n');
+    // a single pass over `source` with `StringView` cursors - keys and
+    // values stay views into `source` until they are stored, so parsing
+    // allocates once per stored key and once per stored value
+    const auto view = StringView(source);
+    const auto length = view.size();
+    size_t offset = 0;
     String prefix = "";
     Map settings = {};
 
-    for (auto entry : entries) {
-      entry = trim(entry);
+    while (offset < length) {
+      auto end = view.find('\n', offset);
+
+      if (end == StringView::npos) {
+        end = length;
+      }
+
+      const auto entry = trimView(view.substr(offset, end - offset));
+      offset = end + 1;
+
+      if (entry.size() == 0) {
+        continue;
+      }
 
       // handle a variety of comment styles
       if (entry[0] == ';' || entry[0] == '#') {
@@ -19,13 +35,25 @@ namespace SSC::INI {
       }
 
       if (entry.starts_with("[") && entry.ends_with("]")) {
-        if (entry.starts_with("[.") && entry.ends_with("]")) {
-          prefix += entry.substr(2, entry.length() - 3);
-        } else {
-          prefix = entry.substr(1, entry.length() - 2);
+        const auto nested = entry.starts_with("[.");
+        const auto section = nested
+          ? entry.substr(2, entry.length() - 3)
+          : entry.substr(1, entry.length() - 2);
+
+        if (!nested) {
+          prefix.clear();
+        }
+
+        prefix.reserve(prefix.size() + section.size() + keyPathSeparator.size());
+
+        for (const auto character : section) {
+          if (character == '.') {
+            prefix += keyPathSeparator;
+          } else {
+            prefix += character;
+          }
         }
 
-        prefix = replace(prefix, "\\.", keyPathSeparator);
         if (prefix.size() > 0) {
           prefix += keyPathSeparator;
         }
@@ -33,54 +61,72 @@ namespace SSC::INI {
         continue;
       }
 
-      auto index = entry.find_first_of('=');
+      const auto index = entry.find_first_of('=');
 
-      if (index >= 0 && index <= entry.size()) {
-        auto key = trim(prefix + entry.substr(0, index));
-        auto value = trim(entry.substr(index + 1));
+      if (index == StringView::npos) {
+        continue;
+      }
 
-        // trim quotes from quoted strings
-        size_t closing_quote_index = -1;
-        bool quoted_value = false;
-        if (value[0] == '"') {
-          closing_quote_index = value.find_first_of('"', 1);
-          if (closing_quote_index != std::string::npos) {
-            quoted_value = true;
-            value = trim(value.substr(1, closing_quote_index - 1));
-          }
+      auto name = trimView(entry.substr(0, index));
+      auto value = trimView(entry.substr(index + 1));
+
+      const auto isArrayEntry = name.ends_with("[]");
+
+      if (isArrayEntry) {
+        name = trimView(name.substr(0, name.size() - 2));
+      }
+
+      // trim quotes from quoted strings
+      size_t closing_quote_index = -1;
+      bool quoted_value = false;
+      if (value.size() > 0 && value[0] == '"') {
+        closing_quote_index = value.find_first_of('"', 1);
+        if (closing_quote_index != StringView::npos) {
+          quoted_value = true;
+          value = trimView(value.substr(1, closing_quote_index - 1));
         }
+      }
 
-        if (!quoted_value) {
-          // ignore comments within quoted part of value
-          auto i = value.find_first_of(';');
-          auto j = value.find_first_of('#');
+      if (!quoted_value) {
+        // ignore comments within quoted part of value
+        auto i = value.find_first_of(';');
+        auto j = value.find_first_of('#');
 
-          if (i > 0) {
-            value = trim(value.substr(0, i));
-          }
-          else if (j > 0) {
-            value = trim(value.substr(0, j));
-          }
+        if (i > 0) {
+          value = trimView(value.substr(0, i));
+        }
+        else if (j > 0) {
+          value = trimView(value.substr(0, j));
         }
+      }
 
-        if (key.ends_with("[]")) {
-          key = trim(key.substr(0, key.size() - 2));
+      String key;
+      key.reserve(prefix.size() + name.size());
+      key += prefix;
+      key.append(name);
+
+      if (isArrayEntry) {
+        String materialized;
+        materialized.reserve(value.size() + 1);
+        materialized.append(value);
+
+        // handle special configurations
+        if (key == "webview_headers") {
+          // inject '\n' as headers should be stored with
+          // new lines for each entry in the configuration
+          materialized += "\n";
+        }
 
-          // handle special configurations
-          if (key == "webview_headers") {
-            // inject '\n' as headers should be stored with
-            // new lines for each entry in the configuration
-            value += "\n";
-          }
+        const auto existing = settings.find(key);
 
-          if (settings[key].size() > 0) {
-            settings[key] += " " + value;
-          } else {
-            settings[key] = value;
-          }
+        if (existing != settings.end() && existing->second.size() > 0) {
+          existing->second += ' ';
+          existing->second += materialized;
         } else {
-          settings[key] = value;
+          settings.insert_or_assign(std::move(key), std::move(materialized));
         }
+      } else {
+        settings.insert_or_assign(std::move(key), String(value));
       }
     }
 
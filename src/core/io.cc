@@ -6,8 +6,9 @@
 
 namespace SSC::IO {
   void write (const String& input, bool isErrorOutput) {
-    static const auto GITHUB_ACTIONS_CI = Env::get("GITHUB_ACTIONS_CI");
-    static const auto isGitHubActionsCI = GITHUB_ACTIONS_CI.size() > 0;
+    // `Env::get` serves a cached snapshot reference, so this probe is
+    // cheap per call and no longer needs a local static
+    const auto isGitHubActionsCI = Env::get("GITHUB_ACTIONS_CI").size() > 0;
     auto& stream = isErrorOutput ? std::cerr : std::cout;
 
     stream << input;
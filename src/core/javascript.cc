@@ -2,27 +2,47 @@
 #include "json.hh"
 
 namespace SSC {
+  // the prologue and epilogue every generated script shares - kept as
+  // compile-time segments so the hot emitters below can assemble their
+  // output into a preallocated buffer instead of concatenating
+  static constexpr const char JAVASCRIPT_PROLOGUE[] =
+    ";(async () => {                                                       \n"
+    "  if (!globalThis.__RUNTIME_INIT_NOW__) {                             \n"
+    "    await new Promise((resolve) => {                                  \n"
+    "      globalThis.addEventListener('__runtime_init__', resolve, {      \n"
+    "        once: true                                                    \n"
+    "      });                                                             \n"
+    "    });                                                               \n"
+    "  }                                                                   \n"
+    "                                                                      \n"
+    "  console.assert(                                                     \n"
+    "    typeof globalThis.__RUNTIME_INIT_NOW__ === 'number',              \n"
+    "    '__RUNTIME_INIT_NOW__ check failed. ' +                           \n"
+    "    'The webview environment may not be initialized correctly.'       \n"
+    "  );                                                                  \n"
+    "                                                                      \n"
+    "  ";
+
+  static constexpr const char JAVASCRIPT_EPILOGUE[] =
+    ";                                                                     \n"
+    "})();                                                                 \n"
+    "//# sourceURL=";
+
   String createJavaScript (const String& name, const String& source) {
-    return String(
-      ";(async () => {                                                       \n"
-      "  if (!globalThis.__RUNTIME_INIT_NOW__) {                             \n"
-      "    await new Promise((resolve) => {                                  \n"
-      "      globalThis.addEventListener('__runtime_init__', resolve, {      \n"
-      "        once: true                                                    \n"
-      "      });                                                             \n"
-      "    });                                                               \n"
-      "  }                                                                   \n"
-      "                                                                      \n"
-      "  console.assert(                                                     \n"
-      "    typeof globalThis.__RUNTIME_INIT_NOW__ === 'number',              \n"
-      "    '__RUNTIME_INIT_NOW__ check failed. ' +                           \n"
-      "    'The webview environment may not be initialized correctly.'       \n"
-      "  );                                                                  \n"
-      "                                                                      \n"
-      "  " + trim(source) + ";                                               \n"
-      "})();                                                                 \n"
-      "//# sourceURL=" + name + "                                            \n"
+    const auto trimmed = trim(source);
+
+    String output;
+    output.reserve(
+      sizeof(JAVASCRIPT_PROLOGUE) + sizeof(JAVASCRIPT_EPILOGUE) +
+      trimmed.size() + name.size() + 1
     );
+
+    output += JAVASCRIPT_PROLOGUE;
+    output += trimmed;
+    output += JAVASCRIPT_EPILOGUE;
+    output += name;
+    output += '\n';
+    return output;
   }
 
   String getEmitToRenderProcessJavaScript (
@@ -32,19 +52,17 @@ namespace SSC {
     return getEmitToRenderProcessJavaScript(event, value, "globalThis", JSON::Object {});
   }
 
-  String getEmitToRenderProcessJavaScript (
-    const String& event,
-    const String& value,
-    const String& target,
-    const JSON::Object& options
-  ) {
-    SSC::String jsonValue = JSON::Any(SSC::replace(value, "\\\\", "\\\\")).str();
-
-    return createJavaScript("emit-to-render-process.js",
-      "const name = decodeURIComponent(`" + event + "`);                     \n"
-      "const value = " + jsonValue + ";                                      \n"
-      "const target = " + target + ";                                        \n"
-      "const options = " + options.str() + ";                                \n"
+  // `emit-to-render-process.js`, split at its four interpolated slots
+  static constexpr const char EMIT_NAME_SEGMENT[] =
+    "const name = decodeURIComponent(`";
+  static constexpr const char EMIT_VALUE_SEGMENT[] =
+    "`);\nconst value = ";
+  static constexpr const char EMIT_TARGET_SEGMENT[] =
+    ";\nconst target = ";
+  static constexpr const char EMIT_OPTIONS_SEGMENT[] =
+    ";\nconst options = ";
+  static constexpr const char EMIT_BODY_SEGMENT[] =
+      ";                                                                     \n"
       "let detail = value;                                                   \n"
       "                                                                      \n"
       "if (typeof value === 'string') {                                      \n"
@@ -96,8 +114,43 @@ namespace SSC {
       "}                                                                     \n"
       "                                                                      \n"
       "const event = new CustomEvent(name, { detail, ...options });          \n"
-      "target.dispatchEvent(event);                                          \n"
+      "target.dispatchEvent(event);";
+
+  String getEmitToRenderProcessJavaScript (
+    const String& event,
+    const String& value,
+    const String& target,
+    const JSON::Object& options
+  ) {
+    const auto jsonValue = JSON::Any(SSC::replace(value, "\\\\", "\\\\")).str();
+    const auto jsonOptions = options.str();
+
+    // assembled into a reusable per-thread buffer with the length
+    // computed up front, so the append pass never reallocates and the
+    // buffer capacity is amortized across events
+    static thread_local String buffer;
+    buffer.clear();
+    buffer.reserve(
+      sizeof(JAVASCRIPT_PROLOGUE) + sizeof(EMIT_NAME_SEGMENT) +
+      sizeof(EMIT_VALUE_SEGMENT) + sizeof(EMIT_TARGET_SEGMENT) +
+      sizeof(EMIT_OPTIONS_SEGMENT) + sizeof(EMIT_BODY_SEGMENT) +
+      sizeof(JAVASCRIPT_EPILOGUE) + event.size() + jsonValue.size() +
+      target.size() + jsonOptions.size() + 32
     );
+
+    buffer += JAVASCRIPT_PROLOGUE;
+    buffer += EMIT_NAME_SEGMENT;
+    buffer += event;
+    buffer += EMIT_VALUE_SEGMENT;
+    buffer += jsonValue;
+    buffer += EMIT_TARGET_SEGMENT;
+    buffer += target;
+    buffer += EMIT_OPTIONS_SEGMENT;
+    buffer += jsonOptions;
+    buffer += EMIT_BODY_SEGMENT;
+    buffer += JAVASCRIPT_EPILOGUE;
+    buffer += "emit-to-render-process.js\n";
+    return buffer;
   }
 
   String getResolveMenuSelectionJavaScript (
@@ -122,16 +175,17 @@ namespace SSC {
     );
   }
 
-  String getResolveToRenderProcessJavaScript (
-    const String& seq,
-    const String& state,
-    const String& value
-  ) {
-    return createJavaScript("resolve-to-render-process.js",
-      "const seq = String('" + seq + "');                                    \n"
-      "const value = '" + value + "';                                        \n"
-      "const index = globalThis.__args.index;                                \n"
-      "const state = Number('" + state + "');                                \n"
+  // `resolve-to-render-process.js`, split at its three interpolated slots
+  static constexpr const char RESOLVE_SEQ_SEGMENT[] =
+    "const seq = String('";
+  static constexpr const char RESOLVE_VALUE_SEGMENT[] =
+    "');\nconst value = '";
+  static constexpr const char RESOLVE_STATE_SEGMENT[] =
+    "';\n"
+    "const index = globalThis.__args.index;\n"
+    "const state = Number('";
+  static constexpr const char RESOLVE_BODY_SEGMENT[] =
+      "');                                                                   \n"
       "const eventName = `resolve-${index}-${seq}`;                          \n"
       "let detail = value;                                                   \n"
       "                                                                      \n"
@@ -162,7 +216,33 @@ namespace SSC {
       "                                                                      \n"
       "                                                                      \n"
       "const event = new CustomEvent(eventName, { detail });                 \n"
-      "globalThis.dispatchEvent(event);                                      \n"
+      "globalThis.dispatchEvent(event);";
+
+  String getResolveToRenderProcessJavaScript (
+    const String& seq,
+    const String& state,
+    const String& value
+  ) {
+    // same reusable-buffer assembly as the emit path above
+    static thread_local String buffer;
+    buffer.clear();
+    buffer.reserve(
+      sizeof(JAVASCRIPT_PROLOGUE) + sizeof(RESOLVE_SEQ_SEGMENT) +
+      sizeof(RESOLVE_VALUE_SEGMENT) + sizeof(RESOLVE_STATE_SEGMENT) +
+      sizeof(RESOLVE_BODY_SEGMENT) + sizeof(JAVASCRIPT_EPILOGUE) +
+      seq.size() + state.size() + value.size() + 32
     );
+
+    buffer += JAVASCRIPT_PROLOGUE;
+    buffer += RESOLVE_SEQ_SEGMENT;
+    buffer += seq;
+    buffer += RESOLVE_VALUE_SEGMENT;
+    buffer += value;
+    buffer += RESOLVE_STATE_SEGMENT;
+    buffer += state;
+    buffer += RESOLVE_BODY_SEGMENT;
+    buffer += JAVASCRIPT_EPILOGUE;
+    buffer += "resolve-to-render-process.js\n";
+    return buffer;
   }
 }
@@ -1,75 +1,150 @@
-#include <regex>
-
 #include "json.hh"
 #include "string.hh"
 
-namespace SSC::JSON {
-  Null null;
-  Any anyNull = nullptr;
+#if defined(__SSE2__) || (defined(_M_X64) && !defined(_M_ARM64EC))
+#define SSC_JSON_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define SSC_JSON_NEON 1
+#include <arm_neon.h>
+#endif
 
-  Number::Number (const String& string) {
-    this->data = std::stod(string.str());
+//
+// Returns `true` when the 16 byte block at `input` contains a character
+// that needs escaping in a JSON string value ('"' or '\n').
+//
+#if defined(SSC_JSON_SSE2)
+static inline bool hasEscapableBlock (const char* input) {
+  const auto block = _mm_loadu_si128((const __m128i *) input);
+  const auto mask = _mm_or_si128(
+    _mm_cmpeq_epi8(block, _mm_set1_epi8('"')),
+    _mm_cmpeq_epi8(block, _mm_set1_epi8('\n'))
+  );
+
+  return _mm_movemask_epi8(mask) != 0;
+}
+#elif defined(SSC_JSON_NEON)
+static inline bool hasEscapableBlock (const char* input) {
+  const auto block = vld1q_u8((const unsigned char *) input);
+  const auto mask = vorrq_u8(
+    vceqq_u8(block, vdupq_n_u8('"')),
+    vceqq_u8(block, vdupq_n_u8('\n'))
+  );
+
+  return vmaxvq_u8(mask) != 0;
+}
+#else
+static inline bool hasEscapableBlock (const char* input) {
+  for (size_t i = 0; i < 16; ++i) {
+    if (input[i] == '"' || input[i] == '\n') {
+      return true;
+    }
   }
 
-  std::string Number::str () const {
-    if (this->data == 0) {
-      return "0";
-    }
+  return false;
+}
+#endif
 
-    auto value = this->data;
-    auto output = std::to_string(value);
-    auto decimal = output.find(".");
+// appends `source` to `out` as a quoted JSON string, escaping '"' and
+// '\n' - clean 16 byte blocks are bulk-appended
+static void writeEscapedString (SSC::String& out, const SSC::String& source) {
+  out += '"';
 
-    // trim trailing zeros
-    if (decimal >= 0) {
-      auto i = output.size() - 1;
-      while (output[i] == '0' && i >= decimal) {
-        i--;
+  size_t offset = 0;
+  const auto length = source.size();
+
+  while (offset + 16 <= length) {
+    if (!hasEscapableBlock(source.data() + offset)) {
+      out.append(source, offset, 16);
+      offset += 16;
+      continue;
+    }
+
+    const auto blockEnd = offset + 16;
+    while (offset < blockEnd) {
+      const auto character = source[offset++];
+      if (character == '"') {
+        out += "\\\"";
+      } else if (character == '\n') {
+        out += "\\n";
+      } else {
+        out += character;
       }
+    }
+  }
 
-      return output.substr(0, i);
+  while (offset < length) {
+    const auto character = source[offset++];
+    if (character == '"') {
+      out += "\\\"";
+    } else if (character == '\n') {
+      out += "\\n";
+    } else {
+      out += character;
     }
+  }
+
+  out += '"';
+}
+
+namespace SSC::JSON {
+  Null null;
+  Any anyNull = nullptr;
+
+  Number::Number (const String& string) {
+    this->data = std::stod(string.str());
+  }
 
-    return output;
+  std::string Number::str () const {
+    SSC::String out;
+    this->write(out);
+    return out;
   }
 
   std::string Object::str () const {
-    std::stringstream stream;
+    SSC::String out;
+    out.reserve(256);
+    this->write(out);
+    return out;
+  }
+
+  void Object::write (SSC::String& out) const {
     auto count = this->data.size();
-    stream << std::string("{");
-    for (const auto& tuple : this->data) {
-      auto key = replace(tuple.first, "\"","\\\"");
-      auto value = tuple.second.str();
+    out += '{';
 
-      stream << std::string("\"");
-      stream << key;
-      stream << std::string("\":");
-      stream << value;
+    for (const auto& tuple : this->data) {
+      writeEscapedString(out, tuple.first);
+      out += ':';
+      tuple.second.write(out);
 
       if (--count > 0) {
-        stream << std::string(",");
+        out += ',';
       }
     }
 
-    stream << std::string("}");
-    return stream.str();
+    out += '}';
   }
 
   std::string Array::str () const {
-    std::stringstream stream;
+    SSC::String out;
+    out.reserve(256);
+    this->write(out);
+    return out;
+  }
+
+  void Array::write (SSC::String& out) const {
     auto count = this->data.size();
-    stream << std::string("[");
+    out += '[';
 
     for (const auto& value : this->data) {
-      stream << value.str();
+      value.write(out);
 
       if (--count > 0) {
-        stream << std::string(",");
+        out += ',';
       }
     }
 
-    stream << std::string("]");
-    return stream.str();
+    out += ']';
   }
 
   String::String (const Number& number) {
@@ -77,136 +152,171 @@ namespace SSC::JSON {
   }
 
   SSC::String String::str () const {
-    auto escaped = replace(this->data, "\"", "\\\"");
-    return "\"" + replace(escaped, "\n", "\\n") + "\"";
+    SSC::String out;
+    out.reserve(this->data.size() + 2);
+    this->write(out);
+    return out;
+  }
+
+  void String::write (SSC::String& out) const {
+    writeEscapedString(out, this->data);
+  }
+
+  void Number::write (SSC::String& out) const {
+    SSC::writeNumber(out, this->data);
   }
 
   Any::Any (const Null null) {
-    this->pointer = std::shared_ptr<void>(new Null());
+    this->pointer = std::make_shared<Null>();
     this->type = Type::Null;
   }
 
   Any::Any (std::nullptr_t) {
-    this->pointer = std::shared_ptr<void>(new Null());
+    this->pointer = std::make_shared<Null>();
     this->type = Type::Null;
   }
 
   Any::Any (const char *string) {
-    this->pointer = std::shared_ptr<void>(new String(string));
+    this->pointer = std::make_shared<String>(string);
     this->type = Type::String;
   }
 
   Any::Any (const char string) {
-    this->pointer = std::shared_ptr<void>(new String(string));
+    this->pointer = std::make_shared<String>(string);
     this->type = Type::String;
   }
 
-  Any::Any (const std::string string) {
-    this->pointer = std::shared_ptr<void>(new String(string));
+  Any::Any (const std::string& string) {
+    this->pointer = std::make_shared<String>(string);
     this->type = Type::String;
   }
 
-  Any::Any (const String string) {
-    this->pointer = std::shared_ptr<void>(new String(string));
+  Any::Any (const String& string) {
+    this->pointer = std::make_shared<String>(string);
     this->type = Type::String;
   }
 
   Any::Any (bool boolean) {
-    this->pointer = std::shared_ptr<void>(new Boolean(boolean));
+    this->pointer = std::make_shared<Boolean>(boolean);
     this->type = Type::Boolean;
   }
 
   Any::Any (const Boolean boolean) {
-    this->pointer = std::shared_ptr<void>(new Boolean(boolean));
+    this->pointer = std::make_shared<Boolean>(boolean);
     this->type = Type::Boolean;
   }
 
   Any::Any (int32_t number) {
-    this->pointer = std::shared_ptr<void>(new Number((double) number));
+    this->pointer = std::make_shared<Number>((double) number);
     this->type = Type::Number;
   }
 
   Any::Any (uint32_t number) {
-    this->pointer = std::shared_ptr<void>(new Number((double) number));
+    this->pointer = std::make_shared<Number>((double) number);
     this->type = Type::Number;
   }
 
   Any::Any (int64_t number) {
-    this->pointer = std::shared_ptr<void>(new Number((double) number));
+    this->pointer = std::make_shared<Number>((double) number);
     this->type = Type::Number;
   }
 
   Any::Any (uint64_t number) {
-    this->pointer = std::shared_ptr<void>(new Number((double) number));
+    this->pointer = std::make_shared<Number>((double) number);
     this->type = Type::Number;
   }
 
   Any::Any (double number) {
-    this->pointer = std::shared_ptr<void>(new Number((double) number));
+    this->pointer = std::make_shared<Number>((double) number);
     this->type = Type::Number;
   }
 
 #if defined(__APPLE__) && !TARGET_OS_IPHONE && !TARGET_IPHONE_SIMULATOR
   Any::Any (size_t number) {
-    this->pointer = std::shared_ptr<void>(new Number((double) number));
+    this->pointer = std::make_shared<Number>((double) number);
     this->type = Type::Number;
   }
 #endif
 
 #if defined(__APPLE__)
   Any::Any (ssize_t number) {
-    this->pointer = std::shared_ptr<void>(new Number((double) number));
+    this->pointer = std::make_shared<Number>((double) number);
     this->type = Type::Number;
   }
 #endif
 
   Any::Any (const Number number) {
-    this->pointer = std::shared_ptr<void>(new Number(number));
+    this->pointer = std::make_shared<Number>(number);
     this->type = Type::Number;
   }
 
-  Any::Any (const Object object) {
-    this->pointer = std::shared_ptr<void>(new Object(object));
+  Any::Any (const Object& object) {
+    this->pointer = std::make_shared<Object>(object);
+    this->type = Type::Object;
+  }
+
+  Any::Any (Object&& object) {
+    this->pointer = std::make_shared<Object>(std::move(object));
     this->type = Type::Object;
   }
 
-  Any::Any (const Object::Entries entries) {
-    this->pointer = std::shared_ptr<void>(new Object(entries));
+  Any::Any (const Object::Entries& entries) {
+    this->pointer = std::make_shared<Object>(entries);
     this->type = Type::Object;
   }
 
-  Any::Any (const Array array) {
-    this->pointer = std::shared_ptr<void>(new Array(array));
+  Any::Any (Object::Entries&& entries) {
+    this->pointer = std::make_shared<Object>(std::move(entries));
+    this->type = Type::Object;
+  }
+
+  Any::Any (const Array& array) {
+    this->pointer = std::make_shared<Array>(array);
+    this->type = Type::Array;
+  }
+
+  Any::Any (Array&& array) {
+    this->pointer = std::make_shared<Array>(std::move(array));
+    this->type = Type::Array;
+  }
+
+  Any::Any (const Array::Entries& entries) {
+    this->pointer = std::make_shared<Array>(entries);
     this->type = Type::Array;
   }
 
-  Any::Any (const Array::Entries entries) {
-    this->pointer = std::shared_ptr<void>(new Array(entries));
+  Any::Any (Array::Entries&& entries) {
+    this->pointer = std::make_shared<Array>(std::move(entries));
     this->type = Type::Array;
   }
 
-  Any::Any (const Raw source) {
-    this->pointer = std::shared_ptr<void>(new Raw(source));
+  Any::Any (const Raw& source) {
+    this->pointer = std::make_shared<Raw>(source);
     this->type = Type::Raw;
   }
 
   std::string Any::str () const {
+    SSC::String out;
+    out.reserve(256);
+    this->write(out);
+    return out;
+  }
+
+  void Any::write (SSC::String& out) const {
     const auto ptr = this->pointer.get() == nullptr
       ? reinterpret_cast<const void*>(this)
       : this->pointer.get();
 
     switch (this->type) {
-      case Type::Empty: return "";
-      case Type::Any: return "";
-      case Type::Raw: return reinterpret_cast<const Raw*>(ptr)->str();
-      case Type::Null: return "null";
-      case Type::Object: return reinterpret_cast<const Object*>(ptr)->str();
-      case Type::Array: return reinterpret_cast<const Array*>(ptr)->str();
-      case Type::Boolean: return reinterpret_cast<const Boolean*>(ptr)->str();
-      case Type::Number: return reinterpret_cast<const Number*>(ptr)->str();
-      case Type::String: return reinterpret_cast<const String*>(ptr)->str();
+      case Type::Empty: return;
+      case Type::Any: return;
+      case Type::Raw: return reinterpret_cast<const Raw*>(ptr)->write(out);
+      case Type::Null: out += "null"; return;
+      case Type::Object: return reinterpret_cast<const Object*>(ptr)->write(out);
+      case Type::Array: return reinterpret_cast<const Array*>(ptr)->write(out);
+      case Type::Boolean: return reinterpret_cast<const Boolean*>(ptr)->write(out);
+      case Type::Number: return reinterpret_cast<const Number*>(ptr)->write(out);
+      case Type::String: return reinterpret_cast<const String*>(ptr)->write(out);
     }
-
-    return "";
   }
 }
@@ -1,6 +1,7 @@
 #ifndef SSC_SOCKET_JSON_HH
 #define SSC_SOCKET_JSON_HH
 
+#include "heap.hh"
 #include "types.hh"
 
 namespace SSC::JSON {
@@ -14,7 +15,11 @@ namespace SSC::JSON {
   class Number;
   class String;
 
-  using ObjectEntries = std::map<SSC::String, Any>;
+  // a flat, insertion-ordered list of key/value pairs - typical result
+  // objects hold 3-8 keys, where a linear probe over contiguous storage
+  // beats a node-based map and construction from an initializer list is
+  // a single allocation
+  using ObjectEntries = std::vector<std::pair<SSC::String, Any>>;
   using ArrayEntries = std::vector<Any>;
 
   class Error : public std::invalid_argument {
@@ -90,6 +95,10 @@ namespace SSC::JSON {
       SSC::String str () const {
         return "null";
       }
+
+      void write (SSC::String& out) const {
+        out += "null";
+      }
   };
 
   extern Null null;
@@ -97,6 +106,9 @@ namespace SSC::JSON {
   class Any : public Value<void *, Type::Any> {
     public:
       std::shared_ptr<void> pointer = nullptr;
+      // zero-size in unprofiled builds - counts live nodes for the
+      // `diagnostics.query` heap totals
+      [[no_unique_address]] Heap::Tracked<Heap::Tag::json> tracked;
 
       Any () {
         this->pointer = nullptr;
@@ -113,6 +125,27 @@ namespace SSC::JSON {
         this->type = any.type;
       }
 
+      Any (Any&& any) noexcept {
+        this->pointer = std::move(any.pointer);
+        this->type = any.type;
+        any.pointer = nullptr;
+        any.type = Type::Any;
+      }
+
+      Any& operator = (const Any& any) {
+        this->pointer = any.pointer;
+        this->type = any.type;
+        return *this;
+      }
+
+      Any& operator = (Any&& any) noexcept {
+        this->pointer = std::move(any.pointer);
+        this->type = any.type;
+        any.pointer = nullptr;
+        any.type = Type::Any;
+        return *this;
+      }
+
       Any (Type type, std::shared_ptr<void> pointer) {
         this->type = type;
         this->pointer = pointer;
@@ -136,15 +169,20 @@ namespace SSC::JSON {
       Any (const Number);
       Any (const char);
       Any (const char *);
-      Any (const SSC::String);
-      Any (const String);
-      Any (const Object);
-      Any (const ObjectEntries);
-      Any (const Array);
-      Any (const ArrayEntries);
-      Any (const Raw source);
+      Any (const SSC::String&);
+      Any (const String&);
+      Any (const Object&);
+      Any (Object&&);
+      Any (const ObjectEntries&);
+      Any (ObjectEntries&&);
+      Any (const Array&);
+      Any (Array&&);
+      Any (const ArrayEntries&);
+      Any (ArrayEntries&&);
+      Any (const Raw& source);
 
       SSC::String str () const;
+      void write (SSC::String& out) const;
 
       template <typename T> T& as () const {
         auto ptr = this->pointer.get();
@@ -166,6 +204,10 @@ namespace SSC::JSON {
       const SSC::String str () const {
         return this->data;
       }
+
+      void write (SSC::String& out) const {
+        out += this->data;
+      }
   };
 
   extern Any anyNull;
@@ -179,89 +221,129 @@ namespace SSC::JSON {
       using Entries = ObjectEntries;
       Object () = default;
       Object (std::map<SSC::String, int> entries) {
+        this->data.reserve(entries.size());
         for (auto const &tuple : entries) {
-          auto key = tuple.first;
-          auto value = tuple.second;
-          this->data.insert_or_assign(key, value);
+          this->set(tuple.first, tuple.second);
         }
       }
 
       Object (std::map<SSC::String, bool> entries) {
+        this->data.reserve(entries.size());
         for (auto const &tuple : entries) {
-          auto key = tuple.first;
-          auto value = tuple.second;
-          this->data.insert_or_assign(key, value);
+          this->set(tuple.first, tuple.second);
         }
       }
 
       Object (std::map<SSC::String, double> entries) {
+        this->data.reserve(entries.size());
         for (auto const &tuple : entries) {
-          auto key = tuple.first;
-          auto value = tuple.second;
-          this->data.insert_or_assign(key, value);
+          this->set(tuple.first, tuple.second);
         }
       }
 
       Object (std::map<SSC::String, int64_t> entries) {
+        this->data.reserve(entries.size());
         for (auto const &tuple : entries) {
-          auto key = tuple.first;
-          auto value = tuple.second;
-          this->data.insert_or_assign(key, value);
+          this->set(tuple.first, tuple.second);
         }
       }
 
-      Object (const Object::Entries entries) {
+      Object (const Object::Entries& entries) {
+        this->data.reserve(entries.size());
         for (const auto& tuple : entries) {
-          auto key = tuple.first;
-          auto value = tuple.second;
-          this->data.insert_or_assign(key, value);
+          this->set(tuple.first, tuple.second);
+        }
+      }
+
+      Object (Object::Entries&& entries) {
+        this->data.reserve(entries.size());
+        for (auto& tuple : entries) {
+          this->set(std::move(tuple.first), std::move(tuple.second));
         }
       }
 
       Object (const Object& object) {
-        this->data = object.value();
+        this->data = object.data;
+      }
+
+      Object (Object&& object) noexcept {
+        this->data = std::move(object.data);
+      }
+
+      Object& operator = (const Object& object) {
+        this->data = object.data;
+        return *this;
+      }
+
+      Object& operator = (Object&& object) noexcept {
+        this->data = std::move(object.data);
+        return *this;
       }
 
       Object (const std::map<SSC::String, SSC::String> map) {
+        this->data.reserve(map.size());
         for (const auto& tuple : map) {
-          auto key = tuple.first;
-          auto value = Any(tuple.second);
-          this->data.insert_or_assign(key, value);
+          this->set(tuple.first, Any(tuple.second));
         }
       }
 
       SSC::String str () const;
+      void write (SSC::String& out) const;
 
       const Object::Entries value () const {
         return this->data;
       }
 
       Any& get (const SSC::String key) {
-        if (this->data.find(key) != this->data.end()) {
-          return this->data.at(key);
+        for (auto& tuple : this->data) {
+          if (tuple.first == key) {
+            return tuple.second;
+          }
         }
 
         return anyNull;
       }
 
-      void set (const SSC::String key, Any value) {
-        this->data[key] = value;
+      void set (SSC::String key, Any value) {
+        for (auto& tuple : this->data) {
+          if (tuple.first == key) {
+            tuple.second = std::move(value);
+            return;
+          }
+        }
+
+        this->data.push_back(std::make_pair(std::move(key), std::move(value)));
       }
 
       bool has (const SSC::String& key) const {
-        return this->data.find(key) != this->data.end();
+        for (const auto& tuple : this->data) {
+          if (tuple.first == key) {
+            return true;
+          }
+        }
+
+        return false;
       }
 
       Any operator [] (const SSC::String& key) const {
-        if (this->data.find(key) != this->data.end()) {
-          return this->data.at(key);
+        for (const auto& tuple : this->data) {
+          if (tuple.first == key) {
+            return tuple.second;
+          }
         }
 
         return nullptr;
       }
 
       Any &operator [] (const SSC::String& key) {
-        return this->data[key];
+        for (auto& tuple : this->data) {
+          if (tuple.first == key) {
+            return tuple.second;
+          }
+        }
+
+        this->data.push_back(std::make_pair(key, Any()));
+        return this->data.back().second;
       }
 
       auto size () const {
@@ -274,16 +356,33 @@ namespace SSC::JSON {
       using Entries = ArrayEntries;
       Array () = default;
       Array (const Array& array) {
-        this->data = array.value();
+        this->data = array.data;
       }
 
-      Array (const Array::Entries entries) {
-        for (const auto& value : entries) {
-          this->data.push_back(value);
-        }
+      Array (Array&& array) noexcept {
+        this->data = std::move(array.data);
+      }
+
+      Array& operator = (const Array& array) {
+        this->data = array.data;
+        return *this;
+      }
+
+      Array& operator = (Array&& array) noexcept {
+        this->data = std::move(array.data);
+        return *this;
+      }
+
+      Array (const Array::Entries& entries) {
+        this->data = entries;
+      }
+
+      Array (Array::Entries&& entries) {
+        this->data = std::move(entries);
       }
 
       SSC::String str () const;
+      void write (SSC::String& out) const;
 
       Array::Entries value () const {
         return this->data;
@@ -382,6 +481,10 @@ namespace SSC::JSON {
       SSC::String str () const {
         return this->data ? "true" : "false";
       }
+
+      void write (SSC::String& out) const {
+        out += this->data ? "true" : "false";
+      }
   };
 
   class Number : public Value<double, Type::Number> {
@@ -418,6 +521,7 @@ namespace SSC::JSON {
       }
 
       SSC::String str () const;
+      void write (SSC::String& out) const;
   };
 
   class String : public Value<SSC::String, Type::String> {
@@ -450,6 +554,7 @@ namespace SSC::JSON {
       }
 
       SSC::String str () const;
+      void write (SSC::String& out) const;
 
       SSC::String value () const {
         return this->data;
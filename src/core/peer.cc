@@ -1,31 +1,98 @@
 #include "core.hh"
 
+#if defined(__linux__)
+#include <netinet/udp.h>
+#endif
+
 namespace SSC {
   void Core::resumeAllPeers () {
-    dispatchEventLoop([=, this]() {
-      for (auto const &tuple : this->peers) {
-        auto peer = tuple.second;
-        if (peer != nullptr && (peer->isBound() || peer->isConnected())) {
-          peer->resume();
-        }
+    this->transitionAllPeers(true);
+  }
+
+  void Core::pauseAllPeers () {
+    this->transitionAllPeers(false);
+  }
+
+  /**
+   * Stages a background/foreground transition across all peers. The
+   * lifecycle callback only snapshots candidate ids — active peers
+   * ordered first so sockets with live traffic transition soonest —
+   * and the actual pause/resume work is processed in bounded batches,
+   * each deferred batch landing on a later loop tick. Keepalive peers
+   * (`PEER_FLAG_KEEP_ALIVE`) skip the cycle entirely.
+   */
+  void Core::transitionAllPeers (bool resume) {
+    auto ids = std::make_shared<Vector<uint64_t>>();
+    auto deferred = Vector<uint64_t>();
+
+    this->peers.each([&](uint64_t id, Peer*& peer) {
+      if (peer == nullptr || peer->isKeepAlive()) {
+        return;
+      }
+
+      if (!peer->isBound() && !peer->isConnected()) {
+        return;
+      }
+
+      if (peer->isActive()) {
+        ids->push_back(id);
+      } else {
+        deferred.push_back(id);
       }
     });
+
+    ids->insert(ids->end(), deferred.begin(), deferred.end());
+
+    if (ids->size() > 0) {
+      this->processPeerTransitionBatch(ids, 0, resume);
+    }
   }
 
-  void Core::pauseAllPeers () {
-    dispatchEventLoop([=, this]() {
-      for (auto const &tuple : this->peers) {
-        auto peer = tuple.second;
-        if (peer != nullptr && (peer->isBound() || peer->isConnected())) {
+  void Core::processPeerTransitionBatch (
+    std::shared_ptr<Vector<uint64_t>> ids,
+    size_t offset,
+    bool resume
+  ) {
+    const auto end = std::min(
+      offset + PEER_LIFECYCLE_BATCH_SIZE,
+      ids->size()
+    );
+
+    for (auto i = offset; i < end; ++i) {
+      const auto id = ids->at(i);
+      auto peer = this->getPeer(id);
+
+      // the peer may have closed since the snapshot was taken
+      if (peer == nullptr) {
+        continue;
+      }
+
+      auto dispatch = [peer, resume]() {
+        if (resume) {
+          peer->resume();
+        } else {
           peer->pause();
         }
+      };
+
+      // each peer transitions on its owning loop since UDP handles may
+      // be pinned to different loops
+      if (peer->isUDP()) {
+        this->dispatchEventLoop(id, dispatch);
+      } else {
+        this->dispatchEventLoop(dispatch);
       }
-    });
+    }
+
+    if (end < ids->size()) {
+      this->setTimeout(PEER_LIFECYCLE_BATCH_INTERVAL, [this, ids, end, resume]() {
+        this->processPeerTransitionBatch(ids, end, resume);
+      });
+    }
   }
 
   bool Core::hasPeer (uint64_t peerId) {
-    Lock lock(this->peersMutex);
-    return this->peers.find(peerId) != this->peers.end();
+    return this->peers.has(peerId);
   }
 
   void Core::removePeer (uint64_t peerId) {
@@ -33,23 +100,18 @@ namespace SSC {
   }
 
   void Core::removePeer (uint64_t peerId, bool autoClose) {
-    if (this->hasPeer(peerId)) {
-      if (autoClose) {
-        auto peer = this->getPeer(peerId);
-        if (peer != nullptr) {
-          peer->close();
-        }
+    if (autoClose) {
+      auto peer = this->getPeer(peerId);
+      if (peer != nullptr) {
+        peer->close();
       }
-
-      Lock lock(this->peersMutex);
-      this->peers.erase(peerId);
     }
+
+    this->peers.erase(peerId);
   }
 
   Peer* Core::getPeer (uint64_t peerId) {
-    if (!this->hasPeer(peerId)) return nullptr;
-    Lock lock(this->peersMutex);
-    return this->peers.at(peerId);
+    return this->peers.get(peerId);
   }
 
   Peer* Core::createPeer (peer_type_t peerType, uint64_t peerId) {
@@ -74,8 +136,7 @@ namespace SSC {
     }
 
     auto peer = new Peer(this, peerType, peerId, isEphemeral);
-    Lock lock(this->peersMutex);
-    this->peers[peer->id] = peer;
+    this->peers.set(peer->id, peer);
     return peer;
   }
 
@@ -190,11 +251,27 @@ namespace SSC {
 
   Peer::~Peer () {
     this->core->removePeer(this->id, true); // auto close
+
+    for (const auto request : this->sendRequestPool) {
+      delete request;
+    }
+
+    for (const auto request : this->writeRequestPool) {
+      delete request;
+    }
+
+    this->sendRequestPool.clear();
+    this->writeRequestPool.clear();
   }
 
   int Peer::init () {
     Lock lock(this->mutex);
-    auto loop = this->core->getEventLoop();
+    // UDP peers are pinned to an event loop by id so receive processing
+    // scales across the configured loops; TCP peers and everything else
+    // stay on the primary loop
+    auto loop = this->type == PEER_TYPE_UDP
+      ? this->core->getEventLoop(this->id)
+      : this->core->getEventLoop();
     int err = 0;
 
     memset(&this->handle, 0, sizeof(this->handle));
@@ -274,6 +351,21 @@ namespace SSC {
     return (PEER_FLAG_EPHEMERAL & this->flags) == PEER_FLAG_EPHEMERAL;
   }
 
+  bool Peer::isKeepAlive () {
+    Lock lock(this->mutex);
+    return (PEER_FLAG_KEEP_ALIVE & this->flags) == PEER_FLAG_KEEP_ALIVE;
+  }
+
+  void Peer::setKeepAlive (bool enabled) {
+    Lock lock(this->mutex);
+
+    if (enabled) {
+      this->flags = (peer_flag_t) (this->flags | PEER_FLAG_KEEP_ALIVE);
+    } else {
+      this->flags = (peer_flag_t) (this->flags & ~PEER_FLAG_KEEP_ALIVE);
+    }
+  }
+
   bool Peer::isBound () {
     return (
       (this->isUDP() && this->hasState(PEER_STATE_UDP_BOUND)) ||
@@ -419,57 +511,721 @@ namespace SSC {
     return err;
   }
 
+  int Peer::setMembership (
+    const String group,
+    const String iface,
+    const String source,
+    uv_membership membership
+  ) {
+    Lock lock(this->mutex);
+
+    if (!this->isUDP()) {
+      return UV_EINVAL;
+    }
+
+    const auto interfaceAddress = iface.size() > 0 ? iface.c_str() : nullptr;
+
+    if (source.size() > 0) {
+      return uv_udp_set_source_membership(
+        (uv_udp_t *) &this->handle,
+        group.c_str(),
+        interfaceAddress,
+        source.c_str(),
+        membership
+      );
+    }
+
+    return uv_udp_set_membership(
+      (uv_udp_t *) &this->handle,
+      group.c_str(),
+      interfaceAddress,
+      membership
+    );
+  }
+
+  int Peer::setMulticastInterface (const String iface) {
+    Lock lock(this->mutex);
+
+    if (!this->isUDP()) {
+      return UV_EINVAL;
+    }
+
+    return uv_udp_set_multicast_interface(
+      (uv_udp_t *) &this->handle,
+      iface.c_str()
+    );
+  }
+
+  int Peer::setMulticastTTL (int ttl) {
+    Lock lock(this->mutex);
+
+    if (!this->isUDP()) {
+      return UV_EINVAL;
+    }
+
+    return uv_udp_set_multicast_ttl((uv_udp_t *) &this->handle, ttl);
+  }
+
+  int Peer::setMulticastLoopback (bool enabled) {
+    Lock lock(this->mutex);
+
+    if (!this->isUDP()) {
+      return UV_EINVAL;
+    }
+
+    return uv_udp_set_multicast_loop((uv_udp_t *) &this->handle, enabled ? 1 : 0);
+  }
+
+  void Peer::send (
+    char *buf,
+    size_t size,
+    int port,
+    const String address,
+    Peer::RequestContext::Callback cb
+  ) {
+    Lock lock(this->mutex);
+    int err = 0;
+
+    struct sockaddr *sockaddr = nullptr;
+
+    // connected sockets carry their destination in the kernel - only
+    // unconnected sends need a sockaddr, and thousands of sends to the
+    // same destination in a row parse the address string exactly once
+    if (!this->isConnected()) {
+      if (port != this->sendAddrPort || address != this->sendAddrAddress) {
+        err = uv_ip4_addr((char *) address.c_str(), port, &this->sendAddr);
+
+        if (err) {
+          return cb(err, Post{});
+        }
+
+        this->sendAddrAddress = address;
+        this->sendAddrPort = port;
+      }
+
+      sockaddr = (struct sockaddr *) &this->sendAddr;
+    }
+
+    // clear a lingering segmentation offload setting so this buffer
+    // goes out as a single datagram
+    if (this->gsoSegmentSize != 0) {
+      this->setSegmentSize(0);
+    }
+
+    auto callback = Peer::RequestContext::Callback([=, this](auto status, auto post) {
+      cb(status, post);
+
+      if (this->isEphemeral()) {
+        this->close();
+      }
+    });
+
+    // route through the bounded outbound queue when one is configured
+    if (this->outboundDepth > 0) {
+      return this->enqueueOutbound(buf, size, sockaddr != nullptr, callback);
+    }
+
+    this->write(buf, size, sockaddr, callback);
+  }
+
   void Peer::send (
     char *buf,
     size_t size,
     int port,
     const String address,
+    size_t segmentSize,
     Peer::RequestContext::Callback cb
   ) {
+    if (segmentSize == 0 || segmentSize >= size) {
+      return this->send(buf, size, port, address, cb);
+    }
+
     Lock lock(this->mutex);
     int err = 0;
 
     struct sockaddr *sockaddr = nullptr;
 
     if (!this->isConnected()) {
-      sockaddr = (struct sockaddr *) &this->addr;
-      err = uv_ip4_addr((char *) address.c_str(), port, &this->addr);
+      if (port != this->sendAddrPort || address != this->sendAddrAddress) {
+        err = uv_ip4_addr((char *) address.c_str(), port, &this->sendAddr);
+
+        if (err) {
+          return cb(err, Post{});
+        }
+
+        this->sendAddrAddress = address;
+        this->sendAddrPort = port;
+      }
+
+      sockaddr = (struct sockaddr *) &this->sendAddr;
+    }
+
+    // when the kernel supports segmentation offload the whole
+    // super-buffer goes out in one send and is split into
+    // `segmentSize` sized datagrams on the way down
+    if (
+      this->gsoSegmentSize == segmentSize ||
+      this->setSegmentSize(segmentSize) == 0
+    ) {
+      return this->write(buf, size, sockaddr, [=, this](auto status, auto post) {
+        cb(status, post);
+
+        if (this->isEphemeral()) {
+          this->close();
+        }
+      });
+    }
+
+    // userspace fallback - one datagram per segment, completing with
+    // the first error or with success after the last segment
+    auto remaining = std::make_shared<size_t>((size + segmentSize - 1) / segmentSize);
+    auto failed = std::make_shared<bool>(false);
+
+    for (size_t offset = 0; offset < size; offset += segmentSize) {
+      const auto length = std::min(segmentSize, size - offset);
+
+      this->write(buf + offset, length, sockaddr, [=, this](auto status, auto post) {
+        if (*failed) {
+          return;
+        }
+
+        if (status < 0) {
+          *failed = true;
+        } else if (--(*remaining) > 0) {
+          return;
+        }
+
+        cb(status < 0 ? status : 0, Post{});
+
+        if (this->isEphemeral()) {
+          this->close();
+        }
+      });
 
-      if (err) {
-        return cb(err, Post{});
+      if (*failed) {
+        return;
       }
     }
+  }
 
+  void Peer::write (
+    char *buf,
+    size_t size,
+    struct sockaddr *sockaddr,
+    Peer::RequestContext::Callback cb
+  ) {
     auto buffer = uv_buf_init(buf, (int) size);
-    auto ctx = new Peer::RequestContext(cb);
-    auto req = new uv_udp_send_t;
 
-    req->data = (void *) ctx;
-    ctx->peer = this;
+    // most datagrams can be written to the socket immediately - try that
+    // first and only fall back to an async send request when the socket
+    // would block
+    int err = uv_udp_try_send((uv_udp_t *) &this->handle, &buffer, 1, sockaddr);
 
-    err = uv_udp_send(req, (uv_udp_t *) &this->handle, &buffer, 1, sockaddr, [](uv_udp_send_t *req, int status) {
-      auto ctx = reinterpret_cast<Peer::RequestContext*>(req->data);
-      auto peer = ctx->peer;
+    if (err != UV_EAGAIN && err != UV_ENOSYS) {
+      return cb(err < 0 ? err : 0, Post{});
+    }
 
-      ctx->cb(status, Post{});
+    auto request = this->acquireSendRequest(cb);
 
-      if (peer->isEphemeral()) {
-        peer->close();
+    err = uv_udp_send(&request->req, (uv_udp_t *) &this->handle, &buffer, 1, sockaddr, [](uv_udp_send_t *req, int status) {
+      auto request = reinterpret_cast<Peer::SendRequest*>(req->data);
+      auto peer = request->peer;
+      auto cb = request->cb;
+
+      peer->releaseSendRequest(request);
+      cb(status, Post{});
+    });
+
+    if (err < 0) {
+      this->releaseSendRequest(request);
+      cb(err, Post{});
+    }
+  }
+
+  // configures kernel generic segmentation offload on the underlying
+  // socket - a send larger than `segmentSize` is split into datagrams
+  // of that size by the kernel. `0` disables splitting
+  int Peer::setSegmentSize (size_t segmentSize) {
+  #if defined(__linux__) && defined(UDP_SEGMENT)
+    uv_os_fd_t fd;
+    int err = uv_fileno((uv_handle_t *) &this->handle, &fd);
+
+    if (err != 0) {
+      return err;
+    }
+
+    const int segment = (int) segmentSize;
+    if (setsockopt(fd, SOL_UDP, UDP_SEGMENT, &segment, sizeof(segment)) != 0) {
+      return uv_translate_sys_error(errno);
+    }
+
+    this->gsoSegmentSize = segmentSize;
+    return 0;
+  #else
+    return UV_ENOSYS;
+  #endif
+  }
+
+  // reuses a pooled send request when one is available, falling back
+  // to an allocation when the pool is empty
+  Peer::SendRequest* Peer::acquireSendRequest (RequestContext::Callback cb) {
+    SendRequest *request = nullptr;
+
+    do {
+      Lock lock(this->mutex);
+      if (this->sendRequestPool.size() > 0) {
+        request = this->sendRequestPool.back();
+        this->sendRequestPool.pop_back();
+      }
+    } while (0);
+
+    if (request == nullptr) {
+      request = new SendRequest();
+    }
+
+    request->cb = cb;
+    request->peer = this;
+    request->req.data = (void *) request;
+    return request;
+  }
+
+  void Peer::releaseSendRequest (SendRequest *request) {
+    request->cb = nullptr;
+
+    Lock lock(this->mutex);
+    if (this->sendRequestPool.size() < MAX_POOLED_SEND_REQUESTS) {
+      this->sendRequestPool.push_back(request);
+    } else {
+      delete request;
+    }
+  }
+
+  // bounds the outbound queue and selects the overflow policy - when the
+  // queue is full either the oldest waiting packet is dropped to make
+  // room (default) or the incoming one is rejected. `0` disables the
+  // queue and restores direct sends
+  void Peer::configureQueue (size_t depth, bool dropNewest) {
+    Lock lock(this->mutex);
+    this->outboundDepth = depth;
+    this->outboundDropNewest = dropNewest;
+
+    // apply the new bound to packets already waiting
+    while (depth > 0 && this->outbound.size() > depth) {
+      auto dropped = std::move(this->outbound.front());
+      this->outbound.pop_front();
+      this->outboundDropped++;
+
+      if (dropped.cb != nullptr) {
+        dropped.cb(UV_ENOBUFS, Post{});
       }
+    }
+  }
+
+  void Peer::enqueueOutbound (
+    char *buf,
+    size_t size,
+    bool hasAddr,
+    RequestContext::Callback cb
+  ) {
+    OutboundPacket packet;
+    packet.size = size;
+    packet.hasAddr = hasAddr;
+    packet.cb = cb;
+    packet.body = BufferPool::instance()->acquire(size);
+    memcpy(packet.body.get(), buf, size);
+
+    if (hasAddr) {
+      packet.addr = this->sendAddr;
+    }
+
+    do {
+      Lock lock(this->mutex);
+
+      if (this->outbound.size() >= this->outboundDepth) {
+        this->outboundDropped++;
+
+        if (this->outboundDropNewest) {
+          if (cb != nullptr) {
+            cb(UV_ENOBUFS, Post{});
+          }
+
+          return;
+        }
+
+        auto dropped = std::move(this->outbound.front());
+        this->outbound.pop_front();
+
+        if (dropped.cb != nullptr) {
+          dropped.cb(UV_ENOBUFS, Post{});
+        }
+      }
+
+      this->outbound.push_back(std::move(packet));
+    } while (0);
+
+    this->drainOutbound();
+  }
+
+  void Peer::drainOutbound () {
+    Lock lock(this->mutex);
+
+    while (
+      this->outbound.size() > 0 &&
+      this->outboundInflight < MAX_POOLED_SEND_REQUESTS
+    ) {
+      auto& head = this->outbound.front();
+
+      // look ahead for a run of equal-size datagrams to the same
+      // destination - where segmentation offload is available the run
+      // collapses into a single kernel-split send
+      size_t run = 1;
+      size_t total = head.size;
+
+      while (run < this->outbound.size() && total < 64 * 1024) {
+        const auto& next = this->outbound.at(run);
+
+        if (
+          next.size != head.size ||
+          next.hasAddr != head.hasAddr ||
+          (next.hasAddr && memcmp(&next.addr, &head.addr, sizeof(head.addr)) != 0)
+        ) {
+          break;
+        }
+
+        total += next.size;
+        run++;
+      }
+
+      if (run > 1 && this->setSegmentSize(head.size) != 0) {
+        run = 1;
+        total = head.size;
+      }
+
+      auto body = head.body;
+      auto size = head.size;
+
+      if (run > 1) {
+        body = BufferPool::instance()->acquire(total);
+        size = total;
+
+        size_t offset = 0;
+        for (size_t index = 0; index < run; index++) {
+          const auto& packet = this->outbound.at(index);
+          memcpy(body.get() + offset, packet.body.get(), packet.size);
+          offset += packet.size;
+        }
+
+        this->outboundCoalesced += run - 1;
+      } else if (this->gsoSegmentSize != 0) {
+        this->setSegmentSize(0);
+      }
+
+      auto callbacks = std::make_shared<Vector<RequestContext::Callback>>();
+      struct sockaddr_in addr = head.addr;
+      struct sockaddr *sockaddr = head.hasAddr
+        ? (struct sockaddr *) &addr
+        : nullptr;
+
+      for (size_t index = 0; index < run; index++) {
+        callbacks->push_back(std::move(this->outbound.front().cb));
+        this->outbound.pop_front();
+      }
+
+      auto buffer = uv_buf_init(body.get(), (int) size);
+      auto complete = [callbacks](int status) {
+        for (const auto& cb : *callbacks) {
+          if (cb != nullptr) {
+            cb(status, Post{});
+          }
+        }
+      };
+
+      // packets that can go out immediately skip the async request
+      int err = uv_udp_try_send((uv_udp_t *) &this->handle, &buffer, 1, sockaddr);
+
+      if (err != UV_EAGAIN && err != UV_ENOSYS) {
+        complete(err < 0 ? err : 0);
+        continue;
+      }
+
+      this->outboundInflight++;
+
+      // `body` rides in the closure so the packed bytes outlive the
+      // async send
+      auto request = this->acquireSendRequest([this, body, complete](auto status, auto post) {
+        do {
+          Lock lock(this->mutex);
+          this->outboundInflight--;
+        } while (0);
+
+        complete(status);
+        this->drainOutbound();
+      });
+
+      err = uv_udp_send(&request->req, (uv_udp_t *) &this->handle, &buffer, 1, sockaddr, [](uv_udp_send_t *req, int status) {
+        auto request = reinterpret_cast<Peer::SendRequest*>(req->data);
+        auto peer = request->peer;
+        auto cb = request->cb;
+
+        peer->releaseSendRequest(request);
+        cb(status, Post{});
+      });
+
+      if (err < 0) {
+        this->releaseSendRequest(request);
+        this->outboundInflight--;
+        complete(err);
+      }
+    }
+  }
+
+  int Peer::listen (
+    const String address,
+    int port,
+    int backlog,
+    TCPAcceptCallback onaccept
+  ) {
+    Lock lock(this->mutex);
+    int err = 0;
+
+    if (!this->isTCP()) {
+      return UV_EINVAL;
+    }
+
+    if ((err = uv_ip4_addr((char *) address.c_str(), port, &this->addr))) {
+      return err;
+    }
+
+    auto sockaddr = (struct sockaddr *) &this->addr;
+    if ((err = uv_tcp_bind((uv_tcp_t *) &this->handle, sockaddr, 0))) {
+      return err;
+    }
+
+    this->addState(PEER_STATE_TCP_BOUND);
+    this->acceptCallback = onaccept;
+
+    err = uv_listen((uv_stream_t *) &this->handle, backlog, [](uv_stream_t *stream, int status) {
+      auto peer = (Peer *) stream->data;
+
+      if (status < 0) {
+        return peer->acceptCallback(status, 0);
+      }
+
+      auto connection = peer->core->createPeer(PEER_TYPE_TCP, rand64());
+
+      status = uv_accept(stream, (uv_stream_t *) &connection->handle);
 
-      delete ctx;
-      delete req;
+      if (status < 0) {
+        connection->close();
+        return peer->acceptCallback(status, 0);
+      }
+
+      connection->addState(PEER_STATE_TCP_CONNECTED);
+      connection->initLocalPeerInfo();
+      connection->initRemotePeerInfo();
+      peer->acceptCallback(status, connection->id);
     });
 
     if (err < 0) {
-      ctx->cb(err, Post{});
+      return err;
+    }
 
-      if (this->isEphemeral()) {
-        this->close();
+    this->addState(PEER_STATE_TCP_LISTENING);
+    return this->initLocalPeerInfo();
+  }
+
+  void Peer::connect (const String address, int port, TCPConnectCallback cb) {
+    Lock lock(this->mutex);
+    int err = 0;
+
+    struct ConnectContext {
+      TCPConnectCallback cb;
+      Peer *peer;
+    };
+
+    if ((err = uv_ip4_addr((char *) address.c_str(), port, &this->addr))) {
+      return cb(err);
+    }
+
+    auto request = new uv_connect_t;
+    request->data = new ConnectContext { cb, this };
+
+    auto sockaddr = (struct sockaddr *) &this->addr;
+    err = uv_tcp_connect(request, (uv_tcp_t *) &this->handle, sockaddr, [](uv_connect_t *request, int status) {
+      auto context = reinterpret_cast<ConnectContext*>(request->data);
+      auto peer = context->peer;
+
+      if (status == 0) {
+        peer->addState(PEER_STATE_TCP_CONNECTED);
+        peer->initLocalPeerInfo();
+        peer->initRemotePeerInfo();
+      }
+
+      context->cb(status);
+      delete context;
+      delete request;
+    });
+
+    if (err < 0) {
+      delete reinterpret_cast<ConnectContext*>(request->data);
+      delete request;
+      cb(err);
+    }
+  }
+
+  int Peer::shutdown (std::function<void(int)> cb) {
+    struct ShutdownContext {
+      std::function<void(int)> cb;
+    };
+
+    auto request = new uv_shutdown_t;
+    request->data = new ShutdownContext { cb };
+
+    Lock lock(this->mutex);
+    auto err = uv_shutdown(request, (uv_stream_t *) &this->handle, [](uv_shutdown_t *request, int status) {
+      auto context = reinterpret_cast<ShutdownContext*>(request->data);
+      context->cb(status);
+      delete context;
+      delete request;
+    });
+
+    if (err < 0) {
+      delete reinterpret_cast<ShutdownContext*>(request->data);
+      delete request;
+    }
+
+    return err;
+  }
+
+  int Peer::readstart (TCPReceiveCallback onread) {
+    Lock lock(this->mutex);
+
+    if (this->hasState(PEER_STATE_TCP_READ_STARTED)) {
+      return UV_EALREADY;
+    }
+
+    this->addState(PEER_STATE_TCP_READ_STARTED);
+    this->streamReceiveCallback = onread;
+
+    auto allocate = [](uv_handle_t *handle, size_t size, uv_buf_t *buf) {
+      if (size > 0) {
+        buf->base = BufferPool::instance()->acquireRaw(size);
+        buf->len = size;
+      }
+    };
+
+    auto receive = [](uv_stream_t *stream, ssize_t nread, const uv_buf_t *buf) {
+      auto peer = (Peer *) stream->data;
+      peer->streamReceiveCallback(nread, buf);
+    };
+
+    return uv_read_start((uv_stream_t *) &this->handle, allocate, receive);
+  }
+
+  int Peer::readstop () {
+    int err = 0;
+
+    if (this->hasState(PEER_STATE_TCP_READ_STARTED)) {
+      this->removeState(PEER_STATE_TCP_READ_STARTED);
+      Lock lock(this->core->loopMutex);
+      err = uv_read_stop((uv_stream_t *) &this->handle);
+    }
+
+    return err;
+  }
+
+  void Peer::write (char *buf, size_t size, Peer::RequestContext::Callback cb) {
+    return this->write(Vector<uv_buf_t> { uv_buf_init(buf, (int) size) }, cb);
+  }
+
+  void Peer::write (
+    const Vector<uv_buf_t>& buffers,
+    Peer::RequestContext::Callback cb
+  ) {
+    Lock lock(this->mutex);
+    auto stream = (uv_stream_t *) &this->handle;
+    Vector<uv_buf_t> pending;
+
+    // most writes complete inline - try that first and only queue an
+    // async write request for whatever the socket did not take
+    int err = uv_try_write(stream, buffers.data(), buffers.size());
+
+    if (err >= 0) {
+      size_t written = (size_t) err;
+      size_t total = 0;
+
+      for (const auto& buffer : buffers) {
+        total += buffer.len;
+      }
+
+      if (written == total) {
+        return cb(0, Post{});
+      }
+
+      // partial write - queue the remainder
+      for (const auto& buffer : buffers) {
+        if (written >= buffer.len) {
+          written -= buffer.len;
+          continue;
+        }
+
+        pending.push_back(uv_buf_init(buffer.base + written, buffer.len - written));
+        written = 0;
       }
+    } else if (err != UV_EAGAIN && err != UV_ENOSYS) {
+      return cb(err, Post{});
+    } else {
+      pending = buffers;
+    }
+
+    auto request = this->acquireWriteRequest(cb);
+
+    err = uv_write(&request->req, stream, pending.data(), pending.size(), [](uv_write_t *req, int status) {
+      auto request = reinterpret_cast<Peer::WriteRequest*>(req->data);
+      auto peer = request->peer;
+      auto cb = request->cb;
+
+      peer->releaseWriteRequest(request);
+      cb(status, Post{});
+    });
+
+    if (err < 0) {
+      this->releaseWriteRequest(request);
+      cb(err, Post{});
+    }
+  }
+
+  // reuses a pooled stream write request when one is available, falling
+  // back to an allocation when the pool is empty
+  Peer::WriteRequest* Peer::acquireWriteRequest (RequestContext::Callback cb) {
+    WriteRequest *request = nullptr;
+
+    do {
+      Lock lock(this->mutex);
+      if (this->writeRequestPool.size() > 0) {
+        request = this->writeRequestPool.back();
+        this->writeRequestPool.pop_back();
+      }
+    } while (0);
 
-      delete ctx;
-      delete req;
+    if (request == nullptr) {
+      request = new WriteRequest();
+    }
+
+    request->cb = cb;
+    request->peer = this;
+    request->req.data = (void *) request;
+    return request;
+  }
+
+  void Peer::releaseWriteRequest (WriteRequest *request) {
+    request->cb = nullptr;
+
+    Lock lock(this->mutex);
+    if (this->writeRequestPool.size() < MAX_POOLED_SEND_REQUESTS) {
+      this->writeRequestPool.push_back(request);
+    } else {
+      delete request;
     }
   }
 
@@ -493,7 +1249,7 @@ namespace SSC {
 
     auto allocate = [](uv_handle_t *handle, size_t size, uv_buf_t *buf) {
       if (size > 0) {
-        buf->base = (char *) new char[size]{0};
+        buf->base = BufferPool::instance()->acquireRaw(size);
         buf->len = size;
       }
     };
@@ -508,6 +1264,10 @@ namespace SSC {
       auto peer = (Peer *) handle->data;
 
       if (nread == UV_ENOTCONN) {
+        if (buf->base != nullptr) {
+          BufferPool::instance()->release(buf->base, buf->len);
+        }
+
         peer->recvstop();
         return;
       }
@@ -597,7 +1357,7 @@ namespace SSC {
       this->onclose.push_back(onclose);
     }
 
-    if (this->type == PEER_TYPE_UDP) {
+    if (this->type == PEER_TYPE_UDP || this->type == PEER_TYPE_TCP) {
       Lock lock(this->mutex);
       // reset state and set to CLOSED
       uv_close((uv_handle_t*) &this->handle, [](uv_handle_t *handle) {
@@ -606,7 +1366,11 @@ namespace SSC {
           peer->removeState((peer_state_t) (
             PEER_STATE_UDP_BOUND |
             PEER_STATE_UDP_CONNECTED |
-            PEER_STATE_UDP_RECV_STARTED
+            PEER_STATE_UDP_RECV_STARTED |
+            PEER_STATE_TCP_BOUND |
+            PEER_STATE_TCP_CONNECTED |
+            PEER_STATE_TCP_LISTENING |
+            PEER_STATE_TCP_READ_STARTED
           ));
 
           for (const auto &onclose : peer->onclose) {
@@ -3,9 +3,9 @@
 #include "string.hh"
 
 namespace SSC {
-  String createPreload (
-    const WindowOptions opts,
-    const PreloadOptions preloadOptions
+  static String buildPreload (
+    const WindowOptions& opts,
+    const PreloadOptions& preloadOptions
   ) {
     auto argv = opts.argv;
   #ifdef _WIN32
@@ -28,9 +28,9 @@ namespace SSC {
       "    enumerable: true                                                  \n"
       "  },                                                                  \n"
       "  config: {                                                           \n"
-      "    value: {},                                                        \n"
+      "    get: () => (config === null ? (config = decodeConfig()) : config),\n"
+      "    set: (value) => { config = value; },                              \n"
       "    enumerable: true,                                                 \n"
-      "    writable: true,                                                   \n"
       "    configurable: true                                                \n"
       "  },                                                                  \n"
       "  debug: {                                                            \n"
@@ -111,7 +111,14 @@ namespace SSC {
       }
     }
 
-    // fill in the config
+    // the config rides along as one compact payload of URI-encoded
+    // key/value pairs decoded on first `__args.config` access instead of
+    // one expanded statement per key the webview must parse at document
+    // start on every navigation; only the `env_` entries are applied
+    // eagerly because `__args.env` is frozen before the lazy decode runs
+    auto payload = StringStream();
+    auto delimiter = "";
+
     for (auto const &tuple : opts.appData) {
       auto key = trim(tuple.first);
       auto value = trim(tuple.second);
@@ -121,44 +128,48 @@ namespace SSC {
         continue;
       }
 
-      preload += (
-        "  ;(() => {                                                         \n"
-        "    let key = decodeURIComponent(                                   \n"
-        "      '" + encodeURIComponent(key) + "'                             \n"
-        "    )                                                               \n"
-      );
-
       if (key.starts_with("env_")) {
         preload += (
-          "    const k = key.slice(4);                                       \n"
-          "    const value = `" + value + "`;                                \n"
-          "    globalThis.__args.env[k] = value;                             \n"
-          "    globalThis.__args.config[key] = value;                        \n"
-        );
-      } else if (value == "true" || value == "false") {
-        preload += (
-          "    const k = key.toLowerCase();                                  \n"
-          "    globalThis.__args.config[k] = " + value + "                   \n"
-        );
-      } else {
-        preload += (
-          "    const k = key.toLowerCase();                                  \n"
-          "    const value = '" + encodeURIComponent(value) + "'             \n"
-          "    if (!isNaN(value) && !Number.isNaN(parseFloat(value))) {      \n"
-          "      globalThis.__args.config[k] = parseFloat(value) ;           \n"
-          "    } else {                                                      \n"
-          "      let val = decodeURIComponent(value);                        \n"
-          "      try { val = JSON.parse(val) } catch (err) {}                \n"
-          "      globalThis.__args.config[k] = val;                          \n"
-          "    }                                                             \n"
+          "  ;(() => {                                                       \n"
+          "    const key = decodeURIComponent(                               \n"
+          "      '" + encodeURIComponent(key) + "'                           \n"
+          "    )                                                             \n"
+          "    globalThis.__args.env[key.slice(4)] = `" + value + "`;        \n"
+          "  })();                                                           \n"
         );
       }
 
-      preload += "  })();\n";
+      payload << delimiter << encodeURIComponent(key);
+      payload << "," << encodeURIComponent(value);
+      delimiter = ",";
     }
 
     preload += (
-      "  Object.freeze(globalThis.__args.config);                            \n"
+      "  const payload = '" + payload.str() + "';                            \n"
+      "  let config = null;                                                  \n"
+      "  const decodeConfig = () => {                                        \n"
+      "    const decoded = {};                                               \n"
+      "    const entries = payload.length > 0                                \n"
+      "      ? payload.split(',').map(decodeURIComponent)                    \n"
+      "      : [];                                                           \n"
+      "    for (let i = 0; i < entries.length; i += 2) {                     \n"
+      "      const key = entries[i];                                         \n"
+      "      const value = entries[i + 1];                                   \n"
+      "      if (key.startsWith('env_')) {                                   \n"
+      "        decoded[key] = value;                                         \n"
+      "      } else if (value === 'true' || value === 'false') {             \n"
+      "        decoded[key.toLowerCase()] = value === 'true';                \n"
+      "      } else if (!isNaN(value) && !Number.isNaN(parseFloat(value))) { \n"
+      "        decoded[key.toLowerCase()] = parseFloat(value);               \n"
+      "      } else {                                                        \n"
+      "        let val = value;                                              \n"
+      "        try { val = JSON.parse(val) } catch (err) {}                  \n"
+      "        decoded[key.toLowerCase()] = val;                             \n"
+      "      }                                                               \n"
+      "    }                                                                 \n"
+      "    return Object.freeze(decoded);                                    \n"
+      "  };                                                                  \n"
+      "                                                                      \n"
       "  Object.freeze(globalThis.__args.argv);                              \n"
       "  Object.freeze(globalThis.__args.env);                               \n"
       "                                                                      \n"
@@ -198,4 +209,46 @@ namespace SSC {
 
     return preload;
   }
+
+  String createPreload (
+    const WindowOptions opts,
+    const PreloadOptions preloadOptions
+  ) {
+    // the generated source depends only on this subset of the options -
+    // windows and webviews created with the same configuration (reloads,
+    // secondary windows) reuse the cached script instead of rebuilding
+    // and re-serializing the config every time
+    static Mutex mutex;
+    static Map cache;
+
+    String key;
+    key.reserve(opts.argv.size() + opts.env.size() + 64);
+    key += std::to_string(opts.index);
+    key += '\x1f';
+    key += std::to_string(opts.debug);
+    key += opts.headless ? '1' : '0';
+    key += preloadOptions.module ? '1' : '0';
+    key += '\x1f';
+    key += opts.argv;
+    key += '\x1f';
+    key += opts.env;
+
+    for (const auto& tuple : opts.appData) {
+      key += '\x1f';
+      key += tuple.first;
+      key += '\x1e';
+      key += tuple.second;
+    }
+
+    Lock lock(mutex);
+    const auto entry = cache.find(key);
+
+    if (entry != cache.end()) {
+      return entry->second;
+    }
+
+    auto preload = buildPreload(opts, preloadOptions);
+    cache.insert_or_assign(std::move(key), preload);
+    return preload;
+  }
 }
@@ -1,6 +1,8 @@
 #include "string.hh"
 #include "debug.hh"
 
+#include <charconv>
+#include <cmath>
 #include <regex>
 
 #if defined(min)
@@ -12,17 +14,97 @@ namespace SSC {
     return std::regex_replace(source, regex, value);
   }
 
-  String replace (const String& source, const String& regex, const String& value) {
-    return replace(source, std::regex(regex), value);
+  String replace (const String& source, const String& pattern, const String& value) {
+    // the pattern is treated as a literal, with backslash escaping the
+    // following character so regex-era call sites like "\\." keep working -
+    // compiling a std::regex per call costs more than the replacement itself
+    String needle;
+    needle.reserve(pattern.size());
+
+    for (size_t i = 0; i < pattern.size(); ++i) {
+      if (pattern[i] == '\\' && i + 1 < pattern.size()) {
+        i++;
+      }
+
+      needle += pattern[i];
+    }
+
+    if (needle.size() == 0) {
+      return source;
+    }
+
+    String output;
+    output.reserve(source.size());
+
+    size_t offset = 0;
+    size_t position = 0;
+
+    while ((position = source.find(needle, offset)) != String::npos) {
+      output.append(source, offset, position - offset);
+      output += value;
+      offset = position + needle.size();
+    }
+
+    output.append(source, offset, String::npos);
+    return output;
   }
 
   String tmpl (const String& source, const Map& variables) {
-    String output = source;
+    // a single scan over the source handles every key - expansion cost no
+    // longer scales with the number of variables
+    String output;
+    output.reserve(source.size());
+
+    size_t position = 0;
+
+    while (position < source.size()) {
+      const auto open = source.find('{', position);
+
+      if (open == String::npos) {
+        output.append(source, position, String::npos);
+        break;
+      }
+
+      output.append(source, position, open - position);
+      position = open;
+
+      // consume the '{' run, the key and the '}' run - one or more braces
+      // on either side, like the old [{]+(key)[}]+ patterns
+      auto keyStart = open;
+      while (keyStart < source.size() && source[keyStart] == '{') {
+        keyStart++;
+      }
+
+      auto keyEnd = keyStart;
+      while (
+        keyEnd < source.size() &&
+        source[keyEnd] != '}' &&
+        source[keyEnd] != '{'
+      ) {
+        keyEnd++;
+      }
 
-    for (const auto tuple : variables) {
-      auto key = String("[{]+(" + tuple.first + ")[}]+");
-      auto value = tuple.second;
-      output = std::regex_replace(output, std::regex(key), value);
+      if (
+        keyEnd > keyStart &&
+        keyEnd < source.size() &&
+        source[keyEnd] == '}'
+      ) {
+        const auto entry = variables.find(source.substr(keyStart, keyEnd - keyStart));
+
+        if (entry != variables.end()) {
+          auto close = keyEnd;
+          while (close < source.size() && source[close] == '}') {
+            close++;
+          }
+
+          output += entry->second;
+          position = close;
+          continue;
+        }
+      }
+
+      // not a known variable - emit this brace and rescan after it
+      output += source[position++];
     }
 
     return output;
@@ -69,6 +151,33 @@ namespace SSC {
     return result;
   }
 
+  //
+  // Splits like `split(source, character)` - empty tokens are dropped -
+  // but returns views into `source` instead of owned copies, so the
+  // source must outlive the result. Keeps hot parsers allocation free.
+  //
+  const Vector<StringView> splitView (StringView source, const char character) {
+    Vector<StringView> result;
+    size_t offset = 0;
+
+    while (offset < source.size()) {
+      const auto position = source.find(character, offset);
+
+      if (position == StringView::npos) {
+        result.push_back(source.substr(offset));
+        break;
+      }
+
+      if (position > offset) {
+        result.push_back(source.substr(offset, position - offset));
+      }
+
+      offset = position + 1;
+    }
+
+    return result;
+  }
+
   const Vector<String> splitc (const String& source, const char character) {
     String buffer;
     Vector<String> result;
@@ -93,6 +202,17 @@ namespace SSC {
     return source;
   }
 
+  StringView trimView (StringView source) {
+    const auto start = source.find_first_not_of(" \r\n\t");
+
+    if (start == StringView::npos) {
+      return StringView();
+    }
+
+    const auto end = source.find_last_not_of(" \r\n\t");
+    return source.substr(start, end - start + 1);
+  }
+
   WString convertStringToWString (const String& source) {
     WString result(source.length(), L' ');
     std::copy(source.begin(), source.end(), result.begin());
@@ -151,4 +271,48 @@ namespace SSC {
   Vector<String> parseStringList (const String& string) {
     return parseStringList(string, { ' ', ',' });
   }
+
+  String formatNumber (int64_t value) {
+    char buffer[24];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    return String(buffer, result.ptr - buffer);
+  }
+
+  String formatNumber (uint64_t value) {
+    char buffer[24];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    return String(buffer, result.ptr - buffer);
+  }
+
+  void writeNumber (String& out, double value) {
+    // no JSON representation - render like `JSON.stringify` does
+    if (std::isnan(value) || std::isinf(value)) {
+      out += "null";
+      return;
+    }
+
+    // integral values inside the safe range render as integers, the way
+    // JS prints them - no trailing ".0" and no exponent
+    if (value == std::trunc(value) && std::abs(value) < 9007199254740992.0) {
+      char buffer[24];
+      const auto result = std::to_chars(
+        buffer,
+        buffer + sizeof(buffer),
+        (int64_t) value
+      );
+      out.append(buffer, result.ptr - buffer);
+      return;
+    }
+
+    // shortest representation that round-trips to the same double
+    char buffer[32];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr - buffer);
+  }
+
+  String formatNumber (double value) {
+    String out;
+    writeNumber(out, value);
+    return out;
+  }
 }
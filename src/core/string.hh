@@ -17,6 +17,17 @@ namespace SSC {
   String replace (const String& source, const std::regex& regex, const String& value);
   String tmpl (const String& source, const Map& variables);
   String trim (String source);
+  StringView trimView (StringView source);
+
+  // number formatting - `std::to_chars` into a stack buffer, never a
+  // stringstream or locale. doubles render shortest round-trip, with
+  // integral values inside the 2^53 safe range rendered as integers the
+  // way JS prints them
+  String formatNumber (int64_t value);
+  String formatNumber (uint64_t value);
+  String formatNumber (double value);
+  // appends straight into a serialization buffer
+  void writeNumber (String& out, double value);
 
   // conversion
   WString convertStringToWString (const String& source);
@@ -28,6 +39,7 @@ namespace SSC {
   const Vector<String> splitc (const String& source, const char character);
   const Vector<String> split (const String& source, const char character);
   const Vector<String> split (const String& source, const String& needle);
+  const Vector<StringView> splitView (StringView source, const char character);
   const String join (const Vector<String>& vector, const String& separator);
   const String join (const Vector<String>& vector, const char separator);
   Vector<String> parseStringList (const String& string, const Vector<char>& separators);
@@ -0,0 +1,801 @@
+#include "core.hh"
+
+namespace SSC {
+  static JSON::Object::Entries ERR_SOCKET_STREAM_NOT_RUNNING (
+    const String& source,
+    uint64_t id
+  ) {
+    return JSON::Object::Entries {
+      {"source", source},
+      {"err", JSON::Object::Entries {
+        {"id", std::to_string(id)},
+        {"type", "NotFoundError"},
+        {"code", "ERR_SOCKET_STREAM_NOT_RUNNING"},
+        {"message", "Not running"}
+      }}
+    };
+  }
+
+  static JSON::Object::Entries ERR_SOCKET_STREAM_CLOSED (
+    const String& source,
+    uint64_t id
+  ) {
+    return JSON::Object::Entries {
+      {"source", source},
+      {"err", JSON::Object::Entries {
+        {"id", std::to_string(id)},
+        {"type", "InternalError"},
+        {"code", "ERR_SOCKET_STREAM_CLOSED"},
+        {"message", "Socket is closed"}
+      }}
+    };
+  }
+
+  static JSON::Object::Entries ERR_SOCKET_STREAM_CLOSING (
+    const String& source,
+    uint64_t id
+  ) {
+    return JSON::Object::Entries {
+      {"source", source},
+      {"err", JSON::Object::Entries {
+        {"id", std::to_string(id)},
+        {"type", "NotFoundError"},
+        {"code", "ERR_SOCKET_STREAM_CLOSING"},
+        {"message", "Socket is closing"}
+      }}
+    };
+  }
+
+  // RFC 8305 "connection attempt delay" - how long IPv4 is held back
+  // once an IPv6 attempt is in flight
+  static constexpr uint64_t CONNECT_RACE_STAGGER = 250; // in milliseconds
+
+  // shared state for an RFC 8305 style connection race - both address
+  // families resolve in parallel and connection attempts go out IPv6
+  // first with IPv4 staggered behind it; the first attempt to complete
+  // takes over the caller's handle id
+  struct ConnectRace {
+    Core *core = nullptr;
+    uint64_t peerId = 0;
+    String seq;
+    Core::Module::Callback cb = nullptr;
+    int port = 0;
+    bool settled = false;
+    bool staggerScheduled = false;
+    bool staggerFired = false;
+    bool ipv4Resolved = false;
+    bool ipv6Resolved = false;
+    bool ipv4Started = false;
+    bool ipv6Started = false;
+    bool ipv4Failed = false;
+    bool ipv6Failed = false;
+    int pendingResolutions = 0;
+    int pendingAttempts = 0;
+    int lastError = 0;
+    String ipv4 = "";
+    String ipv6 = "";
+  };
+
+  static void startConnectRaceAttempt (std::shared_ptr<ConnectRace> race, int family);
+  static void onConnectRaceAttemptFailed (std::shared_ptr<ConnectRace> race, int family, int status);
+  static void scheduleConnectRaceStagger (std::shared_ptr<ConnectRace> race);
+  static void maybeFailConnectRace (std::shared_ptr<ConnectRace> race);
+
+  // fails the race once no resolution or attempt is outstanding and no
+  // address is left to try
+  static void maybeFailConnectRace (std::shared_ptr<ConnectRace> race) {
+    if (race->settled) {
+      return;
+    }
+
+    const auto ipv6Startable = race->ipv6.size() > 0 && !race->ipv6Started;
+    const auto ipv4Startable = race->ipv4.size() > 0 && !race->ipv4Started;
+
+    if (
+      race->pendingResolutions > 0 ||
+      race->pendingAttempts > 0 ||
+      ipv6Startable ||
+      ipv4Startable
+    ) {
+      return;
+    }
+
+    race->settled = true;
+
+    const auto status = race->lastError != 0 ? race->lastError : UV_EAI_NONAME;
+    auto json = JSON::Object::Entries {
+      {"source", "tcp.connect"},
+      {"err", JSON::Object::Entries {
+        {"id", std::to_string(race->peerId)},
+        {"code", std::to_string(status)},
+        {"message", String(uv_strerror(status))}
+      }}
+    };
+
+    race->cb(race->seq, json, Post{});
+  }
+
+  static void scheduleConnectRaceStagger (std::shared_ptr<ConnectRace> race) {
+    if (race->staggerScheduled) {
+      return;
+    }
+
+    race->staggerScheduled = true;
+
+    auto timer = new uv_timer_t;
+    timer->data = new std::shared_ptr<ConnectRace>(race);
+
+    uv_timer_init(race->core->getEventLoop(), timer);
+    uv_timer_start(timer, [](uv_timer_t *timer) {
+      auto race = *reinterpret_cast<std::shared_ptr<ConnectRace>*>(timer->data);
+
+      uv_close((uv_handle_t *) timer, [](uv_handle_t *handle) {
+        delete reinterpret_cast<std::shared_ptr<ConnectRace>*>(handle->data);
+        delete reinterpret_cast<uv_timer_t*>(handle);
+      });
+
+      race->staggerFired = true;
+
+      if (!race->settled && !race->ipv4Started && race->ipv4.size() > 0) {
+        startConnectRaceAttempt(race, 4);
+      }
+    }, CONNECT_RACE_STAGGER, 0);
+  }
+
+  static void onConnectRaceAttemptFailed (
+    std::shared_ptr<ConnectRace> race,
+    int family,
+    int status
+  ) {
+    race->lastError = status;
+
+    if (family == 6) {
+      race->ipv6Failed = true;
+    } else {
+      race->ipv4Failed = true;
+    }
+
+    if (race->settled) {
+      return;
+    }
+
+    // a failed family hands its turn to the other one immediately
+    if (family == 6 && race->ipv4.size() > 0 && !race->ipv4Started) {
+      return startConnectRaceAttempt(race, 4);
+    }
+
+    if (family == 4 && race->ipv6.size() > 0 && !race->ipv6Started) {
+      return startConnectRaceAttempt(race, 6);
+    }
+
+    maybeFailConnectRace(race);
+  }
+
+  static void startConnectRaceAttempt (
+    std::shared_ptr<ConnectRace> race,
+    int family
+  ) {
+    struct Attempt {
+      std::shared_ptr<ConnectRace> race;
+      Peer *candidate;
+      int family;
+    };
+
+    const auto address = family == 6 ? race->ipv6 : race->ipv4;
+    struct sockaddr_storage addr;
+
+    if (family == 6) {
+      race->ipv6Started = true;
+    } else {
+      race->ipv4Started = true;
+    }
+
+    int err = family == 6
+      ? uv_ip6_addr(address.c_str(), race->port, (struct sockaddr_in6 *) &addr)
+      : uv_ip4_addr(address.c_str(), race->port, (struct sockaddr_in *) &addr);
+
+    if (err != 0) {
+      return onConnectRaceAttemptFailed(race, family, err);
+    }
+
+    auto candidate = new Peer(race->core, PEER_TYPE_TCP, rand64(), false);
+    auto request = new uv_connect_t;
+    request->data = new Attempt { race, candidate, family };
+    race->pendingAttempts++;
+
+    err = uv_tcp_connect(request, (uv_tcp_t *) &candidate->handle, (struct sockaddr *) &addr, [](uv_connect_t *request, int status) {
+      auto attempt = reinterpret_cast<Attempt*>(request->data);
+      auto race = attempt->race;
+      auto candidate = attempt->candidate;
+      auto family = attempt->family;
+      delete attempt;
+      delete request;
+
+      race->pendingAttempts--;
+
+      // another family already won
+      if (race->settled) {
+        candidate->close();
+        return;
+      }
+
+      if (status < 0) {
+        candidate->close();
+        return onConnectRaceAttemptFailed(race, family, status);
+      }
+
+      race->settled = true;
+      candidate->addState(PEER_STATE_TCP_CONNECTED);
+      candidate->initLocalPeerInfo();
+      candidate->initRemotePeerInfo();
+
+      // the winner takes over the caller's handle id
+      candidate->id = race->peerId;
+      race->core->peers.set(race->peerId, candidate);
+
+      auto info = candidate->getRemotePeerInfo();
+
+      auto json = JSON::Object::Entries {
+        {"source", "tcp.connect"},
+        {"data", JSON::Object::Entries {
+          {"id", std::to_string(race->peerId)},
+          {"address", info->address},
+          {"family", info->family},
+          {"port", (int) info->port}
+        }}
+      };
+
+      race->cb(race->seq, json, Post{});
+    });
+
+    if (err < 0) {
+      delete reinterpret_cast<Attempt*>(request->data);
+      delete request;
+      race->pendingAttempts--;
+      candidate->close();
+      onConnectRaceAttemptFailed(race, family, err);
+    }
+  }
+
+  static void onConnectRaceResolved (
+    std::shared_ptr<ConnectRace> race,
+    int family,
+    const String& address,
+    int status
+  ) {
+    if (family == 6) {
+      race->ipv6 = address;
+      race->ipv6Resolved = true;
+    } else {
+      race->ipv4 = address;
+      race->ipv4Resolved = true;
+    }
+
+    if (status < 0) {
+      race->lastError = status;
+    }
+
+    if (race->settled) {
+      return;
+    }
+
+    if (family == 6 && address.size() > 0) {
+      return startConnectRaceAttempt(race, 6);
+    }
+
+    if (family == 4 && address.size() > 0) {
+      // IPv6 is preferred - IPv4 waits out the stagger unless IPv6
+      // already failed, came up empty, or the stagger has passed
+      if (
+        race->ipv6Failed ||
+        race->staggerFired ||
+        (race->ipv6Resolved && !race->ipv6Started)
+      ) {
+        return startConnectRaceAttempt(race, 4);
+      }
+
+      return scheduleConnectRaceStagger(race);
+    }
+
+    maybeFailConnectRace(race);
+  }
+
+  static void resolveConnectRace (
+    std::shared_ptr<ConnectRace> race,
+    const String& hostname,
+    int family
+  ) {
+    struct Resolution {
+      std::shared_ptr<ConnectRace> race;
+      int family;
+    };
+
+    auto resolver = new uv_getaddrinfo_t;
+    resolver->data = new Resolution { race, family };
+
+    struct addrinfo hints = {0};
+    hints.ai_family = family == 6 ? AF_INET6 : AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+
+    race->pendingResolutions++;
+
+    auto err = uv_getaddrinfo(race->core->getEventLoop(), resolver, [](uv_getaddrinfo_t *resolver, int status, struct addrinfo *res) {
+      auto resolution = reinterpret_cast<Resolution*>(resolver->data);
+      auto race = resolution->race;
+      auto family = resolution->family;
+      delete resolution;
+      delete resolver;
+
+      race->pendingResolutions--;
+
+      String address = "";
+
+      if (status == 0 && res != nullptr) {
+        if (res->ai_family == AF_INET) {
+          char addr[17] = {0};
+          uv_ip4_name((struct sockaddr_in *) res->ai_addr, addr, 16);
+          address = String(addr);
+        } else if (res->ai_family == AF_INET6) {
+          char addr[40] = {0};
+          uv_ip6_name((struct sockaddr_in6 *) res->ai_addr, addr, 39);
+          address = String(addr);
+        }
+      }
+
+      uv_freeaddrinfo(res);
+      onConnectRaceResolved(race, family, address, status);
+    }, hostname.c_str(), nullptr, &hints);
+
+    if (err < 0) {
+      delete reinterpret_cast<Resolution*>(resolver->data);
+      delete resolver;
+      race->pendingResolutions--;
+      onConnectRaceResolved(race, family, "", err);
+    }
+  }
+
+  void Core::TCP::listen (
+    const String seq,
+    uint64_t peerId,
+    TCP::ListenOptions options,
+    Module::Callback cb
+  ) {
+    this->core->dispatchEventLoop([=, this]() {
+      auto peer = this->core->createPeer(PEER_TYPE_TCP, peerId);
+
+      if (peer->hasState(PEER_STATE_TCP_LISTENING)) {
+        auto json = JSON::Object::Entries {
+          {"source", "tcp.listen"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(peerId)},
+            {"message", "Socket is already listening"}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
+      auto err = peer->listen(options.address, options.port, options.backlog, [=, this](auto status, auto connectionId) {
+        if (status < 0) {
+          auto json = JSON::Object::Entries {
+            {"source", "tcp.listen"},
+            {"err", JSON::Object::Entries {
+              {"id", std::to_string(peerId)},
+              {"message", String(uv_strerror(status))}
+            }}
+          };
+
+          return cb("-1", json, Post{});
+        }
+
+        auto connection = this->core->getPeer(connectionId);
+        auto info = connection->getRemotePeerInfo();
+
+        auto json = JSON::Object::Entries {
+          {"source", "tcp.listen"},
+          {"data", JSON::Object::Entries {
+            {"id", std::to_string(peerId)},
+            {"event", "connection"},
+            {"connectionId", std::to_string(connectionId)},
+            {"address", info->address},
+            {"family", info->family},
+            {"port", (int) info->port}
+          }}
+        };
+
+        cb("-1", json, Post{});
+      });
+
+      if (err < 0) {
+        auto json = JSON::Object::Entries {
+          {"source", "tcp.listen"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(peerId)},
+            {"message", String(uv_strerror(err))}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
+      auto info = peer->getLocalPeerInfo();
+
+      auto json = JSON::Object::Entries {
+        {"source", "tcp.listen"},
+        {"data", JSON::Object::Entries {
+          {"id", std::to_string(peerId)},
+          {"event", "listening"},
+          {"address", info->address},
+          {"family", info->family},
+          {"port", (int) info->port}
+        }}
+      };
+
+      cb(seq, json, Post{});
+    });
+  }
+
+  void Core::TCP::connect (
+    const String seq,
+    uint64_t peerId,
+    TCP::ConnectOptions options,
+    Module::Callback cb
+  ) {
+    this->core->dispatchEventLoop([=, this]() {
+      if (this->core->hasPeer(peerId) && this->core->getPeer(peerId)->isConnected()) {
+        auto json = JSON::Object::Entries {
+          {"source", "tcp.connect"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(peerId)},
+            {"message", "Already connected"}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
+      // literal IPv4 addresses keep the direct connect path - hostnames
+      // (and IPv6 literals) race both families per RFC 8305 below
+      struct sockaddr_in literal;
+      if (uv_ip4_addr(options.address.c_str(), options.port, &literal) != 0) {
+        auto race = std::make_shared<ConnectRace>();
+        race->core = this->core;
+        race->peerId = peerId;
+        race->seq = seq;
+        race->cb = cb;
+        race->port = options.port;
+
+        resolveConnectRace(race, options.address, 6);
+        resolveConnectRace(race, options.address, 4);
+        return;
+      }
+
+      auto peer = this->core->createPeer(PEER_TYPE_TCP, peerId);
+
+      peer->connect(options.address, options.port, [=](auto status) {
+        if (status < 0) {
+          auto json = JSON::Object::Entries {
+            {"source", "tcp.connect"},
+            {"err", JSON::Object::Entries {
+              {"id", std::to_string(peerId)},
+              {"message", String(uv_strerror(status))}
+            }}
+          };
+
+          return cb(seq, json, Post{});
+        }
+
+        auto info = peer->getRemotePeerInfo();
+
+        auto json = JSON::Object::Entries {
+          {"source", "tcp.connect"},
+          {"data", JSON::Object::Entries {
+            {"id", std::to_string(peerId)},
+            {"address", info->address},
+            {"family", info->family},
+            {"port", (int) info->port}
+          }}
+        };
+
+        cb(seq, json, Post{});
+      });
+    });
+  }
+
+  void Core::TCP::shutdown (
+    const String seq,
+    uint64_t peerId,
+    Module::Callback cb
+  ) {
+    this->core->dispatchEventLoop([=, this]() {
+      if (!this->core->hasPeer(peerId)) {
+        auto json = ERR_SOCKET_STREAM_NOT_RUNNING("tcp.shutdown", peerId);
+        return cb(seq, json, Post{});
+      }
+
+      auto peer = this->core->getPeer(peerId);
+      auto err = peer->shutdown([=](auto status) {
+        if (status < 0) {
+          auto json = JSON::Object::Entries {
+            {"source", "tcp.shutdown"},
+            {"err", JSON::Object::Entries {
+              {"id", std::to_string(peerId)},
+              {"message", String(uv_strerror(status))}
+            }}
+          };
+
+          return cb(seq, json, Post{});
+        }
+
+        auto json = JSON::Object::Entries {
+          {"source", "tcp.shutdown"},
+          {"data", JSON::Object::Entries {
+            {"id", std::to_string(peerId)}
+          }}
+        };
+
+        cb(seq, json, Post{});
+      });
+
+      if (err < 0) {
+        auto json = JSON::Object::Entries {
+          {"source", "tcp.shutdown"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(peerId)},
+            {"message", String(uv_strerror(err))}
+          }}
+        };
+
+        cb(seq, json, Post{});
+      }
+    });
+  }
+
+  void Core::TCP::readStart (
+    const String seq,
+    uint64_t peerId,
+    Module::Callback cb
+  ) {
+    if (!this->core->hasPeer(peerId)) {
+      auto json = ERR_SOCKET_STREAM_NOT_RUNNING("tcp.readStart", peerId);
+      return cb(seq, json, Post{});
+    }
+
+    auto peer = this->core->getPeer(peerId);
+
+    if (peer->isClosed()) {
+      auto json = ERR_SOCKET_STREAM_CLOSED("tcp.readStart", peerId);
+      return cb(seq, json, Post{});
+    }
+
+    if (peer->isClosing()) {
+      auto json = ERR_SOCKET_STREAM_CLOSING("tcp.readStart", peerId);
+      return cb(seq, json, Post{});
+    }
+
+    if (peer->hasState(PEER_STATE_TCP_READ_STARTED)) {
+      auto json = JSON::Object::Entries {
+        {"source", "tcp.readStart"},
+        {"err", JSON::Object::Entries {
+          {"id", std::to_string(peerId)},
+          {"message", "Socket is already receiving"}
+        }}
+      };
+
+      return cb(seq, json, Post{});
+    }
+
+    auto err = peer->readstart([=](auto nread, auto buf) {
+      // take ownership of the receive buffer up front so it is
+      // recycled into the pool on every path, including errors
+      auto body = buf->base != nullptr
+        ? BufferPool::instance()->adopt(buf->base, buf->len)
+        : Post::Body(nullptr);
+
+      if (nread == UV_EOF) {
+        auto json = JSON::Object::Entries {
+          {"source", "tcp.readStart"},
+          {"data", JSON::Object::Entries {
+            {"id", std::to_string(peerId)},
+            {"EOF", true}
+          }}
+        };
+
+        cb("-1", json, Post{});
+      } else if (nread < 0) {
+        auto json = JSON::Object::Entries {
+          {"source", "tcp.readStart"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(peerId)},
+            {"message", String(uv_strerror((int) nread))}
+          }}
+        };
+
+        cb("-1", json, Post{});
+      } else if (nread > 0) {
+        Post post;
+
+        post.id = rand64();
+        post.body = body;
+        post.length = (int) nread;
+        post.headers = Headers::forPostBody(nread);
+
+        auto json = JSON::Object::Entries {
+          {"source", "tcp.readStart"},
+          {"data", JSON::Object::Entries {
+            {"id", std::to_string(peerId)},
+            {"bytes", std::to_string(post.length)}
+          }}
+        };
+
+        cb("-1", json, post);
+      }
+    });
+
+    // `UV_EALREADY || UV_EBUSY` could mean there might be
+    // active IO on the underlying handle
+    if (err < 0 && err != UV_EALREADY && err != UV_EBUSY) {
+      auto json = JSON::Object::Entries {
+        {"source", "tcp.readStart"},
+        {"err", JSON::Object::Entries {
+          {"id", std::to_string(peerId)},
+          {"message", String(uv_strerror(err))}
+        }}
+      };
+
+      return cb(seq, json, Post{});
+    }
+
+    auto json = JSON::Object::Entries {
+      {"source", "tcp.readStart"},
+      {"data", JSON::Object::Entries {
+        {"id", std::to_string(peerId)}
+      }}
+    };
+
+    cb(seq, json, Post {});
+  }
+
+  void Core::TCP::readStop (
+    const String seq,
+    uint64_t peerId,
+    Module::Callback cb
+  ) {
+    this->core->dispatchEventLoop([=, this] {
+      if (!this->core->hasPeer(peerId)) {
+        auto json = ERR_SOCKET_STREAM_NOT_RUNNING("tcp.readStop", peerId);
+        return cb(seq, json, Post{});
+      }
+
+      auto peer = this->core->getPeer(peerId);
+
+      if (peer->isClosed()) {
+        auto json = ERR_SOCKET_STREAM_CLOSED("tcp.readStop", peerId);
+        return cb(seq, json, Post{});
+      }
+
+      if (peer->isClosing()) {
+        auto json = ERR_SOCKET_STREAM_CLOSING("tcp.readStop", peerId);
+        return cb(seq, json, Post{});
+      }
+
+      if (!peer->hasState(PEER_STATE_TCP_READ_STARTED)) {
+        auto json = JSON::Object::Entries {
+          {"source", "tcp.readStop"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(peerId)},
+            {"message", "Socket is not receiving"}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
+      auto err = peer->readstop();
+
+      if (err < 0) {
+        auto json = JSON::Object::Entries {
+          {"source", "tcp.readStop"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(peerId)},
+            {"message", String(uv_strerror(err))}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
+      auto json = JSON::Object::Entries {
+        {"source", "tcp.readStop"},
+        {"data", JSON::Object::Entries {
+          {"id", std::to_string(peerId)}
+        }}
+      };
+
+      cb(seq, json, Post {});
+    });
+  }
+
+  void Core::TCP::send (
+    const String seq,
+    uint64_t peerId,
+    TCP::SendOptions options,
+    Module::Callback cb
+  ) {
+    this->core->dispatchEventLoop([=, this] {
+      if (!this->core->hasPeer(peerId)) {
+        auto json = ERR_SOCKET_STREAM_NOT_RUNNING("tcp.send", peerId);
+        return cb(seq, json, Post{});
+      }
+
+      auto peer = this->core->getPeer(peerId);
+      auto size = options.size;
+      auto bytes = options.bytes;
+
+      peer->write(bytes, size, [=](auto status, auto post) {
+        if (status < 0) {
+          auto json = JSON::Object::Entries {
+            {"source", "tcp.send"},
+            {"err", JSON::Object::Entries {
+              {"id", std::to_string(peerId)},
+              {"message", String(uv_strerror(status))}
+            }}
+          };
+
+          return cb(seq, json, Post{});
+        }
+
+        auto json = JSON::Object::Entries {
+          {"source", "tcp.send"},
+          {"data", JSON::Object::Entries {
+            {"id", std::to_string(peerId)},
+            {"status", status}
+          }}
+        };
+
+        cb(seq, json, Post{});
+      });
+    });
+  }
+
+  void Core::TCP::close (
+    const String seq,
+    uint64_t peerId,
+    Module::Callback cb
+  ) {
+    this->core->dispatchEventLoop([=, this]() {
+      if (!this->core->hasPeer(peerId)) {
+        auto json = ERR_SOCKET_STREAM_NOT_RUNNING("tcp.close", peerId);
+        return cb(seq, json, Post{});
+      }
+
+      auto peer = this->core->getPeer(peerId);
+
+      if (!peer->isTCP()) {
+        auto json = ERR_SOCKET_STREAM_NOT_RUNNING("tcp.close", peerId);
+        return cb(seq, json, Post{});
+      }
+
+      if (peer->isClosed()) {
+        auto json = ERR_SOCKET_STREAM_CLOSED("tcp.close", peerId);
+        return cb(seq, json, Post{});
+      }
+
+      if (peer->isClosing()) {
+        auto json = ERR_SOCKET_STREAM_CLOSING("tcp.close", peerId);
+        return cb(seq, json, Post{});
+      }
+
+      peer->close([=, this]() {
+        auto json = JSON::Object::Entries {
+          {"source", "tcp.close"},
+          {"data", JSON::Object::Entries {
+            {"id", std::to_string(peerId)}
+          }}
+        };
+
+        cb(seq, json, Post{});
+      });
+    });
+  }
+}
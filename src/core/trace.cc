@@ -0,0 +1,93 @@
+#include "trace.hh"
+
+#include <cstdio>
+
+#if defined(SSC_ENABLE_TRACING)
+namespace SSC::Trace {
+  // ring buffer capacity - a power of two so slot reservation is a mask
+  static constexpr size_t CAPACITY = 16384;
+
+  static Array<Event, CAPACITY> events;
+  static std::atomic<uint64_t> head = 0;
+
+  uint64_t now () {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()
+    ).count();
+  }
+
+  void emit (
+    const char* category,
+    const char* name,
+    char phase,
+    uint64_t timestamp,
+    uint64_t duration
+  ) {
+    // slot reservation is a single relaxed increment so instrumented hot
+    // paths never serialize on the buffer - a snapshot taken while a
+    // writer is mid-slot may render one torn event, which is acceptable
+    // for a diagnostics stream
+    const auto slot = head.fetch_add(1, std::memory_order_relaxed) & (CAPACITY - 1);
+    auto& event = events[slot];
+
+    event.category = category;
+    event.name = name;
+    event.timestamp = timestamp;
+    event.duration = duration;
+    event.thread = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    event.phase = phase;
+  }
+
+  void clear () {
+    for (auto& event : events) {
+      event.name = nullptr;
+    }
+
+    head.store(0, std::memory_order_relaxed);
+  }
+
+  String snapshot () {
+    const auto recorded = head.load(std::memory_order_relaxed);
+    const auto count = recorded < CAPACITY ? recorded : CAPACITY;
+    // when the buffer has wrapped the oldest surviving event lives at
+    // the reservation cursor, otherwise at the start of the storage
+    const auto start = recorded < CAPACITY ? uint64_t(0) : recorded;
+
+    String output;
+    output.reserve(count * 128 + 32);
+    output += "{\"traceEvents\":[";
+
+    auto emitted = size_t(0);
+
+    for (uint64_t i = 0; i < count; ++i) {
+      const auto& event = events[(start + i) & (CAPACITY - 1)];
+
+      if (event.name == nullptr || event.category == nullptr) {
+        continue;
+      }
+
+      char entry[256];
+      snprintf(
+        entry,
+        sizeof(entry),
+        "%s{\"ph\":\"%c\",\"cat\":\"%s\",\"name\":\"%s\","
+        "\"ts\":%llu,\"dur\":%llu,\"pid\":1,\"tid\":%llu%s}",
+        emitted > 0 ? "," : "",
+        event.phase,
+        event.category,
+        event.name,
+        (unsigned long long) event.timestamp,
+        (unsigned long long) event.duration,
+        (unsigned long long) event.thread,
+        event.phase == 'i' ? ",\"s\":\"t\"" : ""
+      );
+
+      output += entry;
+      emitted++;
+    }
+
+    output += "]}";
+    return output;
+  }
+}
+#endif
@@ -0,0 +1,104 @@
+#ifndef SSC_CORE_TRACE_H
+#define SSC_CORE_TRACE_H
+
+#include "types.hh"
+
+/**
+ * Compile-time opt-in trace-event instrumentation for the message
+ * lifecycle. Built with `-DSSC_ENABLE_TRACING` (exported by
+ * `bin/cflags.sh` when `SSC_ENABLE_TRACING` is set in the environment)
+ * the instrumented stages record spans into a fixed-size in-memory ring
+ * buffer; without the flag every call site compiles away to nothing.
+ *
+ * The buffer renders as chrome://tracing "traceEvents" JSON and is
+ * dumped over the bridge with the `diagnostics.trace` route, so a slow
+ * IPC call can be attributed to webview transport, router dispatch,
+ * event loop queueing, the uv threadpool, or reply serialization by
+ * loading the dump into `chrome://tracing` or Perfetto.
+ */
+namespace SSC::Trace {
+#if defined(SSC_ENABLE_TRACING)
+  /**
+   * One recorded event. `category` and `name` must point at string
+   * literals - only the pointers are stored.
+   */
+  struct Event {
+    const char* category = nullptr;
+    const char* name = nullptr;
+    uint64_t timestamp = 0; // microseconds, monotonic
+    uint64_t duration = 0; // microseconds - `0` for instants
+    uint64_t thread = 0;
+    char phase = 'X';
+  };
+
+  /**
+   * Microseconds on the monotonic clock all events are stamped with.
+   */
+  uint64_t now ();
+
+  /**
+   * Records an event into the global ring buffer, overwriting the
+   * oldest event when full.
+   */
+  void emit (
+    const char* category,
+    const char* name,
+    char phase,
+    uint64_t timestamp,
+    uint64_t duration
+  );
+
+  /**
+   * Drops all recorded events.
+   */
+  void clear ();
+
+  /**
+   * Renders the buffered events, oldest first, as a chrome://tracing
+   * `{"traceEvents": [...]}` JSON document.
+   */
+  String snapshot ();
+
+  /**
+   * Records a complete (`'X'`) event covering its lexical scope.
+   */
+  struct Span {
+    const char* category;
+    const char* name;
+    uint64_t started;
+
+    Span (const char* category, const char* name)
+      : category(category),
+        name(name),
+        started(now())
+    {}
+
+    ~Span () {
+      emit(this->category, this->name, 'X', this->started, now() - this->started);
+    }
+  };
+#else
+  // no-op shells so call sites (including `Span` members) compile
+  // without `#if` guards in untraced builds
+  struct Span {
+    Span (const char*, const char*) {}
+  };
+
+  inline void clear () {}
+  inline String snapshot () { return "{\"traceEvents\":[]}"; }
+#endif
+}
+
+#if defined(SSC_ENABLE_TRACING)
+#define SSC_TRACE_SPAN_NAME_(prefix, line) prefix##line
+#define SSC_TRACE_SPAN_NAME(prefix, line) SSC_TRACE_SPAN_NAME_(prefix, line)
+#define SSC_TRACE_SPAN(category, name)                                         \
+  SSC::Trace::Span SSC_TRACE_SPAN_NAME(_sscTraceSpan, __LINE__)(category, name)
+#define SSC_TRACE_INSTANT(category, name)                                      \
+  SSC::Trace::emit(category, name, 'i', SSC::Trace::now(), 0)
+#else
+#define SSC_TRACE_SPAN(category, name)
+#define SSC_TRACE_INSTANT(category, name)
+#endif
+
+#endif
@@ -3,14 +3,22 @@
 
 #include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
 #include <functional>
+#include <list>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #if defined(__APPLE__)
@@ -22,6 +30,7 @@ namespace SSC {
 
   using AtomicBool = std::atomic<bool>;
   using String = std::string;
+  using StringView = std::string_view;
   using StringStream = std::stringstream;
   using WString = std::wstring;
   using WStringStream = std::wstringstream;
@@ -34,6 +43,7 @@ namespace SSC {
 
   template <typename T> using Atomic = std::atomic<T>;
   template <typename T, int k> using Array = std::array<T, k>;
+  template <typename T> using Deque = std::deque<T>;
   template <typename T> using Queue = std::queue<T>;
   template <typename T> using Vector = std::vector<T>;
 
@@ -97,7 +97,7 @@ namespace SSC {
     UDP::BindOptions options,
     Module::Callback cb
   ) {
-    this->core->dispatchEventLoop([=, this]() {
+    this->core->dispatchEventLoop(peerId, [=, this]() {
       if (this->core->hasPeer(peerId)) {
         if (this->core->getPeer(peerId)->isBound()) {
           auto json = ERR_SOCKET_ALREADY_BOUND("udp.bind", peerId);
@@ -106,6 +106,7 @@ namespace SSC {
       }
 
       auto peer = this->core->createPeer(PEER_TYPE_UDP, peerId);
+      peer->setKeepAlive(options.keepAlive);
       auto err = peer->bind(options.address, options.port, options.reuseAddr);
 
       if (err < 0) {
@@ -155,7 +156,7 @@ namespace SSC {
     UDP::ConnectOptions options,
     Module::Callback cb
   ) {
-    this->core->dispatchEventLoop([=, this]() {
+    this->core->dispatchEventLoop(peerId, [=, this]() {
       auto peer = this->core->createPeer(PEER_TYPE_UDP, peerId);
 
       if (peer->isConnected()) {
@@ -210,7 +211,7 @@ namespace SSC {
     uint64_t peerId,
     Module::Callback cb
   ) {
-    this->core->dispatchEventLoop([=, this]() {
+    this->core->dispatchEventLoop(peerId, [=, this]() {
       if (!this->core->hasPeer(peerId)) {
         auto json = ERR_SOCKET_DGRAM_NOT_CONNECTED("udp.disconnect", peerId);
         return cb(seq, json, Post{});
@@ -337,26 +338,237 @@ namespace SSC {
         {"closed", peer->isClosed()},
         {"closing", peer->isClosing()},
         {"connected", peer->isConnected()},
-        {"ephemeral", peer->isEphemeral()}
+        {"ephemeral", peer->isEphemeral()},
+        {"keepalive", peer->isKeepAlive()},
+        {"queue", JSON::Object::Entries {
+          {"depth", std::to_string(peer->outboundDepth)},
+          {"queued", std::to_string(peer->outbound.size())},
+          {"inflight", std::to_string(peer->outboundInflight)},
+          {"dropped", std::to_string(peer->outboundDropped)},
+          {"coalesced", std::to_string(peer->outboundCoalesced)},
+          {"policy", peer->outboundDropNewest ? "drop-newest" : "drop-oldest"}
+        }}
       }}
     };
 
     cb(seq, json, Post{});
   }
 
+  void Core::UDP::joinGroup (
+    const String seq,
+    uint64_t peerId,
+    UDP::MembershipOptions options,
+    Module::Callback cb
+  ) {
+    this->core->dispatchEventLoop(peerId, [=, this]() {
+      if (!this->core->hasPeer(peerId)) {
+        auto json = ERR_SOCKET_DGRAM_NOT_RUNNING("udp.joinGroup", peerId);
+        return cb(seq, json, Post{});
+      }
+
+      auto peer = this->core->getPeer(peerId);
+      auto err = peer->setMembership(
+        options.group,
+        options.iface,
+        options.source,
+        UV_JOIN_GROUP
+      );
+
+      if (err < 0) {
+        auto json = JSON::Object::Entries {
+          {"source", "udp.joinGroup"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(peerId)},
+            {"message", String(uv_strerror(err))}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
+      auto json = JSON::Object::Entries {
+        {"source", "udp.joinGroup"},
+        {"data", JSON::Object::Entries {
+          {"id", std::to_string(peerId)},
+          {"group", options.group},
+          {"iface", options.iface},
+          {"source", options.source}
+        }}
+      };
+
+      cb(seq, json, Post{});
+    });
+  }
+
+  void Core::UDP::leaveGroup (
+    const String seq,
+    uint64_t peerId,
+    UDP::MembershipOptions options,
+    Module::Callback cb
+  ) {
+    this->core->dispatchEventLoop(peerId, [=, this]() {
+      if (!this->core->hasPeer(peerId)) {
+        auto json = ERR_SOCKET_DGRAM_NOT_RUNNING("udp.leaveGroup", peerId);
+        return cb(seq, json, Post{});
+      }
+
+      auto peer = this->core->getPeer(peerId);
+      auto err = peer->setMembership(
+        options.group,
+        options.iface,
+        options.source,
+        UV_LEAVE_GROUP
+      );
+
+      if (err < 0) {
+        auto json = JSON::Object::Entries {
+          {"source", "udp.leaveGroup"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(peerId)},
+            {"message", String(uv_strerror(err))}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
+      auto json = JSON::Object::Entries {
+        {"source", "udp.leaveGroup"},
+        {"data", JSON::Object::Entries {
+          {"id", std::to_string(peerId)},
+          {"group", options.group},
+          {"iface", options.iface},
+          {"source", options.source}
+        }}
+      };
+
+      cb(seq, json, Post{});
+    });
+  }
+
+  void Core::UDP::setMulticastInterface (
+    const String seq,
+    uint64_t peerId,
+    UDP::MulticastOptions options,
+    Module::Callback cb
+  ) {
+    this->core->dispatchEventLoop(peerId, [=, this]() {
+      if (!this->core->hasPeer(peerId)) {
+        auto json = ERR_SOCKET_DGRAM_NOT_RUNNING("udp.setMulticastInterface", peerId);
+        return cb(seq, json, Post{});
+      }
+
+      auto peer = this->core->getPeer(peerId);
+      int err = 0;
+
+      if (options.iface.size() > 0) {
+        err = peer->setMulticastInterface(options.iface);
+      }
+
+      if (err == 0 && options.ttl >= 0) {
+        err = peer->setMulticastTTL(options.ttl);
+      }
+
+      if (err == 0 && options.loopback >= 0) {
+        err = peer->setMulticastLoopback(options.loopback > 0);
+      }
+
+      if (err < 0) {
+        auto json = JSON::Object::Entries {
+          {"source", "udp.setMulticastInterface"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(peerId)},
+            {"message", String(uv_strerror(err))}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
+      auto json = JSON::Object::Entries {
+        {"source", "udp.setMulticastInterface"},
+        {"data", JSON::Object::Entries {
+          {"id", std::to_string(peerId)},
+          {"iface", options.iface},
+          {"ttl", options.ttl},
+          {"loopback", options.loopback}
+        }}
+      };
+
+      cb(seq, json, Post{});
+    });
+  }
+
+  void Core::UDP::configureQueue (
+    const String seq,
+    uint64_t peerId,
+    UDP::QueueOptions options,
+    Module::Callback cb
+  ) {
+    this->core->dispatchEventLoop(peerId, [=, this]() {
+      auto peer = this->core->createPeer(PEER_TYPE_UDP, peerId);
+
+      peer->configureQueue(options.depth, options.dropNewest);
+
+      auto json = JSON::Object::Entries {
+        {"source", "udp.configureQueue"},
+        {"data", JSON::Object::Entries {
+          {"id", std::to_string(peerId)},
+          {"depth", std::to_string(options.depth)},
+          {"policy", options.dropNewest ? "drop-newest" : "drop-oldest"}
+        }}
+      };
+
+      cb(seq, json, Post{});
+    });
+  }
+
   void Core::UDP::send (
     String seq,
     uint64_t peerId,
     UDP::SendOptions options,
     Module::Callback cb
   ) {
-    this->core->dispatchEventLoop([=, this] {
+    this->core->dispatchEventLoop(peerId, [=, this] {
+      // an aborted request never reaches the socket — the datagram would
+      // be sent on behalf of a requester that is already gone
+      if (options.cancellation != nullptr && options.cancellation->isCancelled()) {
+        auto json = JSON::Object::Entries {
+          {"source", "udp.send"},
+          {"err", JSON::Object::Entries {
+            {"id", std::to_string(peerId)},
+            {"code", UV_ECANCELED},
+            {"type", "AbortError"},
+            {"message", String(uv_strerror(UV_ECANCELED))}
+          }}
+        };
+
+        return cb(seq, json, Post{});
+      }
+
       auto peer = this->core->createPeer(PEER_TYPE_UDP, peerId, options.ephemeral);
       auto size = options.size; // @TODO(jwerle): validate MTU
       auto port = options.port;
       auto bytes = options.bytes;
       auto address = options.address;
-      peer->send(bytes, size, port, address, [=](auto status, auto post) {
+      auto segmentSize = options.segmentSize;
+      peer->send(bytes, size, port, address, segmentSize, [=](auto status, auto post) {
+        // skip serializing the completion for a requester that aborted
+        // while the send was in flight
+        if (options.cancellation != nullptr && options.cancellation->isCancelled()) {
+          auto json = JSON::Object::Entries {
+            {"source", "udp.send"},
+            {"err", JSON::Object::Entries {
+              {"id", std::to_string(peerId)},
+              {"code", UV_ECANCELED},
+              {"type", "AbortError"},
+              {"message", String(uv_strerror(UV_ECANCELED))}
+            }}
+          };
+
+          return cb(seq, json, Post{});
+        }
+
         if (status < 0) {
           auto json = JSON::Object::Entries {
             {"source", "udp.send"},
@@ -382,7 +594,66 @@ namespace SSC {
     });
   }
 
+  // number of bytes a batched receive packs into one pooled buffer before
+  // it is flushed to the webview - a single datagram can still be larger,
+  // in which case the buffer is sized to fit it
+  static constexpr size_t UDP_RECEIVE_BATCH_SIZE = 64 * 1024;
+
+  // accumulates datagrams drained from the socket during one event loop
+  // iteration so they can be delivered in a single post with an offset
+  // table instead of one emit per packet
+  struct ReceiveBatch {
+    Post::Body buffer = nullptr;
+    size_t size = 0; // pooled buffer capacity
+    size_t offset = 0; // bytes packed so far
+    JSON::Array::Entries packets; // offset table
+    bool scheduled = false;
+  };
+
+  static void flushReceiveBatch (
+    std::shared_ptr<ReceiveBatch> batch,
+    uint64_t peerId,
+    Core::Module::Callback cb
+  ) {
+    if (batch->packets.size() == 0) {
+      return;
+    }
+
+    Post post;
+
+    post.id = rand64();
+    post.body = batch->buffer;
+    post.length = (int) batch->offset;
+    post.headers = Headers::forPostBody(batch->offset);
+
+    auto json = JSON::Object::Entries {
+      {"source", "udp.readStart"},
+      {"data", JSON::Object::Entries {
+        {"id", std::to_string(peerId)},
+        {"bytes", std::to_string(batch->offset)},
+        {"count", (int) batch->packets.size()},
+        {"packets", batch->packets}
+      }}
+    };
+
+    batch->buffer = nullptr;
+    batch->size = 0;
+    batch->offset = 0;
+    batch->packets.clear();
+
+    cb("-1", json, post);
+  }
+
   void Core::UDP::readStart (String seq, uint64_t peerId, Module::Callback cb) {
+    return this->readStart(seq, peerId, false, cb);
+  }
+
+  void Core::UDP::readStart (
+    String seq,
+    uint64_t peerId,
+    bool batched,
+    Module::Callback cb
+  ) {
     if (!this->core->hasPeer(peerId)) {
       auto json = ERR_SOCKET_DGRAM_NOT_RUNNING("udp.readStart", peerId);
       return cb(seq, json, Post{});
@@ -423,8 +694,20 @@ namespace SSC {
       return cb(seq, json, Post{});
     }
 
-    auto err = peer->recvstart([=](auto nread, auto buf, auto addr) {
+    auto batch = std::make_shared<ReceiveBatch>();
+    auto err = peer->recvstart([=, this](auto nread, auto buf, auto addr) {
+      // take ownership of the receive buffer up front so it is
+      // recycled into the pool on every path, including errors
+      auto body = buf->base != nullptr
+        ? BufferPool::instance()->adopt(buf->base, buf->len)
+        : Post::Body(nullptr);
+
       if (nread == UV_EOF) {
+        // deliver anything still packed before signalling EOF
+        if (batched) {
+          flushReceiveBatch(batch, peerId, cb);
+        }
+
         auto json = JSON::Object::Entries {
           {"source", "udp.readStart"},
           {"data", JSON::Object::Entries {
@@ -436,20 +719,52 @@ namespace SSC {
         cb("-1", json, Post{});
       } else if (nread > 0) {
         char address[17] = {0};
-        Post post;
         int port;
 
         parseAddress((struct sockaddr *) addr, &port, address);
 
-        auto headers = Headers {{
-          {"content-type" ,"application/octet-stream"},
-          {"content-length", nread}
-        }};
+        if (batched) {
+          // flush early when the datagram does not fit into what is left
+          if (batch->buffer != nullptr && batch->offset + nread > batch->size) {
+            flushReceiveBatch(batch, peerId, cb);
+          }
+
+          if (batch->buffer == nullptr) {
+            batch->size = std::max(UDP_RECEIVE_BATCH_SIZE, (size_t) nread);
+            batch->buffer = BufferPool::instance()->acquire(batch->size);
+          }
+
+          memcpy(batch->buffer.get() + batch->offset, body.get(), nread);
+
+          batch->packets.push_back(JSON::Object::Entries {
+            {"offset", std::to_string(batch->offset)},
+            {"bytes", std::to_string(nread)},
+            {"port", port},
+            {"address", address}
+          });
+
+          batch->offset += (size_t) nread;
+
+          // everything drained during this loop iteration goes out in
+          // one post with an offset table once control returns to the
+          // dispatch queue
+          if (!batch->scheduled) {
+            batch->scheduled = true;
+            this->core->dispatchEventLoop(peerId, [=]() {
+              batch->scheduled = false;
+              flushReceiveBatch(batch, peerId, cb);
+            });
+          }
+
+          return;
+        }
+
+        Post post;
 
         post.id = rand64();
-        post.body = buf->base;
+        post.body = body;
         post.length = (int) nread;
-        post.headers = headers.str();
+        post.headers = Headers::forPostBody(nread);
 
         auto json = JSON::Object::Entries {
           {"source", "udp.readStart"},
@@ -494,7 +809,7 @@ namespace SSC {
     uint64_t peerId,
     Module::Callback cb
   ) {
-    this->core->dispatchEventLoop([=, this] {
+    this->core->dispatchEventLoop(peerId, [=, this] {
       if (!this->core->hasPeer(peerId)) {
         auto json = ERR_SOCKET_DGRAM_NOT_RUNNING("udp.readStop", peerId);
         return cb(seq, json, Post{});
@@ -554,7 +869,7 @@ namespace SSC {
     uint64_t peerId,
     Module::Callback cb
   ) {
-    this->core->dispatchEventLoop([=, this]() {
+    this->core->dispatchEventLoop(peerId, [=, this]() {
       if (!this->core->hasPeer(peerId)) {
         auto json = ERR_SOCKET_DGRAM_NOT_RUNNING("udp.close", peerId);
         return cb(seq, json, Post{});
@@ -702,12 +702,7 @@ MAIN {
             window->eval(script);
           }
         } else {
-          for (auto w : windowManager.windows) {
-            if (w != nullptr) {
-              auto window = windowManager.getWindow(w->opts.index);
-              window->eval(script);
-            }
-          }
+          windowManager.broadcast(message.get("event"), value);
         }
         return;
       }
@@ -763,12 +758,7 @@ MAIN {
     onStdOut,
     onStdErr,
     [&](SSC::String const &code) {
-      for (auto w : windowManager.windows) {
-        if (w != nullptr) {
-          auto window = windowManager.getWindow(w->opts.index);
-          window->eval(getEmitToRenderProcessJavaScript("backend-exit", code));
-        }
-      }
+      windowManager.broadcast("backend-exit", code);
     }
   );
 
@@ -989,6 +979,14 @@ MAIN {
         OK_STATE,
         result.json()
       );
+
+      // re-arm the warm-window pool off the critical path of this call
+      if (app.appData["window_prewarm"] == "true") {
+        app.dispatch([&]() {
+          windowManager.prewarmWindow();
+        });
+      }
+
       return;
     }
 
@@ -1455,6 +1453,15 @@ MAIN {
     }
   }
 
+  // opt-in ([window] prewarm = true): pre-initialize a hidden window
+  // after the default window is up so the first `window.create` hands
+  // out a ready webview instead of paying webview spawn on demand
+  if (app.appData["window_prewarm"] == "true") {
+    app.dispatch([&]() {
+      windowManager.prewarmWindow();
+    });
+  }
+
   //
   // If this is being run in a terminal/multiplexer
   //
@@ -18,6 +18,14 @@ sapi_context_t* sapi_context_create (
     context->retain();
   }
 
+  if (retained && parent != nullptr) {
+    // a retained child context is call-scoped: its retain count already
+    // bounds the lifetime of every allocation made through it, so back
+    // it with a pooled bump arena - the whole call's allocations become
+    // one arena acquire here and one release with the context
+    context->memory.arena = SSC::Extension::Context::Memory::acquireArena();
+  }
+
   return context;
 }
 
@@ -50,6 +58,93 @@ bool sapi_context_dispatch (
   });
 }
 
+bool sapi_context_dispatch_background (
+  sapi_context_t* ctx,
+  const void* data,
+  sapi_context_dispatch_callback callback,
+  sapi_context_dispatch_callback completion
+) {
+  if (ctx == nullptr || callback == nullptr) return false;
+  if (ctx->router == nullptr) return false;
+  if (ctx->router->bridge == nullptr) return false;
+  if (ctx->router->bridge->core == nullptr) return false;
+
+  if (!ctx->isAllowed("context_dispatch")) {
+    sapi_debug(ctx, "'context_dispatch' is not allowed.");
+    return false;
+  }
+
+  auto core = ctx->router->bridge->core;
+
+  core->dispatchLongRunningWorkerPool([=]() {
+    callback(ctx, data);
+
+    if (completion != nullptr) {
+      ctx->router->dispatch([=]() {
+        completion(ctx, data);
+      });
+    }
+  });
+
+  return true;
+}
+
+uint64_t sapi_context_set_timeout (
+  sapi_context_t* ctx,
+  const void* data,
+  uint64_t timeout,
+  sapi_context_timer_callback callback
+) {
+  if (ctx == nullptr || callback == nullptr) return 0;
+  if (ctx->router == nullptr) return 0;
+  if (ctx->router->bridge == nullptr) return 0;
+  if (ctx->router->bridge->core == nullptr) return 0;
+
+  if (!ctx->isAllowed("context_timers")) {
+    sapi_debug(ctx, "'context_timers' is not allowed.");
+    return 0;
+  }
+
+  return ctx->router->bridge->core->setTimeout(timeout, [=]() {
+    callback(ctx, data);
+  });
+}
+
+uint64_t sapi_context_set_interval (
+  sapi_context_t* ctx,
+  const void* data,
+  uint64_t interval,
+  sapi_context_timer_callback callback
+) {
+  if (ctx == nullptr || callback == nullptr) return 0;
+  if (ctx->router == nullptr) return 0;
+  if (ctx->router->bridge == nullptr) return 0;
+  if (ctx->router->bridge->core == nullptr) return 0;
+
+  if (!ctx->isAllowed("context_timers")) {
+    sapi_debug(ctx, "'context_timers' is not allowed.");
+    return 0;
+  }
+
+  return ctx->router->bridge->core->setInterval(interval, [=]() {
+    callback(ctx, data);
+  });
+}
+
+bool sapi_context_clear_timer (sapi_context_t* ctx, uint64_t id) {
+  if (ctx == nullptr) return false;
+  if (ctx->router == nullptr) return false;
+  if (ctx->router->bridge == nullptr) return false;
+  if (ctx->router->bridge->core == nullptr) return false;
+
+  if (!ctx->isAllowed("context_timers")) {
+    sapi_debug(ctx, "'context_timers' is not allowed.");
+    return false;
+  }
+
+  return ctx->router->bridge->core->clearTimer(id);
+}
+
 void sapi_context_retain (sapi_context_t* ctx) {
   if (ctx == nullptr) return;
   if (!ctx->isAllowed("context_retain")) {
@@ -5,6 +5,37 @@ namespace SSC {
   static Vector<String> initializedExtensions;
   static Mutex mutex;
 
+  // statically linked extensions self-register from image constructors,
+  // which run before any dynamic initialization in this translation
+  // unit - so the registry is zero-initialized PODs, never a container
+  static constexpr size_t MAX_STATIC_EXTENSIONS = 256;
+  static const sapi_extension_registration_t* staticRegistrations[MAX_STATIC_EXTENSIONS];
+  static std::atomic<size_t> staticRegistrationCount = 0;
+
+  static const sapi_extension_registration_t* getStaticRegistration (
+    const String& name
+  ) {
+    const auto count = std::min(
+      staticRegistrationCount.load(std::memory_order_acquire),
+      MAX_STATIC_EXTENSIONS
+    );
+
+    for (size_t i = 0; i < count; ++i) {
+      const auto registration = staticRegistrations[i];
+      if (registration != nullptr && name == registration->name) {
+        return registration;
+      }
+    }
+
+    return nullptr;
+  }
+
+  // bounded pool of bump arenas handed to call-scoped contexts -
+  // rewound and reused across routed calls instead of reallocated
+  static constexpr size_t maxPooledArenas = 16;
+  static Vector<std::shared_ptr<Extension::Context::Memory::Arena>> arenaPool;
+  static Mutex arenaPoolMutex;
+
   static String getcwd () {
     String cwd;
   #if defined(__linux__) && !defined(__ANDROID__)
@@ -96,6 +127,9 @@ namespace SSC {
     sapi_ipc_message_t
   );
 
+  template sapi_ipc_message_t**
+  SSC::Extension::Context::Memory::alloc<sapi_ipc_message_t*> (size_t);
+
   Extension::Context::Context (const Extension* extension) {
     this->extension = extension;
     this->router = extension->context.router;
@@ -207,6 +241,19 @@ namespace SSC {
     this->release();
   }
 
+  std::shared_ptr<Extension::Context::Memory::Arena>
+  Extension::Context::Memory::acquireArena () {
+    Lock lock(arenaPoolMutex);
+
+    if (arenaPool.size() > 0) {
+      auto arena = std::move(arenaPool.back());
+      arenaPool.pop_back();
+      return arena;
+    }
+
+    return std::make_shared<Arena>();
+  }
+
   void Extension::Context::Memory::release () {
     Lock lock(this->mutex);
     if (this->pool.size() > 0) {
@@ -216,6 +263,19 @@ namespace SSC {
 
       this->pool.clear();
     }
+
+    if (this->arena != nullptr) {
+      // everything the arena backed was destroyed above - rewind it
+      // and hand it back for the next call
+      this->arena->offset = 0;
+
+      Lock poolLock(arenaPoolMutex);
+      if (arenaPool.size() < maxPooledArenas) {
+        arenaPool.push_back(std::move(this->arena));
+      }
+
+      this->arena = nullptr;
+    }
   }
 
   String Extension::getExtensionsDirectory (const String& name) {
@@ -333,12 +393,26 @@ namespace SSC {
   }
 
   bool Extension::load (const String& name) {
-    Lock lock(mutex);
-
+    SSC_TRACE_SPAN("launch", "Extension::load");
     static auto userConfig = SSC::getUserConfig();
     // check if extension is already known
     if (isLoaded(name)) return true;
 
+    // statically linked extensions registered from image constructors
+    // resolve by name first - no library to open, no handle to hold,
+    // and the ABI always matches because they compiled against this
+    // runtime's headers
+    if (const auto registration = getStaticRegistration(name)) {
+      Lock lock(mutex);
+
+      if (isLoaded(name)) {
+        return true;
+      }
+
+      debug("Registering statically linked extension: %s", registration->name);
+      return sapi_extension_register(registration);
+    }
+
     auto path = getExtensionsDirectory(name) + (name + RUNTIME_EXTENSION_FILE_EXT);
 
   #if defined(_WIN32)
@@ -347,10 +421,18 @@ namespace SSC {
     auto __sapi_extension_init = (sapi_extension_registration_entry) GetProcAddress(handle, "__sapi_extension_init");
     if (!__sapi_extension_init) return false;
   #else
+    // bind symbols lazily so loading an extension does not pay to
+    // relocate every function it exports up front - functions resolve
+    // on first call instead. `[build.extensions.resolve] strict = true`
+    // restores eager `RTLD_NOW` binding
+    const auto flags = userConfig["build_extensions_resolve_strict"] == "true"
+      ? RTLD_NOW | RTLD_LOCAL
+      : RTLD_LAZY | RTLD_LOCAL;
+
   #if defined(__ANDROID__)
-    auto handle = dlopen(String("libextension-" + name + RUNTIME_EXTENSION_FILE_EXT).c_str(), RTLD_NOW | RTLD_LOCAL);
+    auto handle = dlopen(String("libextension-" + name + RUNTIME_EXTENSION_FILE_EXT).c_str(), flags);
   #else
-    auto handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    auto handle = dlopen(path.c_str(), flags);
   #endif
 
     if (handle == nullptr) return false;
@@ -359,6 +441,22 @@ namespace SSC {
     if (!__sapi_extension_init) return false;
   #endif
 
+    // the library was opened and its entry point resolved outside the
+    // registry lock, so independent extensions can load in parallel -
+    // only registration below is serialized
+    Lock lock(mutex);
+
+    if (isLoaded(name)) {
+      // another thread finished loading this extension while we were
+      // resolving it - drop the duplicate handle reference
+    #if defined(_WIN32)
+      FreeLibrary(handle);
+    #else
+      dlclose(handle);
+    #endif
+      return true;
+    }
+
     if (__sapi_extension_init != nullptr) {
       sapi_extension_registration_t* registration = __sapi_extension_init();
       if (registration != nullptr) {
@@ -420,15 +518,18 @@ namespace SSC {
       return true;
     }
 
+    // statically linked extensions have no library handle to release
+    if (extension->handle != nullptr) {
   #if defined(_WIN32)
-    if (!FreeLibrary(reinterpret_cast<HMODULE>(extension->handle))) {
-      return false;
-    }
+      if (!FreeLibrary(reinterpret_cast<HMODULE>(extension->handle))) {
+        return false;
+      }
   #else
-    if (dlclose(extension->handle)) {
-      return false;
-    }
+      if (dlclose(extension->handle)) {
+        return false;
+      }
   #endif
+    }
 
     if (extensions.contains(name)) {
       extensions.erase(name);
@@ -540,6 +641,28 @@ bool sapi_extension_register (
   return false;
 }
 
+bool sapi_extension_register_static (
+  const sapi_extension_registration_t* registration
+) {
+  if (registration == nullptr || registration->name == nullptr) {
+    return false;
+  }
+
+  // no lock and no container here - image constructors may run before
+  // any dynamic initialization in this image
+  const auto index = SSC::staticRegistrationCount.fetch_add(
+    1,
+    std::memory_order_acq_rel
+  );
+
+  if (index >= SSC::MAX_STATIC_EXTENSIONS) {
+    return false;
+  }
+
+  SSC::staticRegistrations[index] = registration;
+  return true;
+}
+
 bool sapi_extension_is_allowed (sapi_context_t* context, const char *allowed) {
   if (context == nullptr) return false;
   if (allowed == nullptr) return false;
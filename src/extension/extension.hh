@@ -43,30 +43,100 @@ namespace SSC {
           {}
         };
 
+        // zero-size in unprofiled builds - counts live contexts for the
+        // `diagnostics.query` heap totals
+        [[no_unique_address]] Heap::Tracked<Heap::Tag::extensionContexts> tracked;
+
         struct Memory {
+          /**
+           * A bump arena backing the small allocations made through a
+           * call-scoped context. Arenas come from a bounded process-wide
+           * pool (see `acquireArena()`), so the hundreds of `sapi_json_*`
+           * and string allocations a routed extension call makes become
+           * one arena acquire up front and one release when the retained
+           * context is released. An exhausted arena falls back to the
+           * heap transparently.
+           */
+          struct Arena {
+            static constexpr size_t SIZE = 256 * 1024;
+
+            std::unique_ptr<unsigned char[]> bytes =
+              std::make_unique<unsigned char[]>(SIZE);
+            size_t offset = 0;
+
+            void* alloc (size_t size, size_t alignment) {
+              // align the absolute address, not just the offset - the
+              // backing bytes only carry default `new[]` alignment
+              const auto base = reinterpret_cast<uintptr_t>(this->bytes.get());
+              const auto aligned =
+                ((base + this->offset + alignment - 1) & ~(alignment - 1)) - base;
+
+              if (aligned + size > SIZE) {
+                return nullptr; // exhausted - callers fall back to the heap
+              }
+
+              this->offset = aligned + size;
+              return this->bytes.get() + aligned;
+            }
+          };
+
           std::vector<std::function<void()>> pool;
+          std::shared_ptr<Arena> arena = nullptr;
           Mutex mutex;
 
+          static std::shared_ptr<Arena> acquireArena ();
+
           ~Memory ();
           void release ();
           void push (std::function<void()> callback);
+
+          template <typename T, typename... Args> T* construct (Args... args) {
+            if (this->arena != nullptr) {
+              const auto slot = this->arena->alloc(sizeof(T), alignof(T));
+
+              if (slot != nullptr) {
+                auto memory = new (slot) T(args...);
+                // the arena owns the bytes - only the destructor runs
+                // at release
+                push([memory]() { memory->~T(); });
+                return memory;
+              }
+            }
+
+            auto memory = new T(args...);
+            push([memory]() { delete memory; });
+            return memory;
+          }
+
           template <typename T, typename C, typename... Args> T* alloc (
             C* ctx,
             Args... args
           ) {
-            auto memory = new T(args...);
+            auto memory = this->construct<T>(args...);
             memory->context = ctx;
-            push([memory]() { delete memory; });
             return memory;
           }
 
           template <typename T, typename... Args> T* alloc (Args... args) {
-            auto memory = new T(args...);
-            push([memory]() { delete memory; });
-            return memory;
+            return this->construct<T>(args...);
           }
 
           template <typename T> T* alloc (size_t size) {
+            if (
+              this->arena != nullptr &&
+              std::is_trivially_destructible<T>::value
+            ) {
+              const auto slot = this->arena->alloc(
+                size * sizeof(T),
+                alignof(T)
+              );
+
+              if (slot != nullptr) {
+                memset(slot, 0, size * sizeof(T));
+                return reinterpret_cast<T*>(slot);
+              }
+            }
+
             auto memory = new T[size]{0};
             push([memory]() { delete [] memory; });
             return memory;
@@ -24,19 +24,207 @@ bool sapi_ipc_router_map (
     auto router,
     auto reply
   ) mutable {
-    auto msg = SSC::IPC::Message(message);
-    auto context = sapi_context_create(ctx, true);
-    if (context == nullptr) {
-      return;
+    auto invoke = [ctx, data, callback, reply, router](
+      const SSC::IPC::Message& message
+    ) mutable {
+      auto msg = SSC::IPC::Message(message);
+      auto context = sapi_context_create(ctx, true);
+      if (context == nullptr) {
+        return;
+      }
+
+      context->data = data;
+      context->internal = new SSC::IPC::Router::ReplyCallback(reply);
+      callback(
+        context,
+        (sapi_ipc_message_t*) &msg,
+        reinterpret_cast<const sapi_ipc_router_t*>(&router)
+      );
+    };
+
+    // extension callbacks may block for as long as they like, so they
+    // run on the long-running worker pool instead of tying up the
+    // router's dispatch queue or the shared worker pool
+    if (router != nullptr && router->core != nullptr) {
+      auto msg = SSC::IPC::Message(message);
+      router->core->dispatchLongRunningWorkerPool([invoke, msg]() mutable {
+        invoke(msg);
+      });
+    } else {
+      invoke(message);
     }
+  });
 
-    context->data = data;
-    context->internal = new SSC::IPC::Router::ReplyCallback(reply);
-    callback(
-      context,
-      (sapi_ipc_message_t*) &msg,
-      reinterpret_cast<const sapi_ipc_router_t*>(&router)
-    );
+  return true;
+}
+
+bool sapi_ipc_router_map_batch (
+  sapi_context_t* ctx,
+  const char* name,
+  sapi_ipc_router_batch_message_callback_t callback,
+  const void* data
+) {
+  if (
+    ctx == nullptr ||
+    ctx->router == nullptr ||
+    ctx->state > SSC::Extension::Context::State::Init
+  ) {
+    return false;
+  }
+
+  if (!ctx->isAllowed("ipc_router_map")) {
+    sapi_debug(ctx, "'ipc_router_map' is not allowed.");
+    return false;
+  }
+
+  // per-route accumulator: the first message of a loop turn schedules a
+  // flush on the router's dispatch queue and every message arriving
+  // before the flush runs joins the batch, so high-rate routes pay one
+  // extension invocation and one context per turn instead of per message
+  struct Batch {
+    struct Entry {
+      SSC::IPC::Message message;
+      SSC::IPC::Router::ReplyCallback reply;
+    };
+
+    SSC::Mutex mutex;
+    SSC::Vector<Entry> entries;
+    bool scheduled = false;
+  };
+
+  // routes replies back to the right message: one reply callback is
+  // claimed per `sapi_ipc_reply()`, keyed by seq, popped in arrival
+  // order so fire-and-forget messages sharing seq "-1" each consume
+  // exactly one. `sapi_ipc_reply()` deletes `context->internal` after
+  // every reply, so the dispatcher re-arms the slot while replies
+  // remain outstanding
+  struct Dispatcher : std::enable_shared_from_this<Dispatcher> {
+    SSC::Mutex mutex;
+    std::map<SSC::String, SSC::Vector<SSC::IPC::Router::ReplyCallback>> replies;
+    size_t remaining = 0;
+    sapi_context_t* context = nullptr;
+
+    void arm () {
+      auto self = this->shared_from_this();
+      this->context->internal = new SSC::IPC::Router::ReplyCallback(
+        [self](const SSC::IPC::Result& result) {
+          self->dispatch(result);
+        }
+      );
+    }
+
+    void dispatch (const SSC::IPC::Result& result) {
+      SSC::IPC::Router::ReplyCallback reply = nullptr;
+
+      {
+        SSC::Lock lock(this->mutex);
+
+        if (this->remaining > 0 && --this->remaining > 0) {
+          this->arm();
+        }
+
+        auto entry = this->replies.find(result.seq);
+        if (entry != this->replies.end() && entry->second.size() > 0) {
+          reply = std::move(entry->second.front());
+          entry->second.erase(entry->second.begin());
+        }
+      }
+
+      if (reply != nullptr) {
+        reply(result);
+      }
+    }
+  };
+
+  auto batch = std::make_shared<Batch>();
+
+  ctx->router->map(name, [ctx, data, callback, batch](
+    auto& message,
+    auto router,
+    auto reply
+  ) mutable {
+    {
+      SSC::Lock lock(batch->mutex);
+      batch->entries.push_back(Batch::Entry {
+        SSC::IPC::Message(message),
+        reply
+      });
+
+      if (batch->scheduled) {
+        return;
+      }
+
+      batch->scheduled = true;
+    }
+
+    router->dispatch([ctx, data, callback, batch, router]() mutable {
+      auto flushed = SSC::Vector<Batch::Entry>();
+
+      {
+        SSC::Lock lock(batch->mutex);
+        flushed = std::move(batch->entries);
+        batch->entries.clear();
+        batch->scheduled = false;
+      }
+
+      if (flushed.size() == 0) {
+        return;
+      }
+
+      auto context = sapi_context_create(ctx, true);
+      if (context == nullptr) {
+        return;
+      }
+
+      context->data = data;
+
+      auto dispatcher = std::make_shared<Dispatcher>();
+      dispatcher->context = context;
+      dispatcher->remaining = flushed.size();
+
+      // messages and the array handed to the callback live in the batch
+      // context's arena and stay valid until the last reply releases it
+      auto messages = context->memory.alloc<sapi_ipc_message_t*>(
+        flushed.size()
+      );
+
+      for (size_t i = 0; i < flushed.size(); i++) {
+        messages[i] = context->memory.alloc<sapi_ipc_message_t>(
+          sapi_ipc_message_t { flushed[i].message }
+        );
+
+        dispatcher->replies[flushed[i].message.seq].push_back(
+          std::move(flushed[i].reply)
+        );
+
+        // each reply releases once - the last one tears down the
+        // context and returns its arena
+        if (i > 0) {
+          context->retain();
+        }
+      }
+
+      dispatcher->arm();
+
+      // assembling the batch stays on the dispatch queue so a whole loop
+      // turn's messages coalesce, but the extension callback itself may
+      // block and runs on the long-running worker pool
+      auto size = static_cast<unsigned int>(flushed.size());
+      auto invoke = [callback, context, messages, size, router]() mutable {
+        callback(
+          context,
+          messages,
+          size,
+          reinterpret_cast<const sapi_ipc_router_t*>(&router)
+        );
+      };
+
+      if (router != nullptr && router->core != nullptr) {
+        router->core->dispatchLongRunningWorkerPool(invoke);
+      } else {
+        invoke();
+      }
+    });
   });
 
   return true;
@@ -172,14 +360,33 @@ bool sapi_ipc_send_chunk (
         "IPC method '" + result->message.name + "' must be invoked with HTTP";
     return sapi_ipc_reply_with_error(result, error.c_str());
   }
+  auto stream = result->post.stream;
   auto send_chunk_ptr = result->post.chunk_stream;
-  if (send_chunk_ptr == nullptr) {
+  if (stream == nullptr && send_chunk_ptr == nullptr) {
     debug(
         "Cannot use 'sapi_ipc_send_chunk' before setting the \"Transfer-Encoding\""
         " header to \"chunked\"");
     return false;
   }
-  bool success = (*send_chunk_ptr)(chunk, chunk_size, finished);
+
+  bool success = false;
+  if (stream != nullptr) {
+    // copy into a pooled buffer so the chunk outlives this call — a
+    // `false` return means the stream is saturated (or cancelled) and
+    // the producer should pause until it drains
+    auto body = chunk_size > 0
+      ? SSC::BufferPool::instance()->acquire(chunk_size)
+      : SSC::Post::Body(nullptr);
+
+    if (body != nullptr) {
+      memcpy(body.get(), chunk, chunk_size);
+    }
+
+    success = stream->write(body, chunk_size, finished);
+  } else {
+    success = (*send_chunk_ptr)(chunk, chunk_size, finished);
+  }
+
   if (finished) {
     auto context = result->context;
     if (context->release()) {
@@ -234,12 +441,12 @@ bool sapi_ipc_send_bytes (
   auto post = SSC::Post {
     .id = 0,
     .ttl = 0,
-    .body = new char[size]{0},
+    .body = SSC::BufferPool::instance()->acquire(size),
     .length = size,
-    .headers = headers ? headers : ""
+    .headers = headers ? SSC::Headers(headers) : SSC::Headers {}
   };
 
-  memcpy(post.body, bytes, size);
+  memcpy(post.body.get(), bytes, size);
 
   if (message) {
     auto result = SSC::IPC::Result(
@@ -270,12 +477,12 @@ bool sapi_ipc_send_bytes_with_result (
   auto post = SSC::Post {
     .id = 0,
     .ttl = 0,
-    .body = new char[size]{0},
+    .body = SSC::BufferPool::instance()->acquire(size),
     .length = size,
-    .headers =headers ? headers : ""
+    .headers = headers ? SSC::Headers(headers) : SSC::Headers {}
   };
 
-  memcpy(post.body, bytes, size);
+  memcpy(post.body.get(), bytes, size);
 
   return ctx->router->send(result->seq, result->str(), post);
 }
@@ -457,7 +664,9 @@ const char* sapi_ipc_message_get (
   const sapi_ipc_message_t* message,
   const char* key
 ) {
-  if (!message || !key || !message->args.contains(key)) return nullptr;
+  if (!message || !key) return nullptr;
+  message->materializeArgs();
+  if (!message->args.contains(key)) return nullptr;
   auto& value = message->args.at(key);
   if (value.size() == 0) return nullptr;
   return value.c_str();
@@ -654,7 +863,31 @@ void sapi_ipc_result_set_bytes (
   if (result && size && bytes) {
     auto pointer = const_cast<char*>(reinterpret_cast<const char*>(bytes));
     result->post.length = size;
-    result->post.body = pointer;
+    // takes ownership of the caller allocated bytes
+    result->post.body = SSC::Post::Body(pointer, [](char* bytes) {
+      delete [] bytes;
+    });
+  }
+}
+
+void sapi_ipc_result_set_bytes_with_release (
+  sapi_ipc_result_t* result,
+  unsigned int size,
+  unsigned char* bytes,
+  sapi_ipc_result_bytes_release_t release,
+  void* data
+) {
+  if (result && size && bytes) {
+    auto pointer = reinterpret_cast<char*>(bytes);
+    result->post.length = size;
+    // the caller keeps ownership - the buffer is published as the post
+    // body directly and `release` fires once the response is consumed,
+    // so no copy is made on the way to the webview
+    result->post.body = SSC::Post::Body(pointer, [release, data](char* bytes) {
+      if (release != nullptr) {
+        release(reinterpret_cast<unsigned char*>(bytes), data);
+      }
+    });
   }
 }
 
@@ -662,7 +895,7 @@ unsigned char* sapi_ipc_result_get_bytes (
   const sapi_ipc_result_t* result
 ) {
   return result
-    ? reinterpret_cast<unsigned char*>(result->post.body)
+    ? reinterpret_cast<unsigned char*>(result->post.body.get())
     : nullptr;
 }
 
@@ -699,6 +932,9 @@ void sapi_ipc_result_set_header (
               [result](const char* chunk, size_t chunk_size, bool finished) {
                 return false;
               });
+      // buffered stream consumed incrementally by the scheme handler,
+      // with a high-water mark so a slow webview pauses the producer
+      result->post.stream = std::make_shared<SSC::PostChunkStream>();
     }
   #endif
   }
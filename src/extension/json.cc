@@ -137,9 +137,11 @@ sapi_json_any_t* sapi_json_object_get (
   const sapi_json_object_t* json,
   const char* key
 ) {
-  if (json->has(key)) {
-    auto pointer = json->data.at(key).pointer.get();
-    return reinterpret_cast<sapi_json_any_t*>(pointer);
+  for (const auto& tuple : json->data) {
+    if (tuple.first == key) {
+      auto pointer = tuple.second.pointer.get();
+      return reinterpret_cast<sapi_json_any_t*>(pointer);
+    }
   }
 
   return nullptr;
@@ -10,12 +10,28 @@ namespace SSC {
     return DEBUG == 1;
   }
 
-  const Map getUserConfig () {
+  const Map& getUserConfig () {
     #include "user-config-bytes.hh" // NOLINT
-    return INI::parse(std::string(
+  #if defined(SSC_CONFIG_TABLE)
+    // the CLI generates the parsed key/value table alongside the raw
+    // bytes, so the map is built directly without parsing any INI at
+    // startup - see `user-config-bytes.hh` generation in `cli.cc`
+    static const Map userConfig = [] {
+      Map map;
+      for (const auto& entry : __ssc_config_table) {
+        map.insert(map.end(), { entry[0], entry[1] });
+      }
+      return map;
+    }();
+  #else
+    // older generated headers only carry the raw bytes - parse them
+    // once and reuse the result for every caller
+    static const Map userConfig = INI::parse(std::string(
       (const char*) __ssc_config_bytes,
       sizeof(__ssc_config_bytes)
     ));
+  #endif
+    return userConfig;
   }
 
   const String getDevHost () {
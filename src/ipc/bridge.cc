@@ -5,6 +5,13 @@
 #include <UniformTypeIdentifiers/UniformTypeIdentifiers.h>
 #endif
 
+#if defined(__linux__) && !defined(__ANDROID__)
+#include <gio/gunixinputstream.h>
+#include <sys/socket.h>
+#include <condition_variable>
+#endif
+
+#include "../core/deflate.hh"
 #include "../extension/extension.hh"
 #include "../window/window.hh"
 #include "ipc.hh"
@@ -13,7 +20,7 @@
 #define IPC_BINARY_CONTENT_TYPE "application/octet-stream"
 #define IPC_JSON_CONTENT_TYPE "text/json"
 
-extern const SSC::Map SSC::getUserConfig ();
+extern const SSC::Map& SSC::getUserConfig ();
 extern bool SSC::isDebugEnabled ();
 
 using namespace SSC;
@@ -108,20 +115,84 @@ static String getcwd () {
 
 #define CLEANUP_AFTER_INVOKE_CALLBACK(router, message, result) {               \
   if (!router->hasMappedBuffer(message.index, message.seq)) {                  \
-    if (message.buffer.bytes != nullptr) {                                     \
+    if (message.buffer.shared == nullptr && message.buffer.bytes != nullptr) { \
       delete [] message.buffer.bytes;                                          \
       message.buffer.bytes = nullptr;                                          \
     }                                                                          \
   }                                                                            \
                                                                                \
-  if (!router->core->hasPostBody(result.post.body)) {                          \
-    if (result.post.body != nullptr) {                                         \
-      delete [] result.post.body;                                              \
-    }                                                                          \
-  }                                                                            \
 }
 
-static void initRouterTable (Router *router) {
+// assembles the route table without a live `Router` - mirrors the
+// `Router::map()` overloads (including the lowercase key transform) so
+// the built-in routes below can be collected once per process and then
+// shared immutably across router instances. the route callbacks are all
+// stateless and receive their `Router*` at dispatch time, which is what
+// makes the table instance-independent
+struct RouteTableBuilder {
+  Router::Table table;
+
+  void map (const String& name, Router::MessageCallback callback) {
+    this->map(name, true, callback);
+  }
+
+  void map (const String& name, bool async, Router::MessageCallback callback) {
+    String data = name;
+    // URI hostnames are not case sensitive. Convert to lowercase.
+    std::transform(data.begin(), data.end(), data.begin(),
+      [](unsigned char c) { return std::tolower(c); });
+    if (callback != nullptr) {
+      table.insert_or_assign(data, Router::MessageCallbackContext { async, callback });
+    }
+  }
+
+  // declares a route whose reply is immutable for the life of the
+  // process (constant tables, platform facts) - rendered once on first
+  // request and answered from cached bytes thereafter
+  void mapImmutable (const String& name, Router::MessageCallback callback) {
+    String data = name;
+    // URI hostnames are not case sensitive. Convert to lowercase.
+    std::transform(data.begin(), data.end(), data.begin(),
+      [](unsigned char c) { return std::tolower(c); });
+    if (callback != nullptr) {
+      table.insert_or_assign(data, Router::MessageCallbackContext {
+        false,
+        callback,
+        nullptr,
+        true
+      });
+    }
+  }
+
+  void map (
+    const String& name,
+    const MessageSchema& schema,
+    Router::MessageCallback callback
+  ) {
+    this->map(name, true, schema, callback);
+  }
+
+  void map (
+    const String& name,
+    bool async,
+    const MessageSchema& schema,
+    Router::MessageCallback callback
+  ) {
+    String data = name;
+    // URI hostnames are not case sensitive. Convert to lowercase.
+    std::transform(data.begin(), data.end(), data.begin(),
+      [](unsigned char c) { return std::tolower(c); });
+    if (callback != nullptr) {
+      table.insert_or_assign(data, Router::MessageCallbackContext {
+        async,
+        callback,
+        std::make_shared<MessageSchema>(schema)
+      });
+    }
+  }
+};
+
+static void initRouterTable (RouteTableBuilder *router) {
   static auto userConfig = SSC::getUserConfig();
 #if defined(__APPLE__)
   static auto bundleIdentifier = userConfig["meta_bundle_identifier"];
@@ -252,6 +323,35 @@ static void initRouterTable (Router *router) {
     reply(Result { message.seq, message });
   });
 
+  /**
+   * Returns a snapshot of the sampled runtime metrics: event loop lag,
+   * dispatch queue depth, posts/peers/descriptors table sizes, per-module
+   * call latency, and buffer pool allocation counters.
+   */
+  router->map("diagnostics.query", [](auto message, auto router, auto reply) {
+    router->core->diagnostics.query(
+      message.seq,
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
+  /**
+   * Dumps the in-memory trace-event ring buffer as chrome://tracing
+   * `traceEvents` JSON. Builds without `SSC_ENABLE_TRACING` reply with
+   * an empty trace.
+   * @param clear Drop the buffered events after dumping them [default = false]
+   */
+  router->map("diagnostics.trace", [](auto message, auto router, auto reply) {
+    auto result = Result { message.seq, message };
+    result.data = JSON::Raw(Trace::snapshot());
+
+    if (message.get("clear") == "true") {
+      Trace::clear();
+    }
+
+    reply(result);
+  });
+
   /**
    * Look up an IP address by `hostname`.
    * @param hostname Host name to lookup
@@ -275,6 +375,30 @@ static void initRouterTable (Router *router) {
     );
   });
 
+  /**
+   * Warms the DNS cache for `hostname` so later lookups answer from the
+   * cache without touching the resolver.
+   * @param hostname Host name to prefetch
+   * @param family IP address family to resolve [default = 0 (AF_UNSPEC)]
+   * @see getaddrinfo(3)
+   */
+  router->map("dns.prefetch", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"hostname"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    int family = 0;
+    REQUIRE_AND_GET_MESSAGE_VALUE(family, "family", std::stoi, "0");
+
+    router->core->dns.prefetch(
+      message.seq,
+      Core::DNS::LookupOptions { message.get("hostname"), family },
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
   router->map("extension.stats", [](auto message, auto router, auto reply) {
     auto extensions = Extension::all();
     auto name = message.get("name");
@@ -510,7 +634,7 @@ static void initRouterTable (Router *router) {
   /**
    * Returns a mapping of file system constants.
    */
-  router->map("fs.constants", [](auto message, auto router, auto reply) {
+  router->mapImmutable("fs.constants", [](auto message, auto router, auto reply) {
     router->core->fs.constants(message.seq, RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply));
   });
 
@@ -599,6 +723,28 @@ static void initRouterTable (Router *router) {
    * @param id
    * @see close(2)
    */
+  /**
+   * Hashes the file at `path` natively - or, for a directory, every
+   * regular file under it across parallel worker threads - and replies
+   * with the digests in one JSON result.
+   * @param path
+   * @param algorithm (optional) "crc32c" or "sha256" (default)
+   */
+  router->map("fs.checksum", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"path"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    router->core->fs.checksum(
+      message.seq,
+      message.get("path"),
+      message.get("algorithm", "sha256"),
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
   router->map("fs.close", [](auto message, auto router, auto reply) {
     auto err = validateMessageParameters(message, {"id"});
 
@@ -694,6 +840,35 @@ static void initRouterTable (Router *router) {
     );
   });
 
+  /**
+   * Copy file at path `src` to path `dest` entirely inside the kernel —
+   * a filesystem clone when supported, chunked sendfile otherwise — with
+   * progress delivered as server sent events on the reply stream.
+   * @param src
+   * @param dest
+   * @param flags
+   * @see copy_file_range(2)
+   * @see clonefile(2)
+   */
+  router->map("fs.copy", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"src", "dest", "flags"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    int flags = 0;
+    REQUIRE_AND_GET_MESSAGE_VALUE(flags, "flags", std::stoi);
+
+    router->core->fs.copy(
+      message.seq,
+      message.get("src"),
+      message.get("dest"),
+      flags,
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
 	/**
    * Creates a link at `dest`
    * @param src
@@ -782,6 +957,72 @@ static void initRouterTable (Router *router) {
     );
   });
 
+  /**
+   * Flushes a descriptor's write coalescer, submitting any buffered
+   * sequential writes without waiting for the size or time threshold.
+   * @param id
+   */
+  router->map("fs.flush", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"id"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    uint64_t id;
+    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
+
+    router->core->fs.flush(
+      message.seq,
+      id,
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
+  /**
+   * Synchronizes several open descriptors with one fan-out: the syncs
+   * run in parallel on the threadpool and a single reply fires when the
+   * last one lands — a durability barrier for multi-file checkpoints.
+   * @param ids comma separated handle IDs for open file descriptors
+   * @param metadata When `true` file metadata is flushed too
+   *                 (`fsync(2)` instead of `fdatasync(2)`)
+   * @see fdatasync(2)
+   */
+  router->map("fs.syncGroup", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"ids"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    auto ids = Vector<uint64_t>();
+
+    for (const auto& entry : split(message.get("ids"), ',')) {
+      try {
+        ids.push_back(std::stoull(trim(entry)));
+      } catch (...) {
+        auto err = JSON::Object::Entries {
+          {"message", "Invalid 'ids' given in parameters"}
+        };
+        return reply(Result::Err { message, err });
+      }
+    }
+
+    if (ids.size() == 0) {
+      auto err = JSON::Object::Entries {
+        {"message", "Expecting 'ids' in parameters"}
+      };
+      return reply(Result::Err { message, err });
+    }
+
+    router->core->fs.syncGroup(
+      message.seq,
+      ids,
+      message.get("metadata") == "true",
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
   /**
    * Truncates opened file
    * @param id
@@ -809,6 +1050,72 @@ static void initRouterTable (Router *router) {
     );
   });
 
+  /**
+   * Preallocates disk space for `[offset, offset + length)` of an opened
+   * file so it can be sized up front and written in place.
+   * @param id
+   * @param offset
+   * @param length
+   * @see posix_fallocate(2)
+   */
+  router->map("fs.allocate", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"id", "offset", "length"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    uint64_t id;
+    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
+
+    int64_t offset;
+    REQUIRE_AND_GET_MESSAGE_VALUE(offset, "offset", std::stoll);
+
+    int64_t length;
+    REQUIRE_AND_GET_MESSAGE_VALUE(length, "length", std::stoll);
+
+    router->core->fs.allocate(
+      message.seq,
+      id,
+      offset,
+      length,
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
+  /**
+   * Returns `[offset, offset + length)` of an opened file to the file
+   * system as a sparse hole, without changing the file size.
+   * @param id
+   * @param offset
+   * @param length
+   * @see fallocate(2)
+   */
+  router->map("fs.punchHole", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"id", "offset", "length"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    uint64_t id;
+    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
+
+    int64_t offset;
+    REQUIRE_AND_GET_MESSAGE_VALUE(offset, "offset", std::stoll);
+
+    int64_t length;
+    REQUIRE_AND_GET_MESSAGE_VALUE(length, "length", std::stoll);
+
+    router->core->fs.punchHole(
+      message.seq,
+      id,
+      offset,
+      length,
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
   /**
    * Returns all open file or directory descriptors.
    */
@@ -822,6 +1129,8 @@ static void initRouterTable (Router *router) {
   /**
    * Computes stats for a symbolic link at `path`.
    * @param path
+   * @param cache set to `true` to allow a cached answer for repeated
+   *              stats of unchanged paths
    * @see stat(2)
    * @see lstat(2)
    */
@@ -835,10 +1144,91 @@ static void initRouterTable (Router *router) {
     router->core->fs.lstat(
       message.seq,
       message.get("path"),
+      message.get("cache") == "true",
       RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
     );
   });
 
+  /**
+   * Memory maps `size` bytes of the open file descriptor `id` at page
+   * aligned `offset` and registers the region with the router's shared
+   * buffer table under the descriptor id, so the webview side can access
+   * the file with no read syscalls and no copies.
+   * @param id
+   * @param size
+   * @param offset
+   * @see mmap(2)
+   */
+  router->map("fs.map", MessageSchema {{
+    { "id", MessageSchema::Type::Unsigned64 },
+    { "size", MessageSchema::Type::Integer },
+    { "offset", MessageSchema::Type::Integer }
+  }}, [](auto message, auto router, auto reply) {
+    auto id = message.typed->getUnsigned64("id");
+    auto desc = router->core->fs.getDescriptor(id);
+
+    if (desc == nullptr || !desc->isFile()) {
+      auto err = JSON::Object::Entries {
+        {"id", std::to_string(id)},
+        {"code", "ENOTOPEN"},
+        {"type", "NotFoundError"},
+        {"message", "No file descriptor found with that id"}
+      };
+      return reply(Result::Err { message, err });
+    }
+
+    auto region = SharedMemoryRegion::mapFile(
+      desc->fd,
+      (size_t) message.typed->getInteger("size"),
+      (size_t) message.typed->getInteger("offset")
+    );
+
+    if (region == nullptr) {
+      auto err = JSON::Object::Entries {
+        {"id", std::to_string(id)},
+        {"message", "Failed to map file descriptor"}
+      };
+      return reply(Result::Err { message, err });
+    }
+
+    router->setMappedBuffer(0, std::to_string(id), MessageBuffer(region));
+
+    auto data = JSON::Object::Entries {
+      {"id", std::to_string(id)},
+      {"size", std::to_string(region->size())}
+    };
+    reply(Result::Data { message, data });
+  });
+
+  /**
+   * Releases the memory mapping previously created for descriptor `id`
+   * with `fs.map`. The mapping is dropped once the last reference to the
+   * region goes away.
+   * @param id
+   * @see munmap(2)
+   */
+  router->map("fs.unmap", MessageSchema {{
+    { "id", MessageSchema::Type::Unsigned64 }
+  }}, [](auto message, auto router, auto reply) {
+    auto id = message.typed->getUnsigned64("id");
+
+    if (!router->hasMappedBuffer(0, std::to_string(id))) {
+      auto err = JSON::Object::Entries {
+        {"id", std::to_string(id)},
+        {"type", "NotFoundError"},
+        {"message", "No mapped region found with that id"}
+      };
+      return reply(Result::Err { message, err });
+    }
+
+    router->removeMappedBuffer(0, std::to_string(id));
+
+    auto data = JSON::Object::Entries {
+      {"id", std::to_string(id)}
+    };
+    reply(Result::Data { message, data });
+  });
+
   /**
    * Creates a directory at `path` with an optional mode and an optional recursive flag.
    * @param path
@@ -872,7 +1262,14 @@ static void initRouterTable (Router *router) {
    * @param path
    * @param flags
    * @param mode
+   * @param advice Optional access-pattern hint for the descriptor:
+   *               "sequential", "random", or "dontneed" (sequential
+   *               readahead plus page cache eviction after every read)
+   * @param direct When `true` the descriptor is opened for unbuffered
+   *               IO (`O_DIRECT`, `F_NOCACHE` on macOS) — sizes and
+   *               offsets should be block aligned
    * @see open(2)
+   * @see posix_fadvise(2)
    */
   router->map("fs.open", [](auto message, auto router, auto reply) {
     auto err = validateMessageParameters(message, {
@@ -899,7 +1296,9 @@ static void initRouterTable (Router *router) {
       message.get("path"),
       flags,
       mode,
-      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply),
+      message.get("advice"),
+      message.get("direct") == "true"
     );
   });
 
@@ -934,35 +1333,69 @@ static void initRouterTable (Router *router) {
    * @param offset
    * @see read(2)
    */
-  router->map("fs.read", [](auto message, auto router, auto reply) {
-    auto err = validateMessageParameters(message, {"id", "size", "offset"});
-
-    if (err.type != JSON::Type::Null) {
-      return reply(Result::Err { message, err });
-    }
-
-    uint64_t id;
-    int size = 0;
-    int offset = 0;
-    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
-    REQUIRE_AND_GET_MESSAGE_VALUE(size, "size", std::stoi);
-    REQUIRE_AND_GET_MESSAGE_VALUE(offset, "offset", std::stoi);
-
+  router->map("fs.read", MessageSchema {{
+    { "id", MessageSchema::Type::Unsigned64 },
+    { "size", MessageSchema::Type::Integer },
+    { "offset", MessageSchema::Type::Integer }
+  }}, [](auto message, auto router, auto reply) {
     router->core->fs.read(
       message.seq,
-      id,
-      size,
-      offset,
-      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+      message.typed->getUnsigned64("id"),
+      message.typed->getInteger("size"),
+      message.typed->getInteger("offset"),
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply),
+      message.cancel != nullptr ? message.cancel->token : nullptr
     );
   });
 
   /**
-   * Reads next `entries` of from the underlying directory descriptor.
+   * Reads multiple extents at `offset` from the underlying file
+   * descriptor with a single scatter request.
    * @param id
-   * @param entries (default: 256)
+   * @param sizes comma separated extent sizes, in bytes
+   * @param offset
+   * @see readv(2)
    */
-  router->map("fs.readdir", [](auto message, auto router, auto reply) {
+  router->map("fs.readv", MessageSchema {{
+    { "id", MessageSchema::Type::Unsigned64 },
+    { "offset", MessageSchema::Type::Integer }
+  }}, [](auto message, auto router, auto reply) {
+    auto sizes = Vector<size_t>();
+
+    for (const auto& entry : split(message.get("sizes"), ',')) {
+      try {
+        sizes.push_back(std::stoull(trim(entry)));
+      } catch (...) {
+        auto err = JSON::Object::Entries {
+          {"message", "Invalid 'sizes' given in parameters"}
+        };
+        return reply(Result::Err { message, err });
+      }
+    }
+
+    if (sizes.size() == 0) {
+      auto err = JSON::Object::Entries {
+        {"message", "Expecting 'sizes' in parameters"}
+      };
+      return reply(Result::Err { message, err });
+    }
+
+    router->core->fs.readv(
+      message.seq,
+      message.typed->getUnsigned64("id"),
+      sizes,
+      message.typed->getInteger("offset"),
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply),
+      message.cancel != nullptr ? message.cancel->token : nullptr
+    );
+  });
+
+  /**
+   * Reads next `entries` of from the underlying directory descriptor.
+   * @param id
+   * @param entries (default: 256)
+   */
+  router->map("fs.readdir", [](auto message, auto router, auto reply) {
     auto err = validateMessageParameters(message, {"id"});
 
     if (err.type != JSON::Type::Null) {
@@ -978,7 +1411,8 @@ static void initRouterTable (Router *router) {
       message.seq,
       id,
       entries,
-      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply),
+      message.cancel != nullptr ? message.cancel->token : nullptr
     );
   });
 
@@ -1084,6 +1518,8 @@ static void initRouterTable (Router *router) {
   /**
    * Computes stats for a file at `path`.
    * @param path
+   * @param cache set to `true` to allow a cached answer for repeated
+   *              stats of unchanged paths
    * @see stat(2)
    */
   router->map("fs.stat", [](auto message, auto router, auto reply) {
@@ -1096,6 +1532,7 @@ static void initRouterTable (Router *router) {
     router->core->fs.stat(
       message.seq,
       message.get("path"),
+      message.get("cache") == "true",
       RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
     );
   });
@@ -1140,6 +1577,55 @@ static void initRouterTable (Router *router) {
     );
   });
 
+  /**
+   * Streams the contents of the file at `path` back as one chunked
+   * response - a native read-ahead pipeline instead of a webview-driven
+   * `fs.read` roundtrip per chunk.
+   * @param path
+   * @param size (optional) bytes to stream, until EOF when omitted
+   * @param offset (optional) byte offset to start from
+   */
+  router->map("fs.readStream", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"path"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    size_t size = 0;
+    size_t offset = 0;
+
+    REQUIRE_AND_GET_MESSAGE_VALUE(size, "size", std::stoul, "0");
+    REQUIRE_AND_GET_MESSAGE_VALUE(offset, "offset", std::stoul, "0");
+
+    router->core->fs.readStream(
+      message.seq,
+      message.get("path"),
+      size,
+      offset,
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
+  /**
+   * Recursively walks the tree rooted at `path`, streaming batched
+   * `{path, type, size, mtime}` entries back as chunked ndjson.
+   * @param path
+   */
+  router->map("fs.walk", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"path"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    router->core->fs.walk(
+      message.seq,
+      message.get("path"),
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
   /**
    * TODO
    */
@@ -1166,41 +1652,105 @@ static void initRouterTable (Router *router) {
    * at `offset` for an opened file handle.
    * @param id Handle ID for an open file descriptor
    * @param offset The offset to start writing at
+   * @param append When `true` the offset is ignored and the kernel's own
+   *               file position is used instead (append mode, `O_APPEND`)
+   * @param coalesce When `true` sequential writes may be buffered and
+   *                 submitted together as a single vectored write
    * @see write(2)
    */
-  router->map("fs.write", [](auto message, auto router, auto reply) {
-    auto err = validateMessageParameters(message, {"id", "offset"});
-
-    if (err.type != JSON::Type::Null) {
-      return reply(Result::Err { message, err });
-    }
-
+  router->map("fs.write", MessageSchema {{
+    { "id", MessageSchema::Type::Unsigned64 },
+    { "offset", MessageSchema::Type::Integer }
+  }}, [](auto message, auto router, auto reply) {
     if (message.buffer.bytes == nullptr || message.buffer.size == 0) {
       auto err = JSON::Object::Entries {{ "message", "Missing buffer in message" }};
       return reply(Result::Err { message, err });
     }
 
+    auto offset = message.typed->getInteger("offset");
 
-    uint64_t id;
-    int offset = 0;
-    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
-    REQUIRE_AND_GET_MESSAGE_VALUE(offset, "offset", std::stoi);
+    if (message.get("append") == "true") {
+      offset = -1;
+    }
 
     router->core->fs.write(
       message.seq,
-      id,
+      message.typed->getUnsigned64("id"),
       message.buffer.bytes,
       message.buffer.size,
       offset,
-      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply),
+      message.cancel != nullptr ? message.cancel->token : nullptr,
+      message.get("coalesce") == "true"
+    );
+  });
+
+  /**
+   * Writes multiple extents carried as one concatenated buffer to the
+   * underlying file descriptor with a single gather request.
+   * @param id
+   * @param sizes comma separated extent sizes, in bytes — must sum to
+   *              the size of the buffer in the message
+   * @param offset
+   * @see writev(2)
+   */
+  router->map("fs.writev", MessageSchema {{
+    { "id", MessageSchema::Type::Unsigned64 },
+    { "offset", MessageSchema::Type::Integer }
+  }}, [](auto message, auto router, auto reply) {
+    if (message.buffer.bytes == nullptr || message.buffer.size == 0) {
+      auto err = JSON::Object::Entries {{ "message", "Missing buffer in message" }};
+      return reply(Result::Err { message, err });
+    }
+
+    auto sizes = Vector<size_t>();
+    size_t total = 0;
+
+    for (const auto& entry : split(message.get("sizes"), ',')) {
+      try {
+        sizes.push_back(std::stoull(trim(entry)));
+      } catch (...) {
+        auto err = JSON::Object::Entries {
+          {"message", "Invalid 'sizes' given in parameters"}
+        };
+        return reply(Result::Err { message, err });
+      }
+
+      total += sizes.back();
+    }
+
+    if (sizes.size() == 0) {
+      auto err = JSON::Object::Entries {
+        {"message", "Expecting 'sizes' in parameters"}
+      };
+      return reply(Result::Err { message, err });
+    }
+
+    if (total != message.buffer.size) {
+      auto err = JSON::Object::Entries {
+        {"message", "Invalid 'sizes' given in parameters"}
+      };
+      return reply(Result::Err { message, err });
+    }
+
+    router->core->fs.writev(
+      message.seq,
+      message.typed->getUnsigned64("id"),
+      message.buffer.bytes,
+      sizes,
+      message.typed->getInteger("offset"),
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply),
+      message.cancel != nullptr ? message.cancel->token : nullptr
     );
   });
 
 #if defined(__APPLE__)
   router->map("geolocation.getCurrentPosition", [](auto message, auto router, auto reply) {
     if (!router->locationObserver) {
-      auto err = JSON::Object::Entries {{ "message", "Location observer is not initialized",  }};
-      err["type"] = "GeolocationPositionError";
+      auto err = JSON::Object::Entries {
+        { "message", "Location observer is not initialized"},
+        {"type", "GeolocationPositionError"}
+      };
       return reply(Result::Err { message, err });
     }
 
@@ -1211,8 +1761,10 @@ static void initRouterTable (Router *router) {
              ? error.localizedDescription.UTF8String
              : "An unknown error occurred"
          );
-        auto err = JSON::Object::Entries {{ "message", message }};
-        err["type"] = "GeolocationPositionError";
+        auto err = JSON::Object::Entries {
+          { "message", message},
+          {"type", "GeolocationPositionError"}
+        };
         return reply(Result::Err { message, err });
       }
 
@@ -1234,16 +1786,20 @@ static void initRouterTable (Router *router) {
     }];
 
     if (!performedActivation) {
-      auto err = JSON::Object::Entries {{ "message", "Location observer could not be activated" }};
-      err["type"] = "GeolocationPositionError";
+      auto err = JSON::Object::Entries {
+        { "message", "Location observer could not be activated"},
+        {"type", "GeolocationPositionError"}
+      };
       return reply(Result::Err { message, err });
     }
   });
 
   router->map("geolocation.watchPosition", [](auto message, auto router, auto reply) {
     if (!router->locationObserver) {
-      auto err = JSON::Object::Entries {{ "message", "Location observer is not initialized",  }};
-      err["type"] = "GeolocationPositionError";
+      auto err = JSON::Object::Entries {
+        { "message", "Location observer is not initialized"},
+        {"type", "GeolocationPositionError"}
+      };
       return reply(Result::Err { message, err });
     }
 
@@ -1263,8 +1819,10 @@ static void initRouterTable (Router *router) {
              ? error.localizedDescription.UTF8String
              : "An unknown error occurred"
         );
-        auto err = JSON::Object::Entries {{ "message", message }};
-        err["type"] = "GeolocationPositionError";
+        auto err = JSON::Object::Entries {
+          { "message", message},
+          {"type", "GeolocationPositionError"}
+        };
         return reply(Result::Err { message, err });
       }
 
@@ -1289,8 +1847,10 @@ static void initRouterTable (Router *router) {
     }];
 
     if (identifier == -1) {
-      auto err = JSON::Object::Entries {{ "message", "Location observer could not be activated" }};
-      err["type"] = "GeolocationPositionError";
+      auto err = JSON::Object::Entries {
+        { "message", "Location observer could not be activated"},
+        {"type", "GeolocationPositionError"}
+      };
       return reply(Result::Err { message, err });
     }
 
@@ -1305,8 +1865,10 @@ static void initRouterTable (Router *router) {
 
   router->map("geolocation.clearWatch", [](auto message, auto router, auto reply) {
     if (!router->locationObserver) {
-      auto err = JSON::Object::Entries {{ "message", "Location observer is not initialized",  }};
-      err["type"] = "GeolocationPositionError";
+      auto err = JSON::Object::Entries {
+        { "message", "Location observer is not initialized"},
+        {"type", "GeolocationPositionError"}
+      };
       return reply(Result::Err { message, err });
     }
 
@@ -1667,6 +2229,53 @@ static void initRouterTable (Router *router) {
     router->core->os.networkInterfaces(message.seq, RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply));
   });
 
+  /**
+   * Subscribes to network interface change events. The platform observer
+   * (netlink on Linux, `NotifyIpInterfaceChange` on Windows,
+   * `nw_path_monitor` on Apple platforms) pushes deltas - `family:name`
+   * keys added, removed or changed plus the fresh enumeration - through
+   * the router instead of the caller polling `os.networkInterfaces`.
+   * @param id
+   */
+  router->map("os.networkInterfaces.subscribe", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"id"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    uint64_t id;
+    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
+
+    router->core->os.subscribeNetworkInterfaces(
+      message.seq,
+      id,
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
+  /**
+   * Removes a network interface change subscription. The platform
+   * observer is torn down when the last subscriber leaves.
+   * @param id
+   */
+  router->map("os.networkInterfaces.unsubscribe", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"id"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    uint64_t id;
+    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
+
+    router->core->os.unsubscribeNetworkInterfaces(
+      message.seq,
+      id,
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
   /**
    * Returns an array of CPUs available to the process.
    */
@@ -1682,7 +2291,7 @@ static void initRouterTable (Router *router) {
     router->core->os.uptime(message.seq, RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply));
   });
 
-  router->map("os.uname", [](auto message, auto router, auto reply) {
+  router->mapImmutable("os.uname", [](auto message, auto router, auto reply) {
     router->core->os.uname(message.seq, RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply));
   });
 
@@ -1694,7 +2303,7 @@ static void initRouterTable (Router *router) {
     router->core->os.availableMemory(message.seq, RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply));
   });
 
-  router->map("os.paths", [](auto message, auto router, auto reply) {
+  router->mapImmutable("os.paths", [](auto message, auto router, auto reply) {
     JSON::Object data;
 
     // paths
@@ -1916,8 +2525,10 @@ static void initRouterTable (Router *router) {
       }];
 
       if (!performedActivation) {
-        auto err = JSON::Object::Entries {{ "message", "Location observer could not be activated" }};
-        err["type"] = "GeolocationPositionError";
+        auto err = JSON::Object::Entries {
+          { "message", "Location observer could not be activated"},
+          {"type", "GeolocationPositionError"}
+        };
         return reply(Result::Err { message, err });
       }
 
@@ -2124,15 +2735,10 @@ static void initRouterTable (Router *router) {
    * `ipc://post` IPC call intercepted by an XHR request.
    * @param id The id of the post data.
    */
-  router->map("post", [](auto message, auto router, auto reply) {
-    auto err = validateMessageParameters(message, {"id"});
-
-    if (err.type != JSON::Type::Null) {
-      return reply(Result::Err { message, err });
-    }
-
-    uint64_t id;
-    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
+  router->map("post", MessageSchema {{
+    { "id", MessageSchema::Type::Unsigned64 }
+  }}, [](auto message, auto router, auto reply) {
+    auto id = message.typed->getUnsigned64("id");
 
     if (!router->core->hasPost(id)) {
       return reply(Result::Err { message, JSON::Object::Entries {
@@ -2147,6 +2753,20 @@ static void initRouterTable (Router *router) {
     router->core->removePost(id);
   });
 
+  /**
+   * Negotiates the binary IPC framing protocol for this bridge.
+   * Once enabled, length-prefixed `Frame` messages are accepted by
+   * `Bridge::route` alongside `ipc://` URIs.
+   * @param enable Enable or disable binary framing (default: true)
+   */
+  router->map("protocol.framing", [](auto message, auto router, auto reply) {
+    router->allowsBinaryFraming = message.get("enable", "true") != "false";
+    reply(Result::Data { message, JSON::Object::Entries {
+      {"enabled", router->allowsBinaryFraming},
+      {"version", (int) Frame::VERSION}
+    }});
+  });
+
   /**
    * Prints incoming message value to stdout.
    */
@@ -2170,15 +2790,17 @@ static void initRouterTable (Router *router) {
   });
 
   /**
-   * Binds an UDP socket to a specified port, and optionally a host
-   * address (default: 0.0.0.0).
+   * Binds a TCP socket to a specified port, and optionally a host
+   * address (default: 0.0.0.0), and starts listening for connections.
+   * Each accepted connection is emitted as a 'connection' event carrying
+   * the handle ID of the new socket.
    * @param id Handle ID of underlying socket
-   * @param port Port to bind the UDP socket to
-   * @param address The address to bind the UDP socket to (default: 0.0.0.0)
-   * @param reuseAddr Reuse underlying UDP socket address (default: false)
+   * @param port Port to listen on
+   * @param address The address to bind the TCP socket to (default: 0.0.0.0)
+   * @param backlog Maximum length of the pending connection queue (default: 128)
    */
-  router->map("udp.bind", [](auto message, auto router, auto reply) {
-    Core::UDP::BindOptions options;
+  router->map("tcp.listen", [](auto message, auto router, auto reply) {
+    Core::TCP::ListenOptions options;
     auto err = validateMessageParameters(message, {"id", "port"});
 
     if (err.type != JSON::Type::Null) {
@@ -2189,10 +2811,19 @@ static void initRouterTable (Router *router) {
     REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
     REQUIRE_AND_GET_MESSAGE_VALUE(options.port, "port", std::stoi);
 
-    options.reuseAddr = message.get("reuseAddr") == "true";
     options.address = message.get("address", "0.0.0.0");
 
-    router->core->udp.bind(
+    if (message.has("backlog")) {
+      try {
+        options.backlog = std::stoi(message.get("backlog"));
+      } catch (...) {
+        return reply(Result::Err { message, JSON::Object::Entries {
+          {"message", "Invalid 'backlog' given in parameters"}
+        }});
+      }
+    }
+
+    router->core->tcp.listen(
       message.seq,
       id,
       options,
@@ -2201,44 +2832,26 @@ static void initRouterTable (Router *router) {
   });
 
   /**
-   * Close socket handle and underlying UDP socket.
-   * @param id Handle ID of underlying socket
-   */
-  router->map("udp.close", [](auto message, auto router, auto reply) {
-    auto err = validateMessageParameters(message, {"id"});
-
-    if (err.type != JSON::Type::Null) {
-      return reply(Result::Err { message, err });
-    }
-
-    uint64_t id;
-    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
-
-    router->core->udp.close(message.seq, id, RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply));
-  });
-
-  /**
-   * Connects an UDP socket to a specified port, and optionally a host
-   * address (default: 0.0.0.0).
+   * Connects a TCP socket to a remote host.
    * @param id Handle ID of underlying socket
-   * @param port Port to connect the UDP socket to
-   * @param address The address to connect the UDP socket to (default: 0.0.0.0)
+   * @param port Port to connect to
+   * @param address The address to connect to
    */
-  router->map("udp.connect", [](auto message, auto router, auto reply) {
-    auto err = validateMessageParameters(message, {"id", "port"});
+  router->map("tcp.connect", [](auto message, auto router, auto reply) {
+    Core::TCP::ConnectOptions options;
+    auto err = validateMessageParameters(message, {"id", "port", "address"});
 
     if (err.type != JSON::Type::Null) {
       return reply(Result::Err { message, err });
     }
 
-    Core::UDP::ConnectOptions options;
     uint64_t id;
     REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
     REQUIRE_AND_GET_MESSAGE_VALUE(options.port, "port", std::stoi);
 
-    options.address = message.get("address", "0.0.0.0");
+    options.address = message.get("address");
 
-    router->core->udp.connect(
+    router->core->tcp.connect(
       message.seq,
       id,
       options,
@@ -2247,10 +2860,11 @@ static void initRouterTable (Router *router) {
   });
 
   /**
-   * Disconnects a connected socket handle and underlying UDP socket.
+   * Shuts down the write side of a connected TCP socket after pending
+   * writes have drained.
    * @param id Handle ID of underlying socket
    */
-  router->map("udp.disconnect", [](auto message, auto router, auto reply) {
+  router->map("tcp.shutdown", [](auto message, auto router, auto reply) {
     auto err = validateMessageParameters(message, {"id"});
 
     if (err.type != JSON::Type::Null) {
@@ -2260,7 +2874,7 @@ static void initRouterTable (Router *router) {
     uint64_t id;
     REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
 
-    router->core->udp.disconnect(
+    router->core->tcp.shutdown(
       message.seq,
       id,
       RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
@@ -2268,10 +2882,11 @@ static void initRouterTable (Router *router) {
   });
 
   /**
-   * Returns connected peer socket address information.
+   * Initializes socket handle to start receiving data from the underlying
+   * socket and route through the IPC bridge to the WebView.
    * @param id Handle ID of underlying socket
    */
-  router->map("udp.getPeerName", [](auto message, auto router, auto reply) {
+  router->map("tcp.readStart", [](auto message, auto router, auto reply) {
     auto err = validateMessageParameters(message, {"id"});
 
     if (err.type != JSON::Type::Null) {
@@ -2281,18 +2896,21 @@ static void initRouterTable (Router *router) {
     uint64_t id;
     REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
 
-    router->core->udp.getPeerName(
+    router->core->tcp.readStart(
       message.seq,
       id,
-      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+      [message, reply](auto seq, auto json, auto post) {
+        reply(Result { seq, message, json, post });
+      }
     );
   });
 
   /**
-   * Returns local socket address information.
+   * Stops socket handle from receiving data from the underlying
+   * socket and routing through the IPC bridge to the WebView.
    * @param id Handle ID of underlying socket
    */
-  router->map("udp.getSockName", [](auto message, auto router, auto reply) {
+  router->map("tcp.readStop", [](auto message, auto router, auto reply) {
     auto err = validateMessageParameters(message, {"id"});
 
     if (err.type != JSON::Type::Null) {
@@ -2302,7 +2920,7 @@ static void initRouterTable (Router *router) {
     uint64_t id;
     REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
 
-    router->core->udp.getSockName(
+    router->core->tcp.readStop(
       message.seq,
       id,
       RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
@@ -2310,32 +2928,33 @@ static void initRouterTable (Router *router) {
   });
 
   /**
-   * Returns socket state information.
+   * Writes bytes to a connected TCP socket.
    * @param id Handle ID of underlying socket
+   * @param size The size of the bytes to send
+   * @param bytes A pointer to the bytes to send
    */
-  router->map("udp.getState", [](auto message, auto router, auto reply) {
-    auto err = validateMessageParameters(message, {"id"});
-
-    if (err.type != JSON::Type::Null) {
-      return reply(Result::Err { message, err });
-    }
+  router->map("tcp.send", MessageSchema {{
+    { "id", MessageSchema::Type::Unsigned64 }
+  }}, [](auto message, auto router, auto reply) {
+    Core::TCP::SendOptions options;
+    auto id = message.typed->getUnsigned64("id");
 
-    uint64_t id;
-    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
+    options.size = message.buffer.size;
+    options.bytes = message.buffer.bytes;
 
-    router->core->udp.getState(
+    router->core->tcp.send(
       message.seq,
       id,
+      options,
       RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
     );
   });
 
   /**
-   * Initializes socket handle to start receiving data from the underlying
-   * socket and route through the IPC bridge to the WebView.
+   * Closes a TCP socket.
    * @param id Handle ID of underlying socket
    */
-  router->map("udp.readStart", [](auto message, auto router, auto reply) {
+  router->map("tcp.close", [](auto message, auto router, auto reply) {
     auto err = validateMessageParameters(message, {"id"});
 
     if (err.type != JSON::Type::Null) {
@@ -2345,22 +2964,338 @@ static void initRouterTable (Router *router) {
     uint64_t id;
     REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
 
-    router->core->udp.readStart(
+    router->core->tcp.close(
       message.seq,
       id,
-      [message, reply](auto seq, auto json, auto post) {
-        reply(Result { seq, message, json, post });
-      }
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
     );
   });
 
   /**
-   * Stops socket handle from receiving data from the underlying
-   * socket and routing through the IPC bridge to the WebView.
+   * Binds an UDP socket to a specified port, and optionally a host
+   * address (default: 0.0.0.0).
    * @param id Handle ID of underlying socket
+   * @param port Port to bind the UDP socket to
+   * @param address The address to bind the UDP socket to (default: 0.0.0.0)
+   * @param reuseAddr Reuse underlying UDP socket address (default: false)
+   * @param keepalive Keep the socket receiving while the app is backgrounded (default: false)
    */
-  router->map("udp.readStop", [](auto message, auto router, auto reply) {
-    auto err = validateMessageParameters(message, {"id"});
+  router->map("udp.bind", [](auto message, auto router, auto reply) {
+    Core::UDP::BindOptions options;
+    auto err = validateMessageParameters(message, {"id", "port"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    uint64_t id;
+    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
+    REQUIRE_AND_GET_MESSAGE_VALUE(options.port, "port", std::stoi);
+
+    options.reuseAddr = message.get("reuseAddr") == "true";
+    options.keepAlive = message.get("keepalive") == "true";
+    options.address = message.get("address", "0.0.0.0");
+
+    router->core->udp.bind(
+      message.seq,
+      id,
+      options,
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
+  /**
+   * Close socket handle and underlying UDP socket.
+   * @param id Handle ID of underlying socket
+   */
+  router->map("udp.close", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"id"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    uint64_t id;
+    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
+
+    router->core->udp.close(message.seq, id, RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply));
+  });
+
+  /**
+   * Configures the bounded outbound queue for a socket handle. When the
+   * queue is full the oldest waiting packet is dropped to make room,
+   * unless the 'drop-newest' policy is selected.
+   * @param id Handle ID of underlying socket
+   * @param depth Maximum number of queued packets, 0 disables the queue
+   * @param policy Overflow policy, 'drop-oldest' (default) or 'drop-newest'
+   */
+  router->map("udp.configureQueue", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"id", "depth"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    Core::UDP::QueueOptions options;
+    uint64_t id;
+    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
+    REQUIRE_AND_GET_MESSAGE_VALUE(options.depth, "depth", std::stoull);
+
+    options.dropNewest = message.get("policy") == "drop-newest";
+
+    router->core->udp.configureQueue(
+      message.seq,
+      id,
+      options,
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
+  /**
+   * Connects an UDP socket to a specified port, and optionally a host
+   * address (default: 0.0.0.0).
+   * @param id Handle ID of underlying socket
+   * @param port Port to connect the UDP socket to
+   * @param address The address to connect the UDP socket to (default: 0.0.0.0)
+   */
+  router->map("udp.connect", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"id", "port"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    Core::UDP::ConnectOptions options;
+    uint64_t id;
+    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
+    REQUIRE_AND_GET_MESSAGE_VALUE(options.port, "port", std::stoi);
+
+    options.address = message.get("address", "0.0.0.0");
+
+    router->core->udp.connect(
+      message.seq,
+      id,
+      options,
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
+  /**
+   * Disconnects a connected socket handle and underlying UDP socket.
+   * @param id Handle ID of underlying socket
+   */
+  router->map("udp.disconnect", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"id"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    uint64_t id;
+    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
+
+    router->core->udp.disconnect(
+      message.seq,
+      id,
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
+  /**
+   * Returns connected peer socket address information.
+   * @param id Handle ID of underlying socket
+   */
+  router->map("udp.getPeerName", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"id"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    uint64_t id;
+    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
+
+    router->core->udp.getPeerName(
+      message.seq,
+      id,
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
+  /**
+   * Returns local socket address information.
+   * @param id Handle ID of underlying socket
+   */
+  router->map("udp.getSockName", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"id"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    uint64_t id;
+    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
+
+    router->core->udp.getSockName(
+      message.seq,
+      id,
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
+  /**
+   * Returns socket state information.
+   * @param id Handle ID of underlying socket
+   */
+  router->map("udp.getState", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"id"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    uint64_t id;
+    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
+
+    router->core->udp.getState(
+      message.seq,
+      id,
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
+  /**
+   * Joins a multicast group on a bound UDP socket, so one socket can
+   * receive group traffic instead of fanning out unicast sockets.
+   * @param id Handle ID of underlying socket
+   * @param group Multicast group address to join
+   * @param iface Local interface address the membership applies to (optional)
+   * @param source Source address for source-specific membership (optional)
+   */
+  router->map("udp.joinGroup", [](auto message, auto router, auto reply) {
+    Core::UDP::MembershipOptions options;
+    auto err = validateMessageParameters(message, {"id", "group"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    uint64_t id;
+    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
+
+    options.group = message.get("group");
+    options.iface = message.get("iface");
+    options.source = message.get("source");
+
+    router->core->udp.joinGroup(
+      message.seq,
+      id,
+      options,
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
+  /**
+   * Leaves a multicast group previously joined with `udp.joinGroup`.
+   * @param id Handle ID of underlying socket
+   * @param group Multicast group address to leave
+   * @param iface Local interface address the membership applies to (optional)
+   * @param source Source address for source-specific membership (optional)
+   */
+  router->map("udp.leaveGroup", [](auto message, auto router, auto reply) {
+    Core::UDP::MembershipOptions options;
+    auto err = validateMessageParameters(message, {"id", "group"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    uint64_t id;
+    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
+
+    options.group = message.get("group");
+    options.iface = message.get("iface");
+    options.source = message.get("source");
+
+    router->core->udp.leaveGroup(
+      message.seq,
+      id,
+      options,
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
+  /**
+   * Configures the outgoing multicast interface and related socket
+   * options for a bound UDP socket.
+   * @param id Handle ID of underlying socket
+   * @param iface Local interface address multicast is sent on (optional)
+   * @param ttl Multicast time-to-live, 0-255 (optional)
+   * @param loopback Whether sent multicast loops back locally (optional)
+   */
+  router->map("udp.setMulticastInterface", [](auto message, auto router, auto reply) {
+    Core::UDP::MulticastOptions options;
+    auto err = validateMessageParameters(message, {"id"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    uint64_t id;
+    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
+
+    options.iface = message.get("iface");
+
+    if (message.has("ttl")) {
+      REQUIRE_AND_GET_MESSAGE_VALUE(options.ttl, "ttl", std::stoi);
+    }
+
+    if (message.has("loopback")) {
+      options.loopback = message.get("loopback") == "true" ? 1 : 0;
+    }
+
+    router->core->udp.setMulticastInterface(
+      message.seq,
+      id,
+      options,
+      RESULT_CALLBACK_FROM_CORE_CALLBACK(message, reply)
+    );
+  });
+
+  /**
+   * Initializes socket handle to start receiving data from the underlying
+   * socket and route through the IPC bridge to the WebView.
+   * @param id Handle ID of underlying socket
+   * @param batched Pack datagrams drained in one loop iteration into a
+   *                single post with an offset table (optional)
+   */
+  router->map("udp.readStart", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"id"});
+
+    if (err.type != JSON::Type::Null) {
+      return reply(Result::Err { message, err });
+    }
+
+    uint64_t id;
+    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
+
+    router->core->udp.readStart(
+      message.seq,
+      id,
+      message.get("batched") == "true",
+      [message, reply](auto seq, auto json, auto post) {
+        reply(Result { seq, message, json, post });
+      }
+    );
+  });
+
+  /**
+   * Stops socket handle from receiving data from the underlying
+   * socket and routing through the IPC bridge to the WebView.
+   * @param id Handle ID of underlying socket
+   */
+  router->map("udp.readStop", [](auto message, auto router, auto reply) {
+    auto err = validateMessageParameters(message, {"id"});
 
     if (err.type != JSON::Type::Null) {
       return reply(Result::Err { message, err });
@@ -2387,24 +3322,35 @@ static void initRouterTable (Router *router) {
    * @param bytes A pointer to the bytes to send
    * @param address The address to send to (default: 0.0.0.0)
    * @param ephemeral Indicates that the socket handle, if created is ephemeral and should eventually be destroyed
+   * @param segmentSize Split the bytes into datagrams of this size (optional)
    */
-  router->map("udp.send", [](auto message, auto router, auto reply) {
-    auto err = validateMessageParameters(message, {"id", "port"});
-
-    if (err.type != JSON::Type::Null) {
-      return reply(Result::Err { message, err });
-    }
-
+  router->map("udp.send", MessageSchema {{
+    { "id", MessageSchema::Type::Unsigned64 },
+    { "port", MessageSchema::Type::Integer }
+  }}, [](auto message, auto router, auto reply) {
     Core::UDP::SendOptions options;
-    uint64_t id;
-    REQUIRE_AND_GET_MESSAGE_VALUE(id, "id", std::stoull);
-    REQUIRE_AND_GET_MESSAGE_VALUE(options.port, "port", std::stoi);
+    auto id = message.typed->getUnsigned64("id");
+    options.port = message.typed->getInteger("port");
 
     options.size = message.buffer.size;
     options.bytes = message.buffer.bytes;
     options.address = message.get("address", "0.0.0.0");
     options.ephemeral = message.get("ephemeral") == "true";
 
+    if (message.cancel != nullptr) {
+      options.cancellation = message.cancel->token;
+    }
+
+    if (message.has("segmentSize")) {
+      try {
+        options.segmentSize = std::stoull(message.get("segmentSize"));
+      } catch (...) {
+        return reply(Result::Err { message, JSON::Object::Entries {
+          {"message", "Invalid 'segmentSize' given in parameters"}
+        }});
+      }
+    }
+
     router->core->udp.send(
       message.seq,
       id,
@@ -2419,86 +3365,311 @@ static void initRouterTable (Router *router) {
     const auto allowDirs = message.get("allowDirs") == "true";
     const auto isSave = message.get("type") == "save";
 
-    const auto contentTypeSpecs = message.get("contentTypeSpecs");
-    const auto defaultName = message.get("defaultName");
-    const auto defaultPath = message.get("defaultPath");
-    const auto title = message.get("title", isSave ? "Save" : "Open");
+    const auto contentTypeSpecs = message.get("contentTypeSpecs");
+    const auto defaultName = message.get("defaultName");
+    const auto defaultPath = message.get("defaultPath");
+    const auto title = message.get("title", isSave ? "Save" : "Open");
+
+    Dialog dialog;
+    auto options = Dialog::FileSystemPickerOptions {
+      .directories = allowDirs,
+      .multiple = allowMultiple,
+      .files = allowFiles,
+      .contentTypes = contentTypeSpecs,
+      .defaultName = defaultName,
+      .defaultPath = defaultPath,
+      .title = title
+    };
+
+    if (isSave) {
+      const auto result = dialog.showSaveFilePicker(options);
+
+      if (result.size() == 0) {
+        auto err = JSON::Object::Entries {{"type", "AbortError"}};
+        reply(Result::Err { message, err });
+      } else {
+        auto data = JSON::Object::Entries {
+          {"paths", JSON::Array::Entries{result}}
+        };
+        reply(Result::Data { message, data });
+      }
+    } else {
+      JSON::Array paths;
+      const auto results = (
+        allowFiles && !allowDirs
+          ? dialog.showOpenFilePicker(options)
+          : dialog.showDirectoryPicker(options)
+      );
+
+      for (const auto& result : results) {
+        paths.push(result);
+      }
+
+      auto data = JSON::Object::Entries {
+        {"paths", paths}
+      };
+
+      reply(Result::Data { message, data });
+    }
+  });
+}
+
+// the built-in route table, assembled on first use and shared by every
+// router in the process - construction of a second (and later) router
+// pays a pointer copy here instead of rebuilding the table
+static std::shared_ptr<const Router::Table> getRouterTable () {
+  static const auto table = [] {
+    SSC_TRACE_SPAN("launch", "initRouterTable");
+    auto builder = RouteTableBuilder {};
+    initRouterTable(&builder);
+    return std::make_shared<const Router::Table>(std::move(builder.table));
+  }();
+
+  return table;
+}
+
+#if defined(__linux__) && !defined(__ANDROID__)
+/**
+ * Bridges a chunked `Post` stream into the socket WebKit reads a scheme
+ * response body from. Pooled chunks are written from a dedicated thread —
+ * the socket's own capacity paces the transfer towards the webview while
+ * the stream's watermarks pace the producer, so neither side ever holds
+ * more than a few chunks of a large body in memory.
+ */
+static void pumpPostChunkStreamToDescriptor (
+  std::shared_ptr<PostChunkStream> stream,
+  int descriptor
+) {
+  struct Waiter {
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool readable = false;
+  };
+
+  auto waiter = std::make_shared<Waiter>();
+
+  stream->onReadable = [waiter]() {
+    std::lock_guard<std::mutex> lock(waiter->mutex);
+    waiter->readable = true;
+    waiter->condition.notify_one();
+  };
+
+  auto pump = Thread([stream, waiter, descriptor]() {
+    PostChunkStream::Chunk chunk;
+
+    while (true) {
+      while (stream->read(chunk)) {
+        auto bytes = chunk.body.get();
+        auto remaining = chunk.size;
+
+        while (remaining > 0) {
+          // `MSG_NOSIGNAL` so a torn down response surfaces as `EPIPE`
+          // instead of a process wide `SIGPIPE`
+          auto written = send(descriptor, bytes, remaining, MSG_NOSIGNAL);
+
+          if (written < 0 && errno == EINTR) {
+            continue;
+          }
+
+          if (written <= 0) {
+            stream->cancel();
+            close(descriptor);
+            return;
+          }
+
+          bytes += written;
+          remaining -= written;
+        }
+
+        if (chunk.finished) {
+          close(descriptor);
+          return;
+        }
+      }
+
+      std::unique_lock<std::mutex> lock(waiter->mutex);
+      waiter->condition.wait(lock, [&]() { return waiter->readable; });
+      waiter->readable = false;
+    }
+  });
+
+  pump.detach();
+}
+#endif
+
+/**
+ * Parses a `Range: bytes=<start>-<end>` request header against a resource
+ * of `size` bytes so the scheme handlers can serve media to `<video>` and
+ * `<audio>` tags without buffering whole files. Open ended (`bytes=N-`)
+ * and suffix (`bytes=-N`) forms are supported — multipart ranges are not
+ * and parse as invalid, falling back to a full response.
+ */
+SchemeHandlerByteRange SSC::IPC::parseSchemeHandlerByteRange (
+  const String& header,
+  int64_t size
+) {
+  auto range = SchemeHandlerByteRange {};
+
+  if (size <= 0 || !header.starts_with("bytes=")) {
+    return range;
+  }
+
+  auto spec = header.substr(6);
+
+  if (spec.find(',') != String::npos) {
+    return range;
+  }
+
+  auto delimiter = spec.find('-');
+
+  if (delimiter == String::npos) {
+    return range;
+  }
+
+  auto first = trim(spec.substr(0, delimiter));
+  auto last = trim(spec.substr(delimiter + 1));
+
+  try {
+    if (first.size() == 0 && last.size() > 0) {
+      // suffix form - the final `last` bytes of the resource
+      range.start = size - std::stoll(last);
+      range.end = size - 1;
+    } else if (first.size() > 0) {
+      range.start = std::stoll(first);
+      range.end = last.size() > 0 ? std::stoll(last) : size - 1;
+    } else {
+      return range;
+    }
+  } catch (...) {
+    return range;
+  }
+
+  if (range.end > size - 1) {
+    range.end = size - 1;
+  }
+
+  range.valid = (
+    range.start >= 0 &&
+    range.start < size &&
+    range.start <= range.end
+  );
 
-    Dialog dialog;
-    auto options = Dialog::FileSystemPickerOptions {
-      .directories = allowDirs,
-      .multiple = allowMultiple,
-      .files = allowFiles,
-      .contentTypes = contentTypeSpecs,
-      .defaultName = defaultName,
-      .defaultPath = defaultPath,
-      .title = title
-    };
+  return range;
+}
 
-    if (isSave) {
-      const auto result = dialog.showSaveFilePicker(options);
+#if defined(__linux__) && !defined(__ANDROID__)
+// one `WebKitWebContext` is shared by every router so windows can join
+// the same WebKit web process (see `Window::Window` in window/linux.cc)
+// instead of each paying a full web process startup - scheme handler
+// callbacks resolve their owning router through this registry, keyed by
+// the webview a request originated from
+static Mutex webkitWebViewRoutersMutex;
+static std::map<WebKitWebView*, Router*> webkitWebViewRouters;
+
+static WebKitWebContext* getSharedWebKitWebContext () {
+  static auto context = webkit_web_context_new();
+  return context;
+}
 
-      if (result.size() == 0) {
-        auto err = JSON::Object::Entries {{"type", "AbortError"}};
-        reply(Result::Err { message, err });
-      } else {
-        auto data = JSON::Object::Entries {
-          {"paths", JSON::Array::Entries{result}}
-        };
-        reply(Result::Data { message, data });
-      }
-    } else {
-      JSON::Array paths;
-      const auto results = (
-        allowFiles && !allowDirs
-          ? dialog.showOpenFilePicker(options)
-          : dialog.showDirectoryPicker(options)
-      );
+static Router* getRouterForSchemeRequest (WebKitURISchemeRequest* request) {
+  auto webview = webkit_uri_scheme_request_get_web_view(request);
 
-      for (const auto& result : results) {
-        paths.push(result);
-      }
+  Lock lock(webkitWebViewRoutersMutex);
 
-      auto data = JSON::Object::Entries {
-        {"paths", paths}
-      };
+  if (webview != nullptr && webkitWebViewRouters.contains(webview)) {
+    return webkitWebViewRouters.at(webview);
+  }
 
-      reply(Result::Data { message, data });
-    }
-  });
+  // a request can race the window binding its webview - any live router
+  // can serve it, since built-in routes are shared across instances
+  for (const auto& entry : webkitWebViewRouters) {
+    return entry.second;
+  }
+
+  return nullptr;
 }
+#endif
 
 static void registerSchemeHandler (Router *router) {
   static auto userConfig = SSC::getUserConfig();
   static auto bundleIdentifier = userConfig["meta_bundle_identifier"];
 
 #if defined(__linux__) && !defined(__ANDROID__)
+  // the context is shared across routers, so schemes register against
+  // it exactly once - the first router to construct wins
+  static bool registered = false;
+
+  if (registered) {
+    return;
+  }
+
+  registered = true;
+
   auto ctx = router->webkitWebContext;
   auto security = webkit_web_context_get_security_manager(ctx);
 
   webkit_web_context_register_uri_scheme(ctx, "ipc", [](auto request, auto ptr) {
     auto uri = String(webkit_uri_scheme_request_get_uri(request));
-    auto router = reinterpret_cast<Router *>(ptr);
-    auto invoked = router->invoke(uri, [=](auto result) {
-      auto json = result.str();
-      auto size = result.post.body != nullptr ? result.post.length : json.size();
-      auto body = result.post.body != nullptr ? result.post.body : json.c_str();
-
-      char* data = nullptr;
+    auto router = getRouterForSchemeRequest(request);
 
-      if (size > 0) {
-        data = new char[size]{0};
-        memcpy(data, body, size);
-      }
+    if (router == nullptr) {
+      router = reinterpret_cast<Router *>(ptr);
+    }
 
-      auto stream = g_memory_input_stream_new_from_data(data, size, nullptr);
+    auto invoked = router->invoke(uri, [=](auto result) {
       auto headers = soup_message_headers_new(SOUP_MESSAGE_HEADERS_RESPONSE);
-      auto response = webkit_uri_scheme_response_new(stream, size);
 
       for (const auto& header : result.headers.entries) {
         soup_message_headers_append(headers, header.key.c_str(), header.value.c_str());
       }
 
+      if (result.post.stream != nullptr) {
+        // chunked responses are streamed - WebKit reads the socket while
+        // a pump thread drains pooled chunks into it (see
+        // `pumpPostChunkStreamToDescriptor`)
+        int descriptors[2] = { -1, -1 };
+
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, descriptors) == 0) {
+          auto stream = g_unix_input_stream_new(descriptors[0], true);
+          auto response = webkit_uri_scheme_response_new(stream, -1);
+
+          webkit_uri_scheme_response_set_http_headers(response, headers);
+          webkit_uri_scheme_response_set_content_type(response, IPC_BINARY_CONTENT_TYPE);
+          webkit_uri_scheme_request_finish_with_response(request, response);
+          g_object_unref(stream);
+
+          pumpPostChunkStreamToDescriptor(result.post.stream, descriptors[1]);
+          return;
+        }
+
+        result.post.stream->cancel();
+      }
+
+      GInputStream* stream = nullptr;
+      size_t size = 0;
+
+      if (result.post.body != nullptr) {
+        // share the pooled body with the response instead of copying it -
+        // the holder keeps the bytes alive until the stream is finalized
+        auto body = new Post::Body(result.post.body);
+        size = result.post.length;
+        stream = g_memory_input_stream_new_from_data(body->get(), size, nullptr);
+        g_object_set_data_full(G_OBJECT(stream), "ssc-post-body", body, [](gpointer data) {
+          delete static_cast<Post::Body*>(data);
+        });
+      } else {
+        auto json = new String(result.str());
+        size = json->size();
+        stream = g_memory_input_stream_new_from_data(json->c_str(), size, nullptr);
+        g_object_set_data_full(G_OBJECT(stream), "ssc-post-body", json, [](gpointer data) {
+          delete static_cast<String*>(data);
+        });
+      }
+
+      auto response = webkit_uri_scheme_response_new(stream, size);
+
+      webkit_uri_scheme_response_set_http_headers(response, headers);
+
       if (result.post.body) {
         webkit_uri_scheme_response_set_content_type(response, IPC_BINARY_CONTENT_TYPE);
       } else {
@@ -2506,25 +3677,7 @@ static void registerSchemeHandler (Router *router) {
       }
 
       webkit_uri_scheme_request_finish_with_response(request, response);
-      g_input_stream_close_async(stream, 0, nullptr, +[](
-        GObject* object,
-        GAsyncResult* asyncResult,
-        gpointer userData
-      ) {
-        auto stream = (GInputStream*) object;
-        g_input_stream_close_finish(stream, asyncResult, nullptr);
-        g_object_unref(stream);
-        g_idle_add_full(
-          G_PRIORITY_DEFAULT_IDLE,
-          (GSourceFunc) [](gpointer userData) {
-            return G_SOURCE_REMOVE;
-          },
-          userData,
-           [](gpointer userData) {
-            delete [] static_cast<char *>(userData);
-          }
-        );
-      }, data);
+      g_object_unref(stream);
     });
 
     if (!invoked) {
@@ -2585,16 +3738,40 @@ static void registerSchemeHandler (Router *router) {
       }
 
       uri = "socket://" + bundleIdentifier + "/" + path;
-      auto moduleSource = trim(tmpl(
-        moduleTemplate,
-        Map { {"url", String(uri)} }
-      ));
 
-      auto size = moduleSource.size();
-      auto bytes = moduleSource.data();
+      // the proxy source is memoized per URL with a content hash ETag -
+      // reloads revalidate with `if-none-match` and get a bodyless 304
+      // instead of re-transferring every module shim
+      const auto& module = getCachedModuleSource(uri);
+      auto headers = soup_message_headers_new(SOUP_MESSAGE_HEADERS_RESPONSE);
+
+      soup_message_headers_append(headers, "etag", module.etag.c_str());
+      soup_message_headers_append(headers, "cache-control", "no-cache");
+
+      auto requestHeaders = webkit_uri_scheme_request_get_http_headers(request);
+      auto ifNoneMatch = requestHeaders != nullptr
+        ? soup_message_headers_get_one(requestHeaders, "if-none-match")
+        : nullptr;
+
+      if (ifNoneMatch != nullptr && isETagMatch(ifNoneMatch, module.etag)) {
+        auto stream = g_memory_input_stream_new_from_data(nullptr, 0, 0);
+        auto response = webkit_uri_scheme_response_new(stream, 0);
+
+        webkit_uri_scheme_response_set_http_headers(response, headers);
+        webkit_uri_scheme_response_set_status(response, 304, "Not Modified");
+        webkit_uri_scheme_request_finish_with_response(request, response);
+        g_object_unref(stream);
+        return;
+      }
+
+      // the memoized entry lives for the life of the process, so the
+      // stream can reference its bytes without copying
+      auto size = module.source.size();
+      auto bytes = module.source.data();
       auto stream = g_memory_input_stream_new_from_data(bytes, size, 0);
       auto response = webkit_uri_scheme_response_new(stream, size);
 
+      webkit_uri_scheme_response_set_http_headers(response, headers);
       webkit_uri_scheme_response_set_content_type(response, SOCKET_MODULE_CONTENT_TYPE);
       webkit_uri_scheme_request_finish_with_response(request, response);
       g_object_unref(stream);
@@ -2686,6 +3863,49 @@ static void registerSchemeHandler (Router *router) {
       return;
     }
 
+    // revalidation for static assets - a weak validator derived from
+    // the file size and mtime answers unchanged reloads with a
+    // bodyless 304 before the file is even opened
+    String assetETag;
+
+    do {
+      std::error_code errorCode;
+      const auto lastWriteTime = fs::last_write_time(path, errorCode);
+
+      if (!errorCode) {
+        char buffer[64];
+        snprintf(
+          buffer,
+          sizeof(buffer),
+          "W/\"%llx-%llx\"",
+          (unsigned long long) fs::file_size(path),
+          (unsigned long long) lastWriteTime.time_since_epoch().count()
+        );
+
+        assetETag = buffer;
+      }
+    } while (0);
+
+    auto requestHeaders = webkit_uri_scheme_request_get_http_headers(request);
+
+    if (assetETag.size() > 0 && requestHeaders != nullptr) {
+      const auto ifNoneMatch = soup_message_headers_get_one(requestHeaders, "if-none-match");
+
+      if (ifNoneMatch != nullptr && isETagMatch(ifNoneMatch, assetETag)) {
+        auto headers = soup_message_headers_new(SOUP_MESSAGE_HEADERS_RESPONSE);
+        auto stream = g_memory_input_stream_new_from_data(nullptr, 0, 0);
+        auto response = webkit_uri_scheme_response_new(stream, 0);
+
+        soup_message_headers_append(headers, "etag", assetETag.c_str());
+        soup_message_headers_append(headers, "cache-control", "no-cache");
+        webkit_uri_scheme_response_set_http_headers(response, headers);
+        webkit_uri_scheme_response_set_status(response, 304, "Not Modified");
+        webkit_uri_scheme_request_finish_with_response(request, response);
+        g_object_unref(stream);
+        return;
+      }
+    }
+
     GError* error = nullptr;
 
     auto file = g_file_new_for_path(path.c_str());
@@ -2700,12 +3920,62 @@ static void registerSchemeHandler (Router *router) {
     gchar* mimeType = nullptr;
     auto size = fs::file_size(path);
     auto headers = soup_message_headers_new(SOUP_MESSAGE_HEADERS_RESPONSE);
-    auto response = webkit_uri_scheme_response_new(stream, (gint64) size);
     auto webviewHeaders = split(userConfig["webview_headers"], '\n');
 
+    auto range = SchemeHandlerByteRange {};
+    auto rangeHeader = requestHeaders != nullptr
+      ? soup_message_headers_get_one(requestHeaders, "range")
+      : nullptr;
+
+    if (rangeHeader != nullptr) {
+      range = parseSchemeHandlerByteRange(rangeHeader, (int64_t) size);
+    }
+
+    auto length = (gint64) size;
+
+    if (range.valid) {
+      g_seekable_seek(G_SEEKABLE(stream), range.start, G_SEEK_SET, nullptr, nullptr);
+      length = range.end - range.start + 1;
+
+      if ((uint64_t) range.end != size - 1) {
+        // WebKit drains a response stream to EOF, so a bounded range is
+        // read up front instead - media players request a few megabytes
+        // at most while open ended ranges stream from the seeked file
+        auto buffer = new char[length];
+        gsize bytesRead = 0;
+
+        g_input_stream_read_all(stream, buffer, length, &bytesRead, nullptr, nullptr);
+        g_object_unref(stream);
+
+        length = (gint64) bytesRead;
+        stream = g_memory_input_stream_new_from_data(buffer, length, [](gpointer data) {
+          delete [] static_cast<char*>(data);
+        });
+      }
+    }
+
+    auto response = webkit_uri_scheme_response_new(stream, length);
+
     soup_message_headers_append(headers, "access-control-allow-origin", "*");
     soup_message_headers_append(headers, "access-control-allow-methods", "*");
     soup_message_headers_append(headers, "access-control-allow-headers", "*");
+    soup_message_headers_append(headers, "accept-ranges", "bytes");
+
+    if (assetETag.size() > 0) {
+      soup_message_headers_append(headers, "etag", assetETag.c_str());
+      soup_message_headers_append(headers, "cache-control", "no-cache");
+    }
+
+    if (range.valid) {
+      auto contentRange = String(
+        "bytes " +
+        std::to_string(range.start) + "-" + std::to_string(range.end) +
+        "/" + std::to_string(size)
+      );
+
+      soup_message_headers_append(headers, "content-range", contentRange.c_str());
+      webkit_uri_scheme_response_set_status(response, 206, "Partial Content");
+    }
 
     for (const auto& line : webviewHeaders) {
       auto pair = split(trim(line), ':');
@@ -2795,6 +4065,9 @@ static void registerSchemeHandler (Router *router) {
     if (message.cancel->handler != nullptr) {
       message.cancel->handler(message.cancel->data);
     }
+    if (message.cancel->token != nullptr) {
+      message.cancel->token->cancel();
+    }
   }
   [self finalizeTask: task];
 }
@@ -2937,13 +4210,46 @@ static void registerSchemeHandler (Router *router) {
           }
 
           [url startAccessingSecurityScopedResource];
-          const auto data = [NSData dataWithContentsOfURL: url];
-          headers[@"content-length"] = [@(data.length) stringValue];
+          // mapped so serving a large media file never materializes a
+          // full copy in the UI process - WebKit reads pages on demand
+          auto data = [NSData
+            dataWithContentsOfURL: url
+                          options: NSDataReadingMappedIfSafe
+                            error: nullptr
+          ];
           [url stopAccessingSecurityScopedResource];
 
+          auto statusCode = 200;
+          headers[@"accept-ranges"] = @"bytes";
+
+          const auto rangeHeader = [request valueForHTTPHeaderField: @"range"];
+
+          if (rangeHeader != nullptr && data != nullptr) {
+            const auto range = parseSchemeHandlerByteRange(
+              rangeHeader.UTF8String,
+              (int64_t) data.length
+            );
+
+            if (range.valid) {
+              headers[@"content-range"] = [NSString
+                stringWithFormat: @"bytes %lld-%lld/%lu",
+                                  range.start,
+                                  range.end,
+                                  (unsigned long) data.length
+              ];
+              data = [data subdataWithRange: NSMakeRange(
+                range.start,
+                range.end - range.start + 1
+              )];
+              statusCode = 206;
+            }
+          }
+
+          headers[@"content-length"] = [@(data.length) stringValue];
+
           auto response = [[NSHTTPURLResponse alloc]
             initWithURL: request.URL
-             statusCode: 200
+             statusCode: statusCode
             HTTPVersion: @"HTTP/1.1"
            headerFields: headers
           ];
@@ -3018,7 +4324,11 @@ static void registerSchemeHandler (Router *router) {
       #endif
 
       if (String(request.HTTPMethod.UTF8String) == "GET") {
-        data = [NSData dataWithContentsOfURL: components.URL];
+        data = [NSData
+          dataWithContentsOfURL: components.URL
+                        options: NSDataReadingMappedIfSafe
+                          error: nullptr
+        ];
       }
 
       components.host = request.URL.host;
@@ -3050,13 +4360,39 @@ static void registerSchemeHandler (Router *router) {
       ];
     #endif
       auto moduleUri = "socket://" + bundleIdentifier + "/" + prefix + path;
-      auto moduleSource = trim(tmpl(
-        moduleTemplate,
-        Map { {"url", String(moduleUri)} }
-      ));
+
+      // memoized per URL with a content hash ETag - reloads revalidate
+      // with `if-none-match` and get a bodyless 304 instead of
+      // re-transferring every module shim
+      const auto& module = getCachedModuleSource(moduleUri);
+
+      headers[@"etag"] = @(module.etag.c_str());
+      headers[@"cache-control"] = @"no-cache";
+
+      const auto ifNoneMatch = [request valueForHTTPHeaderField: @"if-none-match"];
+
+      if (
+        ifNoneMatch != nullptr &&
+        isETagMatch(ifNoneMatch.UTF8String, module.etag)
+      ) {
+        auto response = [[NSHTTPURLResponse alloc]
+          initWithURL: request.URL
+           statusCode: 304
+          HTTPVersion: @"HTTP/1.1"
+         headerFields: headers
+        ];
+
+        [task didReceiveResponse: response];
+        [task didFinish];
+
+      #if !__has_feature(objc_arc)
+        [response release];
+      #endif
+        return;
+      }
 
       if (String(request.HTTPMethod.UTF8String) == "GET") {
-        data = [@(moduleSource.c_str()) dataUsingEncoding: NSUTF8StringEncoding];
+        data = [@(module.source.c_str()) dataUsingEncoding: NSUTF8StringEncoding];
       }
     }
 
@@ -3066,7 +4402,34 @@ static void registerSchemeHandler (Router *router) {
 
     components.path = @(path.c_str());
 
+    auto statusCode = exists ? 200 : 404;
+
     if (exists && data) {
+      headers[@"accept-ranges"] = @"bytes";
+
+      const auto rangeHeader = [request valueForHTTPHeaderField: @"range"];
+
+      if (rangeHeader != nullptr) {
+        const auto range = parseSchemeHandlerByteRange(
+          rangeHeader.UTF8String,
+          (int64_t) data.length
+        );
+
+        if (range.valid) {
+          headers[@"content-range"] = [NSString
+            stringWithFormat: @"bytes %lld-%lld/%lu",
+                              range.start,
+                              range.end,
+                              (unsigned long) data.length
+          ];
+          data = [data subdataWithRange: NSMakeRange(
+            range.start,
+            range.end - range.start + 1
+          )];
+          statusCode = 206;
+        }
+      }
+
       headers[@"content-length"] = [@(data.length) stringValue];
       if (isModule && data.length > 0) {
         headers[@"content-type"] = @"text/javascript";
@@ -3092,7 +4455,6 @@ static void registerSchemeHandler (Router *router) {
     components.scheme = @("socket");
     headers[@"content-location"] = components.URL.absoluteString;
 
-    auto statusCode = exists ? 200 : 404;
     auto response = [[NSHTTPURLResponse alloc]
       initWithURL: components.URL
        statusCode: statusCode
@@ -3120,15 +4482,10 @@ static void registerSchemeHandler (Router *router) {
 
     headers[@"content-length"] = [@(post.length) stringValue];
 
-    if (post.headers.size() > 0) {
-      auto lines = SSC::split(SSC::trim(post.headers), '\n');
-
-      for (auto& line : lines) {
-        auto pair = split(trim(line), ':');
-        auto key = [NSString stringWithUTF8String: trim(pair[0]).c_str()];
-        auto value = [NSString stringWithUTF8String: trim(pair[1]).c_str()];
-        headers[key] = value;
-      }
+    for (const auto& header : post.headers.entries) {
+      auto key = [NSString stringWithUTF8String: header.key.c_str()];
+      auto value = [NSString stringWithUTF8String: header.value.str().c_str()];
+      headers[key] = value;
     }
 
     auto response = [[NSHTTPURLResponse alloc]
@@ -3141,7 +4498,7 @@ static void registerSchemeHandler (Router *router) {
     [task didReceiveResponse: response];
 
     if (post.body) {
-      auto data = [NSData dataWithBytes: post.body length: post.length];
+      auto data = [NSData dataWithBytes: post.body.get() length: post.length];
       [task didReceiveData: data];
     } else {
       auto string = [NSString stringWithUTF8String: ""];
@@ -3173,7 +4530,9 @@ static void registerSchemeHandler (Router *router) {
   [self enqueueTask: task withMessage: message];
 
   auto invoked = self.router->invoke(message, body, bufsize, [=](Result result) {
-    // @TODO Communicate task cancellation to the route, so it can cancel its work.
+    // `stopURLSchemeTask:` cancelled `message.cancel->token`, so the
+    // route's in-flight core work aborted itself — this only drops the
+    // (minimal) reply it still produced
     if (![self waitingForTask: task]) {
       return;
     }
@@ -3226,6 +4585,10 @@ static void registerSchemeHandler (Router *router) {
       };
       headers[@"content-type"] = @"text/event-stream";
       headers[@"cache-control"] = @"no-store";
+    } else if (result.post.stream != nullptr) {
+      // chunks are drained incrementally after the response headers are
+      // sent below — see the `onReadable` wiring after `didReceiveResponse`
+      headers[@"transfer-encoding"] = @"chunked";
     } else if (result.post.chunk_stream != nullptr) {
       *result.post.chunk_stream = [=](
         const char* chunk,
@@ -3250,7 +4613,7 @@ static void registerSchemeHandler (Router *router) {
       const char* body;
       size_t size;
       if (result.post.body != nullptr) {
-        body = result.post.body;
+        body = result.post.body.get();
         size = result.post.length;
       } else {
         json = result.str();
@@ -3274,6 +4637,33 @@ static void registerSchemeHandler (Router *router) {
       [task didReceiveData: data];
       [task didFinish];
       [self finalizeTask: task];
+    } else if (result.post.stream != nullptr) {
+      auto stream = result.post.stream;
+      stream->onReadable = [=]() {
+        PostChunkStream::Chunk chunk;
+        while (stream->read(chunk)) {
+          if (![self waitingForTask: task]) {
+            stream->cancel();
+            return;
+          }
+
+          if (chunk.body != nullptr && chunk.size > 0) {
+            [task didReceiveData: [NSData
+              dataWithBytes: chunk.body.get()
+                     length: chunk.size
+            ]];
+          }
+
+          if (chunk.finished) {
+            [task didFinish];
+            [self finalizeTask: task];
+          }
+        }
+      };
+
+      // drain anything the producer buffered before the response headers
+      // were sent
+      stream->onReadable();
     }
 
   #if !__has_feature(objc_arc)
@@ -3703,11 +5093,13 @@ static void registerSchemeHandler (Router *router) {
 
 namespace SSC::IPC {
   Bridge::Bridge (Core *core) : router() {
+    SSC_TRACE_SPAN("launch", "Bridge::Bridge");
     static auto userConfig = SSC::getUserConfig();
 
     this->core = core;
     this->router.core = core;
     this->router.bridge = this;
+    this->bluetooth.core = core;
 
     this->bluetooth.sendFunction = [this](
       const String& seq,
@@ -3726,47 +5118,215 @@ namespace SSC::IPC {
 
   #if !defined(__ANDROID__) && (defined(_WIN32) || defined(__linux__) || (defined(__APPLE__) && !TARGET_OS_IPHONE && !TARGET_IPHONE_SIMULATOR))
     if (isDebugEnabled() && userConfig["webview_watch"] == "true") {
-      this->fileSystemWatcher = new FileSystemWatcher(getcwd());
-      this->fileSystemWatcher->core = this->core;
-      this->fileSystemWatcher->start([=, this](
-        const auto& path,
-        const auto& events,
-        const auto& context
-      ) mutable {
-        auto json = JSON::Object::Entries {
-          {"path", std::filesystem::relative(path, getcwd()).string()}
-        };
+      this->fileSystemWatcherSubscription = FileSystemWatcherService::instance()->subscribe(
+        getcwd(),
+        this->core,
+        [this](
+          const auto& path,
+          const auto& events,
+          const auto& context
+        ) {
+          auto json = JSON::Object::Entries {
+            {"path", std::filesystem::relative(path, getcwd()).string()}
+          };
 
-        auto result = SSC::IPC::Result(json);
-        this->router.emit("filedidchange", result.json().str());
-      });
+          auto result = SSC::IPC::Result(json);
+          this->router.emit("filedidchange", result.json().str());
+        }
+      );
     }
   #endif
   }
 
   Bridge::~Bridge () {
   #if !defined(__ANDROID__) && (defined(_WIN32) || defined(__linux__) || (defined(__APPLE__) && !TARGET_OS_IPHONE && !TARGET_IPHONE_SIMULATOR))
-    if (this->fileSystemWatcher) {
-      this->fileSystemWatcher->stop();
-      delete this->fileSystemWatcher;
+    if (this->fileSystemWatcherSubscription > 0) {
+      FileSystemWatcherService::instance()->unsubscribe(this->fileSystemWatcherSubscription);
+      this->fileSystemWatcherSubscription = 0;
     }
   #endif
   }
 
+  // parses a plain decimal IPC sequence value - returns `false` for
+  // "", "-1" and anything else non-numeric (or too long to fit a
+  // `uint64_t`) so those keys fall back to the string-keyed map
+  static bool parseMappedBufferSeq (const Message::Seq& seq, uint64_t& value) {
+    if (seq.size() == 0 || seq.size() > 19) {
+      return false;
+    }
+
+    uint64_t parsed = 0;
+
+    for (const auto character : seq) {
+      if (character < '0' || character > '9') {
+        return false;
+      }
+
+      parsed = parsed * 10 + (character - '0');
+    }
+
+    value = parsed;
+    return true;
+  }
+
+  // mixes the packed (index, seq) pair into a probe start position -
+  // the finalizer from murmur3 so sequential seqs don't cluster
+  static inline uint64_t mappedBufferHash (int index, uint64_t seq) {
+    auto hash = seq ^ ((uint64_t) (uint32_t) index << 32);
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    return hash;
+  }
+
+  Router::MappedBufferTable::Entry* Router::MappedBufferTable::find (
+    int index,
+    uint64_t seq
+  ) {
+    if (this->occupied == 0) {
+      return nullptr;
+    }
+
+    const auto mask = this->entries.size() - 1;
+    auto position = mappedBufferHash(index, seq) & mask;
+
+    while (true) {
+      auto& entry = this->entries[position];
+
+      if (entry.state == 0) {
+        return nullptr;
+      }
+
+      if (entry.state == 1 && entry.seq == seq && entry.index == index) {
+        return &entry;
+      }
+
+      position = (position + 1) & mask;
+    }
+  }
+
+  void Router::MappedBufferTable::set (
+    int index,
+    uint64_t seq,
+    MessageBuffer buffer
+  ) {
+    if (this->entries.size() == 0) {
+      this->entries.resize(16);
+    } else if ((this->used + 1) * 4 > this->entries.size() * 3) {
+      this->grow();
+    }
+
+    const auto mask = this->entries.size() - 1;
+    auto position = mappedBufferHash(index, seq) & mask;
+    Entry* slot = nullptr;
+
+    while (true) {
+      auto& entry = this->entries[position];
+
+      if (entry.state == 1 && entry.seq == seq && entry.index == index) {
+        entry.buffer = buffer;
+        return;
+      }
+
+      if (entry.state == 2) {
+        // remember the first tombstone but keep probing - the key may
+        // still live further along the chain
+        if (slot == nullptr) {
+          slot = &entry;
+        }
+      } else if (entry.state == 0) {
+        if (slot == nullptr) {
+          slot = &entry;
+          this->used++;
+        }
+
+        break;
+      }
+
+      position = (position + 1) & mask;
+    }
+
+    slot->seq = seq;
+    slot->index = index;
+    slot->state = 1;
+    slot->buffer = buffer;
+    this->occupied++;
+  }
+
+  void Router::MappedBufferTable::remove (int index, uint64_t seq) {
+    const auto entry = this->find(index, seq);
+
+    if (entry != nullptr) {
+      entry->state = 2;
+      // drop the shared memory reference right away instead of waiting
+      // for the slot to be reused
+      entry->buffer = MessageBuffer {};
+      this->occupied--;
+    }
+  }
+
+  void Router::MappedBufferTable::grow () {
+    auto previous = std::move(this->entries);
+
+    this->entries.assign(previous.size() * 2, Entry {});
+    this->occupied = 0;
+    this->used = 0;
+
+    for (auto& entry : previous) {
+      if (entry.state == 1) {
+        this->set(entry.index, entry.seq, std::move(entry.buffer));
+      }
+    }
+  }
+
+  //
+  // Drops every piece of router state scoped to the current page ahead
+  // of a warm restart navigation: mapped buffers, scripts queued for a
+  // webview that is about to be replaced, and the readiness flag so the
+  // reloaded page handshakes again. The route tables and native
+  // listeners survive - routes are process wide and listeners belong to
+  // native subscribers, not the page.
+  //
+  void Router::invalidate () {
+    do {
+      Lock lock(this->mutex);
+      this->buffers.clear();
+      this->mappedBuffers.entries.clear();
+      this->mappedBuffers.occupied = 0;
+      this->mappedBuffers.used = 0;
+      this->isReady = false;
+    } while (0);
+
+    do {
+      Lock lock(this->pendingScriptsMutex);
+      this->pendingScripts.clear();
+    } while (0);
+  }
+
   bool Router::hasMappedBuffer (int index, const Message::Seq seq) {
     Lock lock(this->mutex);
+    uint64_t numericSeq = 0;
+
+    if (parseMappedBufferSeq(seq, numericSeq)) {
+      return this->mappedBuffers.find(index, numericSeq) != nullptr;
+    }
+
     auto key = std::to_string(index) + seq;
     return this->buffers.find(key) != this->buffers.end();
   }
 
   MessageBuffer Router::getMappedBuffer (int index, const Message::Seq seq) {
-    if (this->hasMappedBuffer(index, seq)) {
-      Lock lock(this->mutex);
-      auto key = std::to_string(index) + seq;
-      return this->buffers.at(key);
+    Lock lock(this->mutex);
+    uint64_t numericSeq = 0;
+
+    if (parseMappedBufferSeq(seq, numericSeq)) {
+      const auto entry = this->mappedBuffers.find(index, numericSeq);
+      return entry != nullptr ? entry->buffer : MessageBuffer {};
     }
 
-    return MessageBuffer {};
+    auto key = std::to_string(index) + seq;
+    const auto iterator = this->buffers.find(key);
+    return iterator != this->buffers.end() ? iterator->second : MessageBuffer {};
   }
 
   void Router::setMappedBuffer (
@@ -3775,16 +5335,44 @@ namespace SSC::IPC {
     MessageBuffer buffer
   ) {
     Lock lock(this->mutex);
+    uint64_t numericSeq = 0;
+
+    if (parseMappedBufferSeq(seq, numericSeq)) {
+      this->mappedBuffers.set(index, numericSeq, buffer);
+      return;
+    }
+
     auto key = std::to_string(index) + seq;
     this->buffers.insert_or_assign(key, buffer);
   }
 
+  MessageBuffer Router::createSharedBuffer (
+    int index,
+    const Message::Seq seq,
+    size_t size
+  ) {
+    auto region = SharedMemoryRegion::create(size);
+
+    if (region == nullptr) {
+      return MessageBuffer {};
+    }
+
+    auto buffer = MessageBuffer(region);
+    this->setMappedBuffer(index, seq, buffer);
+    return buffer;
+  }
+
   void Router::removeMappedBuffer (int index, const Message::Seq seq) {
     Lock lock(this->mutex);
-    if (this->hasMappedBuffer(index, seq)) {
-      auto key = std::to_string(index) + seq;
-      this->buffers.erase(key);
+    uint64_t numericSeq = 0;
+
+    if (parseMappedBufferSeq(seq, numericSeq)) {
+      this->mappedBuffers.remove(index, numericSeq);
+      return;
     }
+
+    auto key = std::to_string(index) + seq;
+    this->buffers.erase(key);
   }
 
   bool Bridge::route (const String& uri, const char *bytes, size_t size) {
@@ -3797,6 +5385,26 @@ namespace SSC::IPC {
     size_t size,
     Router::ResultCallback callback
   ) {
+    // binary framed messages arrive through `bytes` once the webview has
+    // negotiated framing — the URI path below remains for compatibility
+    if (this->router.allowsBinaryFraming && Frame::isFrame(bytes, size)) {
+      Frame frame;
+
+      if (!frame.decode(bytes, size)) {
+        return false;
+      }
+
+      auto message = Message(frame);
+
+      if (callback == nullptr) {
+        callback = [this](auto result) {
+          this->router.send(result.seq, result.str(), result.post);
+        };
+      }
+
+      return this->router.invoke(message, frame.body, frame.size, callback);
+    }
+
     if (callback != nullptr) {
       return this->router.invoke(uri, bytes, size, callback);
     } else {
@@ -3830,7 +5438,74 @@ namespace SSC::IPC {
     '/an-index-file' -> redirect to '/an-index-file/'
     '/an-index-file/a-html-file' -> '/an-index-file/a-html-file.html'
    */
-  Router::WebViewURLPathResolution Router::resolveURLPathForWebView (String inputPath, const String& basePath) {
+  /**
+   * Memoizes webview asset path resolutions — every miss below costs
+   * several filesystem probes and a webview startup makes hundreds of
+   * requests against the same handful of prefixes. On desktop a watcher
+   * per resolved base flushes the cache when files under it change, so
+   * edits during development are picked up on the next request. Mobile
+   * application bundles are immutable and cache without invalidation.
+   */
+  struct WebViewPathResolutionCache {
+    // keeps a rogue client issuing unique asset URLs from growing the
+    // cache without bound — a flush just restores the cold cost
+    static constexpr size_t MAX_ENTRIES = 4096;
+
+    Mutex mutex;
+    std::unordered_map<String, Router::WebViewURLPathResolution> resolutions;
+    std::unordered_map<String, Router::WebViewNavigatorMount> mounts;
+
+  #if !defined(__ANDROID__) && (defined(_WIN32) || defined(__linux__) || (defined(__APPLE__) && !TARGET_OS_IPHONE && !TARGET_IPHONE_SIMULATOR))
+    std::map<String, FileSystemWatcherService::Subscription> watchers;
+  #endif
+
+    void watch (const String& basePath) {
+    #if !defined(__ANDROID__) && (defined(_WIN32) || defined(__linux__) || (defined(__APPLE__) && !TARGET_OS_IPHONE && !TARGET_IPHONE_SIMULATOR))
+      do {
+        Lock lock(this->mutex);
+
+        if (basePath.size() == 0 || this->watchers.contains(basePath)) {
+          return;
+        }
+
+        // claim the slot before subscribing so a concurrent `watch`
+        // for the same base does not double subscribe
+        this->watchers.emplace(basePath, 0);
+      } while (0);
+
+      // subscribed outside the cache lock: the service fans events out
+      // under its own lock and `invalidate` takes this one, so holding
+      // both here would invert their order. the subscription is shared
+      // with any bridge watching the same base, so the cache piggybacks
+      // on its kernel subscription instead of adding one
+      auto subscription = FileSystemWatcherService::instance()->subscribe(
+        basePath,
+        nullptr,
+        [this](const auto&, const auto&, const auto&) {
+          this->invalidate();
+        }
+      );
+
+      do {
+        Lock lock(this->mutex);
+        this->watchers[basePath] = subscription;
+      } while (0);
+    #endif
+    }
+
+    void invalidate () {
+      Lock lock(this->mutex);
+      this->resolutions.clear();
+      this->mounts.clear();
+    }
+  };
+
+  static WebViewPathResolutionCache webViewPathResolutionCache;
+
+  static Router::WebViewURLPathResolution resolveURLPathForWebViewUncached (
+    String inputPath,
+    const String& basePath
+  ) {
     namespace fs = std::filesystem;
 
     if (inputPath.starts_with("/")) {
@@ -3872,6 +5547,36 @@ namespace SSC::IPC {
     return Router::WebViewURLPathResolution{};
   };
 
+  Router::WebViewURLPathResolution Router::resolveURLPathForWebView (String inputPath, const String& basePath) {
+    auto& cache = webViewPathResolutionCache;
+    const auto key = basePath + "\n" + inputPath;
+
+    do {
+      Lock lock(cache.mutex);
+      const auto entry = cache.resolutions.find(key);
+
+      if (entry != cache.resolutions.end()) {
+        return entry->second;
+      }
+    } while (0);
+
+    const auto resolution = resolveURLPathForWebViewUncached(inputPath, basePath);
+
+    cache.watch(basePath);
+
+    do {
+      Lock lock(cache.mutex);
+
+      if (cache.resolutions.size() >= WebViewPathResolutionCache::MAX_ENTRIES) {
+        cache.resolutions.clear();
+      }
+
+      cache.resolutions.insert_or_assign(key, resolution);
+    } while (0);
+
+    return resolution;
+  };
+
   Router::WebViewURLComponents Router::parseURL(const SSC::String& url) {
     Router::WebViewURLComponents components;
     components.originalUrl = url;
@@ -3979,16 +5684,18 @@ namespace SSC::IPC {
     return mounts;
   }
 
-  Router::WebViewNavigatorMount Router::resolveNavigatorMountForWebView (const String& path) {
+  static Router::WebViewNavigatorMount resolveNavigatorMountForWebViewUncached (
+    const String& path
+  ) {
     static const auto mounts = getWebViewNavigatorMounts();
 
     for (const auto& tuple : mounts) {
       if (path.starts_with(tuple.second)) {
         const auto relative = replace(path, tuple.second, "");
-        const auto resolution = resolveURLPathForWebView(relative, tuple.first);
+        const auto resolution = Router::resolveURLPathForWebView(relative, tuple.first);
         if (resolution.path.size() > 0) {
           const auto resolved = Path(tuple.first) / resolution.path.substr(1);
-          return WebViewNavigatorMount {
+          return Router::WebViewNavigatorMount {
             resolution,
             resolved.string(),
             path
@@ -3998,7 +5705,7 @@ namespace SSC::IPC {
             ? Path(tuple.first) / relative.substr(1)
             : Path(tuple.first) / relative;
 
-          return WebViewNavigatorMount {
+          return Router::WebViewNavigatorMount {
             resolution,
             resolved.string(),
             path
@@ -4007,10 +5714,46 @@ namespace SSC::IPC {
       }
     }
 
-    return WebViewNavigatorMount {};
+    return Router::WebViewNavigatorMount {};
+  }
+
+  Router::WebViewNavigatorMount Router::resolveNavigatorMountForWebView (const String& path) {
+    auto& cache = webViewPathResolutionCache;
+
+    do {
+      Lock lock(cache.mutex);
+      const auto entry = cache.mounts.find(path);
+
+      if (entry != cache.mounts.end()) {
+        return entry->second;
+      }
+    } while (0);
+
+    // flush mount entries when a configured mount root changes
+    static std::once_flag watchedMountRoots;
+    std::call_once(watchedMountRoots, [&cache]() {
+      for (const auto& tuple : getWebViewNavigatorMounts()) {
+        cache.watch(tuple.first);
+      }
+    });
+
+    const auto mount = resolveNavigatorMountForWebViewUncached(path);
+
+    do {
+      Lock lock(cache.mutex);
+
+      if (cache.mounts.size() >= WebViewPathResolutionCache::MAX_ENTRIES) {
+        cache.mounts.clear();
+      }
+
+      cache.mounts.insert_or_assign(path, mount);
+    } while (0);
+
+    return mount;
   }
 
   Router::Router () {
+    SSC_TRACE_SPAN("launch", "Router::Router");
     static auto userConfig = SSC::getUserConfig();
 
   #if defined(__APPLE__)
@@ -4023,10 +5766,10 @@ namespace SSC::IPC {
     [this->networkStatusObserver setRouter: this];
 
   #elif defined(__linux__) && !defined(__ANDROID__)
-    this->webkitWebContext = webkit_web_context_new();
+    this->webkitWebContext = getSharedWebKitWebContext();
   #endif
 
-    initRouterTable(this);
+    this->preserved = getRouterTable();
     registerSchemeHandler(this);
 
     this->preserveCurrentTable();
@@ -4112,39 +5855,76 @@ namespace SSC::IPC {
     this->networkStatusObserver = nullptr;
     this->locationObserver = nullptr;
     this->schemeHandler = nullptr;
+  #elif defined(__linux__) && !defined(__ANDROID__)
+    this->setWebKitWebView(nullptr);
   #endif
   }
 
-  void Router::preserveCurrentTable () {
-    Lock lock(mutex);
-    this->preserved = this->table;
+#if defined(__linux__) && !defined(__ANDROID__)
+  void Router::setWebKitWebView (WebKitWebView* webview) {
+    Lock lock(webkitWebViewRoutersMutex);
+
+    if (this->webkitWebView != nullptr) {
+      webkitWebViewRouters.erase(this->webkitWebView);
+    }
+
+    this->webkitWebView = webview;
+
+    if (webview != nullptr) {
+      webkitWebViewRouters.insert_or_assign(webview, this);
+    }
   }
+#endif
 
-  uint64_t Router::listen (const String& name, MessageCallback callback) {
+  void Router::preserveCurrentTable () {
     Lock lock(mutex);
 
-    if (!this->listeners.contains(name)) {
-      this->listeners[name] = std::vector<MessageCallbackListenerContext>();
+    // the shared built-in table is already preserved - only pay for a
+    // new snapshot when routes were mapped since construction
+    if (this->table.size() == 0) {
+      return;
+    }
+
+    auto preserved = std::make_shared<Table>(*this->preserved);
+    for (const auto& entry : this->table) {
+      preserved->insert_or_assign(entry.first, entry.second);
     }
+    this->preserved = std::move(preserved);
+  }
+
+  uint64_t Router::listen (const String& name, MessageCallback callback) {
+    Lock lock(listenersMutex);
 
-    auto& listeners = this->listeners.at(name);
+    auto listeners = std::make_shared<Listeners>(*this->listeners);
     auto token = rand64();
-    listeners.push_back(MessageCallbackListenerContext { token , callback });
+    (*listeners)[name].push_back(
+      MessageCallbackListenerContext { token , callback }
+    );
+
+    std::atomic_store(
+      &this->listeners,
+      std::shared_ptr<const Listeners>(listeners)
+    );
     return token;
   }
 
   bool Router::unlisten (const String& name, uint64_t token) {
-    Lock lock(mutex);
+    Lock lock(listenersMutex);
 
-    if (!this->listeners.contains(name)) {
+    if (!this->listeners->contains(name)) {
       return false;
     }
 
-    auto& listeners = this->listeners.at(name);
-    for (int i = 0; i < listeners.size(); ++i) {
-      const auto& listener = listeners[i];
+    auto listeners = std::make_shared<Listeners>(*this->listeners);
+    auto& contexts = listeners->at(name);
+    for (int i = 0; i < contexts.size(); ++i) {
+      const auto& listener = contexts[i];
       if (listener.token == token) {
-        listeners.erase(listeners.begin() + i);
+        contexts.erase(contexts.begin() + i);
+        std::atomic_store(
+          &this->listeners,
+          std::shared_ptr<const Listeners>(listeners)
+        );
         return true;
       }
     }
@@ -4168,6 +5948,35 @@ namespace SSC::IPC {
     }
   }
 
+  void Router::map (
+    const String& name,
+    const MessageSchema& schema,
+    MessageCallback callback
+  ) {
+    return this->map(name, true, schema, callback);
+  }
+
+  void Router::map (
+    const String& name,
+    bool async,
+    const MessageSchema& schema,
+    MessageCallback callback
+  ) {
+    Lock lock(mutex);
+
+    String data = name;
+    // URI hostnames are not case sensitive. Convert to lowercase.
+    std::transform(data.begin(), data.end(), data.begin(),
+      [](unsigned char c) { return std::tolower(c); });
+    if (callback != nullptr) {
+      table.insert_or_assign(data, MessageCallbackContext {
+        async,
+        callback,
+        std::make_shared<MessageSchema>(schema)
+      });
+    }
+  }
+
   void Router::unmap (const String& name) {
     Lock lock(mutex);
 
@@ -4180,6 +5989,45 @@ namespace SSC::IPC {
     }
   }
 
+  // opt-in Post body compression: messages sent with `compress=true`
+  // get bodies above the threshold deflated in the core, ahead of the
+  // scheme-handler/shared-buffer handoff, and tagged with
+  // `content-encoding: deflate` so the consumer inflates them (e.g.
+  // through `DecompressionStream`). bodies that do not shrink ship
+  // unchanged
+  static void maybeCompressPost (const Message& message, Result& result) {
+    static constexpr size_t COMPRESSION_THRESHOLD = 1024;
+
+    if (
+      result.post.body == nullptr ||
+      result.post.length < COMPRESSION_THRESHOLD ||
+      result.post.headers.has("content-encoding") ||
+      message.get("compress") != "true"
+    ) {
+      return;
+    }
+
+    auto bytes = BufferPool::instance()->acquireRaw(result.post.length);
+    const auto compressed = Deflate::compress(
+      result.post.body.get(),
+      result.post.length,
+      bytes,
+      result.post.length
+    );
+
+    if (compressed == 0) {
+      BufferPool::instance()->release(bytes, result.post.length);
+      return;
+    }
+
+    result.post.body = BufferPool::instance()->adopt(bytes, result.post.length);
+    result.post.length = compressed;
+    result.post.headers.set("content-encoding", "deflate");
+    result.post.headers.set("content-length", std::to_string(compressed));
+    result.headers.set("content-encoding", "deflate");
+    result.headers.set("content-length", std::to_string(compressed));
+  }
+
   bool Router::invoke (const String& uri, const char *bytes, size_t size) {
     return this->invoke(uri, bytes, size, [this](auto result) {
       this->send(result.seq, result.str(), result.post);
@@ -4196,7 +6044,9 @@ namespace SSC::IPC {
     size_t size,
     ResultCallback callback
   ) {
-    auto message = Message(uri, true);
+    // lazily parsed — args are sliced out of the URI and only decoded
+    // when a handler actually reads them
+    auto message = Message(uri, true, true);
     return this->invoke(message, bytes, size, callback);
   }
 
@@ -4206,27 +6056,97 @@ namespace SSC::IPC {
     size_t size,
     ResultCallback callback
   ) {
+    SSC_TRACE_SPAN("ipc", "Router::invoke");
     auto name = message.name;
     MessageCallbackContext ctx;
 
-    // URI hostnames are not case sensitive. Convert to lowercase.
-    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) {
-      return std::tolower(c);
-    });
+    // URI hostnames are not case sensitive. Route names are registered in
+    // lowercase, so only pay for a transform when the name actually has
+    // uppercase characters in it.
+    if (std::any_of(name.begin(), name.end(), [](unsigned char c) {
+      return std::isupper(c);
+    })) {
+      std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) {
+        return std::tolower(c);
+      });
+    }
 
     do {
       // lookup router function in the preserved table,
-      // then the public table, return if unable to determine a context
-      if (this->preserved.find(name) != this->preserved.end()) {
-        ctx = this->preserved.at(name);
-      } else if (this->table.find(name) != this->table.end()) {
-        ctx = this->table.at(name);
+      // then the public table, return if unable to determine a context —
+      // one hash over the name, no tree walk
+      auto preserved = this->preserved->find(name);
+      if (preserved != this->preserved->end()) {
+        ctx = preserved->second;
+      } else if (auto entry = this->table.find(name); entry != this->table.end()) {
+        ctx = entry->second;
       } else {
         return false;
       }
     } while (0);
 
+    // immutable routes render once - later calls (from any window) are
+    // answered from the process-wide cache with zero handler execution
+    if (ctx.immutable && ctx.callback != nullptr) {
+      static Mutex immutableResponsesMutex;
+      static std::unordered_map<String, String, TableHash, std::equal_to<>> immutableResponses;
+
+      String cached;
+
+      do {
+        Lock lock(immutableResponsesMutex);
+        const auto entry = immutableResponses.find(name);
+
+        if (entry != immutableResponses.end()) {
+          cached = entry->second;
+        }
+      } while (0);
+
+      if (cached.size() > 0) {
+        auto result = Result(message.seq, message, JSON::Raw(cached));
+
+        if (result.seq == "-1" || callback == nullptr) {
+          this->send(result.seq, result.str(), result.post);
+        } else {
+          callback(result);
+        }
+
+        return true;
+      }
+
+      // first request anywhere: run the handler, capture the rendered
+      // reply for every later caller, then answer normally
+      ctx.callback(message, this, [message, callback, name, this](const auto result) {
+        do {
+          Lock lock(immutableResponsesMutex);
+          String rendered;
+          result.json().write(rendered);
+          immutableResponses.insert_or_assign(name, std::move(rendered));
+        } while (0);
+
+        if (result.seq == "-1" || callback == nullptr) {
+          this->send(result.seq, result.str(), result.post);
+        } else {
+          callback(result);
+        }
+      });
+
+      return true;
+    }
+
     if (ctx.callback != nullptr) {
+      // per-module diagnostics, keyed off the route name prefix: count
+      // the call here and record dispatch-to-reply latency when the
+      // handler replies - both are relaxed atomic adds
+      auto metrics = this->core != nullptr
+        ? this->core->diagnostics.metricsForRoute(name)
+        : nullptr;
+      const auto started = metrics != nullptr ? uv_hrtime() : 0;
+
+      if (metrics != nullptr) {
+        metrics->calls.fetch_add(1, std::memory_order_relaxed);
+      }
+
       Message msg(message);
       // decorate message with buffer if buffer was previously
       // mapped with `ipc://buffer.map`, which we do on Linux
@@ -4241,25 +6161,66 @@ namespace SSC::IPC {
         memcpy(msg.buffer.bytes, bytes, size);
       }
 
-      // named listeners
-      do {
-        auto listeners = this->listeners[name];
-        for (const auto& listener : listeners) {
-          listener.callback(msg, this, [](const auto& _) {});
+      // decode and validate arguments once, up front, for routes mapped
+      // with a schema — handlers read `msg.typed` instead of re-parsing
+      if (ctx.schema != nullptr) {
+        auto typed = std::make_shared<TypedArguments>();
+        auto err = TypedArguments::decode(msg, *ctx.schema, *typed);
+
+        if (!err.isNull()) {
+          auto result = Result(Result::Err { msg, err });
+
+          if (result.seq == "-1" || callback == nullptr) {
+            this->send(result.seq, result.str(), result.post);
+          } else {
+            callback(result);
+          }
+
+          CLEANUP_AFTER_INVOKE_CALLBACK(this, msg, result);
+          return true;
         }
-      } while (0);
 
-      // wild card (*) listeners
+        msg.typed = typed;
+      }
+
+      // listeners are dispatched against an immutable snapshot so a hot
+      // invoke stream never contends with `listen()`/`unlisten()`
       do {
-        auto listeners = this->listeners["*"];
-        for (const auto& listener : listeners) {
-          listener.callback(msg, this, [](const auto& _) {});
+        auto listeners = std::atomic_load(&this->listeners);
+
+        // named listeners
+        auto named = listeners->find(name);
+        if (named != listeners->end()) {
+          for (const auto& listener : named->second) {
+            listener.callback(msg, this, [](const auto& _) {});
+          }
+        }
+
+        // wild card (*) listeners
+        auto wildcard = listeners->find("*");
+        if (wildcard != listeners->end()) {
+          for (const auto& listener : wildcard->second) {
+            listener.callback(msg, this, [](const auto& _) {});
+          }
         }
       } while (0);
 
       if (ctx.async) {
-        auto dispatched = this->dispatch([ctx, msg, callback, this]() mutable {
-          ctx.callback(msg, this, [msg, callback, this](const auto result) mutable {
+        auto dispatched = this->dispatch([ctx, msg, name, callback, metrics, started, this]() mutable {
+          // attribute the synchronous portion of the handler for the
+          // stall watchdog - cleared as soon as it returns, replies
+          // that arrive later are not route execution
+          if (this->core != nullptr) {
+            this->core->diagnostics.setActiveRoute(name.c_str());
+          }
+
+          ctx.callback(msg, this, [msg, callback, metrics, started, this](auto result) mutable {
+            if (metrics != nullptr) {
+              metrics->latency.record(uv_hrtime() - started);
+            }
+
+            maybeCompressPost(msg, result);
+
             if (result.seq == "-1") {
               this->send(result.seq, result.str(), result.post);
             } else {
@@ -4268,6 +6229,10 @@ namespace SSC::IPC {
 
             CLEANUP_AFTER_INVOKE_CALLBACK(this, msg, result);
           });
+
+          if (this->core != nullptr) {
+            this->core->diagnostics.setActiveRoute(nullptr);
+          }
         });
 
         if (!dispatched) {
@@ -4276,7 +6241,17 @@ namespace SSC::IPC {
 
         return dispatched;
       } else {
-        ctx.callback(msg, this, [msg, callback, this](const auto result) mutable {
+        if (this->core != nullptr) {
+          this->core->diagnostics.setActiveRoute(name.c_str());
+        }
+
+        ctx.callback(msg, this, [msg, callback, metrics, started, this](auto result) mutable {
+          if (metrics != nullptr) {
+            metrics->latency.record(uv_hrtime() - started);
+          }
+
+          maybeCompressPost(msg, result);
+
           if (result.seq == "-1") {
             this->send(result.seq, result.str(), result.post);
           } else {
@@ -4285,6 +6260,10 @@ namespace SSC::IPC {
           CLEANUP_AFTER_INVOKE_CALLBACK(this, msg, result);
         });
 
+        if (this->core != nullptr) {
+          this->core->diagnostics.setActiveRoute(nullptr);
+        }
+
         return true;
       }
     }
@@ -4295,11 +6274,36 @@ namespace SSC::IPC {
   bool Router::send (
     const Message::Seq& seq,
     const String data,
-    const Post post
+    const Post post,
+    bool immediate
   ) {
     if (post.body || seq == "-1") {
+      if (this->notifyPostFunction != nullptr) {
+        auto copy = post;
+        copy.id = this->core->registerPost(copy);
+
+        if (this->notifyPostFunction(copy.id, seq, data, copy)) {
+          return true;
+        }
+
+        // the binary channel rejected the record (ring full or torn
+        // down) - announce through the legacy script instead, keeping
+        // the id already registered
+        auto script = this->core->createPost(seq, data, copy);
+
+        if (immediate) {
+          return this->evaluateJavaScript(script);
+        }
+
+        return this->queueJavaScript(script);
+      }
+
       auto script = this->core->createPost(seq, data, post);
-      return this->evaluateJavaScript(script);
+      if (immediate) {
+        return this->evaluateJavaScript(script);
+      }
+
+      return this->queueJavaScript(script);
     }
 
     auto value = encodeURIComponent(data);
@@ -4309,7 +6313,11 @@ namespace SSC::IPC {
       value
     );
 
-    return this->evaluateJavaScript(script);
+    if (immediate) {
+      return this->evaluateJavaScript(script);
+    }
+
+    return this->queueJavaScript(script);
   }
 
   bool Router::emit (
@@ -4318,11 +6326,65 @@ namespace SSC::IPC {
   ) {
     auto value = encodeURIComponent(data);
     auto script = getEmitToRenderProcessJavaScript(name, value);
-    return this->evaluateJavaScript(script);
+    return this->queueJavaScript(script);
+  }
+
+  bool Router::queueJavaScript (const String js) {
+    if (this->evaluateJavaScriptFunction == nullptr) {
+      return false;
+    }
+
+    bool schedule = false;
+    do {
+      Lock lock(this->pendingScriptsMutex);
+      this->pendingScripts.push_back(js);
+
+      if (!this->hasPendingScriptsFlush) {
+        this->hasPendingScriptsFlush = true;
+        schedule = true;
+      }
+    } while (0);
+
+    if (schedule && !this->dispatch([this]() { this->flushPendingScripts(); })) {
+      // no dispatch function is configured so flush synchronously instead
+      // of letting the queue grow unbounded
+      this->flushPendingScripts();
+    }
+
+    return true;
+  }
+
+  void Router::flushPendingScripts () {
+    Vector<String> scripts;
+    do {
+      Lock lock(this->pendingScriptsMutex);
+      scripts.swap(this->pendingScripts);
+      this->hasPendingScriptsFlush = false;
+    } while (0);
+
+    if (scripts.size() == 0) {
+      return;
+    }
+
+    if (scripts.size() == 1) {
+      this->evaluateJavaScript(scripts[0]);
+      return;
+    }
+
+    // every queued script is a self contained IIFE produced by
+    // `createJavaScript()` so a burst of results can be evaluated in the
+    // webview as one batched evaluation instead of one per message
+    StringStream batch;
+    for (const auto& script : scripts) {
+      batch << script << "\n";
+    }
+
+    this->evaluateJavaScript(batch.str());
   }
 
   bool Router::evaluateJavaScript (const String js) {
     if (this->evaluateJavaScriptFunction != nullptr) {
+      SSC_TRACE_SPAN("webview", "Router::evaluateJavaScript");
       this->evaluateJavaScriptFunction(js);
       return true;
     }
@@ -4397,6 +6459,11 @@ namespace SSC::IPC {
 
     auto router = self.router;
     self.router->dispatch([router, json, name] () {
+      // the path changed, so any cached interface enumeration is stale
+      if (router->core != nullptr) {
+        router->core->os.invalidateCachedInfo("os.networkInterfaces");
+      }
+
       auto data = JSON::Object(json);
       router->emit(name, data.str());
     });
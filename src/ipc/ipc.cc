@@ -1,5 +1,14 @@
 #include "../core/core.hh"
 #include "ipc.hh"
+
+#include <charconv>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 namespace SSC {
   #if defined(_WIN32)
   SSC::String FormatError(DWORD error, SSC::String source) {
@@ -23,6 +32,358 @@ namespace SSC {
   #endif
 }
 namespace SSC::IPC {
+  static inline uint16_t readUint16LE (const unsigned char* bytes) {
+    return (uint16_t) bytes[0] | ((uint16_t) bytes[1] << 8);
+  }
+
+  static inline uint32_t readUint32LE (const unsigned char* bytes) {
+    return (
+      (uint32_t) bytes[0] |
+      ((uint32_t) bytes[1] << 8) |
+      ((uint32_t) bytes[2] << 16) |
+      ((uint32_t) bytes[3] << 24)
+    );
+  }
+
+  static inline void writeUint16LE (Vector<char>& out, uint16_t value) {
+    out.push_back((char) (value & 0xFF));
+    out.push_back((char) ((value >> 8) & 0xFF));
+  }
+
+  static inline void writeUint32LE (Vector<char>& out, uint32_t value) {
+    out.push_back((char) (value & 0xFF));
+    out.push_back((char) ((value >> 8) & 0xFF));
+    out.push_back((char) ((value >> 16) & 0xFF));
+    out.push_back((char) ((value >> 24) & 0xFF));
+  }
+
+  std::shared_ptr<SharedMemoryRegion> SharedMemoryRegion::create (size_t size) {
+    if (size == 0) {
+      return nullptr;
+    }
+
+    auto region = std::make_shared<SharedMemoryRegion>();
+
+  // `memfd_create` is not available on Android below API 30 and the
+  // runtime library supports earlier levels, so Android takes the
+  // unsupported arm and callers degrade to copying transfers
+  #if defined(__linux__) && !defined(__ANDROID__)
+    region->fd = (int) memfd_create("ssc-ipc-buffer", MFD_CLOEXEC);
+
+    if (region->fd < 0) {
+      return nullptr;
+    }
+  #elif defined(__APPLE__)
+    // anonymous POSIX shared memory: unlink right after creation so the
+    // region only lives as long as its descriptor and mapping do
+    char name[32];
+    snprintf(name, sizeof(name), "/ssc-ipc-%d-%p", getpid(), (void*) region.get());
+    region->fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+
+    if (region->fd < 0) {
+      return nullptr;
+    }
+
+    shm_unlink(name);
+  #elif defined(_WIN32)
+    region->mapping = CreateFileMappingW(
+      INVALID_HANDLE_VALUE,
+      nullptr,
+      PAGE_READWRITE,
+      (DWORD) ((uint64_t) size >> 32),
+      (DWORD) (size & 0xFFFFFFFF),
+      nullptr
+    );
+
+    if (region->mapping == nullptr) {
+      return nullptr;
+    }
+  #else
+    return nullptr;
+  #endif
+
+  #if !defined(_WIN32)
+    if (ftruncate(region->fd, (off_t) size) != 0) {
+      return nullptr;
+    }
+
+    auto bytes = mmap(
+      nullptr,
+      size,
+      PROT_READ | PROT_WRITE,
+      MAP_SHARED,
+      region->fd,
+      0
+    );
+
+    if (bytes == MAP_FAILED) {
+      return nullptr;
+    }
+
+    region->bytes = reinterpret_cast<char*>(bytes);
+  #else
+    region->bytes = reinterpret_cast<char*>(
+      MapViewOfFile(region->mapping, FILE_MAP_ALL_ACCESS, 0, 0, size)
+    );
+
+    if (region->bytes == nullptr) {
+      return nullptr;
+    }
+  #endif
+
+    region->length = size;
+    return region;
+  }
+
+  std::shared_ptr<SharedMemoryRegion> SharedMemoryRegion::mapFile (
+    int fd,
+    size_t size,
+    size_t offset
+  ) {
+    if (size == 0) {
+      return nullptr;
+    }
+
+    auto region = std::make_shared<SharedMemoryRegion>();
+
+  #if defined(_WIN32)
+    auto handle = uv_get_osfhandle(fd);
+
+    if (handle == INVALID_HANDLE_VALUE) {
+      return nullptr;
+    }
+
+    auto end = (uint64_t) offset + (uint64_t) size;
+    region->mapping = CreateFileMappingW(
+      handle,
+      nullptr,
+      PAGE_READWRITE,
+      (DWORD) (end >> 32),
+      (DWORD) (end & 0xFFFFFFFF),
+      nullptr
+    );
+
+    auto access = (DWORD) FILE_MAP_ALL_ACCESS;
+
+    if (region->mapping == nullptr) {
+      // fall back to a read only view for descriptors opened read only
+      region->mapping = CreateFileMappingW(
+        handle,
+        nullptr,
+        PAGE_READONLY,
+        (DWORD) (end >> 32),
+        (DWORD) (end & 0xFFFFFFFF),
+        nullptr
+      );
+      access = FILE_MAP_READ;
+    }
+
+    if (region->mapping == nullptr) {
+      return nullptr;
+    }
+
+    region->bytes = reinterpret_cast<char*>(MapViewOfFile(
+      region->mapping,
+      access,
+      (DWORD) ((uint64_t) offset >> 32),
+      (DWORD) (offset & 0xFFFFFFFF),
+      size
+    ));
+
+    if (region->bytes == nullptr) {
+      return nullptr;
+    }
+  #else
+    auto bytes = mmap(
+      nullptr,
+      size,
+      PROT_READ | PROT_WRITE,
+      MAP_SHARED,
+      fd,
+      (off_t) offset
+    );
+
+    if (bytes == MAP_FAILED) {
+      // fall back to a read only view for descriptors opened read only
+      bytes = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, (off_t) offset);
+    }
+
+    if (bytes == MAP_FAILED) {
+      return nullptr;
+    }
+
+    region->bytes = reinterpret_cast<char*>(bytes);
+    // `fd` stays owned by the caller — only the mapping is released here
+  #endif
+
+    region->length = size;
+    return region;
+  }
+
+  SharedMemoryRegion::~SharedMemoryRegion () {
+  #if defined(_WIN32)
+    if (this->bytes != nullptr) {
+      UnmapViewOfFile(this->bytes);
+    }
+
+    if (this->mapping != nullptr) {
+      CloseHandle(this->mapping);
+    }
+  #else
+    if (this->bytes != nullptr) {
+      munmap(this->bytes, this->length);
+    }
+
+    if (this->fd >= 0) {
+      close(this->fd);
+    }
+  #endif
+  }
+
+  String getETagForContent (const char* bytes, size_t size) {
+    // FNV-1a over the content - cheap, stable across runs for the same
+    // bytes, and entirely sufficient for cache validation
+    uint64_t hash = 0xCBF29CE484222325ULL;
+
+    for (size_t i = 0; i < size; ++i) {
+      hash ^= (unsigned char) bytes[i];
+      hash *= 0x100000001B3ULL;
+    }
+
+    char buffer[19];
+    snprintf(buffer, sizeof(buffer), "\"%016llx\"", (unsigned long long) hash);
+    return String(buffer);
+  }
+
+  const ModuleSourceCacheEntry& getCachedModuleSource (const String& url) {
+    static Mutex mutex;
+    static std::map<String, ModuleSourceCacheEntry> cache;
+
+    Lock lock(mutex);
+    auto entry = cache.find(url);
+
+    if (entry == cache.end()) {
+      auto source = trim(tmpl(moduleTemplate, Map { {"url", url} }));
+      auto etag = getETagForContent(source.data(), source.size());
+      entry = cache.emplace(url, ModuleSourceCacheEntry {
+        std::move(source),
+        std::move(etag)
+      }).first;
+    }
+
+    return entry->second;
+  }
+
+  bool isETagMatch (const String& ifNoneMatch, const String& etag) {
+    // `if-none-match` may carry a list and weak validators - a strong
+    // content hash compares equal to its weak form for a 304 answer
+    for (auto candidate : split(ifNoneMatch, ',')) {
+      auto trimmed = trim(candidate);
+
+      if (trimmed.starts_with("W/")) {
+        trimmed = trimmed.substr(2);
+      }
+
+      if (trimmed == "*" || trimmed == etag) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  bool Frame::isFrame (const char* bytes, size_t size) {
+    if (bytes == nullptr || size < 5) return false;
+    auto pointer = reinterpret_cast<const unsigned char*>(bytes);
+    return readUint32LE(pointer) == MAGIC && pointer[4] == VERSION;
+  }
+
+  bool Frame::decode (const char* bytes, size_t size) {
+    if (!isFrame(bytes, size)) return false;
+
+    auto pointer = reinterpret_cast<const unsigned char*>(bytes);
+    size_t offset = 5; // magic + version
+
+    auto readString = [&](String& out, size_t lengthSize) -> bool {
+      if (offset + lengthSize > size) return false;
+      size_t length = lengthSize == 2
+        ? readUint16LE(pointer + offset)
+        : readUint32LE(pointer + offset);
+      offset += lengthSize;
+      if (offset + length > size) return false;
+      out = String(reinterpret_cast<const char*>(pointer + offset), length);
+      offset += length;
+      return true;
+    };
+
+    if (!readString(this->name, 2)) return false;
+    if (!readString(this->seq, 2)) return false;
+
+    if (offset + 2 > size) return false;
+    auto count = readUint16LE(pointer + offset);
+    offset += 2;
+
+    for (uint16_t i = 0; i < count; ++i) {
+      String key;
+      String value;
+      if (!readString(key, 2)) return false;
+      if (!readString(value, 4)) return false;
+      this->args[key] = value;
+    }
+
+    if (offset + 4 > size) return false;
+    auto bodySize = readUint32LE(pointer + offset);
+    offset += 4;
+    if (offset + bodySize > size) return false;
+
+    this->body = bodySize > 0 ? bytes + offset : nullptr;
+    this->size = bodySize;
+    return true;
+  }
+
+  Vector<char> Frame::encode (
+    const String& name,
+    const String& seq,
+    const Map& args,
+    const char* body,
+    size_t size
+  ) {
+    Vector<char> out;
+    out.reserve(5 + 4 + name.size() + seq.size() + size);
+
+    writeUint32LE(out, MAGIC);
+    out.push_back((char) VERSION);
+
+    writeUint16LE(out, (uint16_t) name.size());
+    out.insert(out.end(), name.begin(), name.end());
+
+    writeUint16LE(out, (uint16_t) seq.size());
+    out.insert(out.end(), seq.begin(), seq.end());
+
+    writeUint16LE(out, (uint16_t) args.size());
+    for (const auto& entry : args) {
+      writeUint16LE(out, (uint16_t) entry.first.size());
+      out.insert(out.end(), entry.first.begin(), entry.first.end());
+      writeUint32LE(out, (uint32_t) entry.second.size());
+      out.insert(out.end(), entry.second.begin(), entry.second.end());
+    }
+
+    writeUint32LE(out, (uint32_t) size);
+    if (body != nullptr && size > 0) {
+      out.insert(out.end(), body, body + size);
+    }
+
+    return out;
+  }
+
+  template <typename T>
+  static inline bool parseNumber (StringView source, T& output) {
+    auto begin = source.data();
+    auto end = begin + source.size();
+    auto result = std::from_chars(begin, end, output);
+    return result.ec == std::errc() && result.ptr == end;
+  }
+
   Message::Message (const Message& message) {
     this->buffer.bytes = message.buffer.bytes;
     this->buffer.size = message.buffer.size;
@@ -30,12 +391,42 @@ namespace SSC::IPC {
     this->index = message.index;
     this->name = message.name;
     this->seq = message.seq;
+    this->seqNumber = message.seqNumber;
+    this->seqIsNumeric = message.seqIsNumeric;
     this->uri = message.uri;
     this->args = message.args;
+    this->slices = message.slices;
     this->isHTTP = message.isHTTP;
+    this->rawArgs = message.rawArgs;
+    this->lazy = message.lazy;
+    this->decodeValues = message.decodeValues;
+    this->nameSlice = message.nameSlice;
+    this->seqSlice = message.seqSlice;
+    this->typed = message.typed;
     this->cancel = message.cancel;
   }
 
+  Message::Message (const Frame& frame) {
+    this->name = frame.name;
+    this->seq = frame.seq;
+    this->seqIsNumeric = parseNumber(StringView(this->seq), this->seqNumber);
+    this->args = frame.args;
+    this->uri = "ipc://" + frame.name;
+    this->rawArgs = true;
+
+    if (this->args.count("value")) {
+      this->value = this->args.at("value");
+    }
+
+    if (this->args.count("index")) {
+      try {
+        this->index = std::stoi(this->args.at("index"));
+      } catch (...) {
+        debug("Warning: received non-integer index");
+      }
+    }
+  }
+
   Message::Message (const String& source, char *bytes, size_t size)
     : Message(source, false, bytes, size)
   {}
@@ -55,63 +446,207 @@ namespace SSC::IPC {
   : Message(source, false)
   {}
 
+  // the small fixed argument vocabulary the runtime's own routes read
+  // on hot paths — keys are interned when the parser records their
+  // slices so `getView()` compares an integer per entry instead of a
+  // string, mirroring the well-known header key table in `Headers`
+  static const char* WELL_KNOWN_ARG_KEYS[] = {
+    "id",
+    "seq",
+    "value",
+    "index",
+    "size",
+    "offset",
+    "sizes",
+    "port",
+    "address"
+  };
+
+  static int internArgKey (StringView key) {
+    constexpr auto count = (int) (
+      sizeof(WELL_KNOWN_ARG_KEYS) / sizeof(WELL_KNOWN_ARG_KEYS[0])
+    );
+
+    for (int i = 0; i < count; ++i) {
+      if (key == WELL_KNOWN_ARG_KEYS[i]) {
+        return i;
+      }
+    }
+
+    return -1;
+  }
+
+  Message::Message (const String& source, bool decodeValues, bool lazyParse) {
+    this->uri = source;
+    this->lazy = lazyParse;
+    this->decodeValues = decodeValues;
+
+    auto start = this->uri.find("ipc://");
+    if (start == String::npos) return;
+    start += 6;
+
+    // name runs to the first of '?', '/' or end of source
+    auto nameEnd = this->uri.find_first_of("?/", start);
+    this->nameSlice = Slice {
+      start,
+      (nameEnd == String::npos ? this->uri.size() : nameEnd) - start
+    };
+    this->name = String(this->view(this->nameSlice));
+
+    auto query = this->uri.find('?', start);
+    if (query == String::npos) return;
+
+    // one pass over the query string recording key/value slices —
+    // nothing is copied or decoded until an argument is actually read
+    auto offset = query + 1;
+    while (offset < this->uri.size()) {
+      auto end = this->uri.find('&', offset);
+      if (end == String::npos) end = this->uri.size();
+
+      auto equals = this->uri.find('=', offset);
+      if (equals != String::npos && equals < end) {
+        auto key = Slice { offset, equals - offset };
+        auto value = Slice { equals + 1, end - equals - 1 };
+
+        if (key.length > 0 && value.length > 0) {
+          auto keyView = this->view(key);
+          this->slices.push_back({ key, value, internArgKey(keyView) });
+
+          if (keyView == "seq") {
+            this->seqSlice = value;
+            auto raw = this->view(value);
+
+            // virtually all seqs are decimal integers generated by the
+            // JS side — digits never need URI decoding, so the numeric
+            // form skips the decode pass entirely
+            if (parseNumber(raw, this->seqNumber)) {
+              this->seqIsNumeric = true;
+              this->seq = String(raw);
+            } else {
+              this->seq = decodeURIComponent(String(raw));
+            }
+          } else if (keyView == "value") {
+            this->value = decodeURIComponent(String(this->view(value)));
+          } else if (keyView == "index") {
+            try {
+              this->index = std::stoi(String(this->view(value)));
+            } catch (...) {
+              debug("Warning: received non-integer index");
+            }
+          }
+        }
+      }
+
+      offset = end + 1;
+    }
+  }
+
+  StringView Message::view (const Slice& slice) const {
+    return StringView(this->uri).substr(slice.offset, slice.length);
+  }
+
+  StringView Message::nameView () const {
+    return this->view(this->nameSlice);
+  }
+
+  StringView Message::seqView () const {
+    return this->view(this->seqSlice);
+  }
+
+  StringView Message::getView (const String& key) const {
+    // probe keys in the hot vocabulary match on their interned id;
+    // unknown keys fall back to comparing the slice itself
+    const auto interned = internArgKey(key);
+
+    for (const auto& slice : this->slices) {
+      if (
+        interned != -1
+          ? slice.interned == interned
+          : this->view(slice.key) == key
+      ) {
+        return this->view(slice.value);
+      }
+    }
+
+    return StringView();
+  }
+
+  void Message::materializeArgs () const {
+    if (!this->lazy) return;
+
+    for (const auto& slice : this->slices) {
+      auto key = String(this->view(slice.key));
+      if (this->args.count(key) > 0) continue;
+      auto value = String(this->view(slice.value));
+      this->args[key] = this->decodeValues ? decodeURIComponent(value) : value;
+    }
+  }
+
   Message::Message (const String& source, bool decodeValues) {
-    String str = source;
-    uri = str;
+    uri = source;
+    this->decodeValues = decodeValues;
 
     // bail if missing protocol prefix
-    if (str.find("ipc://") == -1) return;
+    if (uri.find("ipc://") == String::npos) return;
 
     // bail if malformed
-    if (str.compare("ipc://") == 0) return;
-    if (str.compare("ipc://?") == 0) return;
-
-    String query;
-    String path;
-
-    auto raw = split(str, '?');
-    path = raw[0];
-    if (raw.size() > 1) query = raw[1];
+    if (uri.compare("ipc://") == 0) return;
+    if (uri.compare("ipc://?") == 0) return;
 
-    auto parts = split(path, '/');
-    if (parts.size() >= 1) name = parts[1];
+    // tokenize with views into `uri` - nothing is copied until an
+    // argument is actually stored
+    const auto raw = splitView(this->uri, '?');
+    const auto parts = splitView(raw[0], '/');
+    if (parts.size() >= 2) name = String(parts[1]);
 
     if (raw.size() != 2) return;
-    auto pairs = split(raw[1], '&');
+    const auto pairs = splitView(raw[1], '&');
 
-    for (auto& rawPair : pairs) {
-      auto pair = split(rawPair, '=');
+    for (const auto& rawPair : pairs) {
+      const auto pair = splitView(rawPair, '=');
       if (pair.size() <= 1) continue;
 
-      if (pair[0].compare("index") == 0) {
+      const auto key = String(pair[0]);
+      const auto entry = String(pair[1]);
+
+      if (key.compare("index") == 0) {
         try {
-          index = std::stoi(pair[1].size() > 0 ? pair[1] : "0");
+          index = std::stoi(entry.size() > 0 ? entry : "0");
         } catch (...) {
           debug("Warning: received non-integer index");
         }
       }
 
-      if (pair[0].compare("value") == 0) {
-        value = decodeURIComponent(pair[1]);
+      if (key.compare("value") == 0) {
+        value = decodeURIComponent(entry);
       }
 
-      if (pair[0].compare("seq") == 0) {
-        seq = decodeURIComponent(pair[1]);
+      if (key.compare("seq") == 0) {
+        if (parseNumber(StringView(entry), this->seqNumber)) {
+          this->seqIsNumeric = true;
+          seq = entry;
+        } else {
+          seq = decodeURIComponent(entry);
+        }
       }
 
       if (decodeValues) {
-        args[pair[0]] = decodeURIComponent(pair[1]);
+        args[key] = decodeURIComponent(entry);
       } else {
-        args[pair[0]] = pair[1];
+        args[key] = entry;
       }
     }
   }
 
   bool Message::has (const String& key) const {
-    return (
+    if (
       this->args.find(key) != this->args.end() &&
       this->args.at(key).size() > 0
-    );
+    ) {
+      return true;
+    }
+
+    return this->lazy && this->getView(key).size() > 0;
   }
 
   String Message::get (const String& key) const {
@@ -119,7 +654,91 @@ namespace SSC::IPC {
   }
 
   String Message::get (const String& key, const String &fallback) const {
-    return args.count(key) ? decodeURIComponent(args.at(key)) : fallback;
+    if (args.count(key)) {
+      return this->rawArgs ? args.at(key) : decodeURIComponent(args.at(key));
+    }
+
+    if (this->lazy) {
+      auto view = this->getView(key);
+      if (view.size() > 0) {
+        // materialize and decode only now that the argument is read,
+        // mirroring what the eager parser would have stored
+        auto value = String(view);
+        if (this->decodeValues) {
+          value = decodeURIComponent(value);
+        }
+        this->args[key] = value;
+        return decodeURIComponent(value);
+      }
+    }
+
+    return fallback;
+  }
+
+  const TypedArguments::Value& TypedArguments::get (const String& name) const {
+    static const Value empty;
+    auto entry = this->values.find(name);
+    return entry != this->values.end() ? entry->second : empty;
+  }
+
+  JSON::Any TypedArguments::decode (
+    const Message& message,
+    const MessageSchema& schema,
+    TypedArguments& output
+  ) {
+    for (const auto& field : schema.fields) {
+      // numeric fields parse straight out of the raw slice — URI encoding
+      // never changes digits — strings go through `get()` for decoding
+      auto view = message.lazy ? message.getView(field.name) : StringView();
+      String stored;
+
+      if (view.size() == 0) {
+        stored = message.get(field.name);
+        view = stored;
+      }
+
+      if (view.size() == 0) {
+        if (field.required && field.fallback.size() == 0) {
+          return JSON::Object::Entries {
+            {"message", "Expecting '" + field.name + "' in parameters"}
+          };
+        }
+
+        view = field.fallback;
+      }
+
+      auto& value = output.values[field.name];
+      auto valid = true;
+
+      switch (field.type) {
+        case MessageSchema::Type::Boolean:
+          value.boolean = view == "true";
+          break;
+        case MessageSchema::Type::Integer:
+          valid = parseNumber(view, value.integer);
+          break;
+        case MessageSchema::Type::Signed64:
+          valid = parseNumber(view, value.signed64);
+          break;
+        case MessageSchema::Type::Unsigned64:
+          valid = parseNumber(view, value.unsigned64);
+          break;
+        case MessageSchema::Type::Size:
+          valid = parseNumber(view, value.size);
+          break;
+        case MessageSchema::Type::String:
+          value.string = message.get(field.name, field.fallback);
+          break;
+      }
+
+      if (!valid) {
+        return JSON::Object::Entries {
+          {"message", "Invalid '" + field.name + "' given in parameters"}
+        };
+      }
+    }
+
+    return nullptr;
   }
 
   Result::Result (
@@ -128,16 +747,15 @@ namespace SSC::IPC {
   ) {
     this->id = rand64();
     this->seq = seq;
-    this->message = message;
     this->source = message.name;
-    this->post.workerId = this->message.get("runtime-worker-id");
+    this->post.workerId = message.get("runtime-worker-id");
   }
 
   Result::Result (
     const Message::Seq& seq,
     const Message& message,
     JSON::Any value
-  ) : Result(seq, message, value, Post{}) {
+  ) : Result(seq, message, std::move(value), Post{}) {
   }
 
   Result::Result (
@@ -146,15 +764,15 @@ namespace SSC::IPC {
     JSON::Any value,
     Post post
   ) : Result(seq, message) {
-    this->post = post;
-    this->headers = Headers(post.headers);
+    this->post = std::move(post);
+    this->headers = this->post.headers;
 
     if (this->post.workerId.size() == 0) {
-      this->post.workerId = this->message.get("runtime-worker-id");
+      this->post.workerId = message.get("runtime-worker-id");
     }
 
     if (value.type != JSON::Type::Any) {
-      this->value = value;
+      this->value = std::move(value);
     }
   }
 
@@ -163,16 +781,25 @@ namespace SSC::IPC {
     this->value = value;
   }
 
-  Result::Result (const Err error): Result(error.message.seq, error.message) {
+  Result::Result (const Err& error) {
+    this->id = rand64();
+    this->seq = error.seq;
+    this->source = error.source;
     this->err = error.value;
-    this->source = error.message.name;
+    this->post.workerId = error.workerId;
   }
 
-  Result::Result (const Data data): Result(data.message.seq, data.message) {
+  Result::Result (const Data& data) {
+    this->id = rand64();
+    this->seq = data.seq;
+    this->source = data.source;
     this->data = data.value;
     this->post = data.post;
-    this->source = data.message.name;
-    this->headers = Headers(data.post.headers);
+    this->headers = this->post.headers;
+
+    if (this->post.workerId.size() == 0) {
+      this->post.workerId = data.workerId;
+    }
   }
 
   JSON::Any Result::json () const {
@@ -191,33 +818,39 @@ namespace SSC::IPC {
       return this->value;
     }
 
-    auto entries = JSON::Object::Entries {
+    auto object = JSON::Object(JSON::Object::Entries {
       {"source", this->source},
       {"id", std::to_string(this->id)}
-    };
+    });
 
     if (!this->err.isNull()) {
-      entries["err"] = this->err;
+      object.set("err", this->err);
       if (this->err.isObject()) {
         if (this->err.as<JSON::Object>().has("id")) {
-          entries["id"] = this->err.as<JSON::Object>().get("id");
+          object.set("id", this->err.as<JSON::Object>().get("id"));
         }
       }
     } else if (!this->data.isNull()) {
-      entries["data"] = this->data;
+      object.set("data", this->data);
       if (this->data.isObject()) {
         if (this->data.as<JSON::Object>().has("id")) {
-          entries["id"] = this->data.as<JSON::Object>().get("id");
+          object.set("id", this->data.as<JSON::Object>().get("id"));
         }
       }
     }
 
-    return JSON::Object(entries);
+    return object;
   }
 
   String Result::str () const {
-    auto json = this->json();
-    return json.str();
+    SSC_TRACE_SPAN("ipc", "Result::str");
+    // replies are serialized on the loop thread — reuse one render
+    // buffer per thread so its capacity is amortized across replies
+    // instead of regrowing a fresh string every iteration
+    static thread_local String buffer;
+    buffer.clear();
+    this->json().write(buffer);
+    return buffer;
   }
 
   Result::Err::Err (
@@ -225,14 +858,15 @@ namespace SSC::IPC {
     JSON::Any value
   ) {
     this->seq = message.seq;
-    this->message = message;
-    this->value = value;
+    this->source = message.name;
+    this->workerId = message.get("runtime-worker-id");
+    this->value = std::move(value);
   }
 
   Result::Data::Data (
     const Message& message,
     JSON::Any value
-  ) : Data(message, value, Post{}) {
+  ) : Data(message, std::move(value), Post{}) {
   }
 
   Result::Data::Data (
@@ -241,8 +875,9 @@ namespace SSC::IPC {
     Post post
   ) {
     this->seq = message.seq;
-    this->message = message;
-    this->value = value;
-    this->post = post;
+    this->source = message.name;
+    this->workerId = message.get("runtime-worker-id");
+    this->value = std::move(value);
+    this->post = std::move(post);
   }
 }
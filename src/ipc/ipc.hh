@@ -117,11 +117,105 @@ namespace SSC::IPC {
 #endif
 
 namespace SSC::IPC {
+  /**
+   * A parsed `Range: bytes=<start>-<end>` request header against a
+   * resource of a known size — used by the platform scheme handlers to
+   * serve partial responses for media without buffering whole files.
+   */
+  struct SchemeHandlerByteRange {
+    int64_t start = 0;
+    int64_t end = 0; // inclusive
+    bool valid = false;
+  };
+
+  SchemeHandlerByteRange parseSchemeHandlerByteRange (
+    const String& header,
+    int64_t size
+  );
+
+  /**
+   * A generated module proxy source together with the strong `ETag`
+   * derived from its content hash. Entries are memoized per URL for the
+   * life of the process — the proxy for a given module URL never
+   * changes — so the platform scheme handlers serve `socket:` imports
+   * from memory and answer revalidations with `304 Not Modified`
+   * instead of re-generating and re-transferring the shim on every
+   * page reload.
+   */
+  struct ModuleSourceCacheEntry {
+    String source;
+    String etag;
+  };
+
+  // formats a content hash of `size` bytes as a quoted strong `ETag`
+  String getETagForContent (const char* bytes, size_t size);
+
+  // memoizes the generated module proxy for `url` — generation and
+  // hashing run once, later imports are a shared map lookup. The
+  // returned reference stays valid for the life of the process
+  const ModuleSourceCacheEntry& getCachedModuleSource (const String& url);
+
+  // `true` when an `if-none-match` request header matches `etag` and
+  // the handler can answer `304 Not Modified` without a body
+  bool isETagMatch (const String& ifNoneMatch, const String& etag);
+
+  /**
+   * A reference counted anonymous shared memory region so large binary
+   * IPC payloads can be handed between the webview and the core without
+   * copying through strings. Backed by `memfd_create(2)` on Linux,
+   * POSIX shared memory on Apple platforms and a pagefile backed file
+   * mapping on Windows (where the WebView2 shared buffer path remains
+   * the preferred transport). The mapping and its handle are released
+   * when the last `MessageBuffer` referencing the region is dropped.
+   */
+  class SharedMemoryRegion {
+    public:
+      static std::shared_ptr<SharedMemoryRegion> create (size_t size);
+      // maps `size` bytes of an open file descriptor at (page aligned)
+      // `offset` — the descriptor stays owned by the caller
+      static std::shared_ptr<SharedMemoryRegion> mapFile (
+        int fd,
+        size_t size,
+        size_t offset
+      );
+
+      SharedMemoryRegion () = default;
+      SharedMemoryRegion (const SharedMemoryRegion&) = delete;
+      SharedMemoryRegion& operator = (const SharedMemoryRegion&) = delete;
+      ~SharedMemoryRegion ();
+
+      char* data () const { return this->bytes; }
+      size_t size () const { return this->length; }
+
+    #if defined(_WIN32)
+      HANDLE handle () const { return this->mapping; }
+    #else
+      int handle () const { return this->fd; }
+    #endif
+
+    private:
+      char* bytes = nullptr;
+      size_t length = 0;
+
+    #if defined(_WIN32)
+      HANDLE mapping = nullptr;
+    #else
+      int fd = -1;
+    #endif
+  };
+
   struct MessageBuffer {
     size_t size = 0;
     char* bytes = nullptr;
+    // retains the shared memory backing, when there is one, for as long
+    // as any copy of this buffer is mapped in `Router::buffers`
+    std::shared_ptr<SharedMemoryRegion> shared = nullptr;
     MessageBuffer(char* bytes, size_t size)
         : size(size), bytes(bytes) { }
+    MessageBuffer(std::shared_ptr<SharedMemoryRegion> region)
+        : size(region != nullptr ? region->size() : 0),
+          bytes(region != nullptr ? region->data() : nullptr),
+          shared(region) { }
   #ifdef _WIN32
     ICoreWebView2SharedBuffer* shared_buf = nullptr;
     MessageBuffer(ICoreWebView2SharedBuffer* buf, size_t size)
@@ -139,40 +233,198 @@ namespace SSC::IPC {
   struct MessageCancellation {
     void (*handler)(void*) = nullptr;
     void *data = nullptr;
+    // shared with the core module servicing the request so still queued
+    // threadpool work can be `uv_cancel`ed and completion callbacks can
+    // exit early once the requester is gone
+    CancellationTokenPointer token = std::make_shared<CancellationToken>();
+  };
+
+  /**
+   * An optional length-prefixed binary IPC frame understood by
+   * `Router::invoke` and `Bridge::route` alongside the `ipc://` URI
+   * scheme, so streaming workloads skip URI encode/decode entirely.
+   * Framing is negotiated per bridge with the `protocol.framing` route.
+   *
+   * Layout (integers are little endian):
+   *   u32 magic ("SIPC")
+   *   u8  version
+   *   u16 name length,  name bytes
+   *   u16 seq length,   seq bytes
+   *   u16 argument count, then for each argument:
+   *     u16 key length,   key bytes
+   *     u32 value length, value bytes
+   *   u32 body length,  body bytes
+   */
+  struct Frame {
+    static constexpr uint32_t MAGIC = 0x43504953; // "SIPC"
+    static constexpr uint8_t VERSION = 1;
+
+    String name = "";
+    String seq = "";
+    Map args;
+
+    // points into the source buffer handed to `decode()`
+    const char* body = nullptr;
+    size_t size = 0;
+
+    static bool isFrame (const char* bytes, size_t size);
+    bool decode (const char* bytes, size_t size);
+    static Vector<char> encode (
+      const String& name,
+      const String& seq,
+      const Map& args,
+      const char* body,
+      size_t size
+    );
+  };
+
+  class Message;
+
+  /**
+   * A declarative description of the arguments a route expects. Routes
+   * mapped with a schema get their arguments decoded once by the router
+   * into `TypedArguments` before the handler runs, replacing repeated
+   * `message.get()` map traversal and exception-based `std::stoull`
+   * validation on the hot path.
+   */
+  struct MessageSchema {
+    enum class Type {
+      Boolean,
+      Integer,
+      Signed64,
+      Unsigned64,
+      Size,
+      String
+    };
+
+    struct Field {
+      String name;
+      Type type = Type::String;
+      bool required = true;
+      String fallback = "";
+    };
+
+    Vector<Field> fields;
+  };
+
+  /**
+   * Arguments decoded once from a message according to a route's
+   * `MessageSchema`, exposed to handlers as `message.typed`.
+   */
+  class TypedArguments {
+    public:
+      struct Value {
+        bool boolean = false;
+        int integer = 0;
+        int64_t signed64 = 0;
+        uint64_t unsigned64 = 0;
+        size_t size = 0;
+        String string = "";
+      };
+
+      std::unordered_map<String, Value> values;
+
+      // returns the error entries for the first missing or malformed
+      // field, or `null` when the message satisfies the schema
+      static JSON::Any decode (
+        const Message& message,
+        const MessageSchema& schema,
+        TypedArguments& output
+      );
+
+      const Value& get (const String& name) const;
+      bool getBoolean (const String& name) const { return get(name).boolean; }
+      int getInteger (const String& name) const { return get(name).integer; }
+      int64_t getSigned64 (const String& name) const { return get(name).signed64; }
+      uint64_t getUnsigned64 (const String& name) const { return get(name).unsigned64; }
+      size_t getSize (const String& name) const { return get(name).size; }
+      const String& getString (const String& name) const { return get(name).string; }
   };
 
   class Message {
     public:
       using Seq = String;
+
+      // an offset based slice into `uri` — stable across copies because
+      // `uri` is the single owned copy of the message source
+      struct Slice {
+        size_t offset = 0;
+        size_t length = 0;
+      };
+
       MessageBuffer buffer;
       String value = "";
       String name = "";
       String uri = "";
       int index = -1;
       Seq seq = "";
-      Map args;
+      // numeric fast path for the sequence number: virtually all seqs
+      // are decimal integers generated by the JS side, parsed once here
+      // so reply plumbing can branch on an integer instead of
+      // reparsing the string; symbolic seqs ("-1") keep `seq` only
+      uint64_t seqNumber = 0;
+      bool seqIsNumeric = false;
+      // materialized lazily for lazily parsed messages — see `get()`
+      // and `materializeArgs()`
+      mutable Map args;
+      // a key/value argument slice recorded by the lazy single-pass
+      // parser — keys in the fixed hot vocabulary carry an interned id
+      // so lookups compare an integer instead of a string
+      struct ArgSlice {
+        Slice key;
+        Slice value;
+        int interned = -1;
+      };
+
+      Vector<ArgSlice> slices;
       bool isHTTP = false;
+      // set when `args` hold raw (not URI encoded) values, as decoded
+      // from a binary `Frame` — `get()` skips `decodeURIComponent`
+      bool rawArgs = false;
+      bool lazy = false;
+      bool decodeValues = false;
+      // populated by the router for routes mapped with a `MessageSchema`
+      std::shared_ptr<TypedArguments> typed;
       std::shared_ptr<MessageCancellation> cancel;
+      // zero-size in unprofiled builds - counts live messages for the
+      // `diagnostics.query` heap totals
+      [[no_unique_address]] Heap::Tracked<Heap::Tag::messages> tracked;
 
       Message () = default;
       Message (const Message& message);
+      Message (const Frame& frame);
       Message (const String& source, bool decodeValues);
+      Message (const String& source, bool decodeValues, bool lazyParse);
       Message (const String& source);
       Message (const String& source, bool decodeValues, char *bytes, size_t size);
       Message (const String& source, char *bytes, size_t size);
       bool has (const String& key) const;
       String get (const String& key) const;
       String get (const String& key, const String& fallback) const;
+      StringView view (const Slice& slice) const;
+      // the raw (still URI encoded) slice for `key`, without allocating
+      StringView getView (const String& key) const;
+      StringView nameView () const;
+      StringView seqView () const;
+      void materializeArgs () const;
       String str () const { return this->uri; }
       const char * c_str () const { return this->uri.c_str(); }
+
+    private:
+      Slice nameSlice;
+      Slice seqSlice;
   };
 
   class Result {
     public:
+      // `Err` and `Data` capture only the fields a reply renders (seq,
+      // source name, worker id) instead of embedding a full `Message`
+      // copy per reply
       class Err {
         public:
-          Message message;
           Message::Seq seq;
+          String source;
+          String workerId;
           JSON::Any value;
           Err () = default;
           Err (const Message&, JSON::Any);
@@ -180,8 +432,9 @@ namespace SSC::IPC {
 
       class Data {
         public:
-          Message message;
           Message::Seq seq;
+          String source;
+          String workerId;
           JSON::Any value;
           Post post;
 
@@ -190,6 +443,9 @@ namespace SSC::IPC {
           Data (const Message&, JSON::Any, Post);
       };
 
+      // only populated when explicitly set (see the extension API) —
+      // results built on the reply path extract `seq`, `source` and the
+      // worker id from the originating message instead of copying it
       Message message;
       Message::Seq seq = "-1";
       uint64_t id = 0;
@@ -199,12 +455,16 @@ namespace SSC::IPC {
       JSON::Any err = nullptr;
       Headers headers;
       Post post;
+      [[no_unique_address]] Heap::Tracked<Heap::Tag::results> tracked;
 
       Result () = default;
       Result (const Result&) = default;
+      Result (Result&&) noexcept = default;
+      Result& operator = (const Result&) = default;
+      Result& operator = (Result&&) noexcept = default;
       Result (const JSON::Any);
-      Result (const Err error);
-      Result (const Data data);
+      Result (const Err& error);
+      Result (const Data& data);
       Result (const Message::Seq&, const Message&);
       Result (const Message::Seq&, const Message&, JSON::Any);
       Result (const Message::Seq&, const Message&, JSON::Any, Post);
@@ -216,14 +476,59 @@ namespace SSC::IPC {
     public:
       using EvaluateJavaScriptCallback = std::function<void(const String)>;
       using DispatchCallback = std::function<void()>;
+      // announces a registered post (id, seq, params, post) over a
+      // binary channel, returning `false` when the record could not be
+      // delivered and the script announcement should be used instead
+      using NotifyPostCallback = std::function<bool(
+        uint64_t,
+        const String&,
+        const String&,
+        const Post&
+      )>;
       using ReplyCallback = std::function<void(const Result&)>;
       using ResultCallback = std::function<void(Result)>;
       using MessageCallback = std::function<void(const Message&, Router*, ReplyCallback)>;
       using BufferMap = std::map<String, MessageBuffer>;
 
+      //
+      // Open-addressing table for mapped buffers keyed by the numeric
+      // (index, seq) pair of the message they belong to. Every
+      // bytes-carrying message stashes and retrieves exactly one buffer
+      // here, so the lookup avoids building a string key and walking a
+      // `std::map` tree on the binary payload hot path. Messages with a
+      // non-numeric seq fall back to the string-keyed `buffers` map.
+      //
+      struct MappedBufferTable {
+        struct Entry {
+          uint64_t seq = 0;
+          int index = 0;
+          // 0 = empty, 1 = occupied, 2 = tombstone
+          uint8_t state = 0;
+          MessageBuffer buffer;
+        };
+
+        // power-of-two capacity, linear probing - allocated lazily on
+        // the first `set()` so buffer-less routers pay nothing
+        Vector<Entry> entries;
+        size_t occupied = 0;
+        // occupied entries plus tombstones - drives the grow threshold
+        size_t used = 0;
+
+        Entry* find (int index, uint64_t seq);
+        void set (int index, uint64_t seq, MessageBuffer buffer);
+        void remove (int index, uint64_t seq);
+        void grow ();
+      };
+
       struct MessageCallbackContext {
         bool async = true;
         MessageCallback callback;
+        std::shared_ptr<MessageSchema> schema = nullptr;
+        // the reply never changes for the life of the process - the
+        // router renders it once on first request and answers later
+        // calls (from any window) from the cached bytes without
+        // executing the handler
+        bool immutable = false;
       };
 
       struct MessageCallbackListenerContext {
@@ -231,8 +536,35 @@ namespace SSC::IPC {
         MessageCallback callback;
       };
 
-      using Table = std::map<String, MessageCallbackContext>;
-      using Listeners = std::map<String, std::vector<MessageCallbackListenerContext>>;
+      // transparent hashing so route lookups can be keyed by a
+      // `StringView` slice of the message without allocating a `String`
+      struct TableHash {
+        using is_transparent = void;
+        size_t operator () (const String& value) const {
+          return std::hash<StringView>{}(value);
+        }
+
+        size_t operator () (StringView value) const {
+          return std::hash<StringView>{}(value);
+        }
+
+        size_t operator () (const char* value) const {
+          return std::hash<StringView>{}(value);
+        }
+      };
+
+      using Table = std::unordered_map<
+        String,
+        MessageCallbackContext,
+        TableHash,
+        std::equal_to<>
+      >;
+      using Listeners = std::unordered_map<
+        String,
+        std::vector<MessageCallbackListenerContext>,
+        TableHash,
+        std::equal_to<>
+      >;
 
       struct WebViewURLPathResolution {
         String path = "";
@@ -257,16 +589,40 @@ namespace SSC::IPC {
       static WebViewNavigatorMount resolveNavigatorMountForWebView (const String& path);
 
     private:
-      Table preserved;
+      // built-in routes, shared immutably across router instances: set
+      // once at construction from the process-wide table and only ever
+      // replaced wholesale by `preserveCurrentTable()`, so per-router
+      // registration is a pointer copy instead of ~100 `map()` calls
+      std::shared_ptr<const Table> preserved = std::make_shared<Table>();
 
     public:
       EvaluateJavaScriptCallback evaluateJavaScriptFunction = nullptr;
       std::function<void(DispatchCallback)> dispatchFunction = nullptr;
+      // set once the webview has negotiated a binary post-notification
+      // channel (see `post.ring` on WebView2); `nullptr` keeps the
+      // legacy `createPost` script path
+      NotifyPostCallback notifyPostFunction = nullptr;
+      // string-keyed fallback for the rare message whose seq is not a
+      // plain decimal number - real traffic lands in `mappedBuffers`
       BufferMap buffers;
+      MappedBufferTable mappedBuffers;
       bool isReady = false;
+      // set when the webview has negotiated the binary IPC framing
+      // protocol through the `protocol.framing` route
+      bool allowsBinaryFraming = false;
       Mutex mutex;
+      // outbound scripts queued by `send()` and `emit()`, flushed as a
+      // single webview evaluation per event loop iteration
+      Mutex pendingScriptsMutex;
+      Vector<String> pendingScripts;
+      bool hasPendingScriptsFlush = false;
       Table table;
-      Listeners listeners;
+      // copy-on-write snapshot: `listen()`/`unlisten()` replace the whole
+      // map under `listenersMutex` while the invoke fast path reads the
+      // current snapshot through `std::atomic_load` without exclusive
+      // locking
+      std::shared_ptr<const Listeners> listeners = std::make_shared<Listeners>();
+      Mutex listenersMutex;
       Core *core = nullptr;
       Bridge *bridge = nullptr;
     #if defined(__APPLE__)
@@ -276,7 +632,11 @@ namespace SSC::IPC {
       SSCIPCSchemeTasks* schemeTasks = nullptr;
       NSTimer* notificationPollTimer = nullptr;
     #elif defined(__linux__) && !defined(__ANDROID__)
+      // shared across all routers - see `getSharedWebKitWebContext()`
       WebKitWebContext* webkitWebContext = nullptr;
+      // the webview this router serves, bound by the owning window so
+      // scheme handler requests on the shared context resolve back here
+      WebKitWebView* webkitWebView = nullptr;
     #endif
 
       Router ();
@@ -287,6 +647,16 @@ namespace SSC::IPC {
       bool hasMappedBuffer (int index, const Message::Seq seq);
       void removeMappedBuffer (int index, const Message::Seq seq);
       void setMappedBuffer(int index, const Message::Seq seq, MessageBuffer msg_buf);
+      MessageBuffer createSharedBuffer (int index, const Message::Seq seq, size_t size);
+
+      // drops page-scoped router state (mapped buffers, queued scripts,
+      // readiness) ahead of a warm restart navigation - see
+      // `App::warmRestart()`
+      void invalidate ();
+
+    #if defined(__linux__) && !defined(__ANDROID__)
+      void setWebKitWebView (WebKitWebView* webview);
+    #endif
 
       void preserveCurrentTable ();
 
@@ -294,11 +664,29 @@ namespace SSC::IPC {
       bool unlisten (const String& name, uint64_t token);
       void map (const String& name, MessageCallback callback);
       void map (const String& name, bool async, MessageCallback callback);
+      void map (
+        const String& name,
+        const MessageSchema& schema,
+        MessageCallback callback
+      );
+      void map (
+        const String& name,
+        bool async,
+        const MessageSchema& schema,
+        MessageCallback callback
+      );
       void unmap (const String& name);
       bool dispatch (DispatchCallback callback);
       bool emit (const String& name, const String data);
       bool evaluateJavaScript (const String javaScript);
-      bool send (const Message::Seq& seq, const String data, const Post post);
+      bool queueJavaScript (const String javaScript);
+      void flushPendingScripts ();
+      bool send (
+        const Message::Seq& seq,
+        const String data,
+        const Post post,
+        bool immediate = false
+      );
       bool invoke (const String& msg, ResultCallback callback);
       bool invoke (const String& msg, const char *bytes, size_t size);
       bool invoke (
@@ -321,7 +709,10 @@ namespace SSC::IPC {
       Bluetooth bluetooth;
       Core *core = nullptr;
     #if !defined(__ANDROID__) && (defined(_WIN32) || defined(__linux__) || (defined(__APPLE__) && !TARGET_OS_IPHONE && !TARGET_IPHONE_SIMULATOR))
-      FileSystemWatcher* fileSystemWatcher = nullptr;
+      // watching is shared process-wide through the watcher service;
+      // this identifies the bridge's subscription to the working
+      // directory watcher, `0` when not subscribed
+      FileSystemWatcherService::Subscription fileSystemWatcherSubscription = 0;
     #endif
 
     #if defined(__ANDROID__)
@@ -0,0 +1,203 @@
+#ifndef SSC_PROCESS_POOL_H
+#define SSC_PROCESS_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+
+#include "process.hh"
+
+namespace SSC {
+  /**
+   * Keeps a small set of warm shell workers alive for repeated
+   * short-lived tool invocations. Each worker spawns `/bin/sh` once and
+   * receives command lines over stdin; responses come back on stdout
+   * delimited by a sentinel line carrying the exit code, so repeated
+   * probes pay a pipe write instead of a full process spawn. `run()`
+   * returns a future, so independent probes multiplex across workers
+   * and can be joined later.
+   *
+   * Output containing the sentinel string itself would terminate a
+   * response early - the sentinel is obscure enough that tool output
+   * never produces it in practice.
+   */
+  class ProcessPool {
+    public:
+      static constexpr auto DEFAULT_SIZE = 2;
+
+    #ifdef _WIN32
+      // no stable `/bin/sh` host on Windows - fall through to the
+      // per-command async exec, keeping the call sites portable
+      ProcessPool (size_t size) {}
+      ProcessPool () : ProcessPool(DEFAULT_SIZE) {}
+
+      std::future<ExecOutput> run (const String& command) {
+        return execAsync(command);
+      }
+    #else
+      ProcessPool (size_t size) {
+        for (size_t i = 0; i < size; i++) {
+          this->workers.push_back(std::make_unique<Worker>());
+        }
+      }
+
+      ProcessPool () : ProcessPool(DEFAULT_SIZE) {}
+
+      ~ProcessPool () {
+        for (const auto& worker : this->workers) {
+          worker->stop();
+        }
+      }
+
+      std::future<ExecOutput> run (const String& command) {
+        const auto index = this->next++ % this->workers.size();
+        return this->workers[index]->submit(command);
+      }
+
+    private:
+      struct Job {
+        String command;
+        std::promise<ExecOutput> promise;
+      };
+
+      struct Worker {
+        static constexpr const char* SENTINEL = "__SSC_POOL_DONE__";
+
+        std::unique_ptr<Process> process;
+        std::mutex mutex;
+        std::condition_variable signal;
+        std::deque<Job> jobs;
+        std::thread thread;
+        bool stopped = false;
+        bool exited = false;
+
+        // state of the in-flight job - written by this worker's thread
+        // and the process reader thread, both under `mutex`
+        ExecOutput current;
+        bool completed = false;
+
+        Worker () {
+          this->process = std::make_unique<Process>(
+            "/bin/sh",
+            "",
+            "",
+            [this](SSC::String line) { this->onLine(line); },
+            nullptr,
+            [this](SSC::String) { this->onExit(); }
+          );
+
+          this->process->open();
+          this->thread = std::thread([this] { this->loop(); });
+        }
+
+        std::future<ExecOutput> submit (const String& command) {
+          Job job;
+          job.command = command;
+          auto future = job.promise.get_future();
+
+          {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->jobs.push_back(std::move(job));
+          }
+
+          this->signal.notify_all();
+          return future;
+        }
+
+        void loop () {
+          std::unique_lock<std::mutex> lock(this->mutex);
+
+          while (true) {
+            this->signal.wait(lock, [this] {
+              return this->stopped || this->exited || this->jobs.size() > 0;
+            });
+
+            if (this->stopped || this->exited) {
+              break;
+            }
+
+            auto job = std::move(this->jobs.front());
+            this->jobs.pop_front();
+            this->current = ExecOutput {};
+            this->completed = false;
+
+            lock.unlock();
+            // a subshell, so `exit`/`exec` in the command can't take the
+            // warm worker shell down with it
+            this->process->write(
+              "( " + job.command + " ) 2>&1; "
+              "printf '%s %d\\n' '" + String(SENTINEL) + "' \"$?\"\n"
+            );
+            lock.lock();
+
+            this->signal.wait(lock, [this] {
+              return this->completed || this->stopped || this->exited;
+            });
+
+            if (!this->completed) {
+              this->current.exitCode = 1;
+            }
+
+            job.promise.set_value(std::move(this->current));
+          }
+
+          // fail anything still queued so callers never block on a
+          // stopped or dead worker
+          while (this->jobs.size() > 0) {
+            auto job = std::move(this->jobs.front());
+            this->jobs.pop_front();
+            auto output = ExecOutput {};
+            output.exitCode = 1;
+            job.promise.set_value(std::move(output));
+          }
+        }
+
+        void onLine (const String& line) {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          const auto index = line.find(SENTINEL);
+
+          if (index != String::npos) {
+            // a trailing partial output line arrives fused with the
+            // sentinel - keep it without a newline, like `exec()` would
+            this->current.output.append(line, 0, index);
+            this->current.exitCode = std::atoi(
+              line.c_str() + index + strlen(SENTINEL)
+            );
+            this->completed = true;
+            this->signal.notify_all();
+          } else {
+            this->current.output += line;
+            this->current.output += '\n';
+          }
+        }
+
+        void onExit () {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          this->exited = true;
+          this->signal.notify_all();
+        }
+
+        void stop () {
+          {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->stopped = true;
+          }
+
+          this->signal.notify_all();
+
+          if (this->thread.joinable()) {
+            this->thread.join();
+          }
+
+          this->process->close_stdin();
+          this->process->kill();
+        }
+      };
+
+      Vector<std::unique_ptr<Worker>> workers;
+      std::atomic<size_t> next = 0;
+    #endif
+  };
+}
+#endif
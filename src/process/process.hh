@@ -1,6 +1,7 @@
 #ifndef SSC_PROCESS_PROCESS_H
 #define SSC_PROCESS_PROCESS_H
 
+#include <future>
 #include <iostream>
 
 #include "../core/core.hh"
@@ -98,6 +99,88 @@ namespace SSC {
     return eo;
   }
 
+  /**
+   * An asynchronous `exec()`: runs `command` on a background thread,
+   * streaming merged stdout/stderr chunks through `onOutput` as they
+   * arrive while also collecting them for the returned future. Launch
+   * several commands and `get()` their futures to run independent
+   * toolchain or device probes concurrently instead of serially.
+   */
+  inline std::future<ExecOutput> execAsync (
+    SSC::String command,
+    const MessageCallback onOutput = nullptr
+  ) {
+    return std::async(std::launch::async, [command = std::move(command), onOutput]() mutable {
+      command = command + " 2>&1";
+
+      ExecOutput eo;
+      size_t count;
+      FILE* pipe;
+      const int bufsize = 128;
+      std::array<char, 128> buffer;
+
+      #ifdef _WIN32
+        pipe = _popen((const char*) command.c_str(), "rt");
+      #else
+        pipe = popen((const char*) command.c_str(), "r");
+      #endif
+
+      if (pipe == NULL) {
+        eo.output = "error: unable to open the command";
+        eo.exitCode = 1;
+        return eo;
+      }
+
+      do {
+        if ((count = fread(buffer.data(), 1, bufsize, pipe)) > 0) {
+          eo.output.append(buffer.data(), count);
+
+          if (onOutput != nullptr) {
+            onOutput(SSC::String(buffer.data(), count));
+          }
+        }
+      } while (count > 0);
+
+      #ifdef _WIN32
+        int exitCode = _pclose(pipe);
+      #else
+        int exitCode = pclose(pipe);
+      #endif
+
+      if (!WIFEXITED(exitCode) || exitCode != 0) {
+        auto status = WEXITSTATUS(exitCode);
+        if (status && exitCode) {
+          exitCode = status;
+        }
+      }
+
+      eo.exitCode = exitCode;
+      return eo;
+    });
+  }
+
+  /**
+   * Launches every command in `commands` concurrently and joins them,
+   * returning their outputs in the same order.
+   */
+  inline Vector<ExecOutput> execAll (const Vector<SSC::String>& commands) {
+    Vector<std::future<ExecOutput>> futures;
+    futures.reserve(commands.size());
+
+    for (const auto& command : commands) {
+      futures.push_back(execAsync(command));
+    }
+
+    Vector<ExecOutput> results;
+    results.reserve(futures.size());
+
+    for (auto& future : futures) {
+      results.push_back(future.get());
+    }
+
+    return results;
+  }
+
   // Platform independent class for creating processes.
   // Note on Windows: it seems not possible to specify which pipes to redirect.
   // Thus, at the moment, if read_stdout==nullptr, read_stderr==nullptr and open_stdin==false,
@@ -115,9 +198,18 @@ namespace SSC {
     typedef SSC::String string_type;
   #endif
 
+    using ViewCallback = std::function<void(const StringView)>;
+
     SSC::String command;
     SSC::String argv;
     SSC::String path;
+
+    // optional zero-copy variants of the read callbacks - when set they
+    // take precedence over the `String` callbacks and receive raw chunk
+    // views into the pooled read buffer, valid only for the duration of
+    // the call; consumers that only scan the output never force a copy
+    ViewCallback read_stdout_view = nullptr;
+    ViewCallback read_stderr_view = nullptr;
     std::atomic<bool> closed = true;
     std::atomic<int> status = -1;
     id_type id = 0;
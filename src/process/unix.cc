@@ -7,16 +7,132 @@
 #include <poll.h>
 #include <set>
 #include <signal.h>
+#include <spawn.h>
 #include <sstream>
 #include <stdexcept>
 #include <sys/wait.h>
 #include <unistd.h>
 
+extern char **environ;
+
 #include "process.hh"
 
 namespace SSC {
 
-static StringStream initial;
+// reaps every child spawned through `Process` on one shared thread: a
+// SIGCHLD handler writes to a self-pipe and the reaper collects each
+// registered pid with `waitpid(..., WNOHANG)`, so exit callbacks fire
+// as soon as the child dies without a blocking wait thread per process.
+// children created elsewhere (popen in `exec`, pclose) are never
+// touched - only registered pids are waited on
+class ProcessReaper {
+public:
+  using ExitCallback = std::function<void(int)>;
+
+  static ProcessReaper* instance() {
+    static ProcessReaper reaper;
+    return &reaper;
+  }
+
+  void watch(pid_t id, ExitCallback callback) {
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+
+      if (!this->started) {
+        this->start();
+      }
+
+      this->watched[id] = std::move(callback);
+    }
+
+    // the child may already have exited before it was registered -
+    // wake the reaper so it checks immediately instead of waiting for
+    // the next SIGCHLD
+    this->wake();
+  }
+
+private:
+  std::mutex mutex;
+  std::map<pid_t, ExitCallback> watched;
+  int wakePipe[2] = {-1, -1};
+  bool started = false;
+
+  static void handleSignal(int) {
+    instance()->wake();
+  }
+
+  void wake() {
+    if (this->wakePipe[1] >= 0) {
+      const char byte = 0;
+      // a full pipe already guarantees a pending wakeup
+      const auto ignored = ::write(this->wakePipe[1], &byte, 1);
+      (void) ignored;
+    }
+  }
+
+  void start() {
+    if (pipe(this->wakePipe) != 0) {
+      this->wakePipe[0] = this->wakePipe[1] = -1;
+      return;
+    }
+
+    fcntl(this->wakePipe[0], F_SETFD, FD_CLOEXEC);
+    fcntl(this->wakePipe[1], F_SETFD, FD_CLOEXEC);
+    // the handler must never block on a saturated pipe
+    fcntl(this->wakePipe[1], F_SETFL, fcntl(this->wakePipe[1], F_GETFL) | O_NONBLOCK);
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = ProcessReaper::handleSignal;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+    sigaction(SIGCHLD, &action, nullptr);
+
+    auto thread = std::thread([this] { this->loop(); });
+    thread.detach();
+    this->started = true;
+  }
+
+  void loop() {
+    while (true) {
+      char bytes[64];
+      const auto n = ::read(this->wakePipe[0], bytes, sizeof(bytes));
+
+      if (n < 0 && errno != EINTR) {
+        break;
+      }
+
+      // collect exited children under the lock, invoke outside it so a
+      // callback registering another process cannot deadlock
+      std::vector<std::pair<ExitCallback, int>> exited;
+
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        for (auto it = this->watched.begin(); it != this->watched.end();) {
+          int code = 0;
+          const auto r = waitpid(it->first, &code, WNOHANG);
+
+          if (r == it->first) {
+            exited.emplace_back(std::move(it->second), code);
+            it = this->watched.erase(it);
+          } else if (r < 0 && errno == ECHILD) {
+            // someone else reaped it - report a clean exit rather than
+            // leaving the callback pending forever
+            exited.emplace_back(std::move(it->second), 0);
+            it = this->watched.erase(it);
+          } else {
+            ++it;
+          }
+        }
+      }
+
+      for (auto& entry : exited) {
+        entry.first(entry.second);
+      }
+    }
+  }
+};
 
 Process::Data::Data() noexcept : id(-1) {}
 Process::Process(
@@ -124,10 +240,7 @@ Process::id_type Process::open(const std::function<int()> &function) noexcept {
   id = pid;
 
   if (pid > 0) {
-    auto thread = std::thread([this] {
-      int code = 0;
-      waitpid(this->id, &code, 0);
-
+    ProcessReaper::instance()->watch(pid, [this](int code) {
       this->status = WEXITSTATUS(code);
       this->closed = true;
 
@@ -135,8 +248,6 @@ Process::id_type Process::open(const std::function<int()> &function) noexcept {
         this->on_exit(std::to_string(status));
       }
     });
-
-    thread.detach();
   } else if (pid == 0) {
     if (stdin_fd) {
       dup2(stdin_p[0], 0);
@@ -202,27 +313,173 @@ Process::id_type Process::open(const std::function<int()> &function) noexcept {
   return pid;
 }
 
+// command launches go through `posix_spawn` instead of `fork` + exec -
+// with a large parent RSS, fork's page table copy stalls the calling
+// thread, while posix_spawn uses vfork/clone semantics and shares the
+// parent address space until exec
 Process::id_type Process::open(const SSC::String &command, const SSC::String &path) noexcept {
-  return open([&command, &path] {
-    auto command_c_str = command.c_str();
-    SSC::String cd_path_and_command;
-
-    if (!path.empty()) {
-      auto path_escaped = path;
-      size_t pos = 0;
-
-      // Based on https://www.reddit.com/r/cpp/comments/3vpjqg/a_new_platform_independent_process_library_for_c11/cxsxyb7
-      while((pos = path_escaped.find('\'', pos)) != SSC::String::npos) {
-        path_escaped.replace(pos, 1, "'\\''");
-        pos += 4;
-      }
+  auto command_c_str = command.c_str();
+  SSC::String cd_path_and_command;
+
+  if (!path.empty()) {
+    auto path_escaped = path;
+    size_t pos = 0;
 
-      cd_path_and_command = "cd '" + path_escaped + "' && " + command; // To avoid resolving symbolic links
-      command_c_str = cd_path_and_command.c_str();
+    // Based on https://www.reddit.com/r/cpp/comments/3vpjqg/a_new_platform_independent_process_library_for_c11/cxsxyb7
+    while((pos = path_escaped.find('\'', pos)) != SSC::String::npos) {
+      path_escaped.replace(pos, 1, "'\\''");
+      pos += 4;
     }
 
-    return execl("/bin/sh", "/bin/sh", "-c", command_c_str, nullptr);
+    cd_path_and_command = "cd '" + path_escaped + "' && " + command; // To avoid resolving symbolic links
+    command_c_str = cd_path_and_command.c_str();
+  }
+
+  if (open_stdin) {
+    stdin_fd = std::unique_ptr<fd_type>(new fd_type);
+  }
+
+  if (read_stdout) {
+    stdout_fd = std::unique_ptr<fd_type>(new fd_type);
+  }
+
+  if (read_stderr) {
+    stderr_fd = std::unique_ptr<fd_type>(new fd_type);
+  }
+
+  int stdin_p[2];
+  int stdout_p[2];
+  int stderr_p[2];
+
+  if (stdin_fd && pipe(stdin_p) != 0) {
+    return -1;
+  }
+
+  if (stdout_fd && pipe(stdout_p) != 0) {
+    if (stdin_fd) {
+      close(stdin_p[0]);
+      close(stdin_p[1]);
+    }
+    return -1;
+  }
+
+  if (stderr_fd && pipe(stderr_p) != 0) {
+    if (stdin_fd) {
+      close(stdin_p[0]);
+      close(stdin_p[1]);
+    }
+
+    if (stdout_fd) {
+      close(stdout_p[0]);
+      close(stdout_p[1]);
+    }
+
+    return -1;
+  }
+
+  posix_spawn_file_actions_t actions;
+  posix_spawnattr_t attributes;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawnattr_init(&attributes);
+
+  if (stdin_fd) {
+    posix_spawn_file_actions_adddup2(&actions, stdin_p[0], 0);
+    posix_spawn_file_actions_addclose(&actions, stdin_p[0]);
+    posix_spawn_file_actions_addclose(&actions, stdin_p[1]);
+  }
+
+  if (stdout_fd) {
+    posix_spawn_file_actions_adddup2(&actions, stdout_p[1], 1);
+    posix_spawn_file_actions_addclose(&actions, stdout_p[0]);
+    posix_spawn_file_actions_addclose(&actions, stdout_p[1]);
+  }
+
+  if (stderr_fd) {
+    posix_spawn_file_actions_adddup2(&actions, stderr_p[1], 2);
+    posix_spawn_file_actions_addclose(&actions, stderr_p[0]);
+    posix_spawn_file_actions_addclose(&actions, stderr_p[1]);
+  }
+
+  // place the child in its own process group so `kill()` can signal the
+  // whole group, matching the `setpgid(0, 0)` in the fork path
+  short flags = POSIX_SPAWN_SETPGROUP;
+#if defined(POSIX_SPAWN_USEVFORK)
+  flags |= POSIX_SPAWN_USEVFORK;
+#endif
+  posix_spawnattr_setflags(&attributes, flags);
+  posix_spawnattr_setpgroup(&attributes, 0);
+
+  const char* spawn_argv[] = { "/bin/sh", "-c", command_c_str, nullptr };
+  id_type pid = -1;
+  const auto rc = posix_spawn(
+    &pid,
+    "/bin/sh",
+    &actions,
+    &attributes,
+    (char* const*) spawn_argv,
+    environ
+  );
+
+  posix_spawn_file_actions_destroy(&actions);
+  posix_spawnattr_destroy(&attributes);
+
+  if (rc != 0) {
+    if (stdin_fd) {
+      close(stdin_p[0]);
+      close(stdin_p[1]);
+    }
+
+    if (stdout_fd) {
+      close(stdout_p[0]);
+      close(stdout_p[1]);
+    }
+
+    if (stderr_fd) {
+      close(stderr_p[0]);
+      close(stderr_p[1]);
+    }
+
+    return -1;
+  }
+
+  closed = false;
+  id = pid;
+
+  ProcessReaper::instance()->watch(pid, [this](int code) {
+    this->status = WEXITSTATUS(code);
+    this->closed = true;
+
+    if (this->on_exit != nullptr) {
+      this->on_exit(std::to_string(status));
+    }
   });
+
+  if (stdin_fd) {
+    close(stdin_p[0]);
+  }
+
+  if (stdout_fd) {
+    close(stdout_p[1]);
+  }
+
+  if (stderr_fd) {
+    close(stderr_p[1]);
+  }
+
+  if (stdin_fd) {
+    *stdin_fd = stdin_p[1];
+  }
+
+  if (stdout_fd) {
+    *stdout_fd = stdout_p[0];
+  }
+
+  if (stderr_fd) {
+    *stderr_fd = stderr_p[0];
+  }
+
+  data.id = pid;
+  return pid;
 }
 
 void Process::read() noexcept {
@@ -247,9 +504,13 @@ void Process::read() noexcept {
       pollfds.back().events = POLLIN;
     }
 
-    auto buffer = std::unique_ptr<char[]>(new char[config.buffer_size]);
+    // pooled so read buffers recycle across process instances instead of
+    // a fresh heap allocation per reader thread
+    auto buffer = BufferPool::instance()->acquire(config.buffer_size);
     bool any_open = !pollfds.empty();
-    SSC::StringStream ss;
+
+    // partial stdout line carried between chunks
+    SSC::String pending;
 
     while (any_open && (poll(pollfds.data(), static_cast<nfds_t>(pollfds.size()), -1) > 0 || errno == EINTR)) {
       any_open = false;
@@ -258,38 +519,63 @@ void Process::read() noexcept {
         if (!(pollfds[i].fd >= 0)) continue;
 
         if (pollfds[i].revents & POLLIN) {
-          memset(buffer.get(), 0, config.buffer_size);
-          const ssize_t n = ::read(pollfds[i].fd, buffer.get(), config.buffer_size);
-
-          if (n > 0) {
-            if (fd_is_stdout[i]) {
-              std::lock_guard<std::mutex> lock(stdout_mutex);
-              auto b = SSC::String(buffer.get());
-              auto parts = splitc(b, '\n');
-
-              if (parts.size() > 1) {
-                for (int i = 0; i < parts.size() - 1; i++) {
-                  ss << parts[i];
-
-                  SSC::String s(ss.str());
-                  read_stdout(s);
-
-                  ss.str(SSC::String());
-                  ss.clear();
-                  ss.copyfmt(initial);
+          // the fds are non-blocking - drain each one completely in this
+          // wakeup instead of paying one poll() round trip per chunk
+          while (pollfds[i].fd >= 0) {
+            const ssize_t n = ::read(pollfds[i].fd, buffer.get(), config.buffer_size);
+
+            if (n > 0) {
+              if (fd_is_stdout[i]) {
+                std::lock_guard<std::mutex> lock(stdout_mutex);
+
+                if (read_stdout_view != nullptr) {
+                  read_stdout_view(StringView(buffer.get(), n));
+                } else {
+                  // deliver complete lines (without the newline), carrying
+                  // any trailing partial line over to the next chunk
+                  size_t offset = 0;
+
+                  while (offset < (size_t) n) {
+                    const auto start = buffer.get() + offset;
+                    const auto newline = (const char*) memchr(start, '\n', n - offset);
+
+                    if (newline == nullptr) {
+                      pending.append(start, n - offset);
+                      break;
+                    }
+
+                    const size_t length = newline - start;
+
+                    if (pending.size() > 0) {
+                      pending.append(start, length);
+                      read_stdout(pending);
+                      pending.clear();
+                    } else {
+                      read_stdout(SSC::String(start, length));
+                    }
+
+                    offset += length + 1;
+                  }
                 }
-                ss << parts[parts.size() - 1];
               } else {
-                ss << b;
+                std::lock_guard<std::mutex> lock(stderr_mutex);
+
+                if (read_stderr_view != nullptr) {
+                  read_stderr_view(StringView(buffer.get(), n));
+                } else {
+                  read_stderr(SSC::String(buffer.get(), n));
+                }
               }
-            } else {
-              std::lock_guard<std::mutex> lock(stderr_mutex);
-              read_stderr(SSC::String(buffer.get()));
+            } else if (n == 0) {
+              pollfds[i].fd = -1;
+            } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+              break;
+            } else if (errno != EINTR) {
+              pollfds[i].fd = -1;
             }
-          } else if (n < 0 && errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK) {
-            pollfds[i].fd = -1;
-            continue;
           }
+
+          if (!(pollfds[i].fd >= 0)) continue;
         }
 
         if (pollfds[i].revents & (POLLERR | POLLHUP | POLLNVAL)) {
@@ -300,6 +586,12 @@ void Process::read() noexcept {
         any_open = true;
       }
     }
+
+    // flush a trailing line the child wrote without a final newline
+    if (pending.size() > 0 && read_stdout != nullptr && read_stdout_view == nullptr) {
+      std::lock_guard<std::mutex> lock(stdout_mutex);
+      read_stdout(pending);
+    }
   });
 }
 
@@ -1225,6 +1225,34 @@ namespace SSC {
     }
   }
 
+  void Window::setIndex (int index) {
+    this->index = index;
+    this->opts.index = index;
+
+    if (this->webview == nullptr) {
+      return;
+    }
+
+    // the preload bakes the window index into the webview, so rebinding
+    // a pooled window replaces the injected user script wholesale
+    WKUserContentController* controller =
+      this->webview.configuration.userContentController;
+
+    [controller removeAllUserScripts];
+
+    SSC::String preload = createPreload(this->opts);
+
+    WKUserScript* userScript = [WKUserScript alloc];
+
+    [userScript
+      initWithSource: [NSString stringWithUTF8String: preload.c_str()]
+      injectionTime: WKUserScriptInjectionTimeAtDocumentStart
+      forMainFrameOnly: NO
+    ];
+
+    [controller addUserScript: userScript];
+  }
+
   ScreenSize Window::getSize () {
     if (this->window == nullptr) {
       return ScreenSize {0, 0};
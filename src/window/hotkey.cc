@@ -9,6 +9,12 @@ namespace SSC {
   // global variables for all windows
   static HotKeyBinding::ID nextGlobalBindingID = 1024;
   static HotKeyContext::Bindings globalBindings;
+  // index of compiled binding hashes so expression lookups resolve with a
+  // single parse and hash instead of re-parsing every registered binding
+  static std::unordered_map<
+    HotKeyBinding::Hash,
+    HotKeyBinding::ID
+  > globalBindingHashes;
 
 #if defined(__APPLE__) && (!TARGET_OS_IPHONE && !TARGET_IPHONE_SIMULATOR)
   static OSStatus carbonEventHandlerCallback (
@@ -80,24 +86,27 @@ namespace SSC {
       return false;
     }
 
-    if (context->context->bindings.contains(context->id)) {
-      static const HotKeyCodeMap map;
-      const auto &binding = context->context->bindings.at(context->id);
+    // candidate bindings are compiled at registration time and keyed on
+    // their key code so matching an event is a single lookup followed by a
+    // modifier mask test - no expression tokens are visited on this path
+    const auto entry = context->context->gtkKeyCodeBindings.find(event->keyval);
 
-      if (binding.keys != event->keyval) {
-        return false;
+    if (entry == context->context->gtkKeyCodeBindings.end()) {
+      return false;
+    }
+
+    for (const auto& id : entry->second) {
+      if (!context->context->bindings.contains(id)) {
+        continue;
       }
 
-      for (const auto& token : binding.sequence) {
-        const auto code = map.get(token);
-        if (map.isModifier(token)) {
-          if (!(event->state & code)) {
-            return false;
-          }
-        }
+      const auto& binding = context->context->bindings.at(id);
+
+      if ((event->state & binding.modifiers) != binding.modifiers) {
+        continue;
       }
 
-      context->context->onHotKeyBindingCallback(context->id);
+      context->context->onHotKeyBindingCallback(id);
 
       if (binding.options.passive) {
         return false;
@@ -580,14 +589,22 @@ namespace SSC {
     return sequence;
   }
 
-  HotKeyBinding::HotKeyBinding (ID id, Expression input) : id(id) {
+  HotKeyBinding::HotKeyBinding (ID id, Expression input)
+    : HotKeyBinding(id, input, parseExpression(input))
+  {}
+
+  HotKeyBinding::HotKeyBinding (
+    ID id,
+    Expression input,
+    const Sequence& sequence
+  ) : id(id) {
     this->expression = input;
-    this->sequence = parseExpression(input);
+    this->sequence = sequence;
 
     for (const auto& token : this->sequence) {
       const auto code = codeMap.get(token);
       if (codeMap.isModifier(token)) {
-        this->modifiers += code;
+        this->modifiers |= code;
       } else if (codeMap.isKey(token)) {
         this->keys = code;
       }
@@ -702,6 +719,47 @@ namespace SSC {
         return reply(IPC::Result::Data { message, data });
       }
 
+      // a comma separated list of expressions is compiled and registered as
+      // one batch so replacing a whole set of bindings costs a single
+      // round trip and parses each expression exactly once
+      if (message.has("expressions")) {
+        if (userConfig["permissions_allow_hotkeys"] == "false") {
+          auto err = JSON::Object::Entries {
+            {"type", "SecurityError"},
+            {"message", "The HotKey API is not allowed."}
+          };
+          return reply(IPC::Result::Err { message, err });
+        }
+
+        const auto expressions = split(message.get("expressions"), ',');
+        const auto bindings = this->bindAll(expressions, options);
+        auto data = JSON::Array::Entries {};
+
+        for (const auto& binding : bindings) {
+          if (!binding.isValid()) {
+            auto err = JSON::Object::Entries {
+              {"message", "Invalid 'expression' in parameters"}
+            };
+            return reply(IPC::Result::Err { message, err });
+          }
+
+          auto sequence = JSON::Array::Entries {};
+
+          for (const auto& token : binding.sequence) {
+            sequence.push_back(token);
+          }
+
+          data.push_back(JSON::Object::Entries {
+            {"expression", binding.expression},
+            {"sequence", sequence},
+            {"hash", binding.hash},
+            {"id", binding.id}
+          });
+        }
+
+        return reply(IPC::Result::Data { message, data });
+      }
+
       auto expression = message.get("expression");
 
       if (expression.size() == 0) {
@@ -934,11 +992,20 @@ namespace SSC {
       return HotKeyBinding(0, "");
     }
 
-    const auto exists = this->hasBindingForExpression(expression);
+    // parse and hash the expression once here - existence checks, lookup,
+    // and construction below all reuse the compiled sequence
+    const auto sequence = HotKeyBinding::parseExpression(expression);
+    const auto hash = std::hash<String>{}(join(sequence, "+"));
+    const auto exists = (
+      globalBindingHashes.contains(hash) &&
+      this->bindings.contains(globalBindingHashes.at(hash))
+    );
 
     auto binding = exists
-      ? getBindingForExpression(expression)
-      : HotKeyBinding(nextGlobalBindingID, expression);
+      ? this->bindings.at(globalBindingHashes.at(hash))
+      : HotKeyBinding(nextGlobalBindingID, expression, sequence);
+
+    binding.options = options;
 
   #if defined(__APPLE__) && (!TARGET_OS_IPHONE && !TARGET_IPHONE_SIMULATOR)
     if (!exists) {
@@ -960,22 +1027,23 @@ namespace SSC {
       }
     }
   #elif defined(__linux__) && !defined(__ANDROID__)
-    static const HotKeyCodeMap hotKeyCodeMap;
-
-    if (!this->gtkKeyPressEventContexts.contains(binding.id)) {
-      this->gtkKeyPressEventContexts.insert_or_assign(
-        binding.id,
-        HotKeyBinding::GTKKeyPressEventContext { this, binding.id }
-      );
-
-      auto& context = this->gtkKeyPressEventContexts.at(binding.id);
-      context.signal = g_signal_connect(
+    // a single handler services every binding in this context so high rate
+    // input costs one signal dispatch per event, not one per binding
+    if (this->gtkKeyPressEventContext.signal == 0) {
+      this->gtkKeyPressEventContext.context = this;
+      this->gtkKeyPressEventContext.signal = g_signal_connect(
         this->window->window,
         "key-press-event",
         G_CALLBACK(gtkKeyPressEventHandlerCallback),
-        &context
+        &this->gtkKeyPressEventContext
       );
     }
+
+    auto& candidates = this->gtkKeyCodeBindings[binding.keys];
+
+    if (std::find(candidates.begin(), candidates.end(), binding.id) == candidates.end()) {
+      candidates.push_back(binding.id);
+    }
   #elif defined(_WIN32)
     if (!exists) {
       const auto status = RegisterHotKey(
@@ -995,11 +1063,35 @@ namespace SSC {
       this->bindingIds.push_back(binding.id);
       nextGlobalBindingID = nextGlobalBindingID + 1;
       this->bindings.insert_or_assign(binding.id, binding);
+
+      if (binding.isValid()) {
+        globalBindingHashes.insert_or_assign(binding.hash, binding.id);
+      }
+    } else {
+      // rebinding an existing expression updates its options
+      this->bindings.at(binding.id).options = options;
     }
 
     return binding;
   }
 
+  const Vector<HotKeyBinding> HotKeyContext::bindAll (
+    const Vector<HotKeyBinding::Expression>& expressions,
+    HotKeyBinding::Options options
+  ) {
+    Lock lock(this->mutex);
+    Vector<HotKeyBinding> results;
+
+    // registering a whole set under one lock parses each expression exactly
+    // once in `bind()` - callers replacing their bindings wholesale should
+    // prefer this over binding expressions one at a time
+    for (const auto& expression : expressions) {
+      results.push_back(this->bind(expression, options));
+    }
+
+    return results;
+  }
+
   bool HotKeyContext::unbind (HotKeyBinding::ID id) {
     Lock lock(this->mutex);
 
@@ -1012,9 +1104,11 @@ namespace SSC {
     }
 
     const auto& binding = this->bindings.at(id);
+    const auto hash = binding.hash;
   #if defined(__APPLE__) && (!TARGET_OS_IPHONE && !TARGET_IPHONE_SIMULATOR)
     if (UnregisterEventHotKey(binding.eventHotKeyRef) == 0) {
       this->bindings.erase(id);
+      globalBindingHashes.erase(hash);
       return true;
     }
   #elif defined(__linux__) && !defined(__ANDROID__)
@@ -1022,18 +1116,42 @@ namespace SSC {
       return false;
     }
 
+    const auto keys = binding.keys;
+
     this->bindings.erase(id);
+    globalBindingHashes.erase(hash);
+
+    if (this->gtkKeyCodeBindings.contains(keys)) {
+      auto& candidates = this->gtkKeyCodeBindings.at(keys);
+      const auto cursor = std::find(candidates.begin(), candidates.end(), id);
 
-    if (this->gtkKeyPressEventContexts.contains(id)) {
-      auto& context = this->gtkKeyPressEventContexts.at(id);
-      this->gtkKeyPressEventContexts.erase(id);
-      g_signal_handler_disconnect(this->window->window, context.signal);
+      if (cursor != candidates.end()) {
+        candidates.erase(cursor);
+      }
+
+      if (candidates.size() == 0) {
+        this->gtkKeyCodeBindings.erase(keys);
+      }
+    }
+
+    // drop the shared key-press handler when the last binding goes away
+    if (
+      this->gtkKeyCodeBindings.size() == 0 &&
+      this->gtkKeyPressEventContext.signal != 0
+    ) {
+      g_signal_handler_disconnect(
+        this->window->window,
+        this->gtkKeyPressEventContext.signal
+      );
+
+      this->gtkKeyPressEventContext.signal = 0;
     }
 
     return true;
   #elif defined(_WIN32)
     if (UnregisterHotKey(this->window->window, id)) {
       this->bindings.erase(id);
+      globalBindingHashes.erase(hash);
       return true;
     }
   #endif
@@ -1044,14 +1162,9 @@ namespace SSC {
   bool HotKeyContext::hasBindingForExpression (HotKeyBinding::Expression expression) const {
     const auto sequence = HotKeyBinding::parseExpression(expression);
     const auto hash = std::hash<String>{}(join(sequence, "+"));
+    const auto entry = globalBindingHashes.find(hash);
 
-    for (const auto& binding : bindings) {
-      if (binding.second.hash == hash) {
-        return true;
-      }
-    }
-
-    return false;
+    return entry != globalBindingHashes.end() && this->bindings.contains(entry->second);
   }
 
   const HotKeyBinding HotKeyContext::getBindingForExpression (
@@ -1059,11 +1172,10 @@ namespace SSC {
   ) const {
     const auto sequence = HotKeyBinding::parseExpression(expression);
     const auto hash = std::hash<String>{}(join(sequence, "+"));
+    const auto entry = globalBindingHashes.find(hash);
 
-    for (const auto& entry : this->bindings) {
-      if (entry.second.hash == hash) {
-        return entry.second;
-      }
+    if (entry != globalBindingHashes.end() && this->bindings.contains(entry->second)) {
+      return this->bindings.at(entry->second);
     }
 
     return HotKeyBinding(0, "");
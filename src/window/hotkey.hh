@@ -40,7 +40,6 @@ namespace SSC {
     #if defined(__linux__) && !defined(__ANDROID__)
       struct GTKKeyPressEventContext {
         HotKeyContext* context = nullptr;
-        ID id = 0;
         guint signal = 0;
       };
     #endif
@@ -64,6 +63,7 @@ namespace SSC {
     #endif
 
       HotKeyBinding (ID id, Expression input);
+      HotKeyBinding (ID id, Expression input, const Sequence& sequence);
       bool isValid () const;
   };
 
@@ -75,10 +75,14 @@ namespace SSC {
       // Apple Carbon API
       EventTargetRef eventTarget;
     #elif defined(__linux__) && !defined(__ANDROID__)
-      std::map<
-        HotKeyBinding::ID,
-        HotKeyBinding::GTKKeyPressEventContext
-      > gtkKeyPressEventContexts;
+      HotKeyBinding::GTKKeyPressEventContext gtkKeyPressEventContext;
+      // binding ids keyed on their compiled GDK key code so a key press
+      // event resolves candidate bindings with a single lookup instead of
+      // walking every binding expression through the code map
+      std::unordered_map<
+        HotKeyCodeMap::Code,
+        Vector<HotKeyBinding::ID>
+      > gtkKeyCodeBindings;
     #endif
 
       Window* window = nullptr;
@@ -99,6 +103,10 @@ namespace SSC {
         HotKeyBinding::Expression expression,
         HotKeyBinding::Options options = {}
       );
+      const Vector<HotKeyBinding> bindAll (
+        const Vector<HotKeyBinding::Expression>& expressions,
+        HotKeyBinding::Options options = {}
+      );
       bool unbind (HotKeyBinding::ID id);
       bool hasBindingForExpression (HotKeyBinding::Expression expression) const;
       const HotKeyBinding getBindingForExpression (HotKeyBinding::Expression expression) const;
@@ -207,65 +207,94 @@ namespace SSC {
       NULL
     );
 
-    webview = GTK_WIDGET(WEBKIT_WEB_VIEW(g_object_new(WEBKIT_TYPE_WEB_VIEW,
-      "web-context", webContext,
-      "settings", settings,
-      "user-content-manager", cm,
-      "website-policies", policies,
-      NULL
-    )));
+    // every webview after the first is created as a related view so it
+    // joins the first window's WebKit web process (one JS heap, one
+    // compiled preload) instead of paying a full web process startup
+    static WebKitWebView* relatedWebview = nullptr;
+
+    if (relatedWebview != nullptr) {
+      webview = GTK_WIDGET(WEBKIT_WEB_VIEW(g_object_new(WEBKIT_TYPE_WEB_VIEW,
+        "related-view", relatedWebview,
+        "settings", settings,
+        "user-content-manager", cm,
+        "website-policies", policies,
+        NULL
+      )));
+    } else {
+      webview = GTK_WIDGET(WEBKIT_WEB_VIEW(g_object_new(WEBKIT_TYPE_WEB_VIEW,
+        "web-context", webContext,
+        "settings", settings,
+        "user-content-manager", cm,
+        "website-policies", policies,
+        NULL
+      )));
+
+      relatedWebview = WEBKIT_WEB_VIEW(webview);
+      g_object_add_weak_pointer(G_OBJECT(webview), (gpointer*) &relatedWebview);
+    }
+
+    // the web context (and its scheme handlers) is shared across
+    // windows - requests resolve back to this window's router by the
+    // webview they came in on
+    this->bridge->router.setWebKitWebView(WEBKIT_WEB_VIEW(webview));
 
     gtk_widget_set_can_focus(GTK_WIDGET(webview), true);
 
     webkit_cookie_manager_set_accept_policy(cookieManager, WEBKIT_COOKIE_POLICY_ACCEPT_ALWAYS);
 
-    g_signal_connect(
-      G_OBJECT(webContext),
-      "initialize-notification-permissions",
-      G_CALLBACK(+[](
-        WebKitWebContext* webContext,
-        gpointer userData
-      ) {
-        static auto userConfig = SSC::getUserConfig();
-        static const auto bundleIdentifier = userConfig["meta_bundle_identifier"];
-
-        auto uri = "socket://" + bundleIdentifier;
-        auto origin = webkit_security_origin_new_for_uri(uri.c_str());
-        GList* allowed = nullptr;
-        GList* disallowed = nullptr;
+    // the context is shared, so this only needs to be connected once
+    static bool notificationPermissionsConnected = false;
 
-        webkit_security_origin_ref(origin);
+    if (!notificationPermissionsConnected) {
+      notificationPermissionsConnected = true;
+      g_signal_connect(
+        G_OBJECT(webContext),
+        "initialize-notification-permissions",
+        G_CALLBACK(+[](
+          WebKitWebContext* webContext,
+          gpointer userData
+        ) {
+          static auto userConfig = SSC::getUserConfig();
+          static const auto bundleIdentifier = userConfig["meta_bundle_identifier"];
+
+          auto uri = "socket://" + bundleIdentifier;
+          auto origin = webkit_security_origin_new_for_uri(uri.c_str());
+          GList* allowed = nullptr;
+          GList* disallowed = nullptr;
+
+          webkit_security_origin_ref(origin);
+
+          if (origin && allowed && disallowed) {
+            if (userConfig["permissions_allow_notifications"] == "false") {
+              disallowed = g_list_append(disallowed, (gpointer) origin);
+            } else {
+              allowed = g_list_append(allowed, (gpointer) origin);
+            }
 
-        if (origin && allowed && disallowed) {
-          if (userConfig["permissions_allow_notifications"] == "false") {
-            disallowed = g_list_append(disallowed, (gpointer) origin);
-          } else {
-            allowed = g_list_append(allowed, (gpointer) origin);
+            if (allowed && disallowed) {
+              webkit_web_context_initialize_notification_permissions(
+                webContext,
+                allowed,
+                disallowed
+              );
+            }
           }
 
-          if (allowed && disallowed) {
-            webkit_web_context_initialize_notification_permissions(
-              webContext,
-              allowed,
-              disallowed
-            );
+          if (allowed) {
+            g_list_free(allowed);
           }
-        }
-
-        if (allowed) {
-          g_list_free(allowed);
-        }
 
-        if (disallowed) {
-          g_list_free(disallowed);
-        }
+          if (disallowed) {
+            g_list_free(disallowed);
+          }
 
-        if (origin) {
-          webkit_security_origin_unref(origin);
-        }
-      }),
-      this
-    );
+          if (origin) {
+            webkit_security_origin_unref(origin);
+          }
+        }),
+        this
+      );
+    }
 
     g_signal_connect(
       G_OBJECT(webview),
@@ -956,21 +985,78 @@ namespace SSC {
   }
 
   void Window::eval (const String& source) {
-    auto webview = this->webview;
-    this->app.dispatch([=, this] {
-      webkit_web_view_evaluate_javascript(
-        WEBKIT_WEB_VIEW(this->webview),
-        String(source).c_str(),
-        -1,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr
-      );
+    do {
+      Lock lock(this->evaluationMutex);
+      this->pendingEvaluations.push_back(source);
+
+      if (this->evaluationFlushScheduled) {
+        return;
+      }
+
+      this->evaluationFlushScheduled = true;
+    } while (0);
+
+    this->app.dispatch([this] {
+      this->flushPendingEvaluations();
     });
   }
 
+  void Window::flushPendingEvaluations () {
+    // keep a single flush under this size so a large burst cannot
+    // monopolize the main loop - the remainder is flushed on the
+    // next idle cycle
+    static constexpr size_t maxFlushSize = 256 * 1024;
+
+    StringStream script;
+    bool reschedule = false;
+
+    do {
+      Lock lock(this->evaluationMutex);
+      size_t flushed = 0;
+      size_t size = 0;
+
+      while (flushed < this->pendingEvaluations.size()) {
+        const auto& source = this->pendingEvaluations[flushed];
+
+        if (flushed > 0 && size + source.size() > maxFlushSize) {
+          break;
+        }
+
+        script << source << ";\n";
+        size += source.size();
+        flushed++;
+      }
+
+      this->pendingEvaluations.erase(
+        this->pendingEvaluations.begin(),
+        this->pendingEvaluations.begin() + flushed
+      );
+
+      if (this->pendingEvaluations.size() > 0) {
+        reschedule = true;
+      } else {
+        this->evaluationFlushScheduled = false;
+      }
+    } while (0);
+
+    webkit_web_view_evaluate_javascript(
+      WEBKIT_WEB_VIEW(this->webview),
+      script.str().c_str(),
+      -1,
+      nullptr,
+      nullptr,
+      nullptr,
+      nullptr,
+      nullptr
+    );
+
+    if (reschedule) {
+      this->app.dispatch([this] {
+        this->flushPendingEvaluations();
+      });
+    }
+  }
+
   void Window::show () {
     gtk_widget_realize(this->window);
 
@@ -1050,6 +1136,31 @@ namespace SSC {
     gtk_window_set_title(GTK_WINDOW(window), s.c_str());
   }
 
+  void Window::setIndex (int index) {
+    this->index = index;
+    this->opts.index = index;
+
+    // the preload bakes the window index into the webview, so rebinding
+    // a pooled window replaces the injected user script wholesale
+    auto manager =
+      webkit_web_view_get_user_content_manager(WEBKIT_WEB_VIEW(this->webview));
+
+    webkit_user_content_manager_remove_all_scripts(manager);
+
+    String preload = createPreload(this->opts);
+
+    webkit_user_content_manager_add_script(
+      manager,
+      webkit_user_script_new(
+        preload.c_str(),
+        WEBKIT_USER_CONTENT_INJECT_ALL_FRAMES,
+        WEBKIT_USER_SCRIPT_INJECT_AT_DOCUMENT_START,
+        nullptr,
+        nullptr
+      )
+    );
+  }
+
   int Window::openExternal (const String& url) {
     gtk_widget_realize(window);
     return gtk_show_uri_on_window(GTK_WINDOW(window), url.c_str(), GDK_CURRENT_TIME, nullptr);
@@ -4,6 +4,8 @@
 #include <shellapi.h>
 #include <fileapi.h>
 #include <urlmon.h>
+#include <condition_variable>
+#include <mutex>
 #include "window.hh"
 
 #include "WebView2.h"
@@ -31,6 +33,173 @@ namespace SSC {
     MessageBoxA(nullptr, s, _TEXT("Alert"), MB_OK | MB_ICONSTOP);
   }
 
+  /**
+   * An `IStream` that pulls pooled chunks out of a chunked `Post` stream
+   * so a WebView2 resource response can stream a large body instead of
+   * buffering it. `Read()` blocks until the producer writes — WebView2
+   * drains response streams off the main thread, so blocking here paces
+   * the transfer towards the webview while the stream's watermarks pace
+   * the producer.
+   */
+  class PostChunkIStream : public IStream {
+    struct Waiter {
+      std::mutex mutex;
+      std::condition_variable condition;
+      bool readable = false;
+    };
+
+    public:
+      PostChunkIStream (std::shared_ptr<PostChunkStream> stream)
+        : stream(stream),
+          waiter(std::make_shared<Waiter>())
+      {
+        auto waiter = this->waiter;
+        this->stream->onReadable = [waiter]() {
+          std::lock_guard<std::mutex> lock(waiter->mutex);
+          waiter->readable = true;
+          waiter->condition.notify_one();
+        };
+      }
+
+      ~PostChunkIStream () {
+        this->stream->cancel();
+      }
+
+      // IUnknown
+      HRESULT __stdcall QueryInterface (REFIID riid, void** object) {
+        if (
+          riid == IID_IUnknown ||
+          riid == IID_IStream ||
+          riid == IID_ISequentialStream
+        ) {
+          *object = static_cast<IStream*>(this);
+          AddRef();
+          return S_OK;
+        }
+
+        *object = nullptr;
+        return E_NOINTERFACE;
+      }
+
+      ULONG __stdcall AddRef (void) {
+        return InterlockedIncrement(&refs);
+      }
+
+      ULONG __stdcall Release (void) {
+        auto count = InterlockedDecrement(&refs);
+        if (count == 0) {
+          delete this;
+        }
+        return count;
+      }
+
+      // ISequentialStream
+      HRESULT __stdcall Read (void* output, ULONG size, ULONG* read) {
+        auto bytes = static_cast<char*>(output);
+        ULONG offset = 0;
+
+        while (offset < size && !this->finished) {
+          if (this->chunk.body != nullptr && this->position < this->chunk.size) {
+            auto available = this->chunk.size - this->position;
+
+            if (available > (size_t) (size - offset)) {
+              available = size - offset;
+            }
+
+            memcpy(bytes + offset, this->chunk.body.get() + this->position, available);
+            this->position += available;
+            offset += (ULONG) available;
+            continue;
+          }
+
+          if (this->chunk.finished) {
+            this->finished = true;
+            break;
+          }
+
+          if (this->stream->read(this->chunk)) {
+            this->position = 0;
+            continue;
+          }
+
+          // an empty closed stream means the final chunk was already
+          // consumed (or the producer cancelled) — otherwise wait for
+          // the producer to write
+          if (this->stream->isClosed()) {
+            this->finished = true;
+            break;
+          }
+
+          std::unique_lock<std::mutex> lock(this->waiter->mutex);
+          this->waiter->condition.wait(lock, [this]() {
+            return this->waiter->readable;
+          });
+          this->waiter->readable = false;
+        }
+
+        if (read != nullptr) {
+          *read = offset;
+        }
+
+        return offset == size ? S_OK : S_FALSE;
+      }
+
+      HRESULT __stdcall Write (const void*, ULONG, ULONG*) {
+        return E_NOTIMPL;
+      }
+
+      // IStream
+      HRESULT __stdcall Seek (LARGE_INTEGER, DWORD, ULARGE_INTEGER*) {
+        return E_NOTIMPL;
+      }
+
+      HRESULT __stdcall SetSize (ULARGE_INTEGER) {
+        return E_NOTIMPL;
+      }
+
+      HRESULT __stdcall CopyTo (IStream*, ULARGE_INTEGER, ULARGE_INTEGER*, ULARGE_INTEGER*) {
+        return E_NOTIMPL;
+      }
+
+      HRESULT __stdcall Commit (DWORD) {
+        return E_NOTIMPL;
+      }
+
+      HRESULT __stdcall Revert (void) {
+        return E_NOTIMPL;
+      }
+
+      HRESULT __stdcall LockRegion (ULARGE_INTEGER, ULARGE_INTEGER, DWORD) {
+        return E_NOTIMPL;
+      }
+
+      HRESULT __stdcall UnlockRegion (ULARGE_INTEGER, ULARGE_INTEGER, DWORD) {
+        return E_NOTIMPL;
+      }
+
+      HRESULT __stdcall Stat (STATSTG* stat, DWORD) {
+        if (stat == nullptr) {
+          return STG_E_INVALIDPOINTER;
+        }
+
+        ZeroMemory(stat, sizeof(STATSTG));
+        stat->type = STGTY_STREAM;
+        return S_OK;
+      }
+
+      HRESULT __stdcall Clone (IStream**) {
+        return E_NOTIMPL;
+      }
+
+    private:
+      std::shared_ptr<PostChunkStream> stream;
+      std::shared_ptr<Waiter> waiter;
+      PostChunkStream::Chunk chunk;
+      size_t position = 0;
+      bool finished = false;
+      LONG refs = 1;
+  };
+
   class CDataObject : public IDataObject {
     public:
       HRESULT __stdcall QueryInterface (REFIID iid, void ** ppvObject);
@@ -954,28 +1123,55 @@ namespace SSC {
                               } else {
                                 delete[] data;
                               }
-                              shared_buf->Close();
+                              // release the stream over the section before
+                              // handing the buffer back for reuse
+                              body_data->Release();
+                              w->sharedBufferPool.recycle(shared_buf);
                             }
                           }
 
                           handled = w->bridge->route(uri, body_ptr, body_length, [&, args, deferral, env, body_ptr](auto result) {
                             String headers;
-                            char* body;
-                            size_t length;
 
                             if (body_ptr != nullptr) {
                               delete[] body_ptr;
                             }
 
-                            if (result.post.body != nullptr) {
-                              length = result.post.length;
-                              body = new char[length];
-                              memcpy(body, result.post.body, length);
+                            if (result.post.stream != nullptr) {
+                              headers = "Content-Type: application/octet-stream\n";
+                              headers += "Connection: keep-alive\n";
+                              headers += "Access-Control-Allow-Headers: *\n";
+                              headers += "Access-Control-Allow-Origin: *\n";
+
+                              // chunked responses stream through an `IStream` pulling
+                              // pooled chunks - no full copy of the body is ever held
+                              auto stream = result.post.stream;
+                              app.dispatch([&, stream, headers, args, deferral, env] {
+                                ICoreWebView2WebResourceResponse* res = nullptr;
+                                IStream* bytes = new PostChunkIStream(stream);
+                                env->CreateWebResourceResponse(
+                                  bytes,
+                                  200,
+                                  L"OK",
+                                  convertStringToWString(headers).c_str(),
+                                  &res
+                                );
+                                args->put_Response(res);
+                                deferral->Complete();
+                                bytes->Release();
+                              });
+                              return;
+                            }
+
+                            // share the pooled post body with the response instead of
+                            // duplicating it here - `SHCreateMemStream` copies once
+                            auto body = result.post.body;
+                            auto json = body == nullptr ? result.str() : String("");
+                            auto length = body != nullptr ? result.post.length : json.size();
+
+                            if (body != nullptr) {
                               headers = "Content-Type: application/octet-stream\n";
                             } else {
-                              length = result.str().size();
-                              body = new char[length];
-                              memcpy(body, result.str().c_str(), length);
                               headers = "Content-Type: application/json\n";
                             }
 
@@ -990,9 +1186,12 @@ namespace SSC {
                             // put_Response() must be called from the same thread that made
                             // the request. This assumes that the request was made from the
                             // main thread, since that's where dispatch() will call its cb.
-                            app.dispatch([&, body, length, headers, args, deferral, env] {
+                            app.dispatch([&, body, json, length, headers, args, deferral, env] {
                               ICoreWebView2WebResourceResponse* res = nullptr;
-                              IStream* bytes = SHCreateMemStream((const BYTE*)body, length);
+                              IStream* bytes = SHCreateMemStream(
+                                (const BYTE*) (body != nullptr ? body.get() : json.c_str()),
+                                length
+                              );
                               env->CreateWebResourceResponse(
                                 bytes,
                                 200,
@@ -1002,7 +1201,6 @@ namespace SSC {
                               );
                               args->put_Response(res);
                               deferral->Complete();
-                              delete[] body;
                             });
                           });
                         }
@@ -1051,25 +1249,61 @@ namespace SSC {
                               String headers;
 
                               auto moduleUri = replace(uri, "\\\\", "/");
-                              auto moduleSource = trim(tmpl(
-                                moduleTemplate,
-                                Map { {"url", String(moduleUri)} }
-                              ));
 
-                              auto length = moduleSource.size();
+                              // memoized per URL with a content hash ETag -
+                              // reloads revalidate with `If-None-Match` and
+                              // get a bodyless 304 instead of re-transferring
+                              // every module shim
+                              const auto& module = IPC::getCachedModuleSource(moduleUri);
+
+                              bool notModified = false;
+                              ICoreWebView2HttpRequestHeaders* moduleRequestHeaders = nullptr;
+
+                              if (req->get_Headers(&moduleRequestHeaders) == S_OK && moduleRequestHeaders != nullptr) {
+                                LPWSTR ifNoneMatch = nullptr;
+
+                                if (moduleRequestHeaders->GetHeader(L"If-None-Match", &ifNoneMatch) == S_OK && ifNoneMatch != nullptr) {
+                                  notModified = IPC::isETagMatch(
+                                    convertWStringToString(ifNoneMatch),
+                                    module.etag
+                                  );
+                                  CoTaskMemFree(ifNoneMatch);
+                                }
+
+                                moduleRequestHeaders->Release();
+                              }
+
+                              auto length = module.source.size();
 
                               headers = "Content-Type: text/javascript\n";
                               headers += "Connection: keep-alive\n";
                               headers += "Access-Control-Allow-Headers: *\n";
                               headers += "Access-Control-Allow-Origin: *\n";
-                              headers += "Content-Length: ";
-                              headers += std::to_string(length);
-                              headers += "\n";
+                              headers += "ETag: " + module.etag + "\n";
+                              headers += "Cache-Control: no-cache\n";
+
+                              if (!notModified) {
+                                headers += "Content-Length: ";
+                                headers += std::to_string(length);
+                                headers += "\n";
+                              }
+
                               headers += userConfig["webview_headers"];
 
                               handled = true;
 
-                              if (method.compare("HEAD") == 0) {
+                              if (notModified) {
+                                ICoreWebView2WebResourceResponse* res = nullptr;
+                                env->CreateWebResourceResponse(
+                                  nullptr,
+                                  304,
+                                  L"Not Modified",
+                                  convertStringToWString(headers).c_str(),
+                                  &res
+                                );
+                                args->put_Response(res);
+                                deferral->Complete();
+                              } else if (method.compare("HEAD") == 0) {
                                 ICoreWebView2WebResourceResponse* res = nullptr;
                                 env->CreateWebResourceResponse(
                                   nullptr,
@@ -1082,7 +1316,7 @@ namespace SSC {
                                 deferral->Complete();
                               } else {
                                 auto body = new char[length];
-                                memcpy(body, moduleSource.c_str(), length);
+                                memcpy(body, module.source.c_str(), length);
 
                                 app.dispatch([&, body, length, headers, args, deferral, env] {
                                   ICoreWebView2WebResourceResponse* res = nullptr;
@@ -1180,9 +1414,25 @@ namespace SSC {
                                 CloseHandle(handle);
                               }
 
+                              String rangeHeader = "";
+
+                              do {
+                                ICoreWebView2HttpRequestHeaders* requestHeaders = nullptr;
+                                LPWSTR value = nullptr;
+
+                                if (req->get_Headers(&requestHeaders) == S_OK && requestHeaders != nullptr) {
+                                  if (requestHeaders->GetHeader(L"Range", &value) == S_OK && value != nullptr) {
+                                    rangeHeader = convertWStringToString(value);
+                                    CoTaskMemFree(value);
+                                  }
+
+                                  requestHeaders->Release();
+                                }
+                              } while (0);
+
                               if (getSizeResult) {
                                 handled = true;
-                                app.dispatch([&, path, args, deferral, env] {
+                                app.dispatch([&, path, rangeHeader, fileSize, args, deferral, env] {
                                   ICoreWebView2WebResourceResponse* res = nullptr;
                                   LPWSTR mimeType = (wchar_t*) L"application/octet-stream";
                                   IStream* stream = nullptr;
@@ -1222,21 +1472,61 @@ namespace SSC {
                                     FindMimeFromData(0, convertStringToWString(path).c_str(), 0, 0, 0, 0, &mimeType, 0);
                                   }
 
+                                  auto range = IPC::parseSchemeHandlerByteRange(rangeHeader, fileSize.QuadPart);
+                                  auto status = 200;
+                                  auto reason = L"OK";
+                                  int64_t length = fileSize.QuadPart;
+
                                   headers = "Content-Type: ";
                                   headers += convertWStringToString(mimeType) + "\n";
                                   headers += "Connection: keep-alive\n";
                                   headers += "Access-Control-Allow-Headers: *\n";
                                   headers += "Access-Control-Allow-Origin: *\n";
+                                  headers += "Accept-Ranges: bytes\n";
+
+                                  if (range.valid) {
+                                    status = 206;
+                                    reason = L"Partial Content";
+                                    length = range.end - range.start + 1;
+                                    headers += "Content-Range: bytes ";
+                                    headers += std::to_string(range.start);
+                                    headers += "-";
+                                    headers += std::to_string(range.end);
+                                    headers += "/";
+                                    headers += std::to_string(fileSize.QuadPart);
+                                    headers += "\n";
+                                  }
+
                                   headers += "Content-Length: ";
-                                  headers += std::to_string(fileSize.QuadPart);
+                                  headers += std::to_string(length);
                                   headers += "\n";
                                   headers += userConfig["webview_headers"];
 
                                   if (SHCreateStreamOnFileA(path.c_str(), STGM_READ, &stream) == S_OK) {
+                                    if (range.valid && range.start > 0) {
+                                      LARGE_INTEGER offset;
+                                      offset.QuadPart = range.start;
+                                      stream->Seek(offset, STREAM_SEEK_SET, nullptr);
+                                    }
+
+                                    if (range.valid && range.end != fileSize.QuadPart - 1) {
+                                      // WebView2 drains a response stream to EOF, so a bounded
+                                      // range is read up front - media players request a few
+                                      // megabytes at most while open ended ranges stream from
+                                      // the seeked file
+                                      auto buffer = new char[length];
+                                      ULONG bytesRead = 0;
+
+                                      stream->Read(buffer, (ULONG) length, &bytesRead);
+                                      stream->Release();
+                                      stream = SHCreateMemStream((const BYTE*) buffer, bytesRead);
+                                      delete [] buffer;
+                                    }
+
                                     env->CreateWebResourceResponse(
                                       stream,
-                                      200,
-                                      L"OK",
+                                      status,
+                                      reason,
                                       convertStringToWString(headers).c_str(),
                                       &res
                                     );
@@ -1302,6 +1592,11 @@ namespace SSC {
                     SSC::convertStringToWString(preload).c_str(),
                     Microsoft::WRL::Callback<ICoreWebView2AddScriptToExecuteOnDocumentCreatedCompletedHandler>(
                       [&](HRESULT error, PCWSTR id) -> HRESULT {
+                        // keep the script id so `setIndex` can replace
+                        // the preload when a pooled window is rebound
+                        if (error == S_OK && id != nullptr) {
+                          preloadScriptId = id;
+                        }
                         return S_OK;
                       }
                     ).Get()
@@ -1335,9 +1630,13 @@ namespace SSC {
                           auto seq = msg.seq;
                           auto size = std::stoull(msg.get("size", "0"));
                           auto index = msg.index;
-                          ICoreWebView2SharedBuffer* sharedBuffer = nullptr;
-                          // TODO(heapwolf): What to do if creation fails, or size == 0?
-                          HRESULT cshr = environment->CreateSharedBuffer(size, &sharedBuffer);
+                          HRESULT cshr = S_OK;
+                          ICoreWebView2SharedBuffer* sharedBuffer = w->sharedBufferPool.acquire(size);
+
+                          if (sharedBuffer == nullptr) {
+                            // TODO(heapwolf): What to do if creation fails, or size == 0?
+                            cshr = environment->CreateSharedBuffer(size, &sharedBuffer);
+                          }
                           String additionalData = "{\"seq\":\"";
                           additionalData += seq;
                           additionalData += "\",\"index\":";
@@ -1356,6 +1655,174 @@ namespace SSC {
                           return S_OK;
                         }
 
+                        // allocates (or replaces) the persistent inbound
+                        // binary ring and hands it to the script — see
+                        // `Window::InboundRing` for the layout
+                        if (msg.name == "buffer.ring") {
+                          ICoreWebView2SharedBuffer* sharedBuffer = nullptr;
+                          constexpr UINT64 size =
+                            Window::InboundRing::HEADER_SIZE +
+                            Window::InboundRing::CAPACITY;
+
+                          HRESULT cshr = environment->CreateSharedBuffer(size, &sharedBuffer);
+
+                          if (cshr == S_OK && sharedBuffer != nullptr) {
+                            BYTE* bytes = nullptr;
+                            sharedBuffer->get_Buffer(&bytes);
+                            memset(bytes, 0, Window::InboundRing::HEADER_SIZE);
+
+                            w->inboundRing.close();
+                            w->inboundRing.buffer = sharedBuffer;
+                            w->inboundRing.bytes = bytes;
+
+                            String additionalData = "{\"ring\":true,\"seq\":\"";
+                            additionalData += msg.seq;
+                            additionalData += "\"}";
+                            cshr = webView18->PostSharedBufferToScript(
+                              sharedBuffer,
+                              COREWEBVIEW2_SHARED_BUFFER_ACCESS_READ_WRITE,
+                              convertStringToWString(additionalData).c_str()
+                            );
+                          }
+
+                          return S_OK;
+                        }
+
+                        // allocates (or replaces) the persistent outbound
+                        // post-notification ring — once attached,
+                        // `Router::send` announces posts as compact binary
+                        // records instead of compiling a `createPost`
+                        // script per payload. see `Window::OutboundRing`
+                        // for the layout
+                        if (msg.name == "post.ring") {
+                          ICoreWebView2SharedBuffer* sharedBuffer = nullptr;
+                          constexpr UINT64 size =
+                            Window::OutboundRing::HEADER_SIZE +
+                            Window::OutboundRing::CAPACITY;
+
+                          HRESULT cshr = environment->CreateSharedBuffer(size, &sharedBuffer);
+
+                          if (cshr == S_OK && sharedBuffer != nullptr) {
+                            BYTE* bytes = nullptr;
+                            sharedBuffer->get_Buffer(&bytes);
+                            memset(bytes, 0, Window::OutboundRing::HEADER_SIZE);
+
+                            w->outboundRing.close();
+                            w->outboundRing.buffer = sharedBuffer;
+                            w->outboundRing.bytes = bytes;
+
+                            w->bridge->router.notifyPostFunction = [w](
+                              uint64_t id,
+                              const SSC::String& seq,
+                              const SSC::String& params,
+                              const SSC::Post& post
+                            ) {
+                              // compact little-endian record: u64 id,
+                              // u32-prefixed params and headers,
+                              // u16-prefixed seq and worker id
+                              const auto headers = post.headers.str();
+                              SSC::String record;
+                              record.reserve(
+                                8 + 4 + params.size() + 4 + headers.size() +
+                                2 + seq.size() + 2 + post.workerId.size()
+                              );
+
+                              const auto append = [&record](const void* bytes, size_t size) {
+                                record.append((const char*) bytes, size);
+                              };
+
+                              uint32_t length32 = 0;
+                              uint16_t length16 = 0;
+
+                              append(&id, 8);
+                              length32 = (uint32_t) params.size();
+                              append(&length32, 4);
+                              record += params;
+                              length32 = (uint32_t) headers.size();
+                              append(&length32, 4);
+                              record += headers;
+                              length16 = (uint16_t) seq.size();
+                              append(&length16, 2);
+                              record += seq;
+                              length16 = (uint16_t) post.workerId.size();
+                              append(&length16, 2);
+                              record += post.workerId;
+
+                              if (!w->outboundRing.write(record.data(), (uint32_t) record.size())) {
+                                return false;
+                              }
+
+                              if (!w->outboundRing.wakeScheduled.exchange(true)) {
+                                w->app.dispatch([w] {
+                                  w->outboundRing.wakeScheduled = false;
+                                  if (w->webview != nullptr) {
+                                    w->webview->PostWebMessageAsJson(L"{\"postRing\":true}");
+                                  }
+                                });
+                              }
+
+                              return true;
+                            };
+
+                            String additionalData = "{\"postRing\":true,\"seq\":\"";
+                            additionalData += msg.seq;
+                            additionalData += "\"}";
+                            cshr = webView18->PostSharedBufferToScript(
+                              sharedBuffer,
+                              COREWEBVIEW2_SHARED_BUFFER_ACCESS_READ_WRITE,
+                              convertStringToWString(additionalData).c_str()
+                            );
+                          }
+
+                          return S_OK;
+                        }
+
+                        // drains every frame the script has written into
+                        // the inbound ring straight into the bridge — only
+                        // this tiny wake message crosses as UTF-16, the
+                        // payloads never do
+                        if (msg.name == "buffer.drain" && w->inboundRing.bytes != nullptr) {
+                          auto bytes = w->inboundRing.bytes;
+                          auto data = (char*) (bytes + Window::InboundRing::HEADER_SIZE);
+                          constexpr auto capacity = (uint32_t) Window::InboundRing::CAPACITY;
+
+                          uint32_t head = 0;
+                          uint32_t tail = 0;
+                          memcpy(&head, bytes, 4);
+                          memcpy(&tail, bytes + 4, 4);
+
+                          while (head != tail) {
+                            if (capacity - head < 4) {
+                              // too close to the end to even hold a
+                              // length — the writer wrapped implicitly
+                              head = 0;
+                              continue;
+                            }
+
+                            uint32_t length = 0;
+                            memcpy(&length, data + head, 4);
+
+                            if (length == 0) {
+                              // padding marker — the writer could not fit
+                              // the next frame before the end and wrapped
+                              head = 0;
+                              continue;
+                            }
+
+                            if (length > capacity - 4 || head + 4 + length > capacity) {
+                              // corrupt cursor or truncated frame — stop
+                              // draining rather than reading past the ring
+                              break;
+                            }
+
+                            w->bridge->route(String(), data + head + 4, length);
+                            head = (head + 4 + length) % capacity;
+                          }
+
+                          memcpy(bytes, &head, 4);
+                          return S_OK;
+                        }
+
                         if (!w->bridge->route(message, nullptr, 0)) {
                           onMessage(message);
                         }
@@ -1501,6 +1968,12 @@ namespace SSC {
   }
 
   void Window::kill () {
+    if (this->bridge != nullptr) {
+      this->bridge->router.notifyPostFunction = nullptr;
+    }
+    this->inboundRing.close();
+    this->outboundRing.close();
+    this->sharedBufferPool.drain();
     if (this->controller != nullptr) this->controller->Close();
     if (this->window != nullptr) {
       if (menubar != NULL) DestroyMenu(menubar);
@@ -1653,6 +2126,38 @@ namespace SSC {
     SetWindowText(window, title.c_str());
   }
 
+  void Window::setIndex (int index) {
+    this->index = index;
+    this->opts.index = index;
+
+    if (this->webview == nullptr) {
+      return;
+    }
+
+    // the preload bakes the window index into the webview, so rebinding
+    // a pooled window replaces the injected script wholesale
+    if (this->preloadScriptId.size() > 0) {
+      this->webview->RemoveScriptToExecuteOnDocumentCreated(
+        this->preloadScriptId.c_str()
+      );
+      this->preloadScriptId.clear();
+    }
+
+    auto preload = createPreload(this->opts);
+
+    this->webview->AddScriptToExecuteOnDocumentCreated(
+      convertStringToWString(preload).c_str(),
+      Microsoft::WRL::Callback<ICoreWebView2AddScriptToExecuteOnDocumentCreatedCompletedHandler>(
+        [this](HRESULT error, PCWSTR id) -> HRESULT {
+          if (error == S_OK && id != nullptr) {
+            this->preloadScriptId = id;
+          }
+          return S_OK;
+        }
+      ).Get()
+    );
+  }
+
   ScreenSize Window::getSize () {
     // 100 are the min width/height that can be returned. Keep defaults in case
     // the function call fail.
@@ -2063,11 +2568,7 @@ namespace SSC {
         }};
 
         if (app != nullptr && app->windowManager != nullptr) {
-          for (auto window : app->windowManager->windows) {
-            if (window != nullptr) {
-              window->bridge->router.emit("applicationurl", json.str());
-            }
-          }
+          app->windowManager->broadcast("applicationurl", json.str());
         }
         break;
       }
@@ -178,6 +178,15 @@ namespace SSC {
       double dragLastY = 0;
       bool isDragInvokedInsideWindow;
       int popupId;
+      // sources queued by `eval()` and flushed once per main loop idle
+      // cycle as a single concatenated script - every call to
+      // `webkit_web_view_evaluate_javascript` crosses into the WebKit UI
+      // process, so a burst of router results becomes one crossing
+      std::vector<String> pendingEvaluations;
+      Mutex evaluationMutex;
+      bool evaluationFlushScheduled = false;
+
+      void flushPendingEvaluations ();
     #elif defined(_WIN32)
       static LRESULT CALLBACK WndProc(HWND, UINT, WPARAM, LPARAM);
       bool usingCustomEdgeRuntimeDirectory = false;
@@ -192,6 +201,183 @@ namespace SSC {
       HWND window;
       std::map<int, std::string> menuMap;
       std::map<int, std::string> menuTrayMap;
+      // id of the injected preload script - kept so `setIndex` can
+      // replace the script when a pooled window is rebound
+      WString preloadScriptId;
+
+      // pool of WebView2 shared buffers: `buffer.create` draws from here
+      // and consumed buffers are recycled once their payload has been
+      // read, so steady-state binary transfer reuses mapped sections
+      // instead of paying `CreateSharedBuffer` kernel work per payload.
+      // classes are keyed by exact payload size - streaming repeats the
+      // same chunk size, and an exact match keeps the byteLength the
+      // script sees unchanged
+      struct SharedBufferPool {
+        static constexpr size_t MAX_PER_CLASS = 4;
+
+        std::recursive_mutex mutex;
+        std::map<uint64_t, std::vector<ICoreWebView2SharedBuffer*>> classes;
+
+        ICoreWebView2SharedBuffer* acquire (uint64_t size) {
+          std::lock_guard<std::recursive_mutex> guard(this->mutex);
+          auto entry = this->classes.find(size);
+
+          if (entry == this->classes.end() || entry->second.empty()) {
+            return nullptr;
+          }
+
+          auto buffer = entry->second.back();
+          entry->second.pop_back();
+          return buffer;
+        }
+
+        void recycle (ICoreWebView2SharedBuffer* buffer) {
+          if (buffer == nullptr) return;
+
+          UINT64 size = 0;
+          buffer->get_Size(&size);
+
+          std::lock_guard<std::recursive_mutex> guard(this->mutex);
+          auto& available = this->classes[size];
+
+          if (available.size() >= MAX_PER_CLASS) {
+            buffer->Close();
+            return;
+          }
+
+          available.push_back(buffer);
+        }
+
+        void drain () {
+          std::lock_guard<std::recursive_mutex> guard(this->mutex);
+
+          for (auto& entry : this->classes) {
+            for (auto buffer : entry.second) {
+              buffer->Close();
+            }
+          }
+
+          this->classes.clear();
+        }
+      };
+
+      SharedBufferPool sharedBufferPool;
+
+      // a persistent web->native shared-buffer ring for inbound binary
+      // IPC: the script writes length-prefixed `Frame` payloads into the
+      // section and posts a tiny `buffer.drain` wake message, so bulk
+      // inbound payloads skip the UTF-16 web message detour entirely.
+      // layout (little endian, cursors advance modulo capacity):
+      //   u32 head - native read cursor, only the native side writes it
+      //   u32 tail - script write cursor, only the script writes it
+      //   data[capacity]
+      // a frame is a u32 length followed by that many bytes; a zero
+      // length marks padding at the end of the section, telling the
+      // reader to wrap to offset 0 (frames are never split) — when
+      // fewer than 4 bytes remain before the end, both sides wrap
+      // implicitly since not even a marker fits
+      struct InboundRing {
+        static constexpr uint64_t CAPACITY = 1024 * 1024;
+        static constexpr uint64_t HEADER_SIZE = 8;
+
+        ICoreWebView2SharedBuffer* buffer = nullptr;
+        BYTE* bytes = nullptr;
+
+        void close () {
+          if (this->buffer != nullptr) {
+            this->buffer->Close();
+            this->buffer = nullptr;
+            this->bytes = nullptr;
+          }
+        }
+      };
+
+      InboundRing inboundRing;
+
+      // a persistent native->web shared-buffer ring announcing `Post`
+      // payloads: `Router::send` writes one compact binary record per
+      // post and a tiny coalesced web message wakes the preload to
+      // drain them, replacing a `createPost` script compile per payload.
+      // layout (little endian, cursors advance modulo capacity):
+      //   u32 head - script read cursor, only the script writes it
+      //   u32 tail - native write cursor, only the native side writes it
+      //   data[capacity]
+      // framing follows `InboundRing`: a u32 length precedes each
+      // record, a zero length marks padding before a wrap and both
+      // sides wrap implicitly when fewer than 4 bytes remain
+      struct OutboundRing {
+        static constexpr uint64_t CAPACITY = 256 * 1024;
+        static constexpr uint64_t HEADER_SIZE = 8;
+
+        ICoreWebView2SharedBuffer* buffer = nullptr;
+        BYTE* bytes = nullptr;
+        // serializes concurrent native writers - the script only reads
+        std::recursive_mutex mutex;
+        // one pending wake drains every record written before it runs
+        std::atomic<bool> wakeScheduled = false;
+
+        // appends one length-prefixed record, returning `false` when no
+        // ring is attached or the record does not fit - the caller
+        // falls back to the script announcement in that case
+        bool write (const char* data, uint32_t length) {
+          std::lock_guard<std::recursive_mutex> guard(this->mutex);
+
+          constexpr auto capacity = (uint32_t) CAPACITY;
+
+          if (this->bytes == nullptr || length == 0 || length > capacity - 4) {
+            return false;
+          }
+
+          uint32_t head = 0;
+          uint32_t tail = 0;
+          memcpy(&head, this->bytes, 4);
+          memcpy(&tail, this->bytes + 4, 4);
+
+          if (head > capacity || tail > capacity) {
+            return false; // corrupt cursors - let the fallback carry it
+          }
+
+          // one byte is kept unused so a full ring and an empty ring
+          // are distinguishable
+          const auto available = (head + capacity - tail - 1) % capacity;
+          const auto contiguous = capacity - tail;
+          const auto need = 4 + length;
+          // wrapping burns the contiguous remainder as padding
+          const auto required = need > contiguous ? contiguous + need : need;
+
+          if (required > available) {
+            return false;
+          }
+
+          auto base = (char*) (this->bytes + HEADER_SIZE);
+
+          if (need > contiguous) {
+            if (contiguous >= 4) {
+              const uint32_t marker = 0;
+              memcpy(base + tail, &marker, 4);
+            }
+            tail = 0;
+          }
+
+          memcpy(base + tail, &length, 4);
+          memcpy(base + tail + 4, data, length);
+          tail = (tail + need) % capacity;
+          memcpy(this->bytes + 4, &tail, 4);
+          return true;
+        }
+
+        void close () {
+          std::lock_guard<std::recursive_mutex> guard(this->mutex);
+          if (this->buffer != nullptr) {
+            this->buffer->Close();
+            this->buffer = nullptr;
+            this->bytes = nullptr;
+          }
+        }
+      };
+
+      OutboundRing outboundRing;
+
       void resize (HWND window);
     #endif
 
@@ -215,6 +401,7 @@ namespace SSC {
       void navigate (const String&, const String&);
       String getTitle ();
       void setTitle (const String&);
+      void setIndex (int);
       ScreenSize getSize ();
       void setSize (int, int, int);
       void setContextMenu (const String&, const String&);
@@ -403,6 +590,31 @@ namespace SSC {
       std::recursive_mutex mutex;
       WindowManagerOptions options;
 
+      // settings-derived window defaults resolved into typed values
+      // once (see `resolveWindowDefaults()`) so `createWindow` copies
+      // them instead of re-parsing percent strings against the screen
+      // size and re-walking `build_env` for every window
+      struct ResolvedWindowDefaults {
+        float width = 0;
+        float height = 0;
+        float minWidth = 0;
+        float minHeight = 0;
+        float maxWidth = 0;
+        float maxHeight = 0;
+        String env = "";
+      };
+
+      ResolvedWindowDefaults resolvedWindowDefaults;
+      bool resolvedWindowDefaultsValid = false;
+
+      // one hidden, fully initialized window kept warm so `window.create`
+      // hands out a ready webview instead of paying process spawn,
+      // content manager setup and preload injection on the critical
+      // path. created against default options and rebound to the
+      // requested index at adoption time; not registered in `windows`
+      // until adopted
+      ManagedWindow* warmWindow = nullptr;
+
       WindowManager (App &app) :
         app(app),
         inits(SSC_MAX_WINDOWS + SSC_MAX_WINDOWS_RESERVED),
@@ -419,6 +631,15 @@ namespace SSC {
 
       void destroy () {
         if (this->destroyed) return;
+
+        if (this->warmWindow != nullptr) {
+          auto warm = this->warmWindow;
+          this->warmWindow = nullptr;
+          warm->close(0);
+          warm->kill();
+          delete warm;
+        }
+
         for (auto window : windows) {
           destroyWindow(window);
         }
@@ -444,6 +665,40 @@ namespace SSC {
         this->options.isTest = configuration.isTest;
         this->options.argv = configuration.argv;
         this->options.cwd = configuration.cwd;
+        this->resolveWindowDefaults();
+      }
+
+      // resolves the configured defaults into the typed template copied
+      // by `createWindow`. runs on `configure()` so a config change
+      // re-resolves, and lazily for managers that were never configured
+      void resolveWindowDefaults () {
+        std::lock_guard<std::recursive_mutex> guard(this->mutex);
+        StringStream env;
+
+        for (auto const &envKey : parseStringList(this->options.appData["build_env"])) {
+          auto cleanKey = trim(envKey);
+
+          if (!Env::has(cleanKey)) {
+            continue;
+          }
+
+          auto envValue = Env::get(cleanKey);
+
+          env << String(
+            cleanKey + "=" + encodeURIComponent(envValue) + "&"
+          );
+        }
+
+        auto screen = Window::getScreenSize();
+
+        this->resolvedWindowDefaults.width = Window::getSizeInPixels(this->options.defaultWidth, screen.width);
+        this->resolvedWindowDefaults.height = Window::getSizeInPixels(this->options.defaultHeight, screen.height);
+        this->resolvedWindowDefaults.minWidth = Window::getSizeInPixels(this->options.defaultMinWidth, screen.width);
+        this->resolvedWindowDefaults.minHeight = Window::getSizeInPixels(this->options.defaultMinHeight, screen.height);
+        this->resolvedWindowDefaults.maxWidth = Window::getSizeInPixels(this->options.defaultMaxWidth, screen.width);
+        this->resolvedWindowDefaults.maxHeight = Window::getSizeInPixels(this->options.defaultMaxHeight, screen.height);
+        this->resolvedWindowDefaults.env = env.str();
+        this->resolvedWindowDefaultsValid = true;
       }
 
       void inline log (const String line) {
@@ -502,6 +757,32 @@ namespace SSC {
         return WindowStatus::WINDOW_NONE;
       }
 
+      /**
+       * Broadcasts `event` to every live window. The emit script is
+       * rendered once and shared across windows, and delivery goes
+       * through each window's batched JavaScript queue so all webviews
+       * flush in the same loop turn - broadcasting to six windows pays
+       * one payload render instead of six.
+       */
+      void broadcast (const String& event, const String& data) {
+        std::lock_guard<std::recursive_mutex> guard(this->mutex);
+        if (this->destroyed) return;
+
+        const auto value = encodeURIComponent(data);
+        const auto script = getEmitToRenderProcessJavaScript(event, value);
+
+        for (auto window : this->windows) {
+          if (
+            window != nullptr &&
+            window->status > WindowStatus::WINDOW_NONE &&
+            window->status < WindowStatus::WINDOW_EXITING &&
+            window->bridge != nullptr
+          ) {
+            window->bridge->router.queueJavaScript(script);
+          }
+        }
+      }
+
       void destroyWindow (int index) {
         std::lock_guard<std::recursive_mutex> guard(this->mutex);
         if (destroyed) return;
@@ -538,6 +819,7 @@ namespace SSC {
       }
 
       ManagedWindow* createWindow (WindowOptions opts) {
+        SSC_TRACE_SPAN("launch", "WindowManager::createWindow");
         std::lock_guard<std::recursive_mutex> guard(this->mutex);
         if (destroyed) return nullptr;
         StringStream env;
@@ -546,7 +828,13 @@ namespace SSC {
           return windows[opts.index];
         }
 
+        if (!this->resolvedWindowDefaultsValid) {
+          this->resolveWindowDefaults();
+        }
+
         if (opts.appData.size() > 0) {
+          // caller-supplied settings can differ from the configured ones,
+          // so this path still resolves per creation
           for (auto const &envKey : parseStringList(opts.appData["build_env"])) {
             auto cleanKey = trim(envKey);
 
@@ -561,40 +849,26 @@ namespace SSC {
             );
           }
         } else {
-          for (auto const &envKey : parseStringList(this->options.appData["build_env"])) {
-            auto cleanKey = trim(envKey);
-
-            if (!Env::has(cleanKey)) {
-              continue;
-            }
-
-            auto envValue = Env::get(cleanKey);
-
-            env << String(
-              cleanKey + "=" + encodeURIComponent(envValue) + "&"
-            );
-          }
+          env << this->resolvedWindowDefaults.env;
         }
 
-        auto screen = Window::getScreenSize();
-
         float width = opts.width <= 0
-          ? Window::getSizeInPixels(this->options.defaultWidth, screen.width)
+          ? this->resolvedWindowDefaults.width
           : opts.width;
         float height = opts.height <= 0
-          ? Window::getSizeInPixels(this->options.defaultHeight, screen.height)
+          ? this->resolvedWindowDefaults.height
           : opts.height;
         float minWidth = opts.minWidth <= 0
-          ? Window::getSizeInPixels(this->options.defaultMinWidth, screen.width)
+          ? this->resolvedWindowDefaults.minWidth
           : opts.minWidth;
         float minHeight = opts.minHeight <= 0
-          ? Window::getSizeInPixels(this->options.defaultMinHeight, screen.height)
+          ? this->resolvedWindowDefaults.minHeight
           : opts.minHeight;
         float maxWidth = opts.maxWidth <= 0
-          ? Window::getSizeInPixels(this->options.defaultMaxWidth, screen.width)
+          ? this->resolvedWindowDefaults.maxWidth
           : opts.maxWidth;
         float maxHeight = opts.maxHeight <= 0
-          ? Window::getSizeInPixels(this->options.defaultMaxHeight, screen.height)
+          ? this->resolvedWindowDefaults.maxHeight
           : opts.maxHeight;
 
         WindowOptions windowOptions = {
@@ -626,7 +900,43 @@ namespace SSC {
           this->log("Creating Window#" + std::to_string(opts.index));
         }
 
-        auto window = new ManagedWindow(*this, app, windowOptions);
+        ManagedWindow* window = nullptr;
+
+        // hand out the warm window when the requested options only
+        // differ in ways that can be rebound after construction (index,
+        // title, size); chrome flags are baked in at creation time
+        if (
+          this->warmWindow != nullptr &&
+          opts.index >= 0 && opts.index < SSC_MAX_WINDOWS &&
+          windowOptions.resizable &&
+          !windowOptions.frameless &&
+          !windowOptions.utility &&
+          !windowOptions.headless &&
+          !windowOptions.debug
+        ) {
+          window = this->warmWindow;
+          this->warmWindow = nullptr;
+
+          this->log("Adopting warm window as Window#" + std::to_string(opts.index));
+
+          window->setIndex(opts.index);
+          window->opts.canExit = windowOptions.canExit;
+          window->opts.url = windowOptions.url;
+
+          if (windowOptions.title.size() > 0) {
+            window->setTitle(windowOptions.title);
+          }
+
+          if (windowOptions.width > 0 && windowOptions.height > 0) {
+            window->setSize(
+              (int) windowOptions.width,
+              (int) windowOptions.height,
+              WINDOW_HINT_NONE
+            );
+          }
+        } else {
+          window = new ManagedWindow(*this, app, windowOptions);
+        }
 
         window->status = WindowStatus::WINDOW_CREATED;
         window->onExit = this->options.onExit;
@@ -638,6 +948,31 @@ namespace SSC {
         return window;
       }
 
+      // creates the hidden warm window handed out by `createWindow`. a
+      // no-op when one is already warm; callers re-arm the pool off the
+      // critical path (deferred through `App::dispatch`) after an
+      // adoption
+      void prewarmWindow () {
+        std::lock_guard<std::recursive_mutex> guard(this->mutex);
+        if (this->destroyed || this->warmWindow != nullptr) return;
+
+        // parked in the last reserved slot until adopted - never shown
+        // and never reachable through `getWindow`
+        auto opts = WindowOptions {};
+        opts.index = SSC_MAX_WINDOWS + SSC_MAX_WINDOWS_RESERVED - 1;
+
+        if (getWindowStatus(opts.index) != WindowStatus::WINDOW_NONE) {
+          return;
+        }
+
+        this->warmWindow = createWindow(opts);
+
+        if (this->warmWindow != nullptr) {
+          windows[opts.index] = nullptr;
+          inits[opts.index] = false;
+        }
+      }
+
       ManagedWindow* createDefaultWindow (WindowOptions opts) {
         return createWindow(WindowOptions {
           .resizable = opts.resizable,
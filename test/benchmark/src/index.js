@@ -0,0 +1,272 @@
+/**
+ * End-to-end throughput/latency harness for the runtime. Unlike the
+ * microbenchmarks in `src/bench/bench.cc`, everything here crosses the
+ * real boundaries a production app crosses: IPC messages travel through
+ * the webview bridge into `Router::invoke` and back, and UDP datagrams
+ * go through `Core::UDP` over an OS loopback socket pair.
+ *
+ * Run with `npm run bench:harness` from `test/`. Configuration comes
+ * from the host environment:
+ *
+ *   BENCH_DURATION_MS        per-benchmark run time      (default 5000)
+ *   BENCH_MESSAGE_SIZE       ipc payload size in bytes   (default 256)
+ *   BENCH_PIPELINE_DEPTH     in-flight messages for the
+ *                            throughput runs             (default 64)
+ *   BENCH_UDP_MESSAGE_SIZE   udp payload size in bytes   (default 1024)
+ *   BENCH_UDP_PORT           loopback port for the
+ *                            udp echo pair               (default 38000)
+ *
+ * Each benchmark reports roundtrip latency percentiles (p50/p90/p99/max)
+ * and the throughput runs additionally report max sustained messages
+ * per second at the configured pipeline depth. Numbers are only
+ * comparable on the same machine, so compare runs against a baseline
+ * recorded on the same host.
+ */
+import process from 'socket:process'
+import console from 'socket:console'
+import Buffer from 'socket:buffer'
+import dgram from 'socket:dgram'
+import ipc from 'socket:ipc'
+
+const config = {
+  duration: int(process.env.BENCH_DURATION_MS, 5000),
+  messageSize: int(process.env.BENCH_MESSAGE_SIZE, 256),
+  pipelineDepth: int(process.env.BENCH_PIPELINE_DEPTH, 64),
+  udpMessageSize: int(process.env.BENCH_UDP_MESSAGE_SIZE, 1024),
+  udpPort: int(process.env.BENCH_UDP_PORT, 38000)
+}
+
+const WARMUP_ITERATIONS = 64
+
+function int (value, defaultValue) {
+  const parsed = parseInt(value, 10)
+  return Number.isFinite(parsed) ? parsed : defaultValue
+}
+
+function percentile (samples, quantile) {
+  if (samples.length === 0) return 0
+  const index = Math.min(
+    samples.length - 1,
+    Math.floor(quantile * samples.length)
+  )
+  return samples[index]
+}
+
+function reportLatency (name, samples) {
+  samples.sort((left, right) => left - right)
+  console.log(
+    'ok - %s p50=%sms p90=%sms p99=%sms max=%sms (%s roundtrips)',
+    name,
+    percentile(samples, 0.50).toFixed(3),
+    percentile(samples, 0.90).toFixed(3),
+    percentile(samples, 0.99).toFixed(3),
+    percentile(samples, 1.00).toFixed(3),
+    samples.length
+  )
+}
+
+function reportThroughput (name, completed, elapsed, bytesPerMessage) {
+  const seconds = elapsed / 1000
+  console.log(
+    'ok - %s %s msgs/s %s MB/s (%s messages in %ss, depth %s)',
+    name,
+    Math.round(completed / seconds),
+    ((completed * bytesPerMessage) / seconds / (1024 * 1024)).toFixed(2),
+    completed,
+    seconds.toFixed(2),
+    config.pipelineDepth
+  )
+}
+
+/**
+ * Serial roundtrips through the webview bridge - each `ipc.send('ping')`
+ * travels webview transport -> `Router::invoke` -> reply serialization
+ * and back before the next one starts.
+ */
+async function benchIPCLatency () {
+  const value = 'x'.repeat(config.messageSize)
+  const samples = []
+
+  for (let i = 0; i < WARMUP_ITERATIONS; ++i) {
+    await ipc.send('ping', value)
+  }
+
+  const deadline = Date.now() + config.duration
+
+  while (Date.now() < deadline) {
+    const started = performance.now()
+    const result = await ipc.send('ping', value)
+
+    if (result.err) {
+      throw result.err
+    }
+
+    samples.push(performance.now() - started)
+  }
+
+  reportLatency(`ipc roundtrip (${config.messageSize} bytes)`, samples)
+}
+
+/**
+ * Max sustainable bridge throughput - keeps `pipelineDepth` messages in
+ * flight for the configured duration and counts completions.
+ */
+async function benchIPCThroughput () {
+  const value = 'x'.repeat(config.messageSize)
+  const deadline = Date.now() + config.duration
+  const started = performance.now()
+
+  let completed = 0
+
+  async function worker () {
+    while (Date.now() < deadline) {
+      const result = await ipc.send('ping', value)
+
+      if (result.err) {
+        throw result.err
+      }
+
+      completed++
+    }
+  }
+
+  const workers = []
+  for (let i = 0; i < config.pipelineDepth; ++i) {
+    workers.push(worker())
+  }
+
+  await Promise.all(workers)
+
+  reportThroughput(
+    `ipc throughput (${config.messageSize} bytes)`,
+    completed,
+    performance.now() - started,
+    config.messageSize
+  )
+}
+
+/**
+ * A loopback echo pair through `Core::UDP` - the server echoes every
+ * datagram back to its sender.
+ */
+async function withUDPEchoPair (callback) {
+  const server = dgram.createSocket('udp4')
+  const client = dgram.createSocket('udp4')
+
+  server.on('message', (message, rinfo) => {
+    server.send(message, rinfo.port, rinfo.address)
+  })
+
+  await new Promise((resolve, reject) => {
+    server.once('error', reject)
+    server.bind(config.udpPort, '127.0.0.1', resolve)
+  })
+
+  try {
+    await callback(client, server)
+  } finally {
+    client.close()
+    server.close()
+  }
+}
+
+async function benchUDPLatency () {
+  const payload = Buffer.alloc(config.udpMessageSize, 0x62)
+
+  await withUDPEchoPair(async (client) => {
+    const samples = []
+
+    function roundtrip () {
+      return new Promise((resolve, reject) => {
+        client.once('message', resolve)
+        client.send(payload, config.udpPort, '127.0.0.1', (err) => {
+          if (err) reject(err)
+        })
+      })
+    }
+
+    for (let i = 0; i < WARMUP_ITERATIONS; ++i) {
+      await roundtrip()
+    }
+
+    const deadline = Date.now() + config.duration
+
+    while (Date.now() < deadline) {
+      const started = performance.now()
+      await roundtrip()
+      samples.push(performance.now() - started)
+    }
+
+    reportLatency(`udp roundtrip (${config.udpMessageSize} bytes)`, samples)
+  })
+}
+
+async function benchUDPThroughput () {
+  const payload = Buffer.alloc(config.udpMessageSize, 0x62)
+
+  await withUDPEchoPair(async (client) => {
+    const deadline = Date.now() + config.duration
+    const started = performance.now()
+
+    let completed = 0
+
+    // keep `pipelineDepth` datagrams in flight - every echo that comes
+    // back refills the window until the deadline passes
+    await new Promise((resolve, reject) => {
+      let inflight = 0
+
+      function send () {
+        inflight++
+        client.send(payload, config.udpPort, '127.0.0.1', (err) => {
+          if (err) reject(err)
+        })
+      }
+
+      client.on('message', () => {
+        completed++
+        inflight--
+
+        if (Date.now() >= deadline) {
+          if (inflight === 0) resolve()
+          return
+        }
+
+        send()
+      })
+
+      for (let i = 0; i < config.pipelineDepth; ++i) {
+        send()
+      }
+    })
+
+    reportThroughput(
+      `udp throughput (${config.udpMessageSize} bytes)`,
+      completed,
+      performance.now() - started,
+      config.udpMessageSize
+    )
+  })
+}
+
+try {
+  console.log('# socket runtime benchmark harness')
+  console.log(
+    '# duration=%sms messageSize=%s pipelineDepth=%s udpMessageSize=%s',
+    config.duration,
+    config.messageSize,
+    config.pipelineDepth,
+    config.udpMessageSize
+  )
+
+  await ipc.ready()
+
+  await benchIPCLatency()
+  await benchIPCThroughput()
+  await benchUDPLatency()
+  await benchUDPThroughput()
+
+  process.exit(0)
+} catch (err) {
+  console.error('not ok -', err.message || err)
+  process.exit(1)
+}
@@ -0,0 +1,22 @@
+import { execSync as exec } from 'node:child_process'
+import path from 'node:path'
+
+const dirname = path.dirname(import.meta.url.replace('file://', '').replace(/^\/[A-Za-z]:/, ''))
+const root = path.dirname(dirname)
+
+const SOCKET_HOME_API = path.join(root, '..', 'api')
+const { DEBUG } = process.env
+
+try {
+  exec(`ssc build -r --headless ${!DEBUG ? '-o --prod' : ''}`, {
+    cwd: path.join(root, 'soak'),
+    stdio: 'inherit',
+    env: {
+      SOCKET_HOME_API,
+      ...process.env
+    }
+  })
+} catch (err) {
+  console.log({ err })
+  process.exit(err.status || 1)
+}
@@ -0,0 +1,302 @@
+/**
+ * Long-running soak and memory-regression harness. The slow leaks that
+ * bite in production - posts that never expire, descriptors retained
+ * after close, listeners accumulating in `Router::listeners` - are
+ * invisible to the short benchmark runs in `test/benchmark`, so this
+ * harness keeps representative IPC/FS/UDP traffic flowing through a
+ * headless `Bridge` + `Core` for as long as you ask and samples the
+ * runtime's own accounting as it goes.
+ *
+ * Run with `npm run soak:harness` from `test/`. Configuration comes
+ * from the host environment:
+ *
+ *   SOAK_DURATION_MS        total run time                (default 60000)
+ *   SOAK_SAMPLE_INTERVAL_MS seconds between samples       (default 5000)
+ *   SOAK_CONCURRENCY        in-flight messages per driver (default 16)
+ *   SOAK_RSS_TOLERANCE      allowed steady-state RSS
+ *                           growth as a fraction          (default 0.10)
+ *   SOAK_UDP_PORT           loopback port for the
+ *                           udp echo pair                 (default 38100)
+ *
+ * Every sample records RSS plus the `diagnostics.query` snapshot:
+ * posts/peers/descriptors table sizes and buffer pool occupancy
+ * (allocations minus frees). The run fails when a table is still
+ * growing at the end - the final sample exceeds every warmup sample -
+ * or when the median RSS of the last quarter of the run exceeds the
+ * median of the second quarter by more than the tolerance. The first
+ * quarter is treated as warmup and never compared, so caches and pools
+ * are allowed to fill once. A weekend run is just a bigger
+ * SOAK_DURATION_MS; ten minutes at your desk already catches the
+ * per-operation leaks.
+ */
+import process from 'socket:process'
+import console from 'socket:console'
+import Buffer from 'socket:buffer'
+import dgram from 'socket:dgram'
+import ipc from 'socket:ipc'
+import fs from 'socket:fs/promises'
+import path from 'socket:path'
+import os from 'socket:os'
+
+const config = {
+  duration: int(process.env.SOAK_DURATION_MS, 60000),
+  sampleInterval: int(process.env.SOAK_SAMPLE_INTERVAL_MS, 5000),
+  concurrency: int(process.env.SOAK_CONCURRENCY, 16),
+  rssTolerance: float(process.env.SOAK_RSS_TOLERANCE, 0.10),
+  udpPort: int(process.env.SOAK_UDP_PORT, 38100)
+}
+
+function int (value, defaultValue) {
+  const parsed = parseInt(value, 10)
+  return Number.isFinite(parsed) ? parsed : defaultValue
+}
+
+function float (value, defaultValue) {
+  const parsed = parseFloat(value)
+  return Number.isFinite(parsed) ? parsed : defaultValue
+}
+
+function sleep (ms) {
+  return new Promise((resolve) => setTimeout(resolve, ms))
+}
+
+function median (values) {
+  if (values.length === 0) return 0
+  const sorted = [...values].sort((left, right) => left - right)
+  return sorted[Math.floor(sorted.length / 2)]
+}
+
+let running = true
+const failures = []
+
+/**
+ * Traffic drivers - each keeps `config.concurrency` operations cycling
+ * until the deadline. Every driver opens and closes its resources per
+ * iteration on purpose: a leak per operation is exactly what we are
+ * trying to make visible in the tables.
+ */
+async function driveIPC () {
+  const value = 'x'.repeat(256)
+
+  async function worker () {
+    while (running) {
+      const result = await ipc.send('ping', value)
+
+      if (result.err) {
+        throw result.err
+      }
+    }
+  }
+
+  const workers = []
+  for (let i = 0; i < config.concurrency; ++i) {
+    workers.push(worker())
+  }
+
+  await Promise.all(workers)
+}
+
+async function driveFS () {
+  const file = path.join(os.tmpdir(), `socket-soak-${process.pid}.bin`)
+  await fs.writeFile(file, Buffer.alloc(64 * 1024, 0x66))
+
+  async function worker () {
+    while (running) {
+      // full descriptor lifecycle per iteration - open, stat, read,
+      // close - so retained descriptors show up in `tables.descriptors`
+      const handle = await fs.open(file, 'r')
+
+      try {
+        await handle.stat()
+        await handle.read(Buffer.alloc(4096), 0, 4096, 0)
+      } finally {
+        await handle.close()
+      }
+    }
+  }
+
+  const workers = []
+  for (let i = 0; i < Math.max(1, config.concurrency >> 2); ++i) {
+    workers.push(worker())
+  }
+
+  try {
+    await Promise.all(workers)
+  } finally {
+    await fs.unlink(file)
+  }
+}
+
+async function driveUDP () {
+  const payload = Buffer.alloc(1024, 0x73)
+  const server = dgram.createSocket('udp4')
+
+  server.on('message', (message, rinfo) => {
+    server.send(message, rinfo.port, rinfo.address)
+  })
+
+  await new Promise((resolve, reject) => {
+    server.once('error', reject)
+    server.bind(config.udpPort, '127.0.0.1', resolve)
+  })
+
+  async function worker () {
+    // sockets are created and torn down per batch so peers that are
+    // never removed from `Core::peers` accumulate visibly
+    while (running) {
+      const client = dgram.createSocket('udp4')
+
+      try {
+        for (let i = 0; i < 64 && running; ++i) {
+          await new Promise((resolve, reject) => {
+            client.once('message', resolve)
+            client.send(payload, config.udpPort, '127.0.0.1', (err) => {
+              if (err) reject(err)
+            })
+          })
+        }
+      } finally {
+        client.close()
+      }
+    }
+  }
+
+  const workers = []
+  for (let i = 0; i < Math.max(1, config.concurrency >> 2); ++i) {
+    workers.push(worker())
+  }
+
+  try {
+    await Promise.all(workers)
+  } finally {
+    server.close()
+  }
+}
+
+/**
+ * Samples RSS and the runtime's own table/pool accounting on an
+ * interval. Returns the full series for the regression checks below.
+ */
+async function sample (samples) {
+  const { err, data } = await ipc.send('diagnostics.query')
+
+  if (err) {
+    throw err
+  }
+
+  const entry = {
+    elapsed: samples.length * config.sampleInterval,
+    rss: process.memoryUsage.rss(),
+    posts: data.tables.posts,
+    peers: data.tables.peers,
+    descriptors: data.tables.descriptors,
+    poolOccupancy: data.bufferPool.allocations - data.bufferPool.frees,
+    dispatchQueueDepth: data.eventLoop.dispatchQueueDepth
+  }
+
+  samples.push(entry)
+
+  console.log(
+    '# t=%ss rss=%sMB posts=%s peers=%s descriptors=%s pool=%s queue=%s',
+    (entry.elapsed / 1000).toFixed(0),
+    (entry.rss / (1024 * 1024)).toFixed(1),
+    entry.posts,
+    entry.peers,
+    entry.descriptors,
+    entry.poolOccupancy,
+    entry.dispatchQueueDepth
+  )
+}
+
+/**
+ * A table leaks when it is still growing after warmup: the final
+ * sample strictly exceeds every sample from the first quarter of the
+ * run. Bounded churn - tables that rise and fall with in-flight work -
+ * passes because some warmup sample will match or exceed the final one.
+ */
+function checkTable (samples, key) {
+  const warmup = samples.slice(0, Math.max(1, samples.length >> 2))
+  const final = samples[samples.length - 1][key]
+  const ceiling = Math.max(...warmup.map((entry) => entry[key]))
+
+  if (final > ceiling) {
+    failures.push(
+      `${key} grew monotonically: ${ceiling} after warmup, ${final} at end`
+    )
+  }
+}
+
+function checkRSS (samples) {
+  const quarter = Math.max(1, samples.length >> 2)
+  const baseline = median(
+    samples.slice(quarter, quarter * 2).map((entry) => entry.rss)
+  )
+  const final = median(
+    samples.slice(samples.length - quarter).map((entry) => entry.rss)
+  )
+
+  if (final > baseline * (1 + config.rssTolerance)) {
+    failures.push(
+      `rss grew ${(((final / baseline) - 1) * 100).toFixed(1)}% ` +
+      `(${(baseline / (1024 * 1024)).toFixed(1)}MB -> ` +
+      `${(final / (1024 * 1024)).toFixed(1)}MB, ` +
+      `tolerance ${(config.rssTolerance * 100).toFixed(0)}%)`
+    )
+  }
+}
+
+try {
+  console.log('# socket runtime soak harness')
+  console.log(
+    '# duration=%sms sampleInterval=%sms concurrency=%s rssTolerance=%s',
+    config.duration,
+    config.sampleInterval,
+    config.concurrency,
+    config.rssTolerance
+  )
+
+  await ipc.ready()
+
+  const samples = []
+  const drivers = [driveIPC(), driveFS(), driveUDP()]
+  const deadline = Date.now() + config.duration
+
+  await sample(samples)
+
+  while (Date.now() < deadline) {
+    await sleep(Math.min(config.sampleInterval, deadline - Date.now()))
+    await sample(samples)
+  }
+
+  running = false
+  await Promise.all(drivers)
+
+  // settle, then take the closing sample with no work in flight so the
+  // table checks see what the runtime actually retained
+  await sleep(1000)
+  await sample(samples)
+
+  if (samples.length >= 4) {
+    checkTable(samples, 'posts')
+    checkTable(samples, 'peers')
+    checkTable(samples, 'descriptors')
+    checkTable(samples, 'poolOccupancy')
+    checkRSS(samples)
+  } else {
+    console.log('# run too short for regression checks - sampling only')
+  }
+
+  if (failures.length > 0) {
+    for (const failure of failures) {
+      console.error('not ok -', failure)
+    }
+
+    process.exit(1)
+  }
+
+  console.log('ok - no monotonic growth over %s samples', samples.length)
+  process.exit(0)
+} catch (err) {
+  console.error('not ok -', err.message || err)
+  process.exit(1)
+}